@@ -4,7 +4,10 @@
 #include <gtk/gtk.h>
 #include <sys/utsname.h>
 
-#include <cstring>
+#include <gameframework/event_stream.h>
+#include <gameframework/method_dispatcher.h>
+
+constexpr char kEventChannel[] = "gameframework_unity/events";
 
 #define UNITY_ENGINE_PLUGIN(obj) \
   (G_TYPE_CHECK_INSTANCE_CAST((obj), unity_engine_plugin_get_type(), \
@@ -12,45 +15,59 @@
 
 struct _UnityEnginePlugin {
   GObject parent_instance;
+
+  // Engine events for Flutter; see event_stream.h
+  gameframework::EventStream* events;
 };
 
 G_DEFINE_TYPE(UnityEnginePlugin, unity_engine_plugin, g_object_get_type())
 
+static FlMethodResponse* get_platform_version(UnityEnginePlugin* self,
+                                              FlMethodCall* method_call) {
+  struct utsname uname_data = {};
+  uname(&uname_data);
+  g_autofree gchar *version = g_strdup_printf("Linux %s", uname_data.version);
+  g_autoptr(FlValue) result = fl_value_new_string(version);
+  return FL_METHOD_RESPONSE(fl_method_success_response_new(result));
+}
+
+static FlMethodResponse* get_engine_type(UnityEnginePlugin* self,
+                                         FlMethodCall* method_call) {
+  g_autoptr(FlValue) result = fl_value_new_string("unity");
+  return FL_METHOD_RESPONSE(fl_method_success_response_new(result));
+}
+
+static FlMethodResponse* get_engine_version(UnityEnginePlugin* self,
+                                            FlMethodCall* method_call) {
+  g_autoptr(FlValue) result = fl_value_new_string("2022.3.0");
+  return FL_METHOD_RESPONSE(fl_method_success_response_new(result));
+}
+
+static FlMethodResponse* is_engine_supported(UnityEnginePlugin* self,
+                                             FlMethodCall* method_call) {
+  g_autoptr(FlValue) result = fl_value_new_bool(TRUE);
+  return FL_METHOD_RESPONSE(fl_method_success_response_new(result));
+}
+
 // Called when a method call is received from Flutter.
 static void unity_engine_plugin_handle_method_call(
     UnityEnginePlugin* self,
     FlMethodCall* method_call) {
-  g_autoptr(FlMethodResponse) response = nullptr;
-
-  const gchar* method = fl_method_call_get_name(method_call);
-
-  if (strcmp(method, "getPlatformVersion") == 0) {
-    struct utsname uname_data = {};
-    uname(&uname_data);
-    g_autofree gchar *version = g_strdup_printf("Linux %s", uname_data.version);
-    g_autoptr(FlValue) result = fl_value_new_string(version);
-    response = FL_METHOD_RESPONSE(fl_method_success_response_new(result));
-  }
-  else if (strcmp(method, "getEngineType") == 0) {
-    g_autoptr(FlValue) result = fl_value_new_string("unity");
-    response = FL_METHOD_RESPONSE(fl_method_success_response_new(result));
-  }
-  else if (strcmp(method, "getEngineVersion") == 0) {
-    g_autoptr(FlValue) result = fl_value_new_string("2022.3.0");
-    response = FL_METHOD_RESPONSE(fl_method_success_response_new(result));
-  }
-  else if (strcmp(method, "isEngineSupported") == 0) {
-    g_autoptr(FlValue) result = fl_value_new_bool(TRUE);
-    response = FL_METHOD_RESPONSE(fl_method_success_response_new(result));
-  }
-  else {
-    response = FL_METHOD_RESPONSE(fl_method_not_implemented_response_new());
-  }
-
-  fl_method_call_respond(method_call, response, nullptr);
+  static gameframework::MethodDispatcher<UnityEnginePlugin> dispatcher({
+      {"getPlatformVersion", get_platform_version},
+      {"getEngineType", get_engine_type},
+      {"getEngineVersion", get_engine_version},
+      {"isEngineSupported", is_engine_supported},
+  });
+
+  dispatcher.Dispatch(self, method_call);
 }
 
 static void unity_engine_plugin_dispose(GObject* object) {
+  UnityEnginePlugin* self = UNITY_ENGINE_PLUGIN(object);
+  delete self->events;
+  self->events = nullptr;
+
   G_OBJECT_CLASS(unity_engine_plugin_parent_class)->dispose(object);
 }
 
@@ -79,5 +96,10 @@ void unity_engine_plugin_register_with_registrar(FlPluginRegistrar* registrar) {
                                             g_object_ref(plugin),
                                             g_object_unref);
 
+  // Nothing sends on it until the plugin talks to a Unity player, but apps
+  // can listen already
+  plugin->events = new gameframework::EventStream(
+      fl_plugin_registrar_get_messenger(registrar), kEventChannel);
+
   g_object_unref(plugin);
 }
@@ -24,6 +24,8 @@ import io.flutter.plugin.common.MethodCall
 import io.flutter.plugin.common.MethodChannel
 import java.io.ByteArrayInputStream
 import java.io.ByteArrayOutputStream
+import java.nio.ByteBuffer
+import java.nio.ByteOrder
 import java.util.concurrent.atomic.AtomicBoolean
 import java.util.zip.GZIPInputStream
 import java.util.zip.GZIPOutputStream
@@ -50,11 +52,18 @@ class UnrealEngineController(
     private var unrealSurfaceView: SurfaceView? = null
     private var surfaceReady = false
     private val isDestroyed = AtomicBoolean(false)
+    private var sendBuffer: ByteBuffer? = null
 
     companion object {
         private const val TAG = "UnrealEngineController"
         const val ENGINE_TYPE = "unreal"
         const val ENGINE_VERSION = "5.3.0"
+
+        // Size of the FFlutterMessageBatch frame header written by the Unreal plugin
+        private const val BATCH_HEADER_SIZE = 8
+
+        // Smallest direct buffer kept for binary sends to Unreal
+        private const val MIN_SEND_BUFFER_SIZE = 64 * 1024
         
         // Track whether native library is available
         private var nativeLibraryLoaded = false
@@ -540,6 +549,15 @@ class UnrealEngineController(
                 val settings = getQualitySettings()
                 result.success(settings)
             }
+            "engine#getSurfaceStatistics" -> {
+                result.success(getSurfaceStatistics())
+            }
+            "engine#setRenderScale" -> {
+                @Suppress("UNCHECKED_CAST")
+                val settings = call.arguments as? Map<String, Any> ?: emptyMap()
+                setRenderScale(settings)
+                result.success(null)
+            }
             // Binary messaging
             "engine#sendBinaryMessage" -> {
                 handleSendBinaryMessage(call, result)
@@ -623,7 +641,7 @@ class UnrealEngineController(
                 } else {
                     decodedData
                 }
-                nativeSendBinaryMessage(target, method, processedData, checksum)
+                nativeSendBinaryBuffer(target, method, directSendBuffer(processedData), processedData.size, checksum)
             } catch (e: Exception) {
                 Log.e(TAG, "Failed to send binary message: ${e.message}", e)
                 sendEventToFlutter("onError", mapOf("message" to "Failed to send binary message: ${e.message}"))
@@ -670,6 +688,25 @@ class UnrealEngineController(
         }
     }
 
+    /**
+     * Direct buffer holding [data] for nativeSendBinaryBuffer
+     *
+     * Native code reads it in place, so one buffer is reused for every send; sends all run on
+     * the main thread and native code is done with it once the call returns.
+     */
+    private fun directSendBuffer(data: ByteArray): ByteBuffer {
+        val current = sendBuffer
+        val buffer = if (current != null && current.capacity() >= data.size) {
+            current
+        } else {
+            ByteBuffer.allocateDirect(maxOf(data.size, MIN_SEND_BUFFER_SIZE)).also { sendBuffer = it }
+        }
+        buffer.clear()
+        buffer.put(data)
+        buffer.flip()
+        return buffer
+    }
+
     fun sendCompressedMessage(
         target: String,
         method: String,
@@ -791,6 +828,48 @@ class UnrealEngineController(
         }
     }
 
+    /**
+     * Surface handoff, first frame and resize timings as a JSON object
+     */
+    fun getSurfaceStatistics(): String? {
+        if (!engineReady || isDestroyed.get()) {
+            sendEventToFlutter("onError", mapOf("message" to "Engine not ready"))
+            return null
+        }
+
+        return try {
+            nativeGetSurfaceStatistics()
+        } catch (e: Exception) {
+            Log.e(TAG, "Failed to get surface statistics: ${e.message}", e)
+            null
+        }
+    }
+
+    /**
+     * Render the game view at a fraction of the surface size and upscale it
+     *
+     * Keys: mode (0 native, 1 fixed, 2 dynamic), scale, minScale, maxScale, targetFrameRate.
+     */
+    fun setRenderScale(settings: Map<String, Any>) {
+        if (!engineReady || isDestroyed.get()) {
+            Log.w(TAG, "Cannot set render scale: engine not ready")
+            return
+        }
+
+        try {
+            nativeSetRenderScale(
+                (settings["mode"] as? Number)?.toInt() ?: 0,
+                (settings["scale"] as? Number)?.toFloat() ?: 1.0f,
+                (settings["minScale"] as? Number)?.toFloat() ?: 0.5f,
+                (settings["maxScale"] as? Number)?.toFloat() ?: 1.0f,
+                (settings["targetFrameRate"] as? Number)?.toFloat() ?: 60.0f
+            )
+        } catch (e: Exception) {
+            Log.e(TAG, "Failed to set render scale: ${e.message}", e)
+            sendEventToFlutter("onError", mapOf("message" to "Failed to set render scale: ${e.message}"))
+        }
+    }
+
     // ===== Lifecycle Callbacks =====
 
     override fun onResume(owner: LifecycleOwner) {
@@ -836,6 +915,46 @@ class UnrealEngineController(
         }
     }
 
+    /**
+     * Called from native code once per frame with every message batched in that frame
+     *
+     * The frame lives in native memory and is unpacked here, then handed back with
+     * nativeReleaseBuffer. Layout (little-endian): "FB", version, reserved, uint32 count,
+     * then a uint32 length and UTF-8 bytes for target, method and data of each message.
+     */
+    @Suppress("unused")
+    fun onMessageBatchFromUnreal(frame: ByteBuffer, count: Int, bufferId: Int) {
+        val messages = ArrayList<Map<String, String>>(count)
+        try {
+            val buffer = frame.duplicate().order(ByteOrder.LITTLE_ENDIAN)
+            buffer.position(BATCH_HEADER_SIZE)
+            repeat(count) {
+                messages.add(mapOf(
+                    "target" to readBatchString(buffer),
+                    "method" to readBatchString(buffer),
+                    "data" to readBatchString(buffer)
+                ))
+            }
+        } catch (e: RuntimeException) {
+            Log.e(TAG, "Malformed message batch from Unreal", e)
+        } finally {
+            nativeReleaseBuffer(bufferId)
+        }
+
+        runOnMainThread {
+            for (message in messages) {
+                sendEventToFlutter("onMessage", message)
+            }
+        }
+    }
+
+    private fun readBatchString(buffer: ByteBuffer): String {
+        val length = buffer.int
+        val bytes = ByteArray(length)
+        buffer.get(bytes)
+        return String(bytes, Charsets.UTF_8)
+    }
+
     /**
      * Called from native code when a level is loaded
      */
@@ -875,6 +994,32 @@ class UnrealEngineController(
         }
     }
 
+    /**
+     * Called from native code when a binary message is received from Unreal in native memory
+     *
+     * The buffer belongs to a native pool: it is copied out here and handed back with
+     * nativeReleaseBuffer right away, so it is never touched after this returns.
+     */
+    @Suppress("unused")
+    fun onBinaryBufferFromUnreal(
+        target: String,
+        method: String,
+        data: ByteBuffer,
+        bufferId: Int,
+        isCompressed: Boolean,
+        checksum: Int
+    ) {
+        val bytes: ByteArray
+        try {
+            bytes = ByteArray(data.remaining())
+            data.duplicate().get(bytes)
+        } finally {
+            nativeReleaseBuffer(bufferId)
+        }
+
+        onBinaryMessageFromUnreal(target, method, bytes, isCompressed, checksum)
+    }
+
     /**
      * Called from native code when a binary chunk is received from Unreal
      */
@@ -907,6 +1052,63 @@ class UnrealEngineController(
         }
     }
 
+    /**
+     * Called from native code when a chunked transfer to Flutter starts
+     */
+    @Suppress("unused")
+    fun onBinaryChunkHeaderFromUnreal(
+        target: String,
+        method: String,
+        transferId: String,
+        totalSize: Int,
+        totalChunks: Int,
+        checksum: Int
+    ) {
+        onBinaryChunkFromUnreal(target, method, "header", transferId, null, totalChunks, totalSize, null, checksum)
+    }
+
+    /**
+     * Called from native code with one chunk of a transfer to Flutter
+     */
+    @Suppress("unused")
+    fun onBinaryChunkDataFromUnreal(
+        target: String,
+        method: String,
+        transferId: String,
+        chunkIndex: Int,
+        data: ByteArray
+    ) {
+        onBinaryChunkFromUnreal(target, method, "data", transferId, chunkIndex, 0, null, data, null)
+    }
+
+    /**
+     * Called from native code once every chunk of a transfer to Flutter has been sent
+     */
+    @Suppress("unused")
+    fun onBinaryChunkFooterFromUnreal(
+        target: String,
+        method: String,
+        transferId: String,
+        totalChunks: Int,
+        checksum: Int
+    ) {
+        onBinaryChunkFromUnreal(target, method, "footer", transferId, null, totalChunks, null, null, checksum)
+    }
+
+    /**
+     * Called from native code with the progress of a transfer to Flutter
+     */
+    @Suppress("unused")
+    fun onBinaryProgressFromUnreal(
+        transferId: String,
+        currentChunk: Int,
+        totalChunks: Int,
+        bytesTransferred: Long,
+        totalBytes: Long
+    ) {
+        onBinaryProgress(transferId, currentChunk, totalChunks, bytesTransferred, totalBytes)
+    }
+
     /**
      * Called from native code to report binary transfer progress
      */
@@ -941,7 +1143,10 @@ class UnrealEngineController(
     private external fun nativeLoadLevel(levelName: String)
     private external fun nativeApplyQualitySettings(settings: Map<String, Any>)
     private external fun nativeGetQualitySettings(): Map<String, Any>
+    private external fun nativeGetSurfaceStatistics(): String
+    private external fun nativeSetRenderScale(mode: Int, scale: Float, minScale: Float, maxScale: Float, targetFrameRate: Float)
     private external fun nativeSendBinaryMessage(target: String, method: String, data: ByteArray, checksum: Int)
+    private external fun nativeSendBinaryBuffer(target: String, method: String, data: ByteBuffer, length: Int, checksum: Int)
     private external fun nativeBinaryChunkHeader(target: String, method: String, transferId: String, totalSize: Int, totalChunks: Int, checksum: Int)
     private external fun nativeBinaryChunkData(target: String, method: String, transferId: String, chunkIndex: Int, data: ByteArray)
     
@@ -950,4 +1155,5 @@ class UnrealEngineController(
     private external fun nativeSurfaceChanged(width: Int, height: Int)
     private external fun nativeBinaryChunkFooter(target: String, method: String, transferId: String, totalChunks: Int, checksum: Int)
     private external fun nativeSetBinaryChunkSize(size: Int)
+    private external fun nativeReleaseBuffer(bufferId: Int)
 }
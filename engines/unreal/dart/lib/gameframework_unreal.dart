@@ -26,13 +26,20 @@ library gameframework_unreal;
 // Core controller
 export 'src/unreal_controller.dart';
 export 'src/unreal_engine_plugin.dart';
+export 'src/unreal_connection_info.dart';
+export 'src/unreal_frame_texture.dart';
 export 'src/unreal_quality_settings.dart';
+export 'src/unreal_render_scale.dart';
+export 'src/unreal_state_mirror.dart';
+export 'src/unreal_surface_statistics.dart';
 
 // Binary protocol
 export 'src/unreal_binary_protocol.dart';
 
 // Performance utilities
 export 'src/unreal_message_batcher.dart';
+export 'src/unreal_event_stream.dart';
+export 'src/unreal_message_lane.dart';
 export 'src/unreal_message_throttler.dart';
 export 'src/unreal_delta_compressor.dart';
 
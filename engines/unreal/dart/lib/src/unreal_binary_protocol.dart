@@ -132,13 +132,26 @@ class UnrealBinaryProtocol {
     }
   }
 
-  /// Decompress GZip data.
+  /// Decompress GZip data, or a zlib/LZ4 payload in a codec envelope.
   Uint8List decompressData(Uint8List data) {
     try {
       // Check for GZip magic number
       if (data.length >= 2 && data[0] == gzipMarker && data[1] == 0x8B) {
         return Uint8List.fromList(gzip.decode(data));
       }
+      final codec = _envelopeCodec(data);
+      if (codec != null) {
+        final size =
+            ByteData.sublistView(data, 4, 8).getUint32(0, Endian.little);
+        final body = Uint8List.sublistView(data, envelopeHeaderSize);
+        final decoded = codec == envelopeCodecZlib
+            ? Uint8List.fromList(zlib.decode(body))
+            : _decodeLz4Block(body, size);
+        if (decoded.length != size) {
+          throw StateError('expected $size bytes, got ${decoded.length}');
+        }
+        return decoded;
+      }
       // Not compressed, return as-is
       return data;
     } catch (e) {
@@ -149,9 +162,79 @@ class UnrealBinaryProtocol {
     }
   }
 
-  /// Check if data is GZip compressed.
+  /// Check if data is GZip compressed or wrapped in a codec envelope.
   bool isCompressed(Uint8List data) {
-    return data.length >= 2 && data[0] == gzipMarker && data[1] == 0x8B;
+    return (data.length >= 2 && data[0] == gzipMarker && data[1] == 0x8B) ||
+        _envelopeCodec(data) != null;
+  }
+
+  /// Size of the codec envelope Unreal puts in front of zlib and LZ4 data:
+  /// "FC", codec, reserved, uint32 uncompressed size (little-endian).
+  static const int envelopeHeaderSize = 8;
+
+  /// Envelope codec id for zlib (matches EFlutterCompressionCodec::Zlib)
+  static const int envelopeCodecZlib = 2;
+
+  /// Envelope codec id for LZ4 (matches EFlutterCompressionCodec::LZ4)
+  static const int envelopeCodecLz4 = 3;
+
+  int? _envelopeCodec(Uint8List data) {
+    if (data.length < envelopeHeaderSize ||
+        data[0] != 0x46 ||
+        data[1] != 0x43 ||
+        data[3] != 0) {
+      return null;
+    }
+    final codec = data[2];
+    return codec == envelopeCodecZlib || codec == envelopeCodecLz4
+        ? codec
+        : null;
+  }
+
+  /// Decode a raw LZ4 block into exactly [size] bytes.
+  Uint8List _decodeLz4Block(Uint8List input, int size) {
+    final output = Uint8List(size);
+    var i = 0;
+    var o = 0;
+
+    int readLength(int length) {
+      if (length != 15) return length;
+      int byte;
+      do {
+        byte = input[i++];
+        length += byte;
+      } while (byte == 255);
+      return length;
+    }
+
+    while (i < input.length) {
+      final token = input[i++];
+
+      final literals = readLength(token >> 4);
+      output.setRange(o, o + literals, input, i);
+      i += literals;
+      o += literals;
+
+      // The last sequence carries literals only
+      if (i >= input.length) break;
+
+      final offset = input[i] | (input[i + 1] << 8);
+      i += 2;
+      final matchLength = readLength(token & 0x0F) + 4;
+      if (offset == 0 || offset > o || o + matchLength > size) {
+        throw StateError('invalid LZ4 match at $i');
+      }
+
+      // Matches may overlap their own output, so copy byte by byte
+      for (var k = 0; k < matchLength; k++, o++) {
+        output[o] = output[o - offset];
+      }
+    }
+
+    if (o != size) {
+      throw StateError('LZ4 block decoded to $o bytes, expected $size');
+    }
+    return output;
   }
 
   // ============================================================
@@ -212,6 +295,74 @@ class UnrealBinaryProtocol {
     return ChunkAssembler(this);
   }
 
+  // ============================================================
+  // MARK: - Message Batches
+  // ============================================================
+
+  /// Target used by the Unreal bridge for batched message frames.
+  static const String batchTarget = '_batch';
+
+  /// Whether [data] is a batch frame sent by the Unreal bridge.
+  ///
+  /// Frames start with "FB", a version byte, a reserved byte and a
+  /// little-endian message count.
+  bool isBatchFrame(Uint8List data) {
+    return data.length >= 8 &&
+        data[0] == 0x46 &&
+        data[1] == 0x42 &&
+        data[2] == _batchFrameVersion;
+  }
+
+  /// Decode a batch frame into its messages, in send order.
+  ///
+  /// Each message is three length-prefixed UTF-8 strings: target, method, data.
+  List<BatchFrameMessage> decodeBatchFrame(Uint8List data) {
+    if (!isBatchFrame(data)) {
+      throw BinaryProtocolException(
+        'Not a batch frame',
+        BinaryProtocolErrorCode.decodingFailed,
+      );
+    }
+
+    final view = ByteData.sublistView(data);
+    final count = view.getUint32(4, Endian.little);
+    final messages = <BatchFrameMessage>[];
+    var offset = 8;
+
+    String readString() {
+      if (offset + 4 > data.length) {
+        throw BinaryProtocolException(
+          'Truncated batch frame',
+          BinaryProtocolErrorCode.decodingFailed,
+        );
+      }
+      final length = view.getUint32(offset, Endian.little);
+      offset += 4;
+      if (offset + length > data.length) {
+        throw BinaryProtocolException(
+          'Truncated batch frame',
+          BinaryProtocolErrorCode.decodingFailed,
+        );
+      }
+      final value =
+          utf8.decode(Uint8List.sublistView(data, offset, offset + length));
+      offset += length;
+      return value;
+    }
+
+    for (var i = 0; i < count; i++) {
+      final target = readString();
+      final method = readString();
+      final payload = readString();
+      messages.add(
+          BatchFrameMessage(target: target, method: method, data: payload));
+    }
+
+    return messages;
+  }
+
+  static const int _batchFrameVersion = 1;
+
   // ============================================================
   // MARK: - Checksum
   // ============================================================
@@ -567,6 +718,19 @@ class BinaryEnvelope {
       'ratio=${(compressionRatio * 100).toStringAsFixed(1)}%)';
 }
 
+/// Single message unpacked from an Unreal batch frame.
+class BatchFrameMessage {
+  final String target;
+  final String method;
+  final String data;
+
+  BatchFrameMessage({
+    required this.target,
+    required this.method,
+    required this.data,
+  });
+}
+
 /// Binary chunk for chunked transfer.
 class BinaryChunk {
   final BinaryChunkType type;
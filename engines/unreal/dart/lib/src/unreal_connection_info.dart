@@ -0,0 +1,112 @@
+/// Connection between the Flutter Linux plugin and the Unreal engine process
+///
+/// The plugin listens on a Unix domain socket at [socketPath]; start the engine
+/// with `-FlutterSocket=<socketPath>` (or set `GAMEFRAMEWORK_UNREAL_SOCKET`) and
+/// it connects back. Round trips are measured from queuing a request to its
+/// response arriving, in milliseconds.
+class UnrealConnectionInfo {
+  /// Socket the plugin listens on; empty if it could not listen
+  final String socketPath;
+
+  /// Shared memory segment the engine mirrors game state to
+  /// (`-FlutterStateMirror=<stateMirrorName>`, see `UnrealStateMirror`); empty
+  /// if it could not be created
+  final String stateMirrorName;
+
+  /// Whether an engine is connected right now
+  final bool connected;
+
+  /// Engine connections accepted so far
+  final int connections;
+
+  final int requestsSent;
+  final int responsesReceived;
+
+  /// Requests the engine answered with an error
+  final int errorsReceived;
+
+  /// Requests that got no answer: not connected, timed out or disconnected
+  final int requestsFailed;
+
+  /// Messages the engine sent on its own
+  final int eventsReceived;
+
+  /// Messages sent on the message lane (`UnrealMessageLane`)
+  final int messagesPosted;
+
+  /// Engine events replaced by a later one with the same key before they
+  /// reached Flutter (`UnrealEventStream.coalesce`)
+  final int eventsCoalesced;
+
+  /// Sends on the event channel, each carrying one frame's events
+  final int eventBatches;
+
+  final int pendingRequests;
+  final int bytesSent;
+  final int bytesReceived;
+
+  final double lastRoundTripMs;
+  final double averageRoundTripMs;
+  final double maxRoundTripMs;
+
+  const UnrealConnectionInfo({
+    this.socketPath = '',
+    this.stateMirrorName = '',
+    this.connected = false,
+    this.connections = 0,
+    this.requestsSent = 0,
+    this.responsesReceived = 0,
+    this.errorsReceived = 0,
+    this.requestsFailed = 0,
+    this.eventsReceived = 0,
+    this.messagesPosted = 0,
+    this.eventsCoalesced = 0,
+    this.eventBatches = 0,
+    this.pendingRequests = 0,
+    this.bytesSent = 0,
+    this.bytesReceived = 0,
+    this.lastRoundTripMs = 0,
+    this.averageRoundTripMs = 0,
+    this.maxRoundTripMs = 0,
+  });
+
+  /// Create from the map returned by the plugin
+  factory UnrealConnectionInfo.fromMap(Map<String, dynamic> map) {
+    int asInt(String key) => (map[key] as num?)?.toInt() ?? 0;
+    final events = map['eventStream'] as Map? ?? const {};
+    double asDouble(String key) => (map[key] as num?)?.toDouble() ?? 0;
+
+    return UnrealConnectionInfo(
+      socketPath: map['socketPath'] as String? ?? '',
+      stateMirrorName: map['stateMirrorName'] as String? ?? '',
+      connected: map['connected'] as bool? ?? false,
+      connections: asInt('connections'),
+      requestsSent: asInt('requestsSent'),
+      responsesReceived: asInt('responsesReceived'),
+      errorsReceived: asInt('errorsReceived'),
+      requestsFailed: asInt('requestsFailed'),
+      eventsReceived: asInt('eventsReceived'),
+      messagesPosted: asInt('messagesPosted'),
+      eventsCoalesced: (events['eventsCoalesced'] as num?)?.toInt() ?? 0,
+      eventBatches: (events['eventBatches'] as num?)?.toInt() ?? 0,
+      pendingRequests: asInt('pendingRequests'),
+      bytesSent: asInt('bytesSent'),
+      bytesReceived: asInt('bytesReceived'),
+      lastRoundTripMs: asDouble('lastRoundTripMs'),
+      averageRoundTripMs: asDouble('averageRoundTripMs'),
+      maxRoundTripMs: asDouble('maxRoundTripMs'),
+    );
+  }
+
+  @override
+  String toString() {
+    return 'UnrealConnectionInfo($socketPath, connected: $connected, '
+        'requests: $requestsSent, responses: $responsesReceived, '
+        'errors: $errorsReceived, failed: $requestsFailed, '
+        'events: $eventsReceived, posted: $messagesPosted, '
+        'coalesced: $eventsCoalesced, batches: $eventBatches, '
+        'round trip: ${lastRoundTripMs.toStringAsFixed(3)}ms '
+        '(avg ${averageRoundTripMs.toStringAsFixed(3)}, '
+        'max ${maxRoundTripMs.toStringAsFixed(3)}))';
+  }
+}
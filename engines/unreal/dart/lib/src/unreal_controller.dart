@@ -4,6 +4,8 @@ import 'package:flutter/foundation.dart';
 import 'package:flutter/services.dart';
 import 'package:gameframework/gameframework.dart';
 import 'unreal_quality_settings.dart';
+import 'unreal_render_scale.dart';
+import 'unreal_surface_statistics.dart';
 import 'unreal_binary_protocol.dart';
 
 /// Unreal Engine-specific implementation of GameEngineController
@@ -95,6 +97,11 @@ class UnrealController implements GameEngineController {
   }
 
   void _handleNativeEvent(dynamic event) {
+    // Platforms that coalesce events send a frame's worth as one list
+    if (event is List) {
+      event.forEach(_handleNativeEvent);
+      return;
+    }
     if (event is! Map) return;
 
     final eventName = event['event'] as String?;
@@ -732,6 +739,62 @@ class UnrealController implements GameEngineController {
     }
   }
 
+  /// Render the game view below the surface resolution and upscale it (Android)
+  ///
+  /// ```dart
+  /// await controller.setRenderScale(const UnrealRenderScale.fixed(0.7));
+  /// await controller.setRenderScale(
+  ///     const UnrealRenderScale.dynamic(minScale: 0.6, targetFrameRate: 60));
+  /// ```
+  Future<void> setRenderScale(UnrealRenderScale renderScale) async {
+    _throwIfDisposed();
+    _throwIfNotReady();
+
+    try {
+      await _channel.invokeMethod('engine#setRenderScale', renderScale.toMap());
+    } catch (e) {
+      throw EngineCommunicationException(
+        'Failed to set render scale: $e',
+        target: 'UnrealController',
+        method: 'setRenderScale',
+        engineType: engineType,
+      );
+    }
+  }
+
+  /// Get surface handoff, first frame and resize timings (Android)
+  ///
+  /// Useful for measuring what orientation changes and surface recreation
+  /// cost: see [UnrealSurfaceStatistics.lastResizeDroppedFrames] and
+  /// [UnrealSurfaceStatistics.lastTimeToFirstFrameMs].
+  Future<UnrealSurfaceStatistics> getSurfaceStatistics() async {
+    _throwIfDisposed();
+    _throwIfNotReady();
+
+    try {
+      final result =
+          await _channel.invokeMethod<String>('engine#getSurfaceStatistics');
+      if (result == null) {
+        throw EngineCommunicationException(
+          'Failed to get surface statistics: null result',
+          target: 'UnrealController',
+          method: 'getSurfaceStatistics',
+          engineType: engineType,
+        );
+      }
+
+      return UnrealSurfaceStatistics.fromMap(
+          Map<String, dynamic>.from(jsonDecode(result) as Map));
+    } catch (e) {
+      throw EngineCommunicationException(
+        'Failed to get surface statistics: $e',
+        target: 'UnrealController',
+        method: 'getSurfaceStatistics',
+        engineType: engineType,
+      );
+    }
+  }
+
   /// Check if engine is in background (mobile platforms)
   @override
   Future<bool> isInBackground() async {
@@ -787,6 +850,19 @@ class UnrealController implements GameEngineController {
           debugPrint('UnrealController: Binary message checksum mismatch');
         }
 
+        // Batched messages from Unreal are delivered one by one
+        if (arguments['target'] == UnrealBinaryProtocol.batchTarget &&
+            _binaryProtocol.isBatchFrame(decoded)) {
+          for (final batched in _binaryProtocol.decodeBatchFrame(decoded)) {
+            _handleMessage({
+              'target': batched.target,
+              'method': batched.method,
+              'data': batched.data,
+            });
+          }
+          return;
+        }
+
         // Emit as message with binary metadata
         final message = GameEngineMessage(
           data: base64Encode(decoded),
@@ -810,9 +886,14 @@ class UnrealController implements GameEngineController {
     if (arguments is Map) {
       try {
         final chunk = BinaryChunk.fromMap(Map<String, dynamic>.from(arguments));
-        final result = _chunkAssembler.processChunk(chunk);
+        final assembled = _chunkAssembler.processChunk(chunk);
+
+        if (assembled != null) {
+          // Unreal compresses large payloads before splitting them
+          final result = _binaryProtocol.isCompressed(assembled)
+              ? _binaryProtocol.decompressData(assembled)
+              : assembled;
 
-        if (result != null) {
           // Transfer complete, emit message
           final message = GameEngineMessage(
             data: base64Encode(result),
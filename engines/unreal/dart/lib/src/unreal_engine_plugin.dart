@@ -1,5 +1,6 @@
 import 'package:flutter/services.dart';
 import 'package:gameframework/gameframework.dart';
+import 'unreal_connection_info.dart';
 import 'unreal_controller.dart';
 
 /// Unreal Engine plugin for the GameFramework
@@ -63,6 +64,44 @@ class UnrealEnginePlugin {
       return 'unknown';
     }
   }
+
+  /// Wait up to [timeout] for the engine process to connect (Linux).
+  ///
+  /// The plugin waits on a worker thread, so frames keep rendering while the
+  /// engine starts up and loads its first level. Returns whether it connected.
+  static Future<bool> waitForEngine(
+      {Duration timeout = const Duration(seconds: 30)}) async {
+    try {
+      final result = await _channel.invokeMethod<bool>('engine#create', {
+        'connectTimeoutMs': timeout.inMilliseconds,
+      });
+      return result ?? false;
+    } catch (e) {
+      throw EngineCommunicationException(
+        'Failed to wait for the engine: $e',
+        target: 'UnrealEnginePlugin',
+        method: 'waitForEngine',
+        engineType: GameEngineType.unreal,
+      );
+    }
+  }
+
+  /// Get the state of the connection to the engine process (Linux)
+  static Future<UnrealConnectionInfo> getConnectionInfo() async {
+    try {
+      final result = await _channel.invokeMapMethod<String, dynamic>(
+        'engine#getConnectionInfo',
+      );
+      return UnrealConnectionInfo.fromMap(result ?? const {});
+    } catch (e) {
+      throw EngineCommunicationException(
+        'Failed to get connection info: $e',
+        target: 'UnrealEnginePlugin',
+        method: 'getConnectionInfo',
+        engineType: GameEngineType.unreal,
+      );
+    }
+  }
 }
 
 /// Factory for creating Unreal Engine controllers
@@ -0,0 +1,61 @@
+import 'package:flutter/services.dart';
+import 'package:gameframework/gameframework.dart';
+
+/// Events from Unreal Engine through the Linux plugin
+///
+/// The plugin sends events as `{'event': name, 'data': value}` maps, at most
+/// once per frame: when several arrive in one frame they come as one list.
+/// Events sent every tick, like progress or state sync, can be coalesced so
+/// only the latest per frame is delivered; name them in [coalesce] with
+/// [messageKey].
+///
+/// ```dart
+/// final events = UnrealEventStream(
+///   coalesce: [UnrealEventStream.messageKey('Player', 'onStateSync')],
+/// );
+/// events.messages.listen((message) => print(message.data));
+/// ```
+class UnrealEventStream {
+  /// Channel the Linux plugin sends events on
+  static const String channel = 'gameframework_unreal/events';
+
+  /// Keys of the events to coalesce
+  final List<String> coalesce;
+
+  final EventChannel _channel;
+
+  UnrealEventStream({this.coalesce = const [], BinaryMessenger? messenger})
+      : _channel = EventChannel(
+            channel, const StandardMethodCodec(), messenger);
+
+  /// Coalescing key of engine messages to [target] with [method]
+  static String messageKey(String target, String method) => '$target/$method';
+
+  /// Every event, one at a time, in the order the engine sent them
+  Stream<Map<dynamic, dynamic>> get events => _channel
+      .receiveBroadcastStream({'coalesce': coalesce}).expand(flatten);
+
+  /// Messages the engine sent with `SendToFlutter`
+  Stream<GameEngineMessage> get messages => events
+      .where((event) => event['event'] == 'onMessage' && event['data'] is Map)
+      .map((event) {
+        final data = event['data'] as Map;
+        return GameEngineMessage(
+          data: data['data'] as String? ?? '',
+          timestamp: DateTime.now(),
+          target: data['target'] as String?,
+          method: data['method'] as String?,
+        );
+      });
+
+  /// The events in one value from the channel: a single event or a batch
+  static List<Map<dynamic, dynamic>> flatten(dynamic value) {
+    if (value is Map) {
+      return [value];
+    }
+    if (value is List) {
+      return value.whereType<Map<dynamic, dynamic>>().toList();
+    }
+    return const [];
+  }
+}
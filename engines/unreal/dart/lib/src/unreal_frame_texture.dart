@@ -0,0 +1,172 @@
+import 'package:flutter/services.dart';
+import 'package:gameframework/gameframework.dart';
+
+/// Unreal Engine frames shown in a Flutter [Texture] (Linux)
+///
+/// The plugin creates a shared-memory frame buffer and a texture that shows it.
+/// Start the engine with `-FlutterFrameBuffer=<sharedMemoryName>` (or set
+/// `GAMEFRAMEWORK_UNREAL_FRAME_BUFFER`) and it copies every finished frame into
+/// the buffer; Flutter draws the latest one. Neither side waits for the other.
+///
+/// This works without a GPU, e.g. with Vulkan on a software rasterizer for
+/// automated visual tests.
+///
+/// ```dart
+/// final frames = await UnrealFrameTexture.create(maxWidth: 1280, maxHeight: 720);
+/// // Start the engine with '-FlutterFrameBuffer=${frames.sharedMemoryName}'
+/// Texture(textureId: frames.textureId)
+/// ```
+class UnrealFrameTexture {
+  static const MethodChannel _channel = MethodChannel('gameframework_unreal');
+
+  /// Id for a [Texture] widget
+  final int textureId;
+
+  /// Shared memory segment the engine publishes frames to
+  final String sharedMemoryName;
+
+  bool _disposed = false;
+
+  UnrealFrameTexture._(this.textureId, this.sharedMemoryName);
+
+  /// Create a texture for engine frames up to [maxWidth] x [maxHeight]
+  ///
+  /// Larger frames are not shown; they are counted in
+  /// [UnrealFrameStatistics.framesRejected].
+  static Future<UnrealFrameTexture> create({
+    int maxWidth = 1920,
+    int maxHeight = 1080,
+  }) async {
+    try {
+      final result = await _channel.invokeMapMethod<String, dynamic>(
+        'frameTexture#create',
+        {'maxWidth': maxWidth, 'maxHeight': maxHeight},
+      );
+      return UnrealFrameTexture._(
+        result!['textureId'] as int,
+        result['sharedMemoryName'] as String,
+      );
+    } catch (e) {
+      throw EngineCommunicationException(
+        'Failed to create frame texture: $e',
+        target: 'UnrealFrameTexture',
+        method: 'create',
+        engineType: GameEngineType.unreal,
+      );
+    }
+  }
+
+  /// Frame counts and per-frame copy cost
+  Future<UnrealFrameStatistics> getStatistics() async {
+    _throwIfDisposed();
+
+    try {
+      final result = await _channel.invokeMapMethod<String, dynamic>(
+        'frameTexture#getStatistics',
+        {'textureId': textureId},
+      );
+      return UnrealFrameStatistics.fromMap(result ?? const {});
+    } catch (e) {
+      throw EngineCommunicationException(
+        'Failed to get frame statistics: $e',
+        target: 'UnrealFrameTexture',
+        method: 'getStatistics',
+        engineType: GameEngineType.unreal,
+      );
+    }
+  }
+
+  /// Unregister the texture and remove the shared memory segment
+  Future<void> dispose() async {
+    if (_disposed) {
+      return;
+    }
+    _disposed = true;
+
+    await _channel.invokeMethod('frameTexture#dispose', {
+      'textureId': textureId,
+    });
+  }
+
+  void _throwIfDisposed() {
+    if (_disposed) {
+      throw StateError('UnrealFrameTexture has been disposed');
+    }
+  }
+}
+
+/// Unreal Engine frame transport statistics
+///
+/// Copy times are what the engine spent converting and copying each frame
+/// into shared memory; latency is from the engine publishing a frame to
+/// Flutter picking it up. Durations are in milliseconds.
+class UnrealFrameStatistics {
+  /// Frames the engine published
+  final int framesPublished;
+
+  /// Frames too large for the buffer
+  final int framesRejected;
+
+  /// Distinct frames Flutter drew
+  final int framesDrawn;
+
+  /// Frames replaced by a newer one before Flutter drew them
+  final int framesSkipped;
+
+  /// Sequence number of the frame drawn last
+  final int lastSequence;
+
+  /// Size of the frame drawn last
+  final int width;
+  final int height;
+
+  final double lastCopyMs;
+  final double averageCopyMs;
+  final double maxCopyMs;
+  final double lastLatencyMs;
+
+  const UnrealFrameStatistics({
+    this.framesPublished = 0,
+    this.framesRejected = 0,
+    this.framesDrawn = 0,
+    this.framesSkipped = 0,
+    this.lastSequence = 0,
+    this.width = 0,
+    this.height = 0,
+    this.lastCopyMs = 0,
+    this.averageCopyMs = 0,
+    this.maxCopyMs = 0,
+    this.lastLatencyMs = 0,
+  });
+
+  /// Create from the map returned by the plugin
+  factory UnrealFrameStatistics.fromMap(Map<String, dynamic> map) {
+    int asInt(String key) => (map[key] as num?)?.toInt() ?? 0;
+    double asDouble(String key) => (map[key] as num?)?.toDouble() ?? 0;
+
+    return UnrealFrameStatistics(
+      framesPublished: asInt('framesPublished'),
+      framesRejected: asInt('framesRejected'),
+      framesDrawn: asInt('framesDrawn'),
+      framesSkipped: asInt('framesSkipped'),
+      lastSequence: asInt('lastSequence'),
+      width: asInt('width'),
+      height: asInt('height'),
+      lastCopyMs: asDouble('lastCopyMs'),
+      averageCopyMs: asDouble('averageCopyMs'),
+      maxCopyMs: asDouble('maxCopyMs'),
+      lastLatencyMs: asDouble('lastLatencyMs'),
+    );
+  }
+
+  @override
+  String toString() {
+    return 'UnrealFrameStatistics(${width}x$height, '
+        'published: $framesPublished, drawn: $framesDrawn, '
+        'skipped: $framesSkipped, rejected: $framesRejected, '
+        'copy: ${lastCopyMs.toStringAsFixed(2)}ms '
+        '(avg ${averageCopyMs.toStringAsFixed(2)}, '
+        'max ${maxCopyMs.toStringAsFixed(2)}), '
+        'latency: ${lastLatencyMs.toStringAsFixed(2)}ms)';
+  }
+}
@@ -0,0 +1,150 @@
+import 'dart:convert';
+import 'dart:typed_data';
+
+import 'package:flutter/services.dart';
+import 'package:gameframework/gameframework.dart';
+
+/// Message for [UnrealMessageLane]
+class UnrealLaneMessage {
+  final String target;
+  final String method;
+  final String data;
+
+  /// Whether [data] is JSON, as with `sendJsonMessage`
+  final bool isJson;
+
+  const UnrealLaneMessage(this.target, this.method, this.data,
+      {this.isJson = false});
+}
+
+/// Fast lane for high-rate messages to Unreal Engine (Linux)
+///
+/// Sends messages as raw bytes on their own channel instead of method calls,
+/// so they skip the standard codec on both sides and reach the engine's socket
+/// without being copied. Messages are fire and forget: the engine does not
+/// answer them, and the returned future only reports whether they were
+/// handed to a connected engine. Control calls stay on the method channel.
+///
+/// ```dart
+/// final lane = UnrealMessageLane();
+/// await lane.sendMessage('Player', 'Move', '0.5,1.0');
+/// ```
+class UnrealMessageLane {
+  /// Channel the Linux plugin listens on
+  static const String channel = 'gameframework_unreal/messages';
+
+  // Wire format of the plugin's engine transport (linux/engine_transport.h)
+  static const int _headerSize = 8;
+  static const int _requestFrame = 1;
+  static const int _sendMessageOp = 1;
+  static const int _sendJsonMessageOp = 2;
+
+  static const int _posted = 0;
+  static const int _notConnected = 1;
+
+  final BinaryMessenger _messenger;
+
+  UnrealMessageLane({BinaryMessenger? messenger})
+      : _messenger =
+            messenger ?? ServicesBinding.instance.defaultBinaryMessenger;
+
+  /// Send one message
+  Future<void> sendMessage(String target, String method, String data) {
+    return sendMessages([UnrealLaneMessage(target, method, data)]);
+  }
+
+  /// Send one message with JSON data
+  Future<void> sendJsonMessage(
+    String target,
+    String method,
+    Map<String, dynamic> data,
+  ) {
+    return sendMessages(
+        [UnrealLaneMessage(target, method, jsonEncode(data), isJson: true)]);
+  }
+
+  /// Send several messages in one platform message, in order
+  Future<void> sendMessages(List<UnrealLaneMessage> messages) async {
+    if (messages.isEmpty) {
+      return;
+    }
+
+    final ByteData? reply;
+    try {
+      reply = await _messenger.send(channel, encode(messages));
+    } catch (e) {
+      throw EngineCommunicationException(
+        'Failed to send messages: $e',
+        target: messages.first.target,
+        method: messages.first.method,
+        engineType: GameEngineType.unreal,
+      );
+    }
+
+    final status = reply != null && reply.lengthInBytes > 0
+        ? reply.getUint8(0)
+        : null;
+    if (status == _posted) {
+      return;
+    }
+    throw EngineCommunicationException(
+      status == null
+          ? 'Message lane is not available on this platform'
+          : status == _notConnected
+              ? 'Engine is not connected'
+              : 'Engine rejected malformed messages',
+      target: messages.first.target,
+      method: messages.first.method,
+      engineType: GameEngineType.unreal,
+    );
+  }
+
+  /// Encode [messages] as transport frames, one per message
+  ///
+  /// Each frame is a request with id 0, which the engine carries out without
+  /// answering; its payload is target, method and data as UTF-8, each with a
+  /// 32-bit length.
+  static ByteData encode(List<UnrealLaneMessage> messages) {
+    final encoded = [
+      for (final message in messages)
+        [
+          utf8.encode(message.target),
+          utf8.encode(message.method),
+          utf8.encode(message.data),
+        ],
+    ];
+
+    var size = 0;
+    for (final fields in encoded) {
+      size += 4 + _headerSize;
+      for (final field in fields) {
+        size += 4 + field.length;
+      }
+    }
+
+    final bytes = Uint8List(size);
+    final view = ByteData.sublistView(bytes);
+    var offset = 0;
+    for (var i = 0; i < messages.length; i++) {
+      final fields = encoded[i];
+      var payloadSize = 0;
+      for (final field in fields) {
+        payloadSize += 4 + field.length;
+      }
+
+      view.setUint32(offset, _headerSize + payloadSize, Endian.little);
+      view.setUint8(offset + 4, _requestFrame);
+      view.setUint8(offset + 5,
+          messages[i].isJson ? _sendJsonMessageOp : _sendMessageOp);
+      // Reserved and request id stay 0
+      offset += 4 + _headerSize;
+
+      for (final field in fields) {
+        view.setUint32(offset, field.length, Endian.little);
+        bytes.setRange(offset + 4, offset + 4 + field.length, field);
+        offset += 4 + field.length;
+      }
+    }
+    return view;
+  }
+}
@@ -0,0 +1,82 @@
+/// How the Unreal game view resolution relates to its surface
+enum UnrealRenderScaleMode {
+  /// Render at the surface resolution
+  native,
+
+  /// Render at a fixed fraction of the surface resolution
+  fixed,
+
+  /// Adjust the fraction to hold a target frame rate
+  dynamic,
+}
+
+/// Unreal Engine render scale model
+///
+/// The game view is rendered at [scale] times the surface size per axis and
+/// upscaled to fill the surface. Rendering at 0.7 draws about half the pixels,
+/// which on lower-tier devices can be the difference between 30 and 60 fps.
+///
+/// The engine reports the resulting render size with a `FlutterBridge`
+/// `onRenderScaleChanged` message whenever the scale changes.
+class UnrealRenderScale {
+  /// Scaling mode
+  final UnrealRenderScaleMode mode;
+
+  /// Scale per axis in fixed mode, and the starting scale in dynamic mode
+  /// (0.25 - 2.0)
+  final double scale;
+
+  /// Lowest scale dynamic mode may use (0.25 - 2.0)
+  final double minScale;
+
+  /// Highest scale dynamic mode may use (0.25 - 2.0)
+  final double maxScale;
+
+  /// Frame rate dynamic mode tries to hold
+  final double targetFrameRate;
+
+  const UnrealRenderScale({
+    this.mode = UnrealRenderScaleMode.native,
+    this.scale = 1.0,
+    this.minScale = 0.5,
+    this.maxScale = 1.0,
+    this.targetFrameRate = 60.0,
+  });
+
+  /// Render at the surface resolution
+  const UnrealRenderScale.native() : this();
+
+  /// Render at a fixed fraction of the surface resolution
+  const UnrealRenderScale.fixed(double scale)
+      : this(mode: UnrealRenderScaleMode.fixed, scale: scale);
+
+  /// Scale between [minScale] and [maxScale] to hold [targetFrameRate]
+  const UnrealRenderScale.dynamic({
+    double minScale = 0.5,
+    double maxScale = 1.0,
+    double targetFrameRate = 60.0,
+  }) : this(
+          mode: UnrealRenderScaleMode.dynamic,
+          scale: maxScale,
+          minScale: minScale,
+          maxScale: maxScale,
+          targetFrameRate: targetFrameRate,
+        );
+
+  /// Convert to map for platform channel
+  Map<String, dynamic> toMap() {
+    return {
+      'mode': mode.index,
+      'scale': scale,
+      'minScale': minScale,
+      'maxScale': maxScale,
+      'targetFrameRate': targetFrameRate,
+    };
+  }
+
+  @override
+  String toString() {
+    return 'UnrealRenderScale(${mode.name}, scale: $scale, '
+        'range: $minScale-$maxScale, target: $targetFrameRate fps)';
+  }
+}
@@ -0,0 +1,140 @@
+import 'dart:async';
+
+import 'package:flutter/services.dart';
+import 'package:gameframework/gameframework.dart';
+
+/// Game state the engine mirrored at one point
+class UnrealStateSnapshot {
+  /// Engine writes so far; each write changes one or more fields together
+  final int version;
+
+  /// How long ago the engine wrote it, in milliseconds
+  final double ageMs;
+
+  /// Field values by name: `int`, `double` or `bool`
+  final Map<String, Object> fields;
+
+  const UnrealStateSnapshot({
+    this.version = 0,
+    this.ageMs = 0,
+    this.fields = const {},
+  });
+
+  /// Create from the map returned by the plugin
+  factory UnrealStateSnapshot.fromMap(Map<String, dynamic> map) {
+    final fields = <String, Object>{};
+    (map['fields'] as Map? ?? const {}).forEach((name, value) {
+      if (name is String && value != null) {
+        fields[name] = value as Object;
+      }
+    });
+    return UnrealStateSnapshot(
+      version: (map['version'] as num?)?.toInt() ?? 0,
+      ageMs: (map['ageMs'] as num?)?.toDouble() ?? 0,
+      fields: Map.unmodifiable(fields),
+    );
+  }
+
+  /// Value of the field [name], or null if the engine has not written it
+  Object? operator [](String name) => fields[name];
+
+  @override
+  String toString() => 'UnrealStateSnapshot(v$version, '
+      'age: ${ageMs.toStringAsFixed(2)}ms, $fields)';
+}
+
+/// Game state shared with Unreal Engine through shared memory (Linux)
+///
+/// The plugin creates a state mirror the engine writes named numeric fields
+/// to, such as score, level or health (`AFlutterBridge::MirrorStateInt` and
+/// friends; `AFlutterGameMode` mirrors its state on its own). Start the engine
+/// with `-FlutterStateMirror=<stateMirrorName>` from
+/// [UnrealConnectionInfo.stateMirrorName] (or set
+/// `GAMEFRAMEWORK_UNREAL_STATE_MIRROR`).
+///
+/// Reading never waits for the engine and no message is sent either way, so
+/// a HUD can read the state every frame. A read while nothing changed returns
+/// the last snapshot without copying anything.
+///
+/// ```dart
+/// final state = UnrealStateMirror();
+/// state.watch().listen((snapshot) => print(snapshot['score']));
+/// ```
+class UnrealStateMirror {
+  final MethodChannel _channel;
+
+  UnrealStateSnapshot? _latest;
+
+  UnrealStateMirror({MethodChannel? channel})
+      : _channel = channel ?? const MethodChannel('gameframework_unreal');
+
+  /// The snapshot the last read returned
+  UnrealStateSnapshot? get latest => _latest;
+
+  /// Read the current state
+  Future<UnrealStateSnapshot> read() async {
+    final Map<String, dynamic>? result;
+    try {
+      result = await _channel.invokeMapMethod<String, dynamic>(
+        'stateMirror#read',
+        {'sinceVersion': _latest?.version ?? -1},
+      );
+    } catch (e) {
+      throw EngineCommunicationException(
+        'Failed to read the state mirror: $e',
+        target: 'UnrealStateMirror',
+        method: 'read',
+        engineType: GameEngineType.unreal,
+      );
+    }
+
+    // Null means the version has not moved since the last read
+    if (result != null) {
+      _latest = UnrealStateSnapshot.fromMap(result);
+    }
+    return _latest ?? const UnrealStateSnapshot();
+  }
+
+  /// Snapshots as the engine changes them, checked every [interval]
+  Stream<UnrealStateSnapshot> watch({
+    Duration interval = const Duration(milliseconds: 16),
+  }) {
+    late final StreamController<UnrealStateSnapshot> controller;
+    Timer? timer;
+    var reading = false;
+
+    Future<void> poll() async {
+      if (reading) {
+        return;
+      }
+      reading = true;
+      final before = _latest;
+      try {
+        final snapshot = await read();
+        if (!identical(snapshot, before) && !controller.isClosed) {
+          controller.add(snapshot);
+        }
+      } catch (e) {
+        if (!controller.isClosed) {
+          controller.addError(e);
+        }
+      } finally {
+        reading = false;
+      }
+    }
+
+    controller = StreamController<UnrealStateSnapshot>(
+      onListen: () {
+        // The first read reports the current state even if it is unchanged
+        _latest = null;
+        poll();
+        timer = Timer.periodic(interval, (_) => poll());
+      },
+      onCancel: () {
+        timer?.cancel();
+        timer = null;
+      },
+    );
+    return controller.stream;
+  }
+}
@@ -0,0 +1,129 @@
+/// Unreal Engine surface statistics model
+///
+/// Timings of the rendering surface handed from the platform view to Unreal:
+/// how long the handoff took, how long until the first frame, and what resizes
+/// (e.g. orientation changes) cost in dropped frames.
+///
+/// Durations are in milliseconds. Times are seconds on the engine's clock and
+/// are only meaningful relative to [captureTime]; zero means the transition has
+/// not happened yet.
+class UnrealSurfaceStatistics {
+  /// Surfaces handed to the engine
+  final int surfacesCreated;
+
+  /// Surface size changes
+  final int resizes;
+
+  /// Surfaces taken away from the engine
+  final int surfacesDestroyed;
+
+  /// Current surface width in pixels, 0 without a surface
+  final int width;
+
+  /// Current surface height in pixels, 0 without a surface
+  final int height;
+
+  /// Surface received to hardware window set
+  final double lastHandoffMs;
+
+  /// Surface ready to the end of the first frame after it
+  final double lastTimeToFirstFrameMs;
+
+  /// Longest time to first frame so far
+  final double maxTimeToFirstFrameMs;
+
+  /// Size change to the last slow frame before the frame rate recovered
+  final double lastResizeSettleMs;
+
+  /// Longest resize settle time so far
+  final double maxResizeSettleMs;
+
+  /// Frames missed while the last resize settled
+  final int lastResizeDroppedFrames;
+
+  /// Frames missed by all resizes
+  final int totalResizeDroppedFrames;
+
+  /// Time taken to release the surface when it went away
+  final double lastDestroyMs;
+
+  /// Typical frame time outside surface transitions
+  final double baselineFrameMs;
+
+  final double lastCreatedTime;
+  final double lastReadyTime;
+  final double lastFirstFrameTime;
+  final double lastResizeTime;
+  final double lastResizeSettledTime;
+  final double lastDestroyedTime;
+
+  /// Engine time at which these statistics were read
+  final double captureTime;
+
+  const UnrealSurfaceStatistics({
+    this.surfacesCreated = 0,
+    this.resizes = 0,
+    this.surfacesDestroyed = 0,
+    this.width = 0,
+    this.height = 0,
+    this.lastHandoffMs = 0,
+    this.lastTimeToFirstFrameMs = 0,
+    this.maxTimeToFirstFrameMs = 0,
+    this.lastResizeSettleMs = 0,
+    this.maxResizeSettleMs = 0,
+    this.lastResizeDroppedFrames = 0,
+    this.totalResizeDroppedFrames = 0,
+    this.lastDestroyMs = 0,
+    this.baselineFrameMs = 0,
+    this.lastCreatedTime = 0,
+    this.lastReadyTime = 0,
+    this.lastFirstFrameTime = 0,
+    this.lastResizeTime = 0,
+    this.lastResizeSettledTime = 0,
+    this.lastDestroyedTime = 0,
+    this.captureTime = 0,
+  });
+
+  /// Whether a resize is still waiting for the frame rate to recover
+  bool get isResizeSettling =>
+      lastResizeTime > 0 && lastResizeSettledTime < lastResizeTime;
+
+  /// Create from the JSON map returned by the engine
+  factory UnrealSurfaceStatistics.fromMap(Map<String, dynamic> map) {
+    int asInt(String key) => (map[key] as num?)?.toInt() ?? 0;
+    double asDouble(String key) => (map[key] as num?)?.toDouble() ?? 0;
+
+    return UnrealSurfaceStatistics(
+      surfacesCreated: asInt('surfacesCreated'),
+      resizes: asInt('resizes'),
+      surfacesDestroyed: asInt('surfacesDestroyed'),
+      width: asInt('width'),
+      height: asInt('height'),
+      lastHandoffMs: asDouble('lastHandoffMs'),
+      lastTimeToFirstFrameMs: asDouble('lastTimeToFirstFrameMs'),
+      maxTimeToFirstFrameMs: asDouble('maxTimeToFirstFrameMs'),
+      lastResizeSettleMs: asDouble('lastResizeSettleMs'),
+      maxResizeSettleMs: asDouble('maxResizeSettleMs'),
+      lastResizeDroppedFrames: asInt('lastResizeDroppedFrames'),
+      totalResizeDroppedFrames: asInt('totalResizeDroppedFrames'),
+      lastDestroyMs: asDouble('lastDestroyMs'),
+      baselineFrameMs: asDouble('baselineFrameMs'),
+      lastCreatedTime: asDouble('lastCreatedTime'),
+      lastReadyTime: asDouble('lastReadyTime'),
+      lastFirstFrameTime: asDouble('lastFirstFrameTime'),
+      lastResizeTime: asDouble('lastResizeTime'),
+      lastResizeSettledTime: asDouble('lastResizeSettledTime'),
+      lastDestroyedTime: asDouble('lastDestroyedTime'),
+      captureTime: asDouble('captureTime'),
+    );
+  }
+
+  @override
+  String toString() {
+    return 'UnrealSurfaceStatistics(${width}x$height, '
+        'surfaces: $surfacesCreated, resizes: $resizes, '
+        'firstFrame: ${lastTimeToFirstFrameMs.toStringAsFixed(1)}ms, '
+        'resizeSettle: ${lastResizeSettleMs.toStringAsFixed(1)}ms, '
+        'dropped: $lastResizeDroppedFrames/$totalResizeDroppedFrames)';
+  }
+}
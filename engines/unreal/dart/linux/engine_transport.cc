@@ -0,0 +1,605 @@
+#include "engine_transport.h"
+
+#include <errno.h>
+#include <fcntl.h>
+#include <poll.h>
+#include <sys/eventfd.h>
+#include <sys/socket.h>
+#include <sys/uio.h>
+#include <sys/un.h>
+#include <unistd.h>
+
+#include <algorithm>
+#include <climits>
+#include <cstring>
+
+#include "frame_buffer.h"
+
+namespace gameframework_unreal {
+
+namespace {
+
+// How long the I/O thread sleeps when nothing is due.
+constexpr int kIdlePollMs = 1000;
+constexpr size_t kReadChunk = 256 * 1024;
+// Queued buffers gathered into one write, so runs of small frames cost one
+// system call instead of one each.
+constexpr size_t kMaxWriteBuffers = 64;
+
+void PutUint32(std::string* out, uint32_t value) {
+  const char bytes[4] = {
+      static_cast<char>(value & 0xFF), static_cast<char>((value >> 8) & 0xFF),
+      static_cast<char>((value >> 16) & 0xFF),
+      static_cast<char>((value >> 24) & 0xFF)};
+  out->append(bytes, 4);
+}
+
+uint32_t GetUint32(const char* data) {
+  const uint8_t* bytes = reinterpret_cast<const uint8_t*>(data);
+  return static_cast<uint32_t>(bytes[0]) |
+         (static_cast<uint32_t>(bytes[1]) << 8) |
+         (static_cast<uint32_t>(bytes[2]) << 16) |
+         (static_cast<uint32_t>(bytes[3]) << 24);
+}
+
+void SetError(std::string* error, const std::string& message) {
+  if (error != nullptr) {
+    *error = message + ": " + strerror(errno);
+  }
+}
+
+}  // namespace
+
+// ===== Framing =====
+
+std::string EncodeFrame(FrameType type, EngineOp op, uint32_t request_id,
+                        const std::string& payload) {
+  std::string frame;
+  frame.reserve(4 + kFrameHeaderSize + payload.size());
+  PutUint32(&frame, static_cast<uint32_t>(kFrameHeaderSize + payload.size()));
+  frame.push_back(static_cast<char>(type));
+  frame.push_back(static_cast<char>(op));
+  frame.append(2, '\0');
+  PutUint32(&frame, request_id);
+  frame.append(payload);
+  return frame;
+}
+
+std::string EncodeStrings(std::initializer_list<std::string> strings) {
+  size_t size = 0;
+  for (const std::string& value : strings) {
+    size += 4 + value.size();
+  }
+  std::string payload;
+  payload.reserve(size);
+  for (const std::string& value : strings) {
+    PutUint32(&payload, static_cast<uint32_t>(value.size()));
+    payload.append(value);
+  }
+  return payload;
+}
+
+bool DecodeStrings(const std::string& payload,
+                   std::vector<std::string>* strings) {
+  strings->clear();
+  size_t offset = 0;
+  while (offset < payload.size()) {
+    if (payload.size() - offset < 4) {
+      return false;
+    }
+    const uint32_t length = GetUint32(payload.data() + offset);
+    offset += 4;
+    if (payload.size() - offset < length) {
+      return false;
+    }
+    strings->emplace_back(payload, offset, length);
+    offset += length;
+  }
+  return true;
+}
+
+uint32_t CountPostedFrames(const char* data, size_t size) {
+  uint32_t count = 0;
+  size_t offset = 0;
+  while (offset < size) {
+    if (size - offset < 4 + kFrameHeaderSize) {
+      return 0;
+    }
+    const uint32_t length = GetUint32(data + offset);
+    const char* header = data + offset + 4;
+    if (length < kFrameHeaderSize || length > kMaxFrameSize ||
+        size - offset - 4 < length ||
+        static_cast<FrameType>(header[0]) != FrameType::kRequest ||
+        (static_cast<EngineOp>(header[1]) != EngineOp::kSendMessage &&
+         static_cast<EngineOp>(header[1]) != EngineOp::kSendJsonMessage) ||
+        GetUint32(header + 4) != 0) {
+      return 0;
+    }
+    offset += 4 + length;
+    count++;
+  }
+  return count;
+}
+
+OutgoingBytes::OutgoingBytes(std::string bytes) : owned_(std::move(bytes)) {}
+
+OutgoingBytes::OutgoingBytes(const char* data, size_t size, Release release,
+                             void* context)
+    : borrowed_(data), size_(size), release_(release), context_(context) {}
+
+OutgoingBytes::~OutgoingBytes() { Reset(); }
+
+OutgoingBytes::OutgoingBytes(OutgoingBytes&& other) noexcept
+    : owned_(std::move(other.owned_)),
+      borrowed_(other.borrowed_),
+      size_(other.size_),
+      release_(other.release_),
+      context_(other.context_) {
+  other.release_ = nullptr;
+}
+
+OutgoingBytes& OutgoingBytes::operator=(OutgoingBytes&& other) noexcept {
+  if (this != &other) {
+    Reset();
+    owned_ = std::move(other.owned_);
+    borrowed_ = other.borrowed_;
+    size_ = other.size_;
+    release_ = other.release_;
+    context_ = other.context_;
+    other.release_ = nullptr;
+  }
+  return *this;
+}
+
+void OutgoingBytes::Reset() {
+  if (release_ != nullptr) {
+    release_(context_);
+    release_ = nullptr;
+  }
+}
+
+void FrameReader::Append(const char* data, size_t size) {
+  // Drop consumed bytes once they make up most of the buffer, so a stream of
+  // large frames does not keep moving memory.
+  if (offset_ > 0 && offset_ >= buffer_.size() / 2) {
+    buffer_.erase(0, offset_);
+    offset_ = 0;
+  }
+  buffer_.append(data, size);
+}
+
+bool FrameReader::Next(TransportFrame* frame) {
+  if (error_ || buffer_.size() - offset_ < 4) {
+    return false;
+  }
+  const uint32_t length = GetUint32(buffer_.data() + offset_);
+  if (length < kFrameHeaderSize || length > kMaxFrameSize) {
+    error_ = true;
+    return false;
+  }
+  if (buffer_.size() - offset_ - 4 < length) {
+    return false;
+  }
+
+  const char* header = buffer_.data() + offset_ + 4;
+  frame->type = static_cast<FrameType>(header[0]);
+  frame->op = static_cast<EngineOp>(header[1]);
+  frame->request_id = GetUint32(header + 4);
+  frame->payload.assign(header + kFrameHeaderSize, length - kFrameHeaderSize);
+  offset_ += 4 + length;
+  return true;
+}
+
+void FrameReader::Reset() {
+  buffer_.clear();
+  offset_ = 0;
+  error_ = false;
+}
+
+// ===== Setup =====
+
+std::unique_ptr<EngineTransport> EngineTransport::Listen(
+    const std::string& path, Dispatcher dispatcher, EventCallback on_event,
+    std::string* error) {
+  struct sockaddr_un address = {};
+  address.sun_family = AF_UNIX;
+  if (path.empty() || path.size() >= sizeof(address.sun_path)) {
+    errno = ENAMETOOLONG;
+    SetError(error, "Invalid socket path " + path);
+    return nullptr;
+  }
+  memcpy(address.sun_path, path.c_str(), path.size() + 1);
+
+  const int listen_fd =
+      socket(AF_UNIX, SOCK_STREAM | SOCK_NONBLOCK | SOCK_CLOEXEC, 0);
+  if (listen_fd < 0) {
+    SetError(error, "socket failed");
+    return nullptr;
+  }
+
+  // A socket file left behind by a crashed process is replaced
+  unlink(path.c_str());
+  if (bind(listen_fd, reinterpret_cast<struct sockaddr*>(&address),
+           sizeof(address)) != 0 ||
+      listen(listen_fd, 1) != 0) {
+    SetError(error, "Listening on " + path + " failed");
+    close(listen_fd);
+    return nullptr;
+  }
+
+  const int wake_fd = eventfd(0, EFD_NONBLOCK | EFD_CLOEXEC);
+  if (wake_fd < 0) {
+    SetError(error, "eventfd failed");
+    close(listen_fd);
+    unlink(path.c_str());
+    return nullptr;
+  }
+
+  return std::unique_ptr<EngineTransport>(
+      new EngineTransport(path, listen_fd, wake_fd, std::move(dispatcher),
+                          std::move(on_event)));
+}
+
+EngineTransport::EngineTransport(std::string path, int listen_fd, int wake_fd,
+                                 Dispatcher dispatcher, EventCallback on_event)
+    : path_(std::move(path)),
+      listen_fd_(listen_fd),
+      wake_fd_(wake_fd),
+      dispatcher_(std::move(dispatcher)),
+      on_event_(std::move(on_event)) {
+  thread_ = std::thread(&EngineTransport::Run, this);
+}
+
+EngineTransport::~EngineTransport() {
+  stopping_ = true;
+  Wake();
+  thread_.join();
+
+  // The I/O thread failed whatever was pending on its way out
+  close(listen_fd_);
+  close(wake_fd_);
+  unlink(path_.c_str());
+}
+
+// ===== Requests =====
+
+void EngineTransport::Request(EngineOp op, std::string payload, int timeout_ms,
+                              ResponseCallback callback) {
+  if (payload.size() > kMaxFrameSize - kFrameHeaderSize) {
+    Fail(std::move(callback), "Message is larger than the transport allows");
+    return;
+  }
+
+  {
+    std::unique_lock<std::mutex> lock(mutex_);
+    if (!connected_ || stopping_) {
+      stats_.requests_failed++;
+      lock.unlock();
+      Fail(std::move(callback), "Engine is not connected");
+      return;
+    }
+
+    uint32_t request_id = next_request_id_++;
+    if (request_id == 0) {
+      request_id = next_request_id_++;
+    }
+
+    const uint64_t now = MonotonicNanoseconds();
+    const uint64_t deadline =
+        now + static_cast<uint64_t>(std::max(timeout_ms, 1)) * 1000000ull;
+    pending_[request_id] = PendingRequest{std::move(callback), now, deadline};
+    next_deadline_ns_ = std::min(next_deadline_ns_, deadline);
+
+    outgoing_.emplace_back(
+        EncodeFrame(FrameType::kRequest, op, request_id, payload));
+    stats_.requests_sent++;
+  }
+  Wake();
+}
+
+bool EngineTransport::Post(OutgoingBytes frames, uint32_t count) {
+  {
+    std::lock_guard<std::mutex> lock(mutex_);
+    if (!connected_ || stopping_) {
+      return false;
+    }
+    outgoing_.push_back(std::move(frames));
+    stats_.messages_posted += count;
+  }
+  Wake();
+  return true;
+}
+
+void EngineTransport::Fail(ResponseCallback callback,
+                           const std::string& reason) {
+  dispatcher_([callback = std::move(callback), reason]() {
+    callback(false, reason);
+  });
+}
+
+void EngineTransport::Wake() {
+  const uint64_t one = 1;
+  ssize_t written = write(wake_fd_, &one, sizeof(one));
+  (void)written;  // EAGAIN means a wake-up is already pending
+}
+
+TransportStatistics EngineTransport::GetStatistics() const {
+  std::lock_guard<std::mutex> lock(mutex_);
+  TransportStatistics stats = stats_;
+  stats.connected = connected_;
+  stats.pending_requests = pending_.size();
+  return stats;
+}
+
+// ===== I/O thread =====
+
+void EngineTransport::Run() {
+  std::vector<struct pollfd> fds;
+  while (!stopping_) {
+    fds.clear();
+    fds.push_back({wake_fd_, POLLIN, 0});
+    fds.push_back({listen_fd_, POLLIN, 0});
+    if (connection_fd_ >= 0) {
+      const bool has_output = !writing_.empty() || [this] {
+        std::lock_guard<std::mutex> lock(mutex_);
+        return !outgoing_.empty();
+      }();
+      fds.push_back(
+          {connection_fd_,
+           static_cast<short>(POLLIN | (has_output ? POLLOUT : 0)), 0});
+    }
+
+    poll(fds.data(), fds.size(), PollTimeoutMs(MonotonicNanoseconds()));
+
+    if (fds[0].revents & POLLIN) {
+      uint64_t count;
+      ssize_t drained = read(wake_fd_, &count, sizeof(count));
+      (void)drained;
+    }
+    if (fds[1].revents & POLLIN) {
+      Accept();
+    }
+    if (fds.size() > 2 && connection_fd_ == fds[2].fd) {
+      if (fds[2].revents & (POLLIN | POLLHUP | POLLERR)) {
+        ReadAvailable();
+      }
+    }
+    if (connection_fd_ >= 0) {
+      WriteQueued();
+    }
+    ExpireRequests(MonotonicNanoseconds());
+  }
+
+  if (connection_fd_ >= 0) {
+    Disconnect("Transport closed");
+  }
+}
+
+void EngineTransport::Accept() {
+  const int fd = accept4(listen_fd_, nullptr, nullptr,
+                         SOCK_NONBLOCK | SOCK_CLOEXEC);
+  if (fd < 0) {
+    return;
+  }
+  if (connection_fd_ >= 0) {
+    Disconnect("Engine reconnected");
+  }
+
+  // Large messages go out in fewer, bigger writes
+  const int buffer_size = 1024 * 1024;
+  setsockopt(fd, SOL_SOCKET, SO_SNDBUF, &buffer_size, sizeof(buffer_size));
+  setsockopt(fd, SOL_SOCKET, SO_RCVBUF, &buffer_size, sizeof(buffer_size));
+
+  connection_fd_ = fd;
+  std::lock_guard<std::mutex> lock(mutex_);
+  connected_ = true;
+  stats_.connections++;
+}
+
+void EngineTransport::ReadAvailable() {
+  char buffer[kReadChunk];
+  uint64_t received = 0;
+  for (;;) {
+    const ssize_t count = read(connection_fd_, buffer, sizeof(buffer));
+    if (count > 0) {
+      reader_.Append(buffer, static_cast<size_t>(count));
+      received += static_cast<uint64_t>(count);
+      continue;
+    }
+    if (count < 0 && errno == EINTR) {
+      continue;
+    }
+    if (count < 0 && (errno == EAGAIN || errno == EWOULDBLOCK)) {
+      break;
+    }
+    // End of stream or a hard error; frames already read still count
+    TransportFrame frame;
+    while (reader_.Next(&frame)) {
+      HandleFrame(&frame);
+    }
+    Disconnect("Engine disconnected");
+    return;
+  }
+
+  {
+    std::lock_guard<std::mutex> lock(mutex_);
+    stats_.bytes_received += received;
+  }
+
+  TransportFrame frame;
+  while (reader_.Next(&frame)) {
+    HandleFrame(&frame);
+  }
+  if (reader_.error()) {
+    Disconnect("Engine sent a malformed frame");
+  }
+}
+
+void EngineTransport::WriteQueued() {
+  {
+    std::lock_guard<std::mutex> lock(mutex_);
+    while (!outgoing_.empty()) {
+      writing_.push_back(std::move(outgoing_.front()));
+      outgoing_.pop_front();
+    }
+  }
+
+  uint64_t sent = 0;
+  struct iovec buffers[kMaxWriteBuffers];
+  while (!writing_.empty()) {
+    size_t buffer_count = 0;
+    for (const OutgoingBytes& bytes : writing_) {
+      if (buffer_count == kMaxWriteBuffers) {
+        break;
+      }
+      const size_t skip = buffer_count == 0 ? write_offset_ : 0;
+      buffers[buffer_count].iov_base =
+          const_cast<char*>(bytes.data() + skip);
+      buffers[buffer_count].iov_len = bytes.size() - skip;
+      buffer_count++;
+    }
+
+    struct msghdr message = {};
+    message.msg_iov = buffers;
+    message.msg_iovlen = buffer_count;
+    const ssize_t count = sendmsg(connection_fd_, &message, MSG_NOSIGNAL);
+    if (count < 0) {
+      if (errno == EINTR) {
+        continue;
+      }
+      if (errno != EAGAIN && errno != EWOULDBLOCK) {
+        Disconnect("Writing to the engine failed");
+      }
+      break;
+    }
+
+    sent += static_cast<uint64_t>(count);
+    size_t remaining = static_cast<size_t>(count);
+    while (remaining > 0) {
+      const size_t left = writing_.front().size() - write_offset_;
+      if (remaining < left) {
+        write_offset_ += remaining;
+        break;
+      }
+      remaining -= left;
+      writing_.pop_front();
+      write_offset_ = 0;
+    }
+  }
+
+  std::lock_guard<std::mutex> lock(mutex_);
+  stats_.bytes_sent += sent;
+}
+
+void EngineTransport::HandleFrame(TransportFrame* frame) {
+  if (frame->type == FrameType::kEvent) {
+    {
+      std::lock_guard<std::mutex> lock(mutex_);
+      stats_.events_received++;
+    }
+    if (on_event_) {
+      // Copied, not captured through this: tasks may outlive the transport
+      dispatcher_([on_event = on_event_, op = frame->op,
+                   payload = std::move(frame->payload)]() {
+        on_event(op, payload);
+      });
+    }
+    return;
+  }
+
+  if (frame->type != FrameType::kResponse &&
+      frame->type != FrameType::kError) {
+    // The engine does not make requests of the plugin
+    return;
+  }
+
+  ResponseCallback callback;
+  {
+    std::lock_guard<std::mutex> lock(mutex_);
+    auto it = pending_.find(frame->request_id);
+    if (it == pending_.end()) {
+      return;  // already timed out
+    }
+    callback = std::move(it->second.callback);
+    const uint64_t round_trip = MonotonicNanoseconds() - it->second.start_ns;
+    pending_.erase(it);
+
+    if (frame->type == FrameType::kResponse) {
+      stats_.responses_received++;
+    } else {
+      stats_.errors_received++;
+    }
+    const uint64_t completed =
+        stats_.responses_received + stats_.errors_received;
+    total_round_trip_ns_ += round_trip;
+    stats_.last_round_trip_ms = round_trip / 1e6;
+    stats_.average_round_trip_ms = total_round_trip_ns_ / 1e6 / completed;
+    stats_.max_round_trip_ms =
+        std::max(stats_.max_round_trip_ms, stats_.last_round_trip_ms);
+  }
+
+  const bool ok = frame->type == FrameType::kResponse;
+  dispatcher_([callback = std::move(callback), ok,
+               payload = std::move(frame->payload)]() {
+    callback(ok, payload);
+  });
+}
+
+void EngineTransport::Disconnect(const char* reason) {
+  close(connection_fd_);
+  connection_fd_ = -1;
+  reader_.Reset();
+  writing_.clear();
+  write_offset_ = 0;
+
+  std::unordered_map<uint32_t, PendingRequest> failed;
+  {
+    std::lock_guard<std::mutex> lock(mutex_);
+    connected_ = false;
+    outgoing_.clear();
+    failed.swap(pending_);
+    next_deadline_ns_ = UINT64_MAX;
+    stats_.requests_failed += failed.size();
+  }
+  for (auto& entry : failed) {
+    Fail(std::move(entry.second.callback), reason);
+  }
+}
+
+void EngineTransport::ExpireRequests(uint64_t now_ns) {
+  std::vector<ResponseCallback> expired;
+  {
+    std::lock_guard<std::mutex> lock(mutex_);
+    if (now_ns < next_deadline_ns_) {
+      return;
+    }
+    next_deadline_ns_ = UINT64_MAX;
+    for (auto it = pending_.begin(); it != pending_.end();) {
+      if (it->second.deadline_ns <= now_ns) {
+        expired.push_back(std::move(it->second.callback));
+        it = pending_.erase(it);
+      } else {
+        next_deadline_ns_ = std::min(next_deadline_ns_, it->second.deadline_ns);
+        ++it;
+      }
+    }
+    stats_.requests_failed += expired.size();
+  }
+  for (ResponseCallback& callback : expired) {
+    Fail(std::move(callback), "Engine did not respond in time");
+  }
+}
+
+int EngineTransport::PollTimeoutMs(uint64_t now_ns) const {
+  std::lock_guard<std::mutex> lock(mutex_);
+  if (next_deadline_ns_ == UINT64_MAX) {
+    return kIdlePollMs;
+  }
+  if (next_deadline_ns_ <= now_ns) {
+    return 0;
+  }
+  const uint64_t wait_ms = (next_deadline_ns_ - now_ns + 999999) / 1000000;
+  return static_cast<int>(std::min<uint64_t>(wait_ms, kIdlePollMs));
+}
+
+}  // namespace gameframework_unreal
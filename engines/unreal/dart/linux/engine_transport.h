@@ -0,0 +1,235 @@
+#ifndef FLUTTER_PLUGIN_UNREAL_ENGINE_TRANSPORT_H_
+#define FLUTTER_PLUGIN_UNREAL_ENGINE_TRANSPORT_H_
+
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <deque>
+#include <functional>
+#include <initializer_list>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <thread>
+#include <unordered_map>
+#include <vector>
+
+namespace gameframework_unreal {
+
+// Message transport between the Linux plugin and the Unreal engine process.
+//
+// The plugin listens on a Unix domain socket and the engine connects to it.
+// Both directions carry length-prefixed frames:
+//
+//   uint32 length      bytes after this field, little endian
+//   uint8  type        FrameType
+//   uint8  op          EngineOp
+//   uint16 reserved
+//   uint32 request_id  matches a response to its request; 0 for events and
+//                      for requests posted without an answer
+//   payload
+//
+// The plugin side never blocks the caller: requests are queued for an I/O
+// thread, and responses, errors, timeouts and engine events are handed back
+// through a dispatcher, which the plugin points at the GTK main loop.
+//
+// The engine side lives in Private/Linux/FlutterSocketConnection.cpp in the
+// Unreal plugin.
+
+enum class FrameType : uint8_t {
+  kRequest = 1,
+  kResponse = 2,
+  kError = 3,  // response whose payload is an error message
+  kEvent = 4,  // engine to plugin, no response
+};
+
+enum class EngineOp : uint8_t {
+  kPing = 0,                   // payload echoed back
+  kSendMessage = 1,            // strings: target, method, data
+  kSendJsonMessage = 2,        // strings: target, method, JSON
+  kExecuteConsoleCommand = 3,  // strings: command
+  kLoadLevel = 4,              // strings: level name
+  kMessage = 5,                // event, strings: target, method, data
+};
+
+constexpr uint32_t kFrameHeaderSize = 8;  // after the length field
+constexpr uint32_t kMaxFrameSize = 64 * 1024 * 1024;
+
+struct TransportFrame {
+  FrameType type = FrameType::kRequest;
+  EngineOp op = EngineOp::kPing;
+  uint32_t request_id = 0;
+  std::string payload;
+};
+
+// Length field, header and payload, ready to write.
+std::string EncodeFrame(FrameType type, EngineOp op, uint32_t request_id,
+                        const std::string& payload);
+
+// Payloads of the string ops: each string as a uint32 length and its bytes.
+std::string EncodeStrings(std::initializer_list<std::string> strings);
+bool DecodeStrings(const std::string& payload,
+                   std::vector<std::string>* strings);
+
+// Frames Flutter posts on the raw message lane: requests with request id 0,
+// which the engine carries out without answering. Returns how many frames
+// |data| holds, or 0 if it is empty or anything but a run of well-formed
+// kSendMessage / kSendJsonMessage frames.
+uint32_t CountPostedFrames(const char* data, size_t size);
+
+// Bytes queued for the engine. Either owned, or borrowed from the caller until
+// they have been written (a GBytes from Flutter, say), so posted messages
+// reach the socket without being copied.
+class OutgoingBytes {
+ public:
+  using Release = void (*)(void* context);
+
+  explicit OutgoingBytes(std::string bytes);
+  OutgoingBytes(const char* data, size_t size, Release release, void* context);
+  ~OutgoingBytes();
+
+  OutgoingBytes(OutgoingBytes&& other) noexcept;
+  OutgoingBytes& operator=(OutgoingBytes&& other) noexcept;
+  OutgoingBytes(const OutgoingBytes&) = delete;
+  OutgoingBytes& operator=(const OutgoingBytes&) = delete;
+
+  const char* data() const {
+    return release_ != nullptr ? borrowed_ : owned_.data();
+  }
+  size_t size() const { return release_ != nullptr ? size_ : owned_.size(); }
+
+ private:
+  void Reset();
+
+  std::string owned_;
+  const char* borrowed_ = nullptr;
+  size_t size_ = 0;
+  Release release_ = nullptr;
+  void* context_ = nullptr;
+};
+
+// Splits a byte stream into frames, however the reads happen to cut it.
+class FrameReader {
+ public:
+  void Append(const char* data, size_t size);
+
+  // Takes the next complete frame. False if more bytes are needed, or for
+  // good once the stream is corrupt (see error()).
+  bool Next(TransportFrame* frame);
+
+  bool error() const { return error_; }
+  void Reset();
+
+ private:
+  std::string buffer_;
+  size_t offset_ = 0;
+  bool error_ = false;
+};
+
+struct TransportStatistics {
+  bool connected = false;
+  uint64_t connections = 0;
+  uint64_t requests_sent = 0;
+  uint64_t responses_received = 0;
+  uint64_t errors_received = 0;
+  uint64_t requests_failed = 0;  // not connected, timed out or disconnected
+  uint64_t events_received = 0;
+  uint64_t messages_posted = 0;
+  uint64_t bytes_sent = 0;
+  uint64_t bytes_received = 0;
+  uint64_t pending_requests = 0;
+  double last_round_trip_ms = 0;
+  double average_round_trip_ms = 0;
+  double max_round_trip_ms = 0;
+};
+
+class EngineTransport {
+ public:
+  using Task = std::function<void()>;
+  // Runs |task| wherever the owner wants callbacks, in order.
+  using Dispatcher = std::function<void(Task task)>;
+  // |ok| is false for engine errors, timeouts and disconnects, with the
+  // reason in |payload|.
+  using ResponseCallback =
+      std::function<void(bool ok, const std::string& payload)>;
+  using EventCallback =
+      std::function<void(EngineOp op, const std::string& payload)>;
+
+  // Listens on |path|, replacing a stale socket file. One engine connection
+  // at a time; a new one replaces the old.
+  static std::unique_ptr<EngineTransport> Listen(const std::string& path,
+                                                 Dispatcher dispatcher,
+                                                 EventCallback on_event,
+                                                 std::string* error);
+
+  ~EngineTransport();
+
+  EngineTransport(const EngineTransport&) = delete;
+  EngineTransport& operator=(const EngineTransport&) = delete;
+
+  // Queues a request and returns at once. |callback| runs exactly once,
+  // through the dispatcher; immediately (with an error) if no engine is
+  // connected.
+  void Request(EngineOp op, std::string payload, int timeout_ms,
+               ResponseCallback callback);
+
+  // Queues frames that need no answer (see CountPostedFrames) as they are.
+  // False, dropping them, if no engine is connected.
+  bool Post(OutgoingBytes frames, uint32_t count);
+
+  bool connected() const { return connected_.load(); }
+  const std::string& path() const { return path_; }
+
+  TransportStatistics GetStatistics() const;
+
+ private:
+  struct PendingRequest {
+    ResponseCallback callback;
+    uint64_t start_ns;
+    uint64_t deadline_ns;
+  };
+
+  EngineTransport(std::string path, int listen_fd, int wake_fd,
+                  Dispatcher dispatcher, EventCallback on_event);
+
+  // I/O thread
+  void Run();
+  void Accept();
+  void ReadAvailable();
+  void WriteQueued();
+  void HandleFrame(TransportFrame* frame);
+  void Disconnect(const char* reason);
+  void ExpireRequests(uint64_t now_ns);
+  int PollTimeoutMs(uint64_t now_ns) const;
+
+  void Wake();
+  void Fail(ResponseCallback callback, const std::string& reason);
+
+  const std::string path_;
+  const int listen_fd_;
+  const int wake_fd_;
+  const Dispatcher dispatcher_;
+  const EventCallback on_event_;
+
+  std::atomic<bool> connected_{false};
+  std::atomic<bool> stopping_{false};
+  std::thread thread_;
+
+  // Only touched by the I/O thread
+  int connection_fd_ = -1;
+  FrameReader reader_;
+  std::deque<OutgoingBytes> writing_;
+  size_t write_offset_ = 0;
+
+  mutable std::mutex mutex_;  // guards everything below
+  std::deque<OutgoingBytes> outgoing_;
+  std::unordered_map<uint32_t, PendingRequest> pending_;
+  uint32_t next_request_id_ = 1;
+  uint64_t next_deadline_ns_ = UINT64_MAX;
+  uint64_t total_round_trip_ns_ = 0;
+  TransportStatistics stats_;
+};
+
+}  // namespace gameframework_unreal
+
+#endif  // FLUTTER_PLUGIN_UNREAL_ENGINE_TRANSPORT_H_
@@ -0,0 +1,349 @@
+#include "frame_buffer.h"
+
+#include <errno.h>
+#include <fcntl.h>
+#include <linux/futex.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <sys/syscall.h>
+#include <time.h>
+#include <unistd.h>
+
+#include <algorithm>
+#include <climits>
+#include <cstring>
+
+namespace gameframework_unreal {
+
+namespace {
+
+constexpr size_t kPageSize = 4096;
+
+size_t AlignUp(size_t value, size_t alignment) {
+  return (value + alignment - 1) / alignment * alignment;
+}
+
+size_t SlotsOffset() {
+  return AlignUp(sizeof(FrameBufferHeader), kPageSize);
+}
+
+size_t SlotCapacity(uint32_t max_width, uint32_t max_height) {
+  return AlignUp(static_cast<size_t>(max_width) * max_height * 4, kPageSize);
+}
+
+// Process-shared futex: no FUTEX_PRIVATE_FLAG, the word lives in shared memory.
+int Futex(std::atomic<uint32_t>* word, int op, uint32_t value,
+          const struct timespec* timeout) {
+  return static_cast<int>(
+      syscall(SYS_futex, reinterpret_cast<uint32_t*>(word), op, value, timeout,
+              nullptr, 0));
+}
+
+void SetError(std::string* error, const std::string& message) {
+  if (error != nullptr) {
+    *error = message + ": " + strerror(errno);
+  }
+}
+
+// BGRA to RGBA; the copy is the producer's main cost, so keep it to one pass.
+void SwizzleRow(const uint8_t* source, uint8_t* dest, uint32_t width) {
+  const uint32_t* in = reinterpret_cast<const uint32_t*>(source);
+  uint32_t* out = reinterpret_cast<uint32_t*>(dest);
+  for (uint32_t x = 0; x < width; ++x) {
+    const uint32_t pixel = in[x];
+    out[x] = (pixel & 0xFF00FF00u) | ((pixel & 0x00FF0000u) >> 16) |
+             ((pixel & 0x000000FFu) << 16);
+  }
+}
+
+}  // namespace
+
+uint64_t MonotonicNanoseconds() {
+  struct timespec now;
+  clock_gettime(CLOCK_MONOTONIC, &now);
+  return static_cast<uint64_t>(now.tv_sec) * 1000000000ull + now.tv_nsec;
+}
+
+size_t SharedFrameBuffer::SegmentSize(uint32_t max_width, uint32_t max_height) {
+  return SlotsOffset() +
+         SlotCapacity(max_width, max_height) * kFrameBufferSlots;
+}
+
+// ===== Setup =====
+
+std::unique_ptr<SharedFrameBuffer> SharedFrameBuffer::Create(
+    const std::string& name, uint32_t max_width, uint32_t max_height,
+    std::string* error) {
+  if (max_width == 0 || max_height == 0) {
+    errno = EINVAL;
+    SetError(error, "Frame buffer size must not be empty");
+    return nullptr;
+  }
+
+  // A segment left behind by a crashed process is replaced
+  shm_unlink(name.c_str());
+  const int fd = shm_open(name.c_str(), O_CREAT | O_EXCL | O_RDWR, 0600);
+  if (fd < 0) {
+    SetError(error, "shm_open(" + name + ") failed");
+    return nullptr;
+  }
+
+  const size_t size = SegmentSize(max_width, max_height);
+  if (ftruncate(fd, static_cast<off_t>(size)) != 0) {
+    SetError(error, "ftruncate failed");
+    close(fd);
+    shm_unlink(name.c_str());
+    return nullptr;
+  }
+
+  void* mapping =
+      mmap(nullptr, size, PROT_READ | PROT_WRITE, MAP_SHARED, fd, 0);
+  close(fd);
+  if (mapping == MAP_FAILED) {
+    SetError(error, "mmap failed");
+    shm_unlink(name.c_str());
+    return nullptr;
+  }
+
+  // ftruncate zero-fills, so only the non-zero fields need setting
+  FrameBufferHeader* header = new (mapping) FrameBufferHeader();
+  header->max_width = max_width;
+  header->max_height = max_height;
+  header->slot_capacity = SlotCapacity(max_width, max_height);
+  header->slots_offset = SlotsOffset();
+  header->middle.store(1, std::memory_order_relaxed);
+  header->front.store(2, std::memory_order_relaxed);
+  header->version = kFrameBufferVersion;
+  std::atomic_thread_fence(std::memory_order_release);
+  header->magic = kFrameBufferMagic;
+
+  return std::unique_ptr<SharedFrameBuffer>(
+      new SharedFrameBuffer(name, mapping, size, true));
+}
+
+std::unique_ptr<SharedFrameBuffer> SharedFrameBuffer::Open(
+    const std::string& name, std::string* error) {
+  const int fd = shm_open(name.c_str(), O_RDWR, 0);
+  if (fd < 0) {
+    SetError(error, "shm_open(" + name + ") failed");
+    return nullptr;
+  }
+
+  struct stat info;
+  if (fstat(fd, &info) != 0 ||
+      static_cast<size_t>(info.st_size) < sizeof(FrameBufferHeader)) {
+    errno = EINVAL;
+    SetError(error, "Frame buffer segment is too small");
+    close(fd);
+    return nullptr;
+  }
+
+  const size_t size = static_cast<size_t>(info.st_size);
+  void* mapping =
+      mmap(nullptr, size, PROT_READ | PROT_WRITE, MAP_SHARED, fd, 0);
+  close(fd);
+  if (mapping == MAP_FAILED) {
+    SetError(error, "mmap failed");
+    return nullptr;
+  }
+
+  const FrameBufferHeader* header =
+      static_cast<const FrameBufferHeader*>(mapping);
+  if (header->magic != kFrameBufferMagic ||
+      header->version != kFrameBufferVersion ||
+      size < SegmentSize(header->max_width, header->max_height)) {
+    munmap(mapping, size);
+    errno = EPROTO;
+    SetError(error, "Not a frame buffer segment of version " +
+                        std::to_string(kFrameBufferVersion));
+    return nullptr;
+  }
+
+  return std::unique_ptr<SharedFrameBuffer>(
+      new SharedFrameBuffer(name, mapping, size, false));
+}
+
+SharedFrameBuffer::SharedFrameBuffer(std::string name, void* mapping,
+                                     size_t size, bool owner)
+    : name_(std::move(name)),
+      mapping_(mapping),
+      size_(size),
+      owner_(owner),
+      header_(static_cast<FrameBufferHeader*>(mapping)) {}
+
+SharedFrameBuffer::~SharedFrameBuffer() {
+  if (owner_) {
+    Close();
+    shm_unlink(name_.c_str());
+  }
+  munmap(mapping_, size_);
+}
+
+void SharedFrameBuffer::Close() {
+  header_->closed.store(1, std::memory_order_release);
+  header_->frame_counter.fetch_add(1, std::memory_order_release);
+  Futex(&header_->frame_counter, FUTEX_WAKE, INT_MAX, nullptr);
+}
+
+uint8_t* SharedFrameBuffer::SlotPixels(uint32_t slot) const {
+  return static_cast<uint8_t*>(mapping_) + header_->slots_offset +
+         header_->slot_capacity * slot;
+}
+
+// ===== Producer =====
+
+uint32_t SharedFrameBuffer::ClaimBackSlot() const {
+  // The back slot is the one that is neither middle nor front. Read both until
+  // they are seen between consumer swaps.
+  for (;;) {
+    const uint32_t middle =
+        header_->middle.load(std::memory_order_acquire) & kFrameBufferSlotMask;
+    const uint32_t front = header_->front.load(std::memory_order_acquire);
+    const uint32_t again =
+        header_->middle.load(std::memory_order_acquire) & kFrameBufferSlotMask;
+    if (middle == again && middle != front && front < kFrameBufferSlots) {
+      return 3 - middle - front;
+    }
+  }
+}
+
+bool SharedFrameBuffer::Publish(const uint8_t* pixels, uint32_t width,
+                                uint32_t height, uint32_t stride,
+                                FramePixelFormat format) {
+  const uint32_t row_bytes = width * 4;
+  if (pixels == nullptr || width == 0 || height == 0 || stride < row_bytes ||
+      width > header_->max_width || height > header_->max_height) {
+    header_->frames_rejected.fetch_add(1, std::memory_order_relaxed);
+    return false;
+  }
+
+  if (back_ >= kFrameBufferSlots) {
+    // First frame from this producer: carry on from any earlier producer
+    back_ = ClaimBackSlot();
+    for (const FrameSlotHeader& slot : header_->slots) {
+      next_sequence_ = std::max(next_sequence_, slot.sequence + 1);
+    }
+  }
+
+  const uint64_t start = MonotonicNanoseconds();
+  uint8_t* dest = SlotPixels(back_);
+  if (format == FramePixelFormat::kRGBA8 && stride == row_bytes) {
+    memcpy(dest, pixels, static_cast<size_t>(row_bytes) * height);
+  } else {
+    for (uint32_t y = 0; y < height; ++y) {
+      const uint8_t* source = pixels + static_cast<size_t>(stride) * y;
+      uint8_t* row = dest + static_cast<size_t>(row_bytes) * y;
+      if (format == FramePixelFormat::kBGRA8) {
+        SwizzleRow(source, row, width);
+      } else {
+        memcpy(row, source, row_bytes);
+      }
+    }
+  }
+  const uint64_t end = MonotonicNanoseconds();
+
+  FrameSlotHeader& slot = header_->slots[back_];
+  slot.sequence = next_sequence_++;
+  slot.width = width;
+  slot.height = height;
+  slot.stride = row_bytes;
+  slot.copy_ns = end - start;
+  slot.publish_time_ns = end;
+
+  back_ = header_->middle.exchange(back_ | kFrameBufferFreshBit,
+                                   std::memory_order_acq_rel) &
+          kFrameBufferSlotMask;
+  header_->frames_published.fetch_add(1, std::memory_order_relaxed);
+
+  header_->frame_counter.fetch_add(1, std::memory_order_release);
+  if (header_->waiters.load(std::memory_order_acquire) != 0) {
+    Futex(&header_->frame_counter, FUTEX_WAKE, INT_MAX, nullptr);
+  }
+  return true;
+}
+
+// ===== Consumer =====
+
+bool SharedFrameBuffer::AcquireLatest(SharedFrame* frame) {
+  bool is_new = false;
+  if (header_->middle.load(std::memory_order_acquire) & kFrameBufferFreshBit) {
+    const uint32_t old_front = header_->front.load(std::memory_order_relaxed);
+    const uint32_t new_front =
+        header_->middle.exchange(old_front, std::memory_order_acq_rel) &
+        kFrameBufferSlotMask;
+    header_->front.store(new_front, std::memory_order_release);
+    is_new = true;
+  }
+
+  const uint32_t front = header_->front.load(std::memory_order_relaxed);
+  const FrameSlotHeader& slot = header_->slots[front];
+  if (slot.sequence == 0) {
+    return false;
+  }
+
+  if (is_new && slot.sequence != last_sequence_) {
+    if (slot.sequence > last_sequence_ + 1) {
+      frames_skipped_ += slot.sequence - last_sequence_ - 1;
+    }
+    last_sequence_ = slot.sequence;
+    ++frames_acquired_;
+    last_copy_ns_ = slot.copy_ns;
+    total_copy_ns_ += slot.copy_ns;
+    max_copy_ns_ = std::max(max_copy_ns_, slot.copy_ns);
+    const uint64_t now = MonotonicNanoseconds();
+    last_latency_ns_ =
+        now > slot.publish_time_ns ? now - slot.publish_time_ns : 0;
+  } else {
+    is_new = false;
+  }
+
+  frame->pixels = SlotPixels(front);
+  frame->width = slot.width;
+  frame->height = slot.height;
+  frame->stride = slot.stride;
+  frame->sequence = slot.sequence;
+  frame->copy_ns = slot.copy_ns;
+  frame->publish_time_ns = slot.publish_time_ns;
+  frame->is_new = is_new;
+  return true;
+}
+
+bool SharedFrameBuffer::WaitForFrame(uint32_t seen_counter, int timeout_ms) {
+  struct timespec timeout;
+  timeout.tv_sec = timeout_ms / 1000;
+  timeout.tv_nsec = static_cast<long>(timeout_ms % 1000) * 1000000;
+
+  header_->waiters.fetch_add(1, std::memory_order_acq_rel);
+  // Returns at once if the counter has already moved
+  Futex(&header_->frame_counter, FUTEX_WAIT, seen_counter, &timeout);
+  header_->waiters.fetch_sub(1, std::memory_order_acq_rel);
+
+  return !closed() && frame_counter() != seen_counter;
+}
+
+uint32_t SharedFrameBuffer::frame_counter() const {
+  return header_->frame_counter.load(std::memory_order_acquire);
+}
+
+bool SharedFrameBuffer::closed() const {
+  return header_->closed.load(std::memory_order_acquire) != 0;
+}
+
+FrameBufferStatistics SharedFrameBuffer::GetStatistics() const {
+  FrameBufferStatistics stats;
+  stats.frames_published =
+      header_->frames_published.load(std::memory_order_relaxed);
+  stats.frames_rejected =
+      header_->frames_rejected.load(std::memory_order_relaxed);
+  stats.frames_acquired = frames_acquired_;
+  stats.frames_skipped = frames_skipped_;
+  stats.last_sequence = last_sequence_;
+  stats.last_copy_ms = last_copy_ns_ / 1e6;
+  stats.average_copy_ms =
+      frames_acquired_ > 0 ? total_copy_ns_ / 1e6 / frames_acquired_ : 0;
+  stats.max_copy_ms = max_copy_ns_ / 1e6;
+  stats.last_latency_ms = last_latency_ns_ / 1e6;
+  return stats;
+}
+
+}  // namespace gameframework_unreal
@@ -0,0 +1,173 @@
+#ifndef FLUTTER_PLUGIN_UNREAL_FRAME_BUFFER_H_
+#define FLUTTER_PLUGIN_UNREAL_FRAME_BUFFER_H_
+
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <string>
+
+namespace gameframework_unreal {
+
+// Shared-memory frame transport between the Unreal engine process (producer)
+// and the Linux plugin (consumer).
+//
+// The segment holds a header, three slot headers and three pixel slots. The
+// producer fills its back slot and swaps it with the shared middle slot in one
+// atomic exchange; the consumer swaps its front slot with the middle slot when
+// the middle one holds a newer frame. Neither side waits for the other, and a
+// slot is never written while it is being read, so there is no tearing.
+//
+// The layout must match Private/Linux/FlutterSharedFrameBuffer.h in the Unreal
+// plugin.
+
+constexpr uint32_t kFrameBufferMagic = 0x42464647;  // "GFFB"
+constexpr uint32_t kFrameBufferVersion = 1;
+constexpr uint32_t kFrameBufferSlots = 3;
+
+// Set on the middle slot index when it holds a frame the consumer has not seen.
+constexpr uint32_t kFrameBufferFreshBit = 0x4;
+constexpr uint32_t kFrameBufferSlotMask = 0x3;
+
+// Pixel layout of frames handed to Publish(). Slots always hold RGBA.
+enum class FramePixelFormat : uint32_t {
+  kRGBA8 = 0,
+  kBGRA8 = 1,
+};
+
+struct FrameSlotHeader {
+  uint64_t sequence;         // 1 for the first frame, 0 if never written
+  uint32_t width;
+  uint32_t height;
+  uint32_t stride;           // bytes per row
+  uint32_t reserved;
+  uint64_t copy_ns;          // time the producer spent converting and copying
+  uint64_t publish_time_ns;  // CLOCK_MONOTONIC
+};
+
+struct FrameBufferHeader {
+  uint32_t magic;
+  uint32_t version;
+  uint32_t max_width;
+  uint32_t max_height;
+  uint64_t slot_capacity;     // bytes per pixel slot
+  uint64_t slots_offset;      // from the start of the segment, page aligned
+  std::atomic<uint32_t> middle;         // slot index, plus kFrameBufferFreshBit
+  std::atomic<uint32_t> front;          // slot the consumer holds
+  std::atomic<uint32_t> frame_counter;  // futex word, bumped on every publish
+  std::atomic<uint32_t> waiters;        // consumers blocked on frame_counter
+  std::atomic<uint32_t> closed;         // set when the owner goes away
+  uint32_t reserved;
+  std::atomic<uint64_t> frames_published;
+  std::atomic<uint64_t> frames_rejected;  // larger than the slots
+  FrameSlotHeader slots[kFrameBufferSlots];
+};
+
+// Both sides check the layout the same way
+static_assert(sizeof(FrameSlotHeader) == 40, "Frame slot header layout changed");
+static_assert(sizeof(FrameBufferHeader) == 192, "Frame buffer header layout changed");
+
+static_assert(ATOMIC_INT_LOCK_FREE == 2 && ATOMIC_LLONG_LOCK_FREE == 2,
+              "Shared atomics must not need a lock");
+
+// A frame as seen by the consumer. Pixels stay valid until the next
+// AcquireLatest() call.
+struct SharedFrame {
+  const uint8_t* pixels = nullptr;
+  uint32_t width = 0;
+  uint32_t height = 0;
+  uint32_t stride = 0;
+  uint64_t sequence = 0;
+  uint64_t copy_ns = 0;
+  uint64_t publish_time_ns = 0;
+  bool is_new = false;  // false if it is the frame returned last time
+};
+
+struct FrameBufferStatistics {
+  uint64_t frames_published = 0;
+  uint64_t frames_rejected = 0;
+  uint64_t frames_acquired = 0;   // distinct frames the consumer picked up
+  uint64_t frames_skipped = 0;    // published but replaced before pickup
+  uint64_t last_sequence = 0;
+  double last_copy_ms = 0;
+  double average_copy_ms = 0;     // over acquired frames
+  double max_copy_ms = 0;
+  double last_latency_ms = 0;     // publish to pickup
+};
+
+class SharedFrameBuffer {
+ public:
+  // Create the segment; the creator owns it and unlinks it when destroyed.
+  // Names follow shm_open(3), e.g. "/gameframework_unreal_1234".
+  static std::unique_ptr<SharedFrameBuffer> Create(const std::string& name,
+                                                   uint32_t max_width,
+                                                   uint32_t max_height,
+                                                   std::string* error);
+
+  // Map a segment created by another process (or another instance).
+  static std::unique_ptr<SharedFrameBuffer> Open(const std::string& name,
+                                                 std::string* error);
+
+  ~SharedFrameBuffer();
+
+  SharedFrameBuffer(const SharedFrameBuffer&) = delete;
+  SharedFrameBuffer& operator=(const SharedFrameBuffer&) = delete;
+
+  // Producer: copy a frame into the back slot and make it the latest.
+  // Returns false, without blocking, if the frame does not fit the slots.
+  bool Publish(const uint8_t* pixels, uint32_t width, uint32_t height,
+               uint32_t stride, FramePixelFormat format);
+
+  // Consumer: take the latest frame. Returns false until one is published.
+  bool AcquireLatest(SharedFrame* frame);
+
+  // Consumer: block until frame_counter() moves past |seen_counter|, the
+  // segment is closed or |timeout_ms| passes. Returns true for a new frame.
+  bool WaitForFrame(uint32_t seen_counter, int timeout_ms);
+
+  // Wake WaitForFrame() callers, e.g. before joining a watcher thread.
+  void Close();
+
+  uint32_t frame_counter() const;
+  bool closed() const;
+  uint32_t max_width() const { return header_->max_width; }
+  uint32_t max_height() const { return header_->max_height; }
+  const std::string& name() const { return name_; }
+
+  FrameBufferStatistics GetStatistics() const;
+
+  // Bytes needed for a segment able to hold frames up to the given size.
+  static size_t SegmentSize(uint32_t max_width, uint32_t max_height);
+
+ private:
+  SharedFrameBuffer(std::string name, void* mapping, size_t size, bool owner);
+
+  uint8_t* SlotPixels(uint32_t slot) const;
+  uint32_t ClaimBackSlot() const;
+
+  std::string name_;
+  void* mapping_;
+  size_t size_;
+  bool owner_;
+  FrameBufferHeader* header_;
+
+  // Producer state
+  uint32_t back_ = kFrameBufferSlots;
+  uint64_t next_sequence_ = 1;
+
+  // Consumer state
+  uint64_t last_sequence_ = 0;
+  uint64_t frames_acquired_ = 0;
+  uint64_t frames_skipped_ = 0;
+  uint64_t total_copy_ns_ = 0;
+  uint64_t max_copy_ns_ = 0;
+  uint64_t last_copy_ns_ = 0;
+  uint64_t last_latency_ns_ = 0;
+};
+
+// CLOCK_MONOTONIC in nanoseconds, comparable across processes.
+uint64_t MonotonicNanoseconds();
+
+}  // namespace gameframework_unreal
+
+#endif  // FLUTTER_PLUGIN_UNREAL_FRAME_BUFFER_H_
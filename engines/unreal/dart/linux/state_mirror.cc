@@ -0,0 +1,301 @@
+#include "state_mirror.h"
+
+#include <errno.h>
+#include <fcntl.h>
+#include <sched.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+
+#include <cstring>
+#include <new>
+#include <utility>
+
+#include "frame_buffer.h"
+
+namespace gameframework_unreal {
+
+namespace {
+
+// A write takes well under a microsecond, so a reader that keeps meeting one
+// is facing a writer that stopped half way
+constexpr int kMaxReadAttempts = 1000;
+
+void SetError(std::string* error, const std::string& message) {
+  if (error != nullptr) {
+    *error = message + ": " + strerror(errno);
+  }
+}
+
+}  // namespace
+
+double StateValue::as_double() const {
+  double value;
+  memcpy(&value, &bits, sizeof(value));
+  return value;
+}
+
+// ===== Setup =====
+
+std::unique_ptr<SharedStateMirror> SharedStateMirror::Create(
+    const std::string& name, std::string* error) {
+  // A segment left behind by a crashed process is replaced
+  shm_unlink(name.c_str());
+  const int fd = shm_open(name.c_str(), O_CREAT | O_EXCL | O_RDWR, 0600);
+  if (fd < 0) {
+    SetError(error, "shm_open(" + name + ") failed");
+    return nullptr;
+  }
+
+  if (ftruncate(fd, sizeof(StateMirrorHeader)) != 0) {
+    SetError(error, "ftruncate failed");
+    close(fd);
+    shm_unlink(name.c_str());
+    return nullptr;
+  }
+
+  void* mapping = mmap(nullptr, sizeof(StateMirrorHeader),
+                       PROT_READ | PROT_WRITE, MAP_SHARED, fd, 0);
+  close(fd);
+  if (mapping == MAP_FAILED) {
+    SetError(error, "mmap failed");
+    shm_unlink(name.c_str());
+    return nullptr;
+  }
+
+  // ftruncate zero-fills, so only the non-zero fields need setting
+  StateMirrorHeader* header = new (mapping) StateMirrorHeader();
+  header->capacity = kStateMirrorFields;
+  header->version = kStateMirrorVersion;
+  std::atomic_thread_fence(std::memory_order_release);
+  header->magic = kStateMirrorMagic;
+
+  return std::unique_ptr<SharedStateMirror>(
+      new SharedStateMirror(name, mapping, true));
+}
+
+std::unique_ptr<SharedStateMirror> SharedStateMirror::Open(
+    const std::string& name, std::string* error) {
+  const int fd = shm_open(name.c_str(), O_RDWR, 0);
+  if (fd < 0) {
+    SetError(error, "shm_open(" + name + ") failed");
+    return nullptr;
+  }
+
+  struct stat info;
+  if (fstat(fd, &info) != 0 ||
+      static_cast<size_t>(info.st_size) < sizeof(StateMirrorHeader)) {
+    errno = EINVAL;
+    SetError(error, "State mirror segment is too small");
+    close(fd);
+    return nullptr;
+  }
+
+  void* mapping = mmap(nullptr, sizeof(StateMirrorHeader),
+                       PROT_READ | PROT_WRITE, MAP_SHARED, fd, 0);
+  close(fd);
+  if (mapping == MAP_FAILED) {
+    SetError(error, "mmap failed");
+    return nullptr;
+  }
+
+  const StateMirrorHeader* header =
+      static_cast<const StateMirrorHeader*>(mapping);
+  if (header->magic != kStateMirrorMagic ||
+      header->version != kStateMirrorVersion ||
+      header->capacity != kStateMirrorFields) {
+    munmap(mapping, sizeof(StateMirrorHeader));
+    errno = EPROTO;
+    SetError(error, "Not a state mirror segment of version " +
+                        std::to_string(kStateMirrorVersion));
+    return nullptr;
+  }
+
+  return std::unique_ptr<SharedStateMirror>(
+      new SharedStateMirror(name, mapping, false));
+}
+
+SharedStateMirror::SharedStateMirror(std::string name, void* mapping,
+                                     bool owner)
+    : name_(std::move(name)),
+      mapping_(mapping),
+      owner_(owner),
+      header_(static_cast<StateMirrorHeader*>(mapping)) {
+  // Snapshots point into it, so it must never reallocate
+  field_names_.reserve(kStateMirrorFields);
+}
+
+SharedStateMirror::~SharedStateMirror() {
+  if (owner_) {
+    Close();
+    shm_unlink(name_.c_str());
+  }
+  munmap(mapping_, sizeof(StateMirrorHeader));
+}
+
+void SharedStateMirror::Close() {
+  header_->closed.store(1, std::memory_order_release);
+}
+
+bool SharedStateMirror::closed() const {
+  return header_->closed.load(std::memory_order_acquire) != 0;
+}
+
+// ===== Writer =====
+
+void SharedStateMirror::BeginWrite() {
+  if (write_depth_++ > 0) {
+    return;
+  }
+  // Still odd if the last writer died mid-write
+  const uint64_t sequence = header_->sequence.load(std::memory_order_relaxed);
+  if ((sequence & 1) == 0) {
+    header_->sequence.store(sequence + 1, std::memory_order_relaxed);
+  }
+  std::atomic_thread_fence(std::memory_order_release);
+}
+
+void SharedStateMirror::EndWrite() {
+  if (write_depth_ == 0 || --write_depth_ > 0) {
+    return;
+  }
+  header_->write_time_ns.store(MonotonicNanoseconds(),
+                               std::memory_order_relaxed);
+  header_->writes.fetch_add(1, std::memory_order_relaxed);
+  header_->sequence.store(
+      header_->sequence.load(std::memory_order_relaxed) + 1,
+      std::memory_order_release);
+}
+
+int SharedStateMirror::Declare(const char* name, StateFieldType type) {
+  auto it = writer_fields_.find(name);
+  if (it != writer_fields_.end()) {
+    return header_->fields[it->second].type == static_cast<uint32_t>(type)
+               ? it->second
+               : -1;
+  }
+
+  const size_t length = strlen(name);
+  if (length == 0 || length >= kStateFieldNameSize) {
+    return -1;
+  }
+
+  // Fields an earlier writer declared keep their place
+  const uint32_t count = header_->field_count.load(std::memory_order_acquire);
+  for (uint32_t i = 0; i < count; ++i) {
+    if (strcmp(header_->fields[i].name, name) == 0) {
+      writer_fields_.emplace(name, static_cast<int>(i));
+      return header_->fields[i].type == static_cast<uint32_t>(type)
+                 ? static_cast<int>(i)
+                 : -1;
+    }
+  }
+  if (count >= kStateMirrorFields) {
+    return -1;
+  }
+
+  StateField& field = header_->fields[count];
+  memcpy(field.name, name, length + 1);
+  field.type = static_cast<uint32_t>(type);
+  field.value.store(0, std::memory_order_relaxed);
+  // Readers look at a field's name and type only below field_count
+  header_->field_count.store(count + 1, std::memory_order_release);
+  writer_fields_.emplace(name, static_cast<int>(count));
+  return static_cast<int>(count);
+}
+
+bool SharedStateMirror::Set(const char* name, StateFieldType type,
+                            uint64_t bits) {
+  if (name == nullptr) {
+    return false;
+  }
+  BeginWrite();
+  const int index = Declare(name, type);
+  if (index >= 0) {
+    header_->fields[index].value.store(bits, std::memory_order_relaxed);
+  }
+  EndWrite();
+  return index >= 0;
+}
+
+bool SharedStateMirror::SetInt(const char* name, int64_t value) {
+  return Set(name, StateFieldType::kInt, static_cast<uint64_t>(value));
+}
+
+bool SharedStateMirror::SetDouble(const char* name, double value) {
+  uint64_t bits;
+  memcpy(&bits, &value, sizeof(bits));
+  return Set(name, StateFieldType::kDouble, bits);
+}
+
+bool SharedStateMirror::SetBool(const char* name, bool value) {
+  return Set(name, StateFieldType::kBool, value ? 1 : 0);
+}
+
+// ===== Reader =====
+
+bool SharedStateMirror::Read(StateSnapshot* snapshot) {
+  uint64_t values[kStateMirrorFields];
+  for (int attempt = 0; attempt < kMaxReadAttempts; ++attempt) {
+    if (attempt > 0) {
+      ++read_retries_;
+      sched_yield();
+    }
+
+    const uint64_t before = header_->sequence.load(std::memory_order_acquire);
+    if (before & 1) {
+      continue;
+    }
+    uint32_t count = header_->field_count.load(std::memory_order_acquire);
+    if (count > kStateMirrorFields) {
+      count = kStateMirrorFields;
+    }
+    for (uint32_t i = 0; i < count; ++i) {
+      values[i] = header_->fields[i].value.load(std::memory_order_relaxed);
+    }
+    const uint64_t write_time_ns =
+        header_->write_time_ns.load(std::memory_order_relaxed);
+    std::atomic_thread_fence(std::memory_order_acquire);
+    if (header_->sequence.load(std::memory_order_relaxed) != before) {
+      continue;
+    }
+
+    // Names never change once declared, so they are copied once
+    for (uint32_t i = field_names_.size(); i < count; ++i) {
+      const StateField& field = header_->fields[i];
+      field_names_.emplace_back(field.name,
+                                strnlen(field.name, kStateFieldNameSize));
+    }
+
+    ++reads_;
+    snapshot->version = before / 2;
+    snapshot->write_time_ns = write_time_ns;
+    snapshot->fields.resize(count);
+    for (uint32_t i = 0; i < count; ++i) {
+      StateValue& value = snapshot->fields[i];
+      value.name = &field_names_[i];
+      value.type = static_cast<StateFieldType>(header_->fields[i].type);
+      value.bits = values[i];
+    }
+    return true;
+  }
+
+  ++reads_failed_;
+  return false;
+}
+
+uint64_t SharedStateMirror::version() const {
+  return header_->sequence.load(std::memory_order_acquire) / 2;
+}
+
+StateMirrorStatistics SharedStateMirror::GetStatistics() const {
+  StateMirrorStatistics stats;
+  stats.writes = header_->writes.load(std::memory_order_relaxed);
+  stats.reads = reads_;
+  stats.read_retries = read_retries_;
+  stats.reads_failed = reads_failed_;
+  stats.fields = header_->field_count.load(std::memory_order_relaxed);
+  return stats;
+}
+
+}  // namespace gameframework_unreal
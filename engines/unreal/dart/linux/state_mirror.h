@@ -0,0 +1,155 @@
+#ifndef FLUTTER_PLUGIN_UNREAL_STATE_MIRROR_H_
+#define FLUTTER_PLUGIN_UNREAL_STATE_MIRROR_H_
+
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <string>
+#include <unordered_map>
+#include <vector>
+
+namespace gameframework_unreal {
+
+// Shared-memory mirror of game state the Flutter UI shows every frame (score,
+// level, health). The Unreal engine process writes named, typed fields; the
+// Linux plugin reads them whenever Flutter asks, without a message either way.
+//
+// Writes are guarded by a seqlock: the writer makes |sequence| odd, stores the
+// values and makes it even again, and a reader retries until it copied the
+// values between two equal, even reads of |sequence|. Readers never block the
+// writer, and every field of a snapshot comes from the same write. A field's
+// name and type are fixed when the writer declares it and published through
+// |field_count|, so only values change under the seqlock.
+//
+// The layout must match Private/Linux/FlutterSharedStateMirror.h in the Unreal
+// plugin.
+
+constexpr uint32_t kStateMirrorMagic = 0x4D534647;  // "GFSM"
+constexpr uint32_t kStateMirrorVersion = 1;
+constexpr uint32_t kStateMirrorFields = 64;
+constexpr uint32_t kStateFieldNameSize = 48;  // including the NUL
+
+enum class StateFieldType : uint32_t {
+  kNone = 0,
+  kInt = 1,     // int64
+  kDouble = 2,  // IEEE double bits
+  kBool = 3,    // 0 or 1
+};
+
+struct StateField {
+  char name[kStateFieldNameSize];
+  uint32_t type;  // StateFieldType
+  uint32_t reserved;
+  std::atomic<uint64_t> value;
+};
+
+struct StateMirrorHeader {
+  uint32_t magic;
+  uint32_t version;
+  uint32_t capacity;                   // fields
+  std::atomic<uint32_t> field_count;   // declared fields
+  std::atomic<uint64_t> sequence;      // odd while a write is in progress
+  std::atomic<uint64_t> write_time_ns;  // CLOCK_MONOTONIC, last write
+  std::atomic<uint64_t> writes;
+  std::atomic<uint32_t> closed;        // set when the owner goes away
+  uint32_t reserved;
+  uint64_t reserved2[2];
+  StateField fields[kStateMirrorFields];
+};
+
+// Both sides check the layout the same way
+static_assert(sizeof(StateField) == 64, "State field layout changed");
+static_assert(sizeof(StateMirrorHeader) == 64 + 64 * kStateMirrorFields,
+              "State mirror header layout changed");
+
+struct StateValue {
+  const std::string* name = nullptr;  // valid while the mirror is
+  StateFieldType type = StateFieldType::kNone;
+  uint64_t bits = 0;
+
+  int64_t as_int() const { return static_cast<int64_t>(bits); }
+  double as_double() const;
+  bool as_bool() const { return bits != 0; }
+};
+
+struct StateSnapshot {
+  uint64_t version = 0;  // completed writes; 0 before the first
+  uint64_t write_time_ns = 0;
+  std::vector<StateValue> fields;  // in declaration order
+};
+
+struct StateMirrorStatistics {
+  uint64_t writes = 0;
+  uint64_t reads = 0;
+  uint64_t read_retries = 0;  // reads that overlapped a write and went again
+  uint64_t reads_failed = 0;  // gave up on a write that did not finish
+  uint32_t fields = 0;
+};
+
+class SharedStateMirror {
+ public:
+  // Create the segment; the creator owns it and unlinks it when destroyed.
+  // Names follow shm_open(3), e.g. "/gameframework_unreal_state_1234".
+  static std::unique_ptr<SharedStateMirror> Create(const std::string& name,
+                                                   std::string* error);
+
+  // Map a segment created by another process (or another instance).
+  static std::unique_ptr<SharedStateMirror> Open(const std::string& name,
+                                                 std::string* error);
+
+  ~SharedStateMirror();
+
+  SharedStateMirror(const SharedStateMirror&) = delete;
+  SharedStateMirror& operator=(const SharedStateMirror&) = delete;
+
+  // Writer: fields set between BeginWrite() and EndWrite() are published
+  // together. A Set* call outside them is a write of its own. One writer at a
+  // time.
+  void BeginWrite();
+  void EndWrite();
+
+  // Writer: declare the field on first use. False if |name| is empty or too
+  // long, was declared with another type, or the mirror is full.
+  bool SetInt(const char* name, int64_t value);
+  bool SetDouble(const char* name, double value);
+  bool SetBool(const char* name, bool value);
+
+  // Reader: copy every field. False if a write did not finish in time, as
+  // when the writer died in the middle of one.
+  bool Read(StateSnapshot* snapshot);
+
+  // Reader: completed writes so far; cheap, for skipping unchanged reads.
+  uint64_t version() const;
+
+  void Close();
+  bool closed() const;
+  const std::string& name() const { return name_; }
+
+  StateMirrorStatistics GetStatistics() const;
+
+ private:
+  SharedStateMirror(std::string name, void* mapping, bool owner);
+
+  bool Set(const char* name, StateFieldType type, uint64_t bits);
+  int Declare(const char* name, StateFieldType type);
+
+  std::string name_;
+  void* mapping_;
+  bool owner_;
+  StateMirrorHeader* header_;
+
+  // Writer state
+  std::unordered_map<std::string, int> writer_fields_;
+  int write_depth_ = 0;
+
+  // Reader state
+  std::vector<std::string> field_names_;
+  uint64_t reads_ = 0;
+  uint64_t read_retries_ = 0;
+  uint64_t reads_failed_ = 0;
+};
+
+}  // namespace gameframework_unreal
+
+#endif  // FLUTTER_PLUGIN_UNREAL_STATE_MIRROR_H_
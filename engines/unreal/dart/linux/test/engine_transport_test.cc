@@ -0,0 +1,623 @@
+#include <gtest/gtest.h>
+#include <sys/socket.h>
+#include <sys/un.h>
+#include <unistd.h>
+
+#include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <condition_variable>
+#include <cstdio>
+#include <cstring>
+#include <deque>
+#include <mutex>
+#include <string>
+#include <thread>
+#include <vector>
+
+#include "engine_transport.h"
+
+// Counts heap allocations on all threads but the stand-in engine's, for the
+// allocations-per-message figures. glibc only, and not under sanitizers,
+// which bring their own allocator.
+#if defined(__GLIBC__) && !defined(__SANITIZE_ADDRESS__) && \
+    !defined(__SANITIZE_THREAD__)
+#define GAMEFRAMEWORK_COUNT_ALLOCATIONS 1
+namespace {
+std::atomic<uint64_t> g_allocations{0};
+thread_local bool g_count_allocations = true;
+
+void CountAllocation() {
+  if (g_count_allocations) {
+    g_allocations.fetch_add(1, std::memory_order_relaxed);
+  }
+}
+}  // namespace
+
+extern "C" {
+void* __libc_malloc(size_t size);
+void* __libc_calloc(size_t count, size_t size);
+void* __libc_realloc(void* pointer, size_t size);
+
+void* malloc(size_t size) {
+  CountAllocation();
+  return __libc_malloc(size);
+}
+
+void* calloc(size_t count, size_t size) {
+  CountAllocation();
+  return __libc_calloc(count, size);
+}
+
+void* realloc(void* pointer, size_t size) {
+  CountAllocation();
+  return __libc_realloc(pointer, size);
+}
+}
+#endif
+
+// The transport is exercised against a stand-in for the engine process: a
+// thread that connects to the plugin's socket and answers like the Unreal
+// side does (Private/Linux/FlutterSocketConnection.cpp).
+
+namespace gameframework_unreal {
+namespace test {
+
+namespace {
+
+std::string SocketPath(const char* test) {
+  return "/tmp/gameframework_unreal_test_" + std::to_string(getpid()) + "_" +
+         test + ".sock";
+}
+
+// Collects dispatched callbacks; the test thread plays the GTK main loop.
+class TaskQueue {
+ public:
+  EngineTransport::Dispatcher dispatcher() {
+    return [this](EngineTransport::Task task) {
+      std::lock_guard<std::mutex> lock(mutex_);
+      tasks_.push_back(std::move(task));
+      ready_.notify_one();
+    };
+  }
+
+  // Runs tasks until |done| holds or five seconds pass.
+  template <typename Predicate>
+  bool RunUntil(Predicate done) {
+    const auto deadline =
+        std::chrono::steady_clock::now() + std::chrono::seconds(5);
+    while (!done()) {
+      std::unique_lock<std::mutex> lock(mutex_);
+      if (!ready_.wait_until(lock, deadline, [this] { return !tasks_.empty(); })) {
+        return false;
+      }
+      EngineTransport::Task task = std::move(tasks_.front());
+      tasks_.pop_front();
+      lock.unlock();
+      task();
+    }
+    return true;
+  }
+
+ private:
+  std::mutex mutex_;
+  std::condition_variable ready_;
+  std::deque<EngineTransport::Task> tasks_;
+};
+
+class StandInEngine {
+ public:
+  explicit StandInEngine(const std::string& path) {
+    fd_ = socket(AF_UNIX, SOCK_STREAM | SOCK_CLOEXEC, 0);
+    struct sockaddr_un address = {};
+    address.sun_family = AF_UNIX;
+    strncpy(address.sun_path, path.c_str(), sizeof(address.sun_path) - 1);
+    connected_ = connect(fd_, reinterpret_cast<struct sockaddr*>(&address),
+                         sizeof(address)) == 0;
+    if (connected_) {
+      thread_ = std::thread(&StandInEngine::Run, this);
+    }
+  }
+
+  ~StandInEngine() { Disconnect(); }
+
+  bool connected() const { return connected_; }
+
+  // kSendMessage / kSendJsonMessage frames received, answered or not
+  uint64_t messages() const { return messages_.load(); }
+
+  void Disconnect() {
+    if (fd_ >= 0) {
+      shutdown(fd_, SHUT_RDWR);
+    }
+    if (thread_.joinable()) {
+      thread_.join();
+    }
+    if (fd_ >= 0) {
+      close(fd_);
+      fd_ = -1;
+    }
+  }
+
+  void SendEvent(const std::string& target, const std::string& method,
+                 const std::string& data) {
+    Send(EncodeFrame(FrameType::kEvent, EngineOp::kMessage, 0,
+                     EncodeStrings({target, method, data})));
+  }
+
+ private:
+  void Send(const std::string& frame) {
+    std::lock_guard<std::mutex> lock(write_mutex_);
+    size_t offset = 0;
+    while (offset < frame.size()) {
+      const ssize_t count = send(fd_, frame.data() + offset,
+                                 frame.size() - offset, MSG_NOSIGNAL);
+      if (count <= 0) {
+        return;
+      }
+      offset += static_cast<size_t>(count);
+    }
+  }
+
+  void Respond(const TransportFrame& request, FrameType type,
+               const std::string& payload) {
+    // Posted frames are not answered
+    if (request.request_id == 0) {
+      return;
+    }
+    Send(EncodeFrame(type, request.op, request.request_id, payload));
+  }
+
+  void Run() {
+#ifdef GAMEFRAMEWORK_COUNT_ALLOCATIONS
+    g_count_allocations = false;
+#endif
+    FrameReader reader;
+    std::vector<char> buffer(256 * 1024);
+    std::vector<TransportFrame> held_levels;
+    for (;;) {
+      const ssize_t count = read(fd_, buffer.data(), buffer.size());
+      if (count <= 0) {
+        return;
+      }
+      reader.Append(buffer.data(), static_cast<size_t>(count));
+
+      TransportFrame frame;
+      while (reader.Next(&frame)) {
+        std::vector<std::string> strings;
+        DecodeStrings(frame.payload, &strings);
+        switch (frame.op) {
+          case EngineOp::kPing:
+            Respond(frame, FrameType::kResponse, frame.payload);
+            break;
+          case EngineOp::kSendMessage:
+          case EngineOp::kSendJsonMessage:
+            messages_++;
+            if (strings.size() == 3 && strings[1] == "echo") {
+              SendEvent(strings[0], strings[1], strings[2]);
+            }
+            Respond(frame, FrameType::kResponse, "");
+            break;
+          case EngineOp::kExecuteConsoleCommand:
+            if (strings.size() == 1 && strings[0] == "fail") {
+              Respond(frame, FrameType::kError, "Unknown command");
+            } else if (strings.size() == 1 && strings[0] != "hang") {
+              Respond(frame, FrameType::kResponse, "");
+            }
+            break;
+          case EngineOp::kLoadLevel:
+            // Answered three at a time in reverse order, as a real engine
+            // finishing loads out of order would
+            held_levels.push_back(frame);
+            if (held_levels.size() == 3) {
+              for (auto it = held_levels.rbegin(); it != held_levels.rend();
+                   ++it) {
+                std::vector<std::string> level;
+                DecodeStrings(it->payload, &level);
+                Respond(*it, FrameType::kResponse, level.at(0));
+              }
+              held_levels.clear();
+            }
+            break;
+          default:
+            Respond(frame, FrameType::kError, "Unsupported");
+            break;
+        }
+      }
+    }
+  }
+
+  int fd_ = -1;
+  bool connected_ = false;
+  std::atomic<uint64_t> messages_{0};
+  std::thread thread_;
+  std::mutex write_mutex_;
+};
+
+struct Harness {
+  explicit Harness(const char* test) {
+    std::string error;
+    transport = EngineTransport::Listen(
+        SocketPath(test), queue.dispatcher(),
+        [this](EngineOp op, const std::string& payload) {
+          std::vector<std::string> strings;
+          DecodeStrings(payload, &strings);
+          events.push_back(strings);
+        },
+        &error);
+    EXPECT_NE(transport, nullptr) << error;
+  }
+
+  bool ConnectEngine() {
+    engine = std::make_unique<StandInEngine>(transport->path());
+    const auto deadline =
+        std::chrono::steady_clock::now() + std::chrono::seconds(5);
+    while (!transport->connected() &&
+           std::chrono::steady_clock::now() < deadline) {
+      std::this_thread::sleep_for(std::chrono::milliseconds(1));
+    }
+    return engine->connected() && transport->connected();
+  }
+
+  TaskQueue queue;
+  std::vector<std::vector<std::string>> events;
+  std::unique_ptr<EngineTransport> transport;
+  std::unique_ptr<StandInEngine> engine;
+};
+
+struct Result {
+  bool done = false;
+  bool ok = false;
+  std::string payload;
+
+  EngineTransport::ResponseCallback callback() {
+    return [this](bool result_ok, const std::string& result_payload) {
+      done = true;
+      ok = result_ok;
+      payload = result_payload;
+    };
+  }
+};
+
+double Percentile(std::vector<double> values, double fraction) {
+  std::sort(values.begin(), values.end());
+  return values[static_cast<size_t>(fraction * (values.size() - 1))];
+}
+
+}  // namespace
+
+TEST(EngineTransport, FrameReaderHandlesAnySplit) {
+  const std::string stream =
+      EncodeFrame(FrameType::kRequest, EngineOp::kPing, 7, "hello") +
+      EncodeFrame(FrameType::kEvent, EngineOp::kMessage, 0,
+                  EncodeStrings({"Target", "Method", ""}));
+
+  // One byte at a time
+  FrameReader reader;
+  std::vector<TransportFrame> frames;
+  for (char byte : stream) {
+    reader.Append(&byte, 1);
+    TransportFrame frame;
+    while (reader.Next(&frame)) {
+      frames.push_back(frame);
+    }
+  }
+  ASSERT_EQ(frames.size(), 2u);
+  EXPECT_EQ(frames[0].type, FrameType::kRequest);
+  EXPECT_EQ(frames[0].request_id, 7u);
+  EXPECT_EQ(frames[0].payload, "hello");
+  std::vector<std::string> strings;
+  ASSERT_TRUE(DecodeStrings(frames[1].payload, &strings));
+  EXPECT_EQ(strings, (std::vector<std::string>{"Target", "Method", ""}));
+
+  // A length below the header size means the stream is corrupt
+  FrameReader corrupt;
+  const char garbage[8] = {2, 0, 0, 0, 0, 0, 0, 0};
+  corrupt.Append(garbage, sizeof(garbage));
+  TransportFrame frame;
+  EXPECT_FALSE(corrupt.Next(&frame));
+  EXPECT_TRUE(corrupt.error());
+
+  EXPECT_FALSE(DecodeStrings(std::string("\x05\0\0\0abc", 7), &strings));
+}
+
+TEST(EngineTransport, FailsRequestsWithoutAnEngine) {
+  Harness harness("unconnected");
+  ASSERT_NE(harness.transport, nullptr);
+
+  Result result;
+  harness.transport->Request(EngineOp::kPing, "x", 1000, result.callback());
+  ASSERT_TRUE(harness.queue.RunUntil([&] { return result.done; }));
+  EXPECT_FALSE(result.ok);
+  EXPECT_EQ(harness.transport->GetStatistics().requests_failed, 1u);
+}
+
+TEST(EngineTransport, CorrelatesOutOfOrderResponses) {
+  Harness harness("correlate");
+  ASSERT_TRUE(harness.ConnectEngine());
+
+  Result results[3];
+  const char* levels[3] = {"MainMenu", "Arena", "Credits"};
+  for (int i = 0; i < 3; ++i) {
+    harness.transport->Request(EngineOp::kLoadLevel, EncodeStrings({levels[i]}),
+                               5000, results[i].callback());
+  }
+  ASSERT_TRUE(harness.queue.RunUntil([&] {
+    return results[0].done && results[1].done && results[2].done;
+  }));
+  for (int i = 0; i < 3; ++i) {
+    EXPECT_TRUE(results[i].ok);
+    EXPECT_EQ(results[i].payload, levels[i]);
+  }
+}
+
+TEST(EngineTransport, DeliversEventsAndErrors) {
+  Harness harness("events");
+  ASSERT_TRUE(harness.ConnectEngine());
+
+  Result sent;
+  harness.transport->Request(EngineOp::kSendMessage,
+                             EncodeStrings({"GameManager", "echo", "{}"}),
+                             5000, sent.callback());
+  Result failed;
+  harness.transport->Request(EngineOp::kExecuteConsoleCommand,
+                             EncodeStrings({"fail"}), 5000, failed.callback());
+  ASSERT_TRUE(harness.queue.RunUntil([&] {
+    return sent.done && failed.done && !harness.events.empty();
+  }));
+
+  EXPECT_TRUE(sent.ok);
+  EXPECT_FALSE(failed.ok);
+  EXPECT_EQ(failed.payload, "Unknown command");
+  EXPECT_EQ(harness.events[0],
+            (std::vector<std::string>{"GameManager", "echo", "{}"}));
+
+  const TransportStatistics stats = harness.transport->GetStatistics();
+  EXPECT_EQ(stats.responses_received, 1u);
+  EXPECT_EQ(stats.errors_received, 1u);
+  EXPECT_EQ(stats.events_received, 1u);
+}
+
+TEST(EngineTransport, TimeoutsAndDisconnectsFailPendingRequests) {
+  Harness harness("timeouts");
+  ASSERT_TRUE(harness.ConnectEngine());
+
+  Result timed_out;
+  harness.transport->Request(EngineOp::kExecuteConsoleCommand,
+                             EncodeStrings({"hang"}), 20,
+                             timed_out.callback());
+  ASSERT_TRUE(harness.queue.RunUntil([&] { return timed_out.done; }));
+  EXPECT_FALSE(timed_out.ok);
+  EXPECT_EQ(timed_out.payload, "Engine did not respond in time");
+
+  Result dropped;
+  harness.transport->Request(EngineOp::kExecuteConsoleCommand,
+                             EncodeStrings({"hang"}), 60000,
+                             dropped.callback());
+  harness.engine->Disconnect();
+  ASSERT_TRUE(harness.queue.RunUntil([&] { return dropped.done; }));
+  EXPECT_FALSE(dropped.ok);
+  EXPECT_EQ(dropped.payload, "Engine disconnected");
+  EXPECT_EQ(harness.transport->GetStatistics().pending_requests, 0u);
+
+  // A restarted engine gets a fresh connection
+  ASSERT_TRUE(harness.ConnectEngine());
+  Result after;
+  harness.transport->Request(EngineOp::kPing, "again", 5000, after.callback());
+  ASSERT_TRUE(harness.queue.RunUntil([&] { return after.done; }));
+  EXPECT_TRUE(after.ok);
+  EXPECT_EQ(harness.transport->GetStatistics().connections, 2u);
+}
+
+TEST(EngineTransport, CountsPostedFrames) {
+  const std::string message =
+      EncodeFrame(FrameType::kRequest, EngineOp::kSendMessage, 0,
+                  EncodeStrings({"GameManager", "Move", "1,2"}));
+  const std::string json =
+      EncodeFrame(FrameType::kRequest, EngineOp::kSendJsonMessage, 0,
+                  EncodeStrings({"GameManager", "State", "{}"}));
+  const std::string batch = message + json + message;
+  EXPECT_EQ(CountPostedFrames(batch.data(), batch.size()), 3u);
+  EXPECT_EQ(CountPostedFrames(message.data(), message.size()), 1u);
+
+  // Empty, cut short, answerable, or an op that needs an answer
+  EXPECT_EQ(CountPostedFrames(batch.data(), 0), 0u);
+  EXPECT_EQ(CountPostedFrames(batch.data(), batch.size() - 1), 0u);
+  const std::string with_id =
+      EncodeFrame(FrameType::kRequest, EngineOp::kSendMessage, 9, "");
+  EXPECT_EQ(CountPostedFrames(with_id.data(), with_id.size()), 0u);
+  const std::string load =
+      EncodeFrame(FrameType::kRequest, EngineOp::kLoadLevel, 0, "");
+  EXPECT_EQ(CountPostedFrames(load.data(), load.size()), 0u);
+  const std::string event =
+      EncodeFrame(FrameType::kEvent, EngineOp::kSendMessage, 0, "");
+  EXPECT_EQ(CountPostedFrames(event.data(), event.size()), 0u);
+}
+
+TEST(EngineTransport, PostsBorrowedFramesWithoutAnswers) {
+  Harness harness("post");
+  std::atomic<int> released{0};
+  auto release = [](void* context) {
+    static_cast<std::atomic<int>*>(context)->fetch_add(1);
+  };
+
+  const std::string frames =
+      EncodeFrame(FrameType::kRequest, EngineOp::kSendMessage, 0,
+                  EncodeStrings({"GameManager", "Move", "1,2"})) +
+      EncodeFrame(FrameType::kRequest, EngineOp::kSendJsonMessage, 0,
+                  EncodeStrings({"GameManager", "echo", "{}"}));
+
+  // Dropped, and handed back, without an engine
+  EXPECT_FALSE(harness.transport->Post(
+      OutgoingBytes(frames.data(), frames.size(), release, &released), 2));
+  EXPECT_EQ(released.load(), 1);
+
+  ASSERT_TRUE(harness.ConnectEngine());
+  for (int i = 0; i < 10; ++i) {
+    EXPECT_TRUE(harness.transport->Post(
+        OutgoingBytes(frames.data(), frames.size(), release, &released), 2));
+  }
+  ASSERT_TRUE(harness.queue.RunUntil(
+      [&] { return harness.events.size() == 10; }));
+  EXPECT_EQ(harness.engine->messages(), 20u);
+
+  // Every buffer is handed back once written
+  const auto deadline =
+      std::chrono::steady_clock::now() + std::chrono::seconds(5);
+  while (released.load() < 11 && std::chrono::steady_clock::now() < deadline) {
+    std::this_thread::sleep_for(std::chrono::milliseconds(1));
+  }
+  EXPECT_EQ(released.load(), 11);
+
+  const TransportStatistics stats = harness.transport->GetStatistics();
+  EXPECT_EQ(stats.messages_posted, 20u);
+  EXPECT_EQ(stats.requests_sent, 0u);
+  EXPECT_EQ(stats.pending_requests, 0u);
+}
+
+// Not a pass/fail benchmark: prints messages per second and heap allocations
+// per message for a 64 byte engine message sent as a request, the way
+// engine#sendMessage on the method channel does, and posted on the raw
+// message lane. The request figures leave out FlStandardMethodCodec and
+// FlValue, which the method channel adds on top.
+TEST(EngineTransport, ReportsMessageLaneThroughput) {
+  Harness harness("lane");
+  ASSERT_TRUE(harness.ConnectEngine());
+  using Clock = std::chrono::steady_clock;
+  constexpr int kMessages = 100000;
+  const std::string data(64, 'd');
+
+  auto allocations = [] {
+#ifdef GAMEFRAMEWORK_COUNT_ALLOCATIONS
+    return g_allocations.load();
+#else
+    return uint64_t{0};
+#endif
+  };
+
+  // Requests, answered by the engine
+  int completed = 0;
+  uint64_t allocations_before = allocations();
+  auto start = Clock::now();
+  for (int i = 0; i < kMessages; ++i) {
+    harness.transport->Request(
+        EngineOp::kSendMessage, EncodeStrings({"GameManager", "Move", data}),
+        10000, [&completed](bool ok, const std::string&) { completed++; });
+  }
+  ASSERT_TRUE(harness.queue.RunUntil([&] { return completed == kMessages; }));
+  const double request_seconds =
+      std::chrono::duration<double>(Clock::now() - start).count();
+  const double request_allocations =
+      static_cast<double>(allocations() - allocations_before) / kMessages;
+
+  // Posted, one buffer per message as the plugin receives them; the release
+  // stands in for g_bytes_unref
+  std::atomic<int> released{0};
+  const std::string frame =
+      EncodeFrame(FrameType::kRequest, EngineOp::kSendMessage, 0,
+                  EncodeStrings({"GameManager", "Move", data}));
+  const uint64_t engine_before = harness.engine->messages();
+  allocations_before = allocations();
+  start = Clock::now();
+  for (int i = 0; i < kMessages; ++i) {
+    harness.transport->Post(
+        OutgoingBytes(frame.data(), frame.size(),
+                      [](void* context) {
+                        static_cast<std::atomic<int>*>(context)->fetch_add(
+                            1, std::memory_order_release);
+                      },
+                      &released),
+        1);
+  }
+  const auto deadline = Clock::now() + std::chrono::seconds(10);
+  while ((harness.engine->messages() - engine_before < kMessages ||
+          released.load(std::memory_order_acquire) < kMessages) &&
+         Clock::now() < deadline) {
+    std::this_thread::yield();
+  }
+  const double post_seconds =
+      std::chrono::duration<double>(Clock::now() - start).count();
+  const double post_allocations =
+      static_cast<double>(allocations() - allocations_before) / kMessages;
+  EXPECT_EQ(harness.engine->messages() - engine_before,
+            static_cast<uint64_t>(kMessages));
+
+  printf("  request: %.0f messages/s, %.2f allocations/message\n",
+         kMessages / request_seconds, request_allocations);
+  printf("  posted:  %.0f messages/s, %.2f allocations/message\n",
+         kMessages / post_seconds, post_allocations);
+}
+
+// Not a pass/fail benchmark: prints round-trip latency and throughput for
+// small and 1 MB messages on this machine.
+TEST(EngineTransport, ReportsLatencyAndThroughput) {
+  Harness harness("throughput");
+  ASSERT_TRUE(harness.ConnectEngine());
+  using Clock = std::chrono::steady_clock;
+
+  auto measure = [&](const std::string& payload, int count, bool pipelined,
+                     std::vector<double>* latencies_us) {
+    int completed = 0;
+    int failed = 0;
+    const auto start = Clock::now();
+    auto send_one = [&] {
+      const auto sent_at = Clock::now();
+      harness.transport->Request(
+          EngineOp::kPing, payload, 10000,
+          [&, sent_at](bool ok, const std::string& echoed) {
+            if (!ok || echoed.size() != payload.size()) {
+              failed++;
+            }
+            completed++;
+            latencies_us->push_back(
+                std::chrono::duration<double, std::micro>(Clock::now() -
+                                                          sent_at)
+                    .count());
+          });
+    };
+    if (pipelined) {
+      for (int i = 0; i < count; ++i) {
+        send_one();
+      }
+      EXPECT_TRUE(harness.queue.RunUntil([&] { return completed == count; }));
+    } else {
+      for (int i = 0; i < count; ++i) {
+        send_one();
+        EXPECT_TRUE(harness.queue.RunUntil([&] { return completed == i + 1; }));
+      }
+    }
+    EXPECT_EQ(failed, 0);
+    return std::chrono::duration<double>(Clock::now() - start).count();
+  };
+
+  const std::string small(64, 's');
+  const std::string large(1024 * 1024, 'L');
+
+  std::vector<double> small_latency;
+  measure(small, 2000, false, &small_latency);
+  std::vector<double> small_pipelined;
+  const double small_seconds = measure(small, 20000, true, &small_pipelined);
+
+  std::vector<double> large_latency;
+  const double large_seconds = measure(large, 100, false, &large_latency);
+  std::vector<double> large_pipelined;
+  const double large_pipelined_seconds =
+      measure(large, 100, true, &large_pipelined);
+
+  printf("  64 B  round trip: p50 %.1f us, p99 %.1f us\n",
+         Percentile(small_latency, 0.5), Percentile(small_latency, 0.99));
+  printf("  64 B  pipelined:  %.0f messages/s\n", 20000 / small_seconds);
+  printf("  1 MB  round trip: p50 %.2f ms, p99 %.2f ms (%.0f MB/s each way)\n",
+         Percentile(large_latency, 0.5) / 1000,
+         Percentile(large_latency, 0.99) / 1000, 100 / large_seconds);
+  printf("  1 MB  pipelined:  %.0f MB/s each way\n",
+         100 / large_pipelined_seconds);
+
+  RecordProperty("small_p50_us",
+                 std::to_string(Percentile(small_latency, 0.5)));
+  RecordProperty("large_p50_us",
+                 std::to_string(Percentile(large_latency, 0.5)));
+}
+
+}  // namespace test
+}  // namespace gameframework_unreal
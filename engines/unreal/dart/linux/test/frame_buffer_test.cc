@@ -0,0 +1,271 @@
+#include <gtest/gtest.h>
+#include <unistd.h>
+
+#include <atomic>
+#include <chrono>
+#include <cstring>
+#include <string>
+#include <thread>
+#include <vector>
+
+#include "frame_buffer.h"
+
+// Producer and consumer each map the segment separately, as the engine and
+// the plugin do from their own processes.
+
+namespace gameframework_unreal {
+namespace test {
+
+namespace {
+
+std::string SegmentName(const char* test) {
+  return "/gameframework_unreal_test_" + std::to_string(getpid()) + "_" + test;
+}
+
+std::vector<uint8_t> SolidFrame(uint32_t width, uint32_t height,
+                                uint32_t value) {
+  std::vector<uint8_t> pixels(static_cast<size_t>(width) * height * 4);
+  for (size_t i = 0; i < pixels.size(); i += 4) {
+    memcpy(&pixels[i], &value, 4);
+  }
+  return pixels;
+}
+
+}  // namespace
+
+TEST(FrameBuffer, PublishAndAcquire) {
+  std::string error;
+  auto consumer = SharedFrameBuffer::Create(SegmentName("basic"), 64, 32, &error);
+  ASSERT_NE(consumer, nullptr) << error;
+  auto producer = SharedFrameBuffer::Open(consumer->name(), &error);
+  ASSERT_NE(producer, nullptr) << error;
+
+  SharedFrame frame;
+  EXPECT_FALSE(consumer->AcquireLatest(&frame));
+
+  const auto pixels = SolidFrame(16, 8, 0x11223344);
+  ASSERT_TRUE(producer->Publish(pixels.data(), 16, 8, 16 * 4,
+                                FramePixelFormat::kRGBA8));
+
+  ASSERT_TRUE(consumer->AcquireLatest(&frame));
+  EXPECT_TRUE(frame.is_new);
+  EXPECT_EQ(frame.sequence, 1u);
+  EXPECT_EQ(frame.width, 16u);
+  EXPECT_EQ(frame.height, 8u);
+  EXPECT_EQ(frame.stride, 16u * 4);
+  EXPECT_EQ(memcmp(frame.pixels, pixels.data(), pixels.size()), 0);
+
+  // Nothing new: the same frame again
+  ASSERT_TRUE(consumer->AcquireLatest(&frame));
+  EXPECT_FALSE(frame.is_new);
+  EXPECT_EQ(frame.sequence, 1u);
+}
+
+TEST(FrameBuffer, LatestFrameWins) {
+  std::string error;
+  auto consumer = SharedFrameBuffer::Create(SegmentName("latest"), 8, 8, &error);
+  ASSERT_NE(consumer, nullptr) << error;
+  auto producer = SharedFrameBuffer::Open(consumer->name(), &error);
+  ASSERT_NE(producer, nullptr) << error;
+
+  for (uint32_t i = 1; i <= 5; ++i) {
+    const auto pixels = SolidFrame(8, 8, i);
+    ASSERT_TRUE(producer->Publish(pixels.data(), 8, 8, 32,
+                                  FramePixelFormat::kRGBA8));
+  }
+
+  SharedFrame frame;
+  ASSERT_TRUE(consumer->AcquireLatest(&frame));
+  EXPECT_EQ(frame.sequence, 5u);
+  EXPECT_EQ(frame.pixels[0], 5);
+
+  const auto pixels = SolidFrame(8, 8, 6);
+  ASSERT_TRUE(producer->Publish(pixels.data(), 8, 8, 32,
+                                FramePixelFormat::kRGBA8));
+  ASSERT_TRUE(consumer->AcquireLatest(&frame));
+  EXPECT_EQ(frame.sequence, 6u);
+
+  const FrameBufferStatistics stats = consumer->GetStatistics();
+  EXPECT_EQ(stats.frames_published, 6u);
+  EXPECT_EQ(stats.frames_acquired, 2u);
+  EXPECT_EQ(stats.frames_skipped, 4u);
+}
+
+TEST(FrameBuffer, SkippedFramesAreCounted) {
+  std::string error;
+  auto consumer = SharedFrameBuffer::Create(SegmentName("skipped"), 8, 8, &error);
+  ASSERT_NE(consumer, nullptr) << error;
+  auto producer = SharedFrameBuffer::Open(consumer->name(), &error);
+  ASSERT_NE(producer, nullptr) << error;
+
+  const auto pixels = SolidFrame(8, 8, 1);
+  SharedFrame frame;
+  producer->Publish(pixels.data(), 8, 8, 32, FramePixelFormat::kRGBA8);
+  ASSERT_TRUE(consumer->AcquireLatest(&frame));
+  for (int i = 0; i < 4; ++i) {
+    producer->Publish(pixels.data(), 8, 8, 32, FramePixelFormat::kRGBA8);
+  }
+  ASSERT_TRUE(consumer->AcquireLatest(&frame));
+  EXPECT_EQ(frame.sequence, 5u);
+  EXPECT_EQ(consumer->GetStatistics().frames_skipped, 3u);
+}
+
+TEST(FrameBuffer, ConvertsBgraAndPaddedRows) {
+  std::string error;
+  auto consumer = SharedFrameBuffer::Create(SegmentName("bgra"), 4, 2, &error);
+  ASSERT_NE(consumer, nullptr) << error;
+  auto producer = SharedFrameBuffer::Open(consumer->name(), &error);
+  ASSERT_NE(producer, nullptr) << error;
+
+  // Two rows of B, G, R, A with 8 bytes of padding per row
+  const uint32_t stride = 4 * 4 + 8;
+  std::vector<uint8_t> bgra(stride * 2, 0xEE);
+  for (uint32_t y = 0; y < 2; ++y) {
+    for (uint32_t x = 0; x < 4; ++x) {
+      uint8_t* pixel = &bgra[y * stride + x * 4];
+      pixel[0] = 0x10;  // B
+      pixel[1] = 0x20;  // G
+      pixel[2] = 0x30;  // R
+      pixel[3] = 0x40;  // A
+    }
+  }
+  ASSERT_TRUE(producer->Publish(bgra.data(), 4, 2, stride,
+                                FramePixelFormat::kBGRA8));
+
+  SharedFrame frame;
+  ASSERT_TRUE(consumer->AcquireLatest(&frame));
+  ASSERT_EQ(frame.stride, 16u);
+  for (uint32_t i = 0; i < 8; ++i) {
+    EXPECT_EQ(frame.pixels[i * 4 + 0], 0x30);
+    EXPECT_EQ(frame.pixels[i * 4 + 1], 0x20);
+    EXPECT_EQ(frame.pixels[i * 4 + 2], 0x10);
+    EXPECT_EQ(frame.pixels[i * 4 + 3], 0x40);
+  }
+}
+
+TEST(FrameBuffer, RejectsOversizedFrames) {
+  std::string error;
+  auto consumer = SharedFrameBuffer::Create(SegmentName("oversized"), 8, 8, &error);
+  ASSERT_NE(consumer, nullptr) << error;
+  auto producer = SharedFrameBuffer::Open(consumer->name(), &error);
+  ASSERT_NE(producer, nullptr) << error;
+
+  const auto pixels = SolidFrame(16, 8, 1);
+  EXPECT_FALSE(producer->Publish(pixels.data(), 16, 8, 64,
+                                 FramePixelFormat::kRGBA8));
+  EXPECT_FALSE(producer->Publish(pixels.data(), 8, 8, 16,
+                                 FramePixelFormat::kRGBA8));
+  EXPECT_EQ(consumer->GetStatistics().frames_rejected, 2u);
+
+  SharedFrame frame;
+  EXPECT_FALSE(consumer->AcquireLatest(&frame));
+}
+
+TEST(FrameBuffer, OpenRejectsForeignSegments) {
+  std::string error;
+  EXPECT_EQ(SharedFrameBuffer::Open(SegmentName("missing"), &error), nullptr);
+  EXPECT_FALSE(error.empty());
+}
+
+TEST(FrameBuffer, RestartedProducerContinuesTheSequence) {
+  std::string error;
+  auto consumer = SharedFrameBuffer::Create(SegmentName("restart"), 8, 8, &error);
+  ASSERT_NE(consumer, nullptr) << error;
+
+  const auto pixels = SolidFrame(8, 8, 1);
+  SharedFrame frame;
+  {
+    auto producer = SharedFrameBuffer::Open(consumer->name(), &error);
+    ASSERT_NE(producer, nullptr) << error;
+    producer->Publish(pixels.data(), 8, 8, 32, FramePixelFormat::kRGBA8);
+    producer->Publish(pixels.data(), 8, 8, 32, FramePixelFormat::kRGBA8);
+  }
+  ASSERT_TRUE(consumer->AcquireLatest(&frame));
+  EXPECT_EQ(frame.sequence, 2u);
+
+  auto producer = SharedFrameBuffer::Open(consumer->name(), &error);
+  ASSERT_NE(producer, nullptr) << error;
+  const auto next = SolidFrame(8, 8, 9);
+  producer->Publish(next.data(), 8, 8, 32, FramePixelFormat::kRGBA8);
+
+  const uint8_t* held = frame.pixels;
+  ASSERT_TRUE(consumer->AcquireLatest(&frame));
+  EXPECT_EQ(frame.sequence, 3u);
+  EXPECT_EQ(frame.pixels[0], 9);
+  EXPECT_NE(frame.pixels, held);
+}
+
+TEST(FrameBuffer, WaitForFrameWakesAndTimesOut) {
+  std::string error;
+  auto consumer = SharedFrameBuffer::Create(SegmentName("wait"), 8, 8, &error);
+  ASSERT_NE(consumer, nullptr) << error;
+  auto producer = SharedFrameBuffer::Open(consumer->name(), &error);
+  ASSERT_NE(producer, nullptr) << error;
+
+  const uint32_t seen = consumer->frame_counter();
+  EXPECT_FALSE(consumer->WaitForFrame(seen, 10));
+
+  std::thread publisher([&producer] {
+    std::this_thread::sleep_for(std::chrono::milliseconds(20));
+    const auto pixels = SolidFrame(8, 8, 1);
+    producer->Publish(pixels.data(), 8, 8, 32, FramePixelFormat::kRGBA8);
+  });
+  EXPECT_TRUE(consumer->WaitForFrame(seen, 5000));
+  publisher.join();
+
+  // Closing wakes waiters without a frame
+  const uint32_t now_seen = consumer->frame_counter();
+  std::thread closer([&consumer] {
+    std::this_thread::sleep_for(std::chrono::milliseconds(20));
+    consumer->Close();
+  });
+  EXPECT_FALSE(consumer->WaitForFrame(now_seen, 5000));
+  closer.join();
+  EXPECT_TRUE(consumer->closed());
+}
+
+TEST(FrameBuffer, ConcurrentFramesNeverTear) {
+  std::string error;
+  auto consumer = SharedFrameBuffer::Create(SegmentName("tearing"), 64, 64, &error);
+  ASSERT_NE(consumer, nullptr) << error;
+  auto producer = SharedFrameBuffer::Open(consumer->name(), &error);
+  ASSERT_NE(producer, nullptr) << error;
+
+  const uint32_t frames = 2000;
+  std::atomic<bool> done(false);
+  std::thread engine([&] {
+    std::vector<uint8_t> pixels(64 * 64 * 4);
+    for (uint32_t i = 1; i <= frames; ++i) {
+      memset(pixels.data(), static_cast<int>(i & 0xFF), pixels.size());
+      producer->Publish(pixels.data(), 64, 64, 256, FramePixelFormat::kRGBA8);
+    }
+    done = true;
+  });
+
+  uint64_t last_sequence = 0;
+  uint64_t torn = 0;
+  SharedFrame frame;
+  while (!done || frame.sequence < frames) {
+    if (!consumer->AcquireLatest(&frame)) {
+      continue;
+    }
+    ASSERT_GE(frame.sequence, last_sequence);
+    last_sequence = frame.sequence;
+    const uint8_t expected = static_cast<uint8_t>(frame.sequence & 0xFF);
+    for (size_t i = 0; i < 64 * 64 * 4; i += 61) {
+      if (frame.pixels[i] != expected) {
+        ++torn;
+        break;
+      }
+    }
+  }
+  engine.join();
+
+  EXPECT_EQ(torn, 0u);
+  EXPECT_EQ(frame.sequence, frames);
+  const FrameBufferStatistics stats = consumer->GetStatistics();
+  EXPECT_EQ(stats.frames_acquired + stats.frames_skipped, frames);
+}
+
+}  // namespace test
+}  // namespace gameframework_unreal
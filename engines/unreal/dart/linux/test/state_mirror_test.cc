@@ -0,0 +1,231 @@
+#include <gtest/gtest.h>
+#include <unistd.h>
+
+#include <atomic>
+#include <chrono>
+#include <cstdio>
+#include <string>
+#include <thread>
+
+#include "state_mirror.h"
+
+// Writer and reader each map the segment separately, as the engine and the
+// plugin do from their own processes.
+
+namespace gameframework_unreal {
+namespace test {
+
+namespace {
+
+std::string SegmentName(const char* test) {
+  return "/gameframework_unreal_state_test_" + std::to_string(getpid()) + "_" +
+         test;
+}
+
+const StateValue* FindField(const StateSnapshot& snapshot, const char* name) {
+  for (const StateValue& value : snapshot.fields) {
+    if (*value.name == name) {
+      return &value;
+    }
+  }
+  return nullptr;
+}
+
+}  // namespace
+
+TEST(StateMirror, WritesAndReadsTypedFields) {
+  std::string error;
+  auto reader = SharedStateMirror::Create(SegmentName("basic"), &error);
+  ASSERT_NE(reader, nullptr) << error;
+  auto writer = SharedStateMirror::Open(reader->name(), &error);
+  ASSERT_NE(writer, nullptr) << error;
+
+  StateSnapshot snapshot;
+  ASSERT_TRUE(reader->Read(&snapshot));
+  EXPECT_EQ(snapshot.version, 0u);
+  EXPECT_TRUE(snapshot.fields.empty());
+
+  EXPECT_TRUE(writer->SetInt("score", 1200));
+  EXPECT_TRUE(writer->SetDouble("health", 0.75));
+  EXPECT_TRUE(writer->SetBool("isPaused", true));
+  EXPECT_TRUE(writer->SetInt("score", -5));
+  EXPECT_EQ(reader->version(), 4u);
+
+  ASSERT_TRUE(reader->Read(&snapshot));
+  EXPECT_EQ(snapshot.version, 4u);
+  EXPECT_GT(snapshot.write_time_ns, 0u);
+  ASSERT_EQ(snapshot.fields.size(), 3u);
+  EXPECT_EQ(*snapshot.fields[0].name, "score");
+  EXPECT_EQ(snapshot.fields[0].type, StateFieldType::kInt);
+  EXPECT_EQ(snapshot.fields[0].as_int(), -5);
+  EXPECT_EQ(snapshot.fields[1].type, StateFieldType::kDouble);
+  EXPECT_EQ(snapshot.fields[1].as_double(), 0.75);
+  EXPECT_EQ(snapshot.fields[2].type, StateFieldType::kBool);
+  EXPECT_TRUE(snapshot.fields[2].as_bool());
+}
+
+TEST(StateMirror, FieldsWrittenTogetherShareAVersion) {
+  std::string error;
+  auto reader = SharedStateMirror::Create(SegmentName("batch"), &error);
+  ASSERT_NE(reader, nullptr) << error;
+  auto writer = SharedStateMirror::Open(reader->name(), &error);
+  ASSERT_NE(writer, nullptr) << error;
+
+  writer->BeginWrite();
+  writer->SetInt("score", 10);
+  writer->SetInt("level", 2);
+  EXPECT_EQ(reader->version(), 0u);
+  writer->SetBool("isRunning", true);
+  writer->EndWrite();
+
+  EXPECT_EQ(reader->version(), 1u);
+  EXPECT_EQ(reader->GetStatistics().writes, 1u);
+}
+
+TEST(StateMirror, RejectsBadFields) {
+  std::string error;
+  auto reader = SharedStateMirror::Create(SegmentName("bad"), &error);
+  ASSERT_NE(reader, nullptr) << error;
+  auto writer = SharedStateMirror::Open(reader->name(), &error);
+  ASSERT_NE(writer, nullptr) << error;
+
+  EXPECT_FALSE(writer->SetInt("", 1));
+  EXPECT_FALSE(writer->SetInt(nullptr, 1));
+  const std::string longest(kStateFieldNameSize - 1, 'x');
+  EXPECT_TRUE(writer->SetInt(longest.c_str(), 1));
+  EXPECT_FALSE(writer->SetInt((longest + "x").c_str(), 1));
+  EXPECT_TRUE(writer->SetInt("score", 1));
+  EXPECT_FALSE(writer->SetDouble("score", 1.5));
+
+  for (uint32_t i = 2; i < kStateMirrorFields; ++i) {
+    EXPECT_TRUE(writer->SetInt(("field" + std::to_string(i)).c_str(), i));
+  }
+  EXPECT_FALSE(writer->SetInt("oneTooMany", 1));
+  EXPECT_TRUE(writer->SetInt("score", 2));
+
+  StateSnapshot snapshot;
+  ASSERT_TRUE(reader->Read(&snapshot));
+  EXPECT_EQ(snapshot.fields.size(), kStateMirrorFields);
+  EXPECT_EQ(FindField(snapshot, "score")->as_int(), 2);
+}
+
+TEST(StateMirror, RestartedWriterKeepsItsFields) {
+  std::string error;
+  auto reader = SharedStateMirror::Create(SegmentName("restart"), &error);
+  ASSERT_NE(reader, nullptr) << error;
+  {
+    auto writer = SharedStateMirror::Open(reader->name(), &error);
+    ASSERT_NE(writer, nullptr) << error;
+    writer->SetInt("score", 7);
+    writer->SetInt("level", 3);
+    // Dies half way through a write
+    writer->BeginWrite();
+  }
+
+  StateSnapshot snapshot;
+  EXPECT_FALSE(reader->Read(&snapshot));
+  EXPECT_EQ(reader->GetStatistics().reads_failed, 1u);
+
+  auto writer = SharedStateMirror::Open(reader->name(), &error);
+  ASSERT_NE(writer, nullptr) << error;
+  EXPECT_FALSE(writer->SetBool("level", true));  // finishes the dead write
+  EXPECT_TRUE(writer->SetInt("level", 4));
+
+  ASSERT_TRUE(reader->Read(&snapshot));
+  EXPECT_EQ(snapshot.version, 4u);
+  ASSERT_EQ(snapshot.fields.size(), 2u);
+  EXPECT_EQ(FindField(snapshot, "score")->as_int(), 7);
+  EXPECT_EQ(FindField(snapshot, "level")->as_int(), 4);
+}
+
+TEST(StateMirror, OpenRejectsForeignSegments) {
+  std::string error;
+  EXPECT_EQ(SharedStateMirror::Open(SegmentName("missing"), &error), nullptr);
+  EXPECT_FALSE(error.empty());
+}
+
+// The engine writes pairs that must always match while the plugin reads as
+// fast as it can; no snapshot may mix two writes.
+TEST(StateMirror, ReadsAreNeverTorn) {
+  std::string error;
+  auto reader = SharedStateMirror::Create(SegmentName("torn"), &error);
+  ASSERT_NE(reader, nullptr) << error;
+  auto writer = SharedStateMirror::Open(reader->name(), &error);
+  ASSERT_NE(writer, nullptr) << error;
+  writer->BeginWrite();
+  writer->SetInt("score", 0);
+  writer->SetInt("negated", 0);
+  writer->SetDouble("ratio", 0);
+  writer->EndWrite();
+
+  std::atomic<bool> done{false};
+  std::thread engine([&] {
+    for (int64_t i = 1; !done; ++i) {
+      writer->BeginWrite();
+      writer->SetInt("score", i);
+      writer->SetInt("negated", -i);
+      writer->SetDouble("ratio", i / 2.0);
+      writer->EndWrite();
+    }
+  });
+
+  StateSnapshot snapshot;
+  uint64_t last_version = 0;
+  int torn = 0;
+  const auto start = std::chrono::steady_clock::now();
+  const auto deadline = start + std::chrono::milliseconds(200);
+  while (std::chrono::steady_clock::now() < deadline) {
+    ASSERT_TRUE(reader->Read(&snapshot));
+    const int64_t score = snapshot.fields[0].as_int();
+    if (score != -snapshot.fields[1].as_int() ||
+        score / 2.0 != snapshot.fields[2].as_double()) {
+      torn++;
+    }
+    EXPECT_GE(snapshot.version, last_version);
+    last_version = snapshot.version;
+  }
+  done = true;
+  engine.join();
+
+  const StateMirrorStatistics stats = reader->GetStatistics();
+  EXPECT_EQ(torn, 0);
+  EXPECT_EQ(stats.reads_failed, 0u);
+  printf("  %llu reads against %llu writes, %llu retries\n",
+         static_cast<unsigned long long>(stats.reads),
+         static_cast<unsigned long long>(stats.writes),
+         static_cast<unsigned long long>(stats.read_retries));
+}
+
+// What a HUD pays per frame: one snapshot of a handful of fields.
+TEST(StateMirror, ReportsReadCost) {
+  std::string error;
+  auto reader = SharedStateMirror::Create(SegmentName("cost"), &error);
+  ASSERT_NE(reader, nullptr) << error;
+  auto writer = SharedStateMirror::Open(reader->name(), &error);
+  ASSERT_NE(writer, nullptr) << error;
+  writer->BeginWrite();
+  writer->SetInt("score", 1200);
+  writer->SetInt("level", 3);
+  writer->SetDouble("health", 0.5);
+  writer->SetBool("isRunning", true);
+  writer->SetBool("isPaused", false);
+  writer->EndWrite();
+
+  constexpr int kIterations = 1000000;
+  StateSnapshot snapshot;
+  const auto start = std::chrono::steady_clock::now();
+  for (int i = 0; i < kIterations; ++i) {
+    reader->Read(&snapshot);
+  }
+  const double read_ns = std::chrono::duration<double, std::nano>(
+                             std::chrono::steady_clock::now() - start)
+                             .count() /
+                         kIterations;
+
+  EXPECT_EQ(snapshot.fields.size(), 5u);
+  printf("  snapshot of %zu fields: %.1f ns\n", snapshot.fields.size(),
+         read_ns);
+}
+
+}  // namespace test
+}  // namespace gameframework_unreal
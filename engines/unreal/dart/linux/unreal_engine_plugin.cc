@@ -3,8 +3,46 @@
 #include <flutter_linux/flutter_linux.h>
 #include <gtk/gtk.h>
 #include <sys/utsname.h>
+#include <unistd.h>
 
-#include <cstring>
+#include <atomic>
+#include <functional>
+#include <memory>
+#include <string>
+#include <vector>
+
+#include <gameframework/event_stream.h>
+#include <gameframework/method_dispatcher.h>
+#include <gameframework/worker_pool.h>
+
+#include "engine_transport.h"
+#include "frame_buffer.h"
+#include "state_mirror.h"
+#include "unreal_frame_texture.h"
+
+using gameframework_unreal::EncodeStrings;
+using gameframework_unreal::EngineOp;
+using gameframework_unreal::EngineTransport;
+using gameframework_unreal::OutgoingBytes;
+using gameframework_unreal::SharedStateMirror;
+using gameframework_unreal::StateFieldType;
+using gameframework_unreal::StateSnapshot;
+using gameframework_unreal::StateValue;
+using gameframework_unreal::TransportStatistics;
+
+// How long the engine has to answer before the call fails
+constexpr int kEngineTimeoutMs = 5000;
+constexpr int kLoadLevelTimeoutMs = 30000;
+
+// Calls that would block the main loop, such as waiting for the engine
+// process to connect, run on these
+constexpr size_t kWorkerThreads = 2;
+
+// Raw channel for engine messages that need no answer; see post_engine_messages
+constexpr char kMessageLaneChannel[] = "gameframework_unreal/messages";
+
+// Engine events for Flutter; see forward_engine_event
+constexpr char kEventChannel[] = "gameframework_unreal/events";
 
 #define UNREAL_ENGINE_PLUGIN(obj) \
   (G_TYPE_CHECK_INSTANCE_CAST((obj), unreal_engine_plugin_get_type(), \
@@ -12,95 +50,606 @@
 
 struct _UnrealEnginePlugin {
   GObject parent_instance;
+
+  FlTextureRegistrar* texture_registrar;
+
+  // Socket the engine process connects to; see engine_transport.h
+  EngineTransport* transport;
+
+  // Off-main-loop work for slow method calls; see run_on_worker
+  gameframework::WorkerPool* workers;
+
+  // Engine events on their way to Flutter, at most one send per frame.
+  // Owned by the transport's event callback, which tasks still queued on the
+  // main loop share; null without a transport.
+  gameframework::EventStream* events;
+
+  // Game state the engine writes for Flutter to read every frame; see
+  // state_mirror.h. Null if the segment could not be created.
+  SharedStateMirror* state_mirror;
+
+  // Frame textures by texture id
+  GHashTable* frame_textures;
+  guint next_frame_buffer;
 };
 
 G_DEFINE_TYPE(UnrealEnginePlugin, unreal_engine_plugin, g_object_get_type())
 
-// Called when a method call is received from Flutter.
-static void unreal_engine_plugin_handle_method_call(
-    UnrealEnginePlugin* self,
-    FlMethodCall* method_call) {
-  g_autoptr(FlMethodResponse) response = nullptr;
+static std::string get_string_arg(FlValue* args, const gchar* key) {
+  if (args == nullptr || fl_value_get_type(args) != FL_VALUE_TYPE_MAP) {
+    return std::string();
+  }
+  FlValue* value = fl_value_lookup_string(args, key);
+  if (value == nullptr || fl_value_get_type(value) != FL_VALUE_TYPE_STRING) {
+    return std::string();
+  }
+  return fl_value_get_string(value);
+}
 
-  const gchar* method = fl_method_call_get_name(method_call);
+static int64_t get_int_arg(FlValue* args, const gchar* key,
+                           int64_t fallback) {
+  if (args == nullptr || fl_value_get_type(args) != FL_VALUE_TYPE_MAP) {
+    return fallback;
+  }
+  FlValue* value = fl_value_lookup_string(args, key);
+  if (value == nullptr || fl_value_get_type(value) != FL_VALUE_TYPE_INT) {
+    return fallback;
+  }
+  return fl_value_get_int(value);
+}
 
-  if (strcmp(method, "getPlatformVersion") == 0) {
-    struct utsname uname_data = {};
-    uname(&uname_data);
-    g_autofree gchar *version = g_strdup_printf("Linux %s", uname_data.version);
-    g_autoptr(FlValue) result = fl_value_new_string(version);
-    response = FL_METHOD_RESPONSE(fl_method_success_response_new(result));
+// Stops the watcher before unregistering, so no frame notification can reach
+// Flutter for a texture it no longer knows. The table drops the last ref.
+static gboolean release_frame_texture_cb(gpointer key, gpointer value,
+                                         gpointer user_data) {
+  UnrealEnginePlugin* self = UNREAL_ENGINE_PLUGIN(user_data);
+  UnrealFrameTexture* texture = UNREAL_FRAME_TEXTURE(value);
+  unreal_frame_texture_stop(texture);
+  fl_texture_registrar_unregister_texture(self->texture_registrar,
+                                          FL_TEXTURE(texture));
+  return TRUE;
+}
+
+static UnrealFrameTexture* lookup_frame_texture(UnrealEnginePlugin* self,
+                                                FlValue* args) {
+  const int64_t texture_id = get_int_arg(args, "textureId", -1);
+  return static_cast<UnrealFrameTexture*>(
+      g_hash_table_lookup(self->frame_textures, &texture_id));
+}
+
+// Creates a shared frame buffer for the engine to publish into, and a texture
+// showing it. Returns the texture id for a Texture widget and the segment name
+// to pass to the engine as -FlutterFrameBuffer=<name>.
+static FlMethodResponse* create_frame_texture(UnrealEnginePlugin* self,
+                                              FlValue* args) {
+  const int64_t max_width = get_int_arg(args, "maxWidth", 1920);
+  const int64_t max_height = get_int_arg(args, "maxHeight", 1080);
+  if (max_width <= 0 || max_height <= 0 || max_width > 16384 ||
+      max_height > 16384) {
+    return FL_METHOD_RESPONSE(fl_method_error_response_new(
+        "INVALID_ARGUMENT", "maxWidth and maxHeight must be 1-16384", nullptr));
   }
-  else if (strcmp(method, "getEngineType") == 0) {
-    g_autoptr(FlValue) result = fl_value_new_string("unreal");
-    response = FL_METHOD_RESPONSE(fl_method_success_response_new(result));
+
+  g_autofree gchar* name = g_strdup_printf(
+      "/gameframework_unreal_%d_%u", getpid(), self->next_frame_buffer++);
+  g_autoptr(GError) error = nullptr;
+  g_autoptr(UnrealFrameTexture) texture = unreal_frame_texture_new(
+      name, static_cast<uint32_t>(max_width), static_cast<uint32_t>(max_height),
+      &error);
+  if (texture == nullptr) {
+    return FL_METHOD_RESPONSE(fl_method_error_response_new(
+        "FRAME_BUFFER_ERROR", error->message, nullptr));
   }
-  else if (strcmp(method, "getEngineVersion") == 0) {
-    g_autoptr(FlValue) result = fl_value_new_string("5.3.0");
-    response = FL_METHOD_RESPONSE(fl_method_success_response_new(result));
+
+  if (!fl_texture_registrar_register_texture(self->texture_registrar,
+                                             FL_TEXTURE(texture))) {
+    return FL_METHOD_RESPONSE(fl_method_error_response_new(
+        "FRAME_BUFFER_ERROR", "Failed to register the frame texture", nullptr));
   }
-  else if (strcmp(method, "isEngineSupported") == 0) {
-    g_autoptr(FlValue) result = fl_value_new_bool(TRUE);
-    response = FL_METHOD_RESPONSE(fl_method_success_response_new(result));
+  unreal_frame_texture_start(texture, self->texture_registrar);
+
+  int64_t* texture_id = g_new(int64_t, 1);
+  *texture_id = fl_texture_get_id(FL_TEXTURE(texture));
+  g_hash_table_insert(self->frame_textures, texture_id, g_object_ref(texture));
+
+  g_autoptr(FlValue) result = fl_value_new_map();
+  fl_value_set_string_take(result, "textureId", fl_value_new_int(*texture_id));
+  fl_value_set_string_take(result, "sharedMemoryName",
+                           fl_value_new_string(name));
+  return FL_METHOD_RESPONSE(fl_method_success_response_new(result));
+}
+
+// Transport callbacks run on the GTK main loop, in the order they happened.
+static gboolean run_transport_task_cb(gpointer data) {
+  (*static_cast<EngineTransport::Task*>(data))();
+  return G_SOURCE_REMOVE;
+}
+
+static void delete_transport_task(gpointer data) {
+  delete static_cast<EngineTransport::Task*>(data);
+}
+
+static void dispatch_to_main_loop(EngineTransport::Task task) {
+  g_idle_add_full(G_PRIORITY_DEFAULT, run_transport_task_cb,
+                  new EngineTransport::Task(std::move(task)),
+                  delete_transport_task);
+}
+
+// Worker results, like transport callbacks, are handled on the main loop.
+static gboolean run_worker_task_cb(gpointer data) {
+  (*static_cast<gameframework::WorkerPool::Task*>(data))();
+  return G_SOURCE_REMOVE;
+}
+
+static void delete_worker_task(gpointer data) {
+  delete static_cast<gameframework::WorkerPool::Task*>(data);
+}
+
+static void invoke_on_main_context(gameframework::WorkerPool::Task task) {
+  g_main_context_invoke_full(nullptr, G_PRIORITY_DEFAULT, run_worker_task_cb,
+                             new gameframework::WorkerPool::Task(
+                                 std::move(task)),
+                             delete_worker_task);
+}
+
+// Runs |work| on a worker and answers the method call with the response it
+// returns, on the main loop. |work| must not use the plugin or GTK, and
+// should return early once |cancelled| is set; calls still pending when the
+// plugin is disposed are answered with a CANCELLED error instead.
+static void run_on_worker(
+    UnrealEnginePlugin* self, FlMethodCall* method_call,
+    std::function<FlMethodResponse*(const std::atomic<bool>& cancelled)>
+        work) {
+  g_object_ref(method_call);
+  auto respond = [method_call](FlMethodResponse* response) {
+    fl_method_call_respond(method_call, response, nullptr);
+    g_object_unref(response);
+    g_object_unref(method_call);
+  };
+  self->workers->Post(
+      [work = std::move(work),
+       respond](const std::atomic<bool>& cancelled)
+          -> gameframework::WorkerPool::Task {
+        // Dropped unanswered if the pool shuts down before it is delivered
+        std::shared_ptr<FlMethodResponse> response(work(cancelled),
+                                                   g_object_unref);
+        return [respond, response] {
+          respond(FL_METHOD_RESPONSE(g_object_ref(response.get())));
+        };
+      },
+      [respond] {
+        respond(FL_METHOD_RESPONSE(fl_method_error_response_new(
+            "CANCELLED", "The engine plugin was disposed", nullptr)));
+      });
+}
+
+// Sends a request to the engine; the method call is answered when the engine
+// responds, so the main loop never waits.
+static void send_to_engine(UnrealEnginePlugin* self, FlMethodCall* method_call,
+                           EngineOp op, std::string payload, int timeout_ms) {
+  if (self->transport == nullptr) {
+    fl_method_call_respond_error(method_call, "ENGINE_ERROR",
+                                 "Engine transport is not available", nullptr,
+                                 nullptr);
+    return;
+  }
+
+  g_object_ref(method_call);
+  self->transport->Request(
+      op, std::move(payload), timeout_ms,
+      [method_call](bool ok, const std::string& result) {
+        if (ok) {
+          fl_method_call_respond_success(method_call, nullptr, nullptr);
+        } else {
+          fl_method_call_respond_error(method_call, "ENGINE_ERROR",
+                                       result.c_str(), nullptr, nullptr);
+        }
+        g_object_unref(method_call);
+      });
+}
+
+// Messages the engine sends on its own become onMessage events, in the format
+// UnrealController handles. Each is coalesced under "<target>/<method>" if
+// Flutter asked for that key when it listened.
+static void forward_engine_event(gameframework::EventStream* events,
+                                 EngineOp op, const std::string& payload) {
+  std::vector<std::string> strings;
+  if (op != EngineOp::kMessage ||
+      !gameframework_unreal::DecodeStrings(payload, &strings) ||
+      strings.size() != 3) {
+    g_warning("Dropping malformed message from the Unreal engine");
+    return;
   }
-  else if (strcmp(method, "engine#create") == 0) {
-    // TODO: Implement Unreal Engine initialization
-    g_autoptr(FlValue) result = fl_value_new_bool(FALSE);
-    response = FL_METHOD_RESPONSE(fl_method_success_response_new(result));
+
+  FlValue* data = fl_value_new_map();
+  fl_value_set_string_take(data, "target",
+                           fl_value_new_string(strings[0].c_str()));
+  fl_value_set_string_take(data, "method",
+                           fl_value_new_string(strings[1].c_str()));
+  fl_value_set_string_take(data, "data",
+                           fl_value_new_string(strings[2].c_str()));
+  events->Send("onMessage", data, strings[0] + "/" + strings[1]);
+}
+
+// Reply codes on the message lane, one byte each
+enum MessageLaneStatus : guint8 {
+  kMessageLanePosted = 0,
+  kMessageLaneNotConnected = 1,
+  kMessageLaneMalformed = 2,
+};
+
+static void release_message_bytes(void* bytes) {
+  g_bytes_unref(static_cast<GBytes*>(bytes));
+}
+
+// Message lane handler. Flutter sends transport frames ready for the socket
+// (posted kSendMessage / kSendJsonMessage requests, see engine_transport.h),
+// one or more per message. They go to the engine in the GBytes Flutter
+// handed over, without FlValue boxing, codec or copy, and are not answered
+// by the engine; the reply is only a status byte.
+static void post_engine_messages(FlBinaryMessenger* messenger,
+                                 const gchar* channel, GBytes* message,
+                                 FlBinaryMessengerResponseHandle* response_handle,
+                                 gpointer user_data) {
+  static const guint8 kStatuses[] = {kMessageLanePosted,
+                                     kMessageLaneNotConnected,
+                                     kMessageLaneMalformed};
+  static GBytes* status_bytes[] = {
+      g_bytes_new_static(&kStatuses[0], 1),
+      g_bytes_new_static(&kStatuses[1], 1),
+      g_bytes_new_static(&kStatuses[2], 1),
+  };
+
+  UnrealEnginePlugin* self = UNREAL_ENGINE_PLUGIN(user_data);
+  gsize size = 0;
+  const char* data = nullptr;
+  if (message != nullptr) {
+    data = static_cast<const char*>(g_bytes_get_data(message, &size));
+  }
+
+  MessageLaneStatus status = kMessageLaneMalformed;
+  const uint32_t count = gameframework_unreal::CountPostedFrames(data, size);
+  if (count > 0 && self->transport != nullptr &&
+      self->transport->Post(OutgoingBytes(data, size, release_message_bytes,
+                                          g_bytes_ref(message)),
+                            count)) {
+    status = kMessageLanePosted;
+  } else if (count > 0) {
+    status = kMessageLaneNotConnected;
   }
-  else if (strcmp(method, "engine#pause") == 0) {
-    // TODO: Implement pause
-    response = FL_METHOD_RESPONSE(fl_method_success_response_new(nullptr));
+
+  g_autoptr(GError) error = nullptr;
+  if (!fl_binary_messenger_send_response(messenger, response_handle,
+                                         status_bytes[status], &error)) {
+    g_warning("Failed to answer on %s: %s", channel, error->message);
   }
-  else if (strcmp(method, "engine#resume") == 0) {
-    // TODO: Implement resume
-    response = FL_METHOD_RESPONSE(fl_method_success_response_new(nullptr));
+}
+
+static FlValue* get_connection_info(UnrealEnginePlugin* self) {
+  FlValue* result = fl_value_new_map();
+  if (self->transport == nullptr) {
+    fl_value_set_string_take(result, "connected", fl_value_new_bool(FALSE));
+    return result;
   }
-  else if (strcmp(method, "engine#unload") == 0) {
-    // TODO: Implement unload
-    response = FL_METHOD_RESPONSE(fl_method_success_response_new(nullptr));
+
+  const TransportStatistics stats = self->transport->GetStatistics();
+  fl_value_set_string_take(
+      result, "socketPath",
+      fl_value_new_string(self->transport->path().c_str()));
+  fl_value_set_string_take(result, "connected",
+                           fl_value_new_bool(stats.connected));
+  fl_value_set_string_take(result, "connections",
+                           fl_value_new_int(stats.connections));
+  fl_value_set_string_take(result, "requestsSent",
+                           fl_value_new_int(stats.requests_sent));
+  fl_value_set_string_take(result, "responsesReceived",
+                           fl_value_new_int(stats.responses_received));
+  fl_value_set_string_take(result, "errorsReceived",
+                           fl_value_new_int(stats.errors_received));
+  fl_value_set_string_take(result, "requestsFailed",
+                           fl_value_new_int(stats.requests_failed));
+  fl_value_set_string_take(result, "eventsReceived",
+                           fl_value_new_int(stats.events_received));
+  fl_value_set_string_take(result, "messagesPosted",
+                           fl_value_new_int(stats.messages_posted));
+  fl_value_set_string_take(result, "pendingRequests",
+                           fl_value_new_int(stats.pending_requests));
+  fl_value_set_string_take(result, "bytesSent",
+                           fl_value_new_int(stats.bytes_sent));
+  fl_value_set_string_take(result, "bytesReceived",
+                           fl_value_new_int(stats.bytes_received));
+  fl_value_set_string_take(result, "lastRoundTripMs",
+                           fl_value_new_float(stats.last_round_trip_ms));
+  fl_value_set_string_take(result, "averageRoundTripMs",
+                           fl_value_new_float(stats.average_round_trip_ms));
+  fl_value_set_string_take(result, "maxRoundTripMs",
+                           fl_value_new_float(stats.max_round_trip_ms));
+  fl_value_set_string_take(result, "eventStream",
+                           self->events->GetStatistics());
+  if (self->state_mirror != nullptr) {
+    fl_value_set_string_take(
+        result, "stateMirrorName",
+        fl_value_new_string(self->state_mirror->name().c_str()));
   }
-  else if (strcmp(method, "engine#quit") == 0) {
-    // TODO: Implement quit
-    response = FL_METHOD_RESPONSE(fl_method_success_response_new(nullptr));
+  return result;
+}
+
+static FlMethodResponse* get_platform_version(UnrealEnginePlugin* self,
+                                              FlMethodCall* method_call) {
+  struct utsname uname_data = {};
+  uname(&uname_data);
+  g_autofree gchar *version = g_strdup_printf("Linux %s", uname_data.version);
+  g_autoptr(FlValue) result = fl_value_new_string(version);
+  return FL_METHOD_RESPONSE(fl_method_success_response_new(result));
+}
+
+static FlMethodResponse* get_engine_type(UnrealEnginePlugin* self,
+                                         FlMethodCall* method_call) {
+  g_autoptr(FlValue) result = fl_value_new_string("unreal");
+  return FL_METHOD_RESPONSE(fl_method_success_response_new(result));
+}
+
+static FlMethodResponse* get_engine_version(UnrealEnginePlugin* self,
+                                            FlMethodCall* method_call) {
+  g_autoptr(FlValue) result = fl_value_new_string("5.3.0");
+  return FL_METHOD_RESPONSE(fl_method_success_response_new(result));
+}
+
+static FlMethodResponse* is_engine_supported(UnrealEnginePlugin* self,
+                                             FlMethodCall* method_call) {
+  g_autoptr(FlValue) result = fl_value_new_bool(TRUE);
+  return FL_METHOD_RESPONSE(fl_method_success_response_new(result));
+}
+
+static FlMethodResponse* engine_create(UnrealEnginePlugin* self,
+                                       FlMethodCall* method_call) {
+  // The engine runs as its own process and connects to the transport;
+  // launching it is up to the app. With connectTimeoutMs the call waits, on
+  // a worker, for the engine to connect while it starts up.
+  const int64_t timeout_ms = get_int_arg(
+      fl_method_call_get_args(method_call), "connectTimeoutMs", 0);
+  EngineTransport* transport = self->transport;
+  if (timeout_ms <= 0 || transport == nullptr || transport->connected()) {
+    g_autoptr(FlValue) result =
+        fl_value_new_bool(transport != nullptr && transport->connected());
+    return FL_METHOD_RESPONSE(fl_method_success_response_new(result));
   }
-  else if (strcmp(method, "engine#sendMessage") == 0) {
-    // TODO: Implement message sending to Unreal
-    response = FL_METHOD_RESPONSE(fl_method_success_response_new(nullptr));
+
+  // The transport outlives the workers; see dispose
+  run_on_worker(self, method_call,
+                [transport, timeout_ms](const std::atomic<bool>& cancelled) {
+                  const gint64 deadline =
+                      g_get_monotonic_time() + timeout_ms * 1000;
+                  while (!transport->connected() && !cancelled &&
+                         g_get_monotonic_time() < deadline) {
+                    g_usleep(10 * 1000);
+                  }
+                  g_autoptr(FlValue) result =
+                      fl_value_new_bool(transport->connected());
+                  return FL_METHOD_RESPONSE(
+                      fl_method_success_response_new(result));
+                });
+  return nullptr;
+}
+
+// TODO: Implement pause, resume, unload, quit and quality settings
+static FlMethodResponse* engine_not_implemented(UnrealEnginePlugin* self,
+                                                FlMethodCall* method_call) {
+  return FL_METHOD_RESPONSE(fl_method_success_response_new(nullptr));
+}
+
+static FlMethodResponse* engine_send_message(UnrealEnginePlugin* self,
+                                             FlMethodCall* method_call) {
+  FlValue* args = fl_method_call_get_args(method_call);
+  send_to_engine(self, method_call, EngineOp::kSendMessage,
+                 EncodeStrings({get_string_arg(args, "target"),
+                                get_string_arg(args, "method"),
+                                get_string_arg(args, "data")}),
+                 kEngineTimeoutMs);
+  return nullptr;
+}
+
+static FlMethodResponse* engine_send_json_message(UnrealEnginePlugin* self,
+                                                  FlMethodCall* method_call) {
+  FlValue* args = fl_method_call_get_args(method_call);
+  FlValue* data = nullptr;
+  if (args != nullptr && fl_value_get_type(args) == FL_VALUE_TYPE_MAP) {
+    data = fl_value_lookup_string(args, "data");
   }
-  else if (strcmp(method, "engine#sendJsonMessage") == 0) {
-    // TODO: Implement JSON message sending to Unreal
-    response = FL_METHOD_RESPONSE(fl_method_success_response_new(nullptr));
+  g_autoptr(FlJsonMessageCodec) json_codec = fl_json_message_codec_new();
+  g_autoptr(GError) error = nullptr;
+  g_autofree gchar* json =
+      data != nullptr ? fl_json_message_codec_encode(json_codec, data, &error)
+                      : g_strdup("{}");
+  if (json == nullptr) {
+    return FL_METHOD_RESPONSE(fl_method_error_response_new(
+        "INVALID_ARGUMENT", error->message, nullptr));
   }
-  else if (strcmp(method, "engine#executeConsoleCommand") == 0) {
-    // TODO: Implement console command execution
-    response = FL_METHOD_RESPONSE(fl_method_success_response_new(nullptr));
+
+  send_to_engine(self, method_call, EngineOp::kSendJsonMessage,
+                 EncodeStrings({get_string_arg(args, "target"),
+                                get_string_arg(args, "method"), json}),
+                 kEngineTimeoutMs);
+  return nullptr;
+}
+
+static FlMethodResponse* engine_execute_console_command(
+    UnrealEnginePlugin* self, FlMethodCall* method_call) {
+  send_to_engine(
+      self, method_call, EngineOp::kExecuteConsoleCommand,
+      EncodeStrings(
+          {get_string_arg(fl_method_call_get_args(method_call), "command")}),
+      kEngineTimeoutMs);
+  return nullptr;
+}
+
+static FlMethodResponse* engine_load_level(UnrealEnginePlugin* self,
+                                           FlMethodCall* method_call) {
+  send_to_engine(
+      self, method_call, EngineOp::kLoadLevel,
+      EncodeStrings(
+          {get_string_arg(fl_method_call_get_args(method_call), "levelName")}),
+      kLoadLevelTimeoutMs);
+  return nullptr;
+}
+
+static FlMethodResponse* engine_get_quality_settings(
+    UnrealEnginePlugin* self, FlMethodCall* method_call) {
+  // TODO: Implement get quality settings
+  g_autoptr(FlValue) result = fl_value_new_map();
+  return FL_METHOD_RESPONSE(fl_method_success_response_new(result));
+}
+
+static FlMethodResponse* engine_is_in_background(UnrealEnginePlugin* self,
+                                                 FlMethodCall* method_call) {
+  g_autoptr(FlValue) result = fl_value_new_bool(FALSE);
+  return FL_METHOD_RESPONSE(fl_method_success_response_new(result));
+}
+
+static FlMethodResponse* engine_get_connection_info(
+    UnrealEnginePlugin* self, FlMethodCall* method_call) {
+  g_autoptr(FlValue) result = get_connection_info(self);
+  return FL_METHOD_RESPONSE(fl_method_success_response_new(result));
+}
+
+static FlMethodResponse* frame_texture_create(UnrealEnginePlugin* self,
+                                              FlMethodCall* method_call) {
+  return create_frame_texture(self, fl_method_call_get_args(method_call));
+}
+
+// Reads the state mirror: {"version", "ageMs", "fields": {name: value}}, or
+// null if the version is still |sinceVersion|, so polling every frame costs
+// next to nothing while nothing changes.
+static FlMethodResponse* state_mirror_read(UnrealEnginePlugin* self,
+                                           FlMethodCall* method_call) {
+  if (self->state_mirror == nullptr) {
+    return FL_METHOD_RESPONSE(fl_method_error_response_new(
+        "UNAVAILABLE", "State mirror is not available", nullptr));
   }
-  else if (strcmp(method, "engine#loadLevel") == 0) {
-    // TODO: Implement level loading
-    response = FL_METHOD_RESPONSE(fl_method_success_response_new(nullptr));
+
+  const int64_t since_version = get_int_arg(
+      fl_method_call_get_args(method_call), "sinceVersion", -1);
+  if (since_version >= 0 &&
+      self->state_mirror->version() == static_cast<uint64_t>(since_version)) {
+    return FL_METHOD_RESPONSE(fl_method_success_response_new(nullptr));
   }
-  else if (strcmp(method, "engine#applyQualitySettings") == 0) {
-    // TODO: Implement quality settings
-    response = FL_METHOD_RESPONSE(fl_method_success_response_new(nullptr));
+
+  StateSnapshot snapshot;
+  if (!self->state_mirror->Read(&snapshot)) {
+    return FL_METHOD_RESPONSE(fl_method_error_response_new(
+        "ENGINE_ERROR", "The engine did not finish writing its state",
+        nullptr));
   }
-  else if (strcmp(method, "engine#getQualitySettings") == 0) {
-    // TODO: Implement get quality settings
-    g_autoptr(FlValue) result = fl_value_new_map();
-    response = FL_METHOD_RESPONSE(fl_method_success_response_new(result));
+
+  FlValue* fields = fl_value_new_map();
+  for (const StateValue& value : snapshot.fields) {
+    FlValue* field = nullptr;
+    switch (value.type) {
+      case StateFieldType::kInt:
+        field = fl_value_new_int(value.as_int());
+        break;
+      case StateFieldType::kDouble:
+        field = fl_value_new_float(value.as_double());
+        break;
+      case StateFieldType::kBool:
+        field = fl_value_new_bool(value.as_bool());
+        break;
+      default:
+        continue;
+    }
+    fl_value_set_string_take(fields, value.name->c_str(), field);
   }
-  else if (strcmp(method, "engine#isInBackground") == 0) {
-    g_autoptr(FlValue) result = fl_value_new_bool(FALSE);
-    response = FL_METHOD_RESPONSE(fl_method_success_response_new(result));
+
+  const uint64_t now_ns = gameframework_unreal::MonotonicNanoseconds();
+  g_autoptr(FlValue) result = fl_value_new_map();
+  fl_value_set_string_take(result, "version",
+                           fl_value_new_int(snapshot.version));
+  fl_value_set_string_take(
+      result, "ageMs",
+      fl_value_new_float(snapshot.write_time_ns > 0 &&
+                                 now_ns > snapshot.write_time_ns
+                             ? (now_ns - snapshot.write_time_ns) / 1e6
+                             : 0));
+  fl_value_set_string_take(result, "fields", fields);
+  return FL_METHOD_RESPONSE(fl_method_success_response_new(result));
+}
+
+static FlMethodResponse* frame_texture_get_statistics(
+    UnrealEnginePlugin* self, FlMethodCall* method_call) {
+  UnrealFrameTexture* texture =
+      lookup_frame_texture(self, fl_method_call_get_args(method_call));
+  if (texture == nullptr) {
+    return FL_METHOD_RESPONSE(fl_method_error_response_new(
+        "INVALID_ARGUMENT", "Unknown frame texture", nullptr));
   }
-  else {
-    response = FL_METHOD_RESPONSE(fl_method_not_implemented_response_new());
+  g_autoptr(FlValue) result = unreal_frame_texture_get_statistics(texture);
+  return FL_METHOD_RESPONSE(fl_method_success_response_new(result));
+}
+
+static FlMethodResponse* frame_texture_dispose(UnrealEnginePlugin* self,
+                                               FlMethodCall* method_call) {
+  const int64_t texture_id =
+      get_int_arg(fl_method_call_get_args(method_call), "textureId", -1);
+  gpointer texture = g_hash_table_lookup(self->frame_textures, &texture_id);
+  if (texture != nullptr) {
+    release_frame_texture_cb(nullptr, texture, self);
+    g_hash_table_remove(self->frame_textures, &texture_id);
   }
+  return FL_METHOD_RESPONSE(fl_method_success_response_new(nullptr));
+}
+
+// Called when a method call is received from Flutter.
+static void unreal_engine_plugin_handle_method_call(
+    UnrealEnginePlugin* self,
+    FlMethodCall* method_call) {
+  static gameframework::MethodDispatcher<UnrealEnginePlugin> dispatcher({
+      {"getPlatformVersion", get_platform_version},
+      {"getEngineType", get_engine_type},
+      {"getEngineVersion", get_engine_version},
+      {"isEngineSupported", is_engine_supported},
+      {"engine#create", engine_create},
+      {"engine#pause", engine_not_implemented},
+      {"engine#resume", engine_not_implemented},
+      {"engine#unload", engine_not_implemented},
+      {"engine#quit", engine_not_implemented},
+      {"engine#sendMessage", engine_send_message},
+      {"engine#sendJsonMessage", engine_send_json_message},
+      {"engine#executeConsoleCommand", engine_execute_console_command},
+      {"engine#loadLevel", engine_load_level},
+      {"engine#applyQualitySettings", engine_not_implemented},
+      {"engine#getQualitySettings", engine_get_quality_settings},
+      {"engine#isInBackground", engine_is_in_background},
+      {"engine#getConnectionInfo", engine_get_connection_info},
+      {"frameTexture#create", frame_texture_create},
+      {"frameTexture#getStatistics", frame_texture_get_statistics},
+      {"frameTexture#dispose", frame_texture_dispose},
+      {"stateMirror#read", state_mirror_read},
+  });
 
-  fl_method_call_respond(method_call, response, nullptr);
+  dispatcher.Dispatch(self, method_call);
 }
 
 static void unreal_engine_plugin_dispose(GObject* object) {
+  UnrealEnginePlugin* self = UNREAL_ENGINE_PLUGIN(object);
+
+  if (self->frame_textures != nullptr) {
+    g_hash_table_foreach_remove(self->frame_textures,
+                                release_frame_texture_cb, self);
+    g_clear_pointer(&self->frame_textures, g_hash_table_destroy);
+  }
+  g_clear_object(&self->texture_registrar);
+  // Workers first: they may still use the transport
+  if (self->workers != nullptr) {
+    self->workers->Shutdown();
+    delete self->workers;
+    self->workers = nullptr;
+  }
+  delete self->transport;
+  self->transport = nullptr;
+  self->events = nullptr;
+  delete self->state_mirror;
+  self->state_mirror = nullptr;
+
   G_OBJECT_CLASS(unreal_engine_plugin_parent_class)->dispose(object);
 }
 
@@ -108,7 +657,12 @@ static void unreal_engine_plugin_class_init(UnrealEnginePluginClass* klass) {
   G_OBJECT_CLASS(klass)->dispose = unreal_engine_plugin_dispose;
 }
 
-static void unreal_engine_plugin_init(UnrealEnginePlugin* self) {}
+static void unreal_engine_plugin_init(UnrealEnginePlugin* self) {
+  self->frame_textures = g_hash_table_new_full(g_int64_hash, g_int64_equal,
+                                               g_free, g_object_unref);
+  self->workers =
+      new gameframework::WorkerPool(kWorkerThreads, invoke_on_main_context);
+}
 
 static void method_call_cb(FlMethodChannel* channel, FlMethodCall* method_call,
                             gpointer user_data) {
@@ -119,6 +673,8 @@ static void method_call_cb(FlMethodChannel* channel, FlMethodCall* method_call,
 void unreal_engine_plugin_register_with_registrar(FlPluginRegistrar* registrar) {
   UnrealEnginePlugin* plugin = UNREAL_ENGINE_PLUGIN(
       g_object_new(unreal_engine_plugin_get_type(), nullptr));
+  plugin->texture_registrar = FL_TEXTURE_REGISTRAR(
+      g_object_ref(fl_plugin_registrar_get_texture_registrar(registrar)));
 
   g_autoptr(FlStandardMethodCodec) codec = fl_standard_method_codec_new();
   g_autoptr(FlMethodChannel) channel =
@@ -129,5 +685,44 @@ void unreal_engine_plugin_register_with_registrar(FlPluginRegistrar* registrar)
                                              g_object_ref(plugin),
                                              g_object_unref);
 
+  // Control calls stay on the method channel; high-rate engine messages can
+  // take the raw lane next to it
+  fl_binary_messenger_set_message_handler_on_channel(
+      fl_plugin_registrar_get_messenger(registrar), kMessageLaneChannel,
+      post_engine_messages, g_object_ref(plugin), g_object_unref);
+
+  auto events = std::make_shared<gameframework::EventStream>(
+      fl_plugin_registrar_get_messenger(registrar), kEventChannel);
+
+  // The engine process connects to this socket; the app passes the path on,
+  // e.g. as -FlutterSocket=<path> (see engine#getConnectionInfo)
+  g_autofree gchar* socket_path =
+      g_strdup_printf("%s/gameframework_unreal_%d.sock",
+                      g_get_user_runtime_dir(), getpid());
+  std::string error;
+  plugin->transport =
+      EngineTransport::Listen(
+          socket_path, dispatch_to_main_loop,
+          [events](EngineOp op, const std::string& payload) {
+            forward_engine_event(events.get(), op, payload);
+          },
+          &error)
+          .release();
+  if (plugin->transport == nullptr) {
+    g_warning("Unreal engine transport unavailable: %s", error.c_str());
+  } else {
+    plugin->events = events.get();
+  }
+
+  // The engine writes its HUD state here, e.g. with
+  // -FlutterStateMirror=<name> (see engine#getConnectionInfo)
+  g_autofree gchar* state_mirror_name =
+      g_strdup_printf("/gameframework_unreal_state_%d", getpid());
+  plugin->state_mirror =
+      SharedStateMirror::Create(state_mirror_name, &error).release();
+  if (plugin->state_mirror == nullptr) {
+    g_warning("Unreal state mirror unavailable: %s", error.c_str());
+  }
+
   g_object_unref(plugin);
 }
@@ -0,0 +1,207 @@
+#include "unreal_frame_texture.h"
+
+#include <atomic>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <thread>
+
+#include "frame_buffer.h"
+
+using gameframework_unreal::FrameBufferStatistics;
+using gameframework_unreal::SharedFrame;
+using gameframework_unreal::SharedFrameBuffer;
+
+namespace {
+
+// How long the watcher sleeps between checks that it should still run.
+constexpr int kWatchTimeoutMs = 100;
+
+struct FrameTextureState {
+  std::unique_ptr<SharedFrameBuffer> buffer;
+  std::thread watcher;
+  std::atomic<bool> running{false};
+
+  // Set while a frame-available notification is on its way to Flutter, so a
+  // fast engine cannot queue more notifications than Flutter draws frames.
+  std::atomic<bool> mark_pending{false};
+
+  // AcquireLatest() runs on the raster thread, statistics on the main thread.
+  std::mutex lock;
+  SharedFrame frame;
+};
+
+// Shown until the engine publishes its first frame.
+const uint8_t kEmptyPixel[4] = {0, 0, 0, 0};
+
+}  // namespace
+
+struct _UnrealFrameTexture {
+  FlPixelBufferTexture parent_instance;
+
+  FrameTextureState* state;
+  FlTextureRegistrar* registrar;
+};
+
+G_DEFINE_TYPE(UnrealFrameTexture, unreal_frame_texture,
+              fl_pixel_buffer_texture_get_type())
+
+// Called on the raster thread when Flutter draws the texture.
+static gboolean unreal_frame_texture_copy_pixels(FlPixelBufferTexture* texture,
+                                                 const uint8_t** out_buffer,
+                                                 uint32_t* width,
+                                                 uint32_t* height,
+                                                 GError** error) {
+  FrameTextureState* state = UNREAL_FRAME_TEXTURE(texture)->state;
+
+  // Cleared before picking up the frame so a frame published from here on
+  // gets its own notification.
+  state->mark_pending.store(false, std::memory_order_release);
+
+  std::lock_guard<std::mutex> guard(state->lock);
+  if (state->buffer == nullptr || !state->buffer->AcquireLatest(&state->frame)) {
+    *out_buffer = kEmptyPixel;
+    *width = 1;
+    *height = 1;
+    return TRUE;
+  }
+
+  // Slots are tightly packed RGBA and the slot is not written again until the
+  // next AcquireLatest(), so Flutter can upload straight from shared memory.
+  *out_buffer = state->frame.pixels;
+  *width = state->frame.width;
+  *height = state->frame.height;
+  return TRUE;
+}
+
+static gboolean mark_frame_available_cb(gpointer user_data) {
+  UnrealFrameTexture* self = UNREAL_FRAME_TEXTURE(user_data);
+  if (self->state->running.load(std::memory_order_acquire) &&
+      self->registrar != nullptr) {
+    fl_texture_registrar_mark_texture_frame_available(self->registrar,
+                                                      FL_TEXTURE(self));
+  } else {
+    self->state->mark_pending.store(false, std::memory_order_release);
+  }
+  return G_SOURCE_REMOVE;
+}
+
+static void watch_frames(UnrealFrameTexture* self) {
+  FrameTextureState* state = self->state;
+  uint32_t seen = state->buffer->frame_counter();
+  while (state->running.load(std::memory_order_acquire)) {
+    if (!state->buffer->WaitForFrame(seen, kWatchTimeoutMs)) {
+      continue;
+    }
+    seen = state->buffer->frame_counter();
+    if (!state->mark_pending.exchange(true, std::memory_order_acq_rel)) {
+      g_main_context_invoke_full(nullptr, G_PRIORITY_DEFAULT,
+                                 mark_frame_available_cb, g_object_ref(self),
+                                 g_object_unref);
+    }
+  }
+}
+
+static void unreal_frame_texture_dispose(GObject* object) {
+  UnrealFrameTexture* self = UNREAL_FRAME_TEXTURE(object);
+
+  unreal_frame_texture_stop(self);
+  g_clear_object(&self->registrar);
+  delete self->state;
+  self->state = nullptr;
+
+  G_OBJECT_CLASS(unreal_frame_texture_parent_class)->dispose(object);
+}
+
+static void unreal_frame_texture_class_init(UnrealFrameTextureClass* klass) {
+  G_OBJECT_CLASS(klass)->dispose = unreal_frame_texture_dispose;
+  FL_PIXEL_BUFFER_TEXTURE_CLASS(klass)->copy_pixels =
+      unreal_frame_texture_copy_pixels;
+}
+
+static void unreal_frame_texture_init(UnrealFrameTexture* self) {
+  self->state = new FrameTextureState();
+}
+
+UnrealFrameTexture* unreal_frame_texture_new(const gchar* name,
+                                             uint32_t max_width,
+                                             uint32_t max_height,
+                                             GError** error) {
+  std::string message;
+  std::unique_ptr<SharedFrameBuffer> buffer =
+      SharedFrameBuffer::Create(name, max_width, max_height, &message);
+  if (buffer == nullptr) {
+    g_set_error(error, G_FILE_ERROR, G_FILE_ERROR_FAILED, "%s",
+                message.c_str());
+    return nullptr;
+  }
+
+  UnrealFrameTexture* self = UNREAL_FRAME_TEXTURE(
+      g_object_new(unreal_frame_texture_get_type(), nullptr));
+  self->state->buffer = std::move(buffer);
+  return self;
+}
+
+void unreal_frame_texture_start(UnrealFrameTexture* self,
+                                FlTextureRegistrar* registrar) {
+  g_return_if_fail(UNREAL_IS_FRAME_TEXTURE(self));
+  FrameTextureState* state = self->state;
+  if (state->running.exchange(true)) {
+    return;
+  }
+
+  g_set_object(&self->registrar, registrar);
+  state->watcher = std::thread(watch_frames, self);
+}
+
+void unreal_frame_texture_stop(UnrealFrameTexture* self) {
+  g_return_if_fail(UNREAL_IS_FRAME_TEXTURE(self));
+  FrameTextureState* state = self->state;
+  if (state == nullptr || !state->running.exchange(false)) {
+    return;
+  }
+
+  // Closing the segment wakes the watcher without waiting for its timeout
+  state->buffer->Close();
+  if (state->watcher.joinable()) {
+    state->watcher.join();
+  }
+}
+
+const gchar* unreal_frame_texture_get_name(UnrealFrameTexture* self) {
+  g_return_val_if_fail(UNREAL_IS_FRAME_TEXTURE(self), nullptr);
+  return self->state->buffer->name().c_str();
+}
+
+FlValue* unreal_frame_texture_get_statistics(UnrealFrameTexture* self) {
+  g_return_val_if_fail(UNREAL_IS_FRAME_TEXTURE(self), nullptr);
+  FrameTextureState* state = self->state;
+
+  std::lock_guard<std::mutex> guard(state->lock);
+  const FrameBufferStatistics stats = state->buffer->GetStatistics();
+
+  FlValue* result = fl_value_new_map();
+  fl_value_set_string_take(result, "framesPublished",
+                           fl_value_new_int(stats.frames_published));
+  fl_value_set_string_take(result, "framesRejected",
+                           fl_value_new_int(stats.frames_rejected));
+  fl_value_set_string_take(result, "framesDrawn",
+                           fl_value_new_int(stats.frames_acquired));
+  fl_value_set_string_take(result, "framesSkipped",
+                           fl_value_new_int(stats.frames_skipped));
+  fl_value_set_string_take(result, "lastSequence",
+                           fl_value_new_int(stats.last_sequence));
+  fl_value_set_string_take(result, "width",
+                           fl_value_new_int(state->frame.width));
+  fl_value_set_string_take(result, "height",
+                           fl_value_new_int(state->frame.height));
+  fl_value_set_string_take(result, "lastCopyMs",
+                           fl_value_new_float(stats.last_copy_ms));
+  fl_value_set_string_take(result, "averageCopyMs",
+                           fl_value_new_float(stats.average_copy_ms));
+  fl_value_set_string_take(result, "maxCopyMs",
+                           fl_value_new_float(stats.max_copy_ms));
+  fl_value_set_string_take(result, "lastLatencyMs",
+                           fl_value_new_float(stats.last_latency_ms));
+  return result;
+}
@@ -0,0 +1,41 @@
+#ifndef FLUTTER_PLUGIN_UNREAL_FRAME_TEXTURE_H_
+#define FLUTTER_PLUGIN_UNREAL_FRAME_TEXTURE_H_
+
+#include <flutter_linux/flutter_linux.h>
+
+G_BEGIN_DECLS
+
+// Pixel buffer texture showing the frames the Unreal engine process publishes
+// into a shared frame buffer (see frame_buffer.h).
+//
+// A watcher thread waits on the buffer and tells Flutter a frame is available,
+// at most once per frame Flutter actually draws; Flutter then copies whatever
+// frame is latest at that moment. The engine never waits for Flutter.
+G_DECLARE_FINAL_TYPE(UnrealFrameTexture, unreal_frame_texture, UNREAL,
+                     FRAME_TEXTURE, FlPixelBufferTexture)
+
+// Creates the shared memory segment |name| with room for frames up to
+// |max_width| x |max_height|. Nothing is watched until
+// unreal_frame_texture_start(). Returns nullptr and sets |error| on failure.
+UnrealFrameTexture* unreal_frame_texture_new(const gchar* name,
+                                             uint32_t max_width,
+                                             uint32_t max_height,
+                                             GError** error);
+
+// Starts signalling new frames to |registrar|, which the texture must already
+// be registered with.
+void unreal_frame_texture_start(UnrealFrameTexture* texture,
+                                FlTextureRegistrar* registrar);
+
+// Stops the watcher thread; safe to call more than once.
+void unreal_frame_texture_stop(UnrealFrameTexture* texture);
+
+// Name of the shared memory segment the engine should publish to.
+const gchar* unreal_frame_texture_get_name(UnrealFrameTexture* texture);
+
+// Frame counts and per-frame copy cost, as a map for the method channel.
+FlValue* unreal_frame_texture_get_statistics(UnrealFrameTexture* texture);
+
+G_END_DECLS
+
+#endif  // FLUTTER_PLUGIN_UNREAL_FRAME_TEXTURE_H_
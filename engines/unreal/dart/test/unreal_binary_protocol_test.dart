@@ -1,3 +1,5 @@
+import 'dart:convert';
+import 'dart:io';
 import 'dart:typed_data';
 import 'package:flutter_test/flutter_test.dart';
 import 'package:gameframework_unreal/src/unreal_binary_protocol.dart';
@@ -102,6 +104,51 @@ void main() {
       });
     });
 
+    group('Codec envelopes', () {
+      Uint8List envelope(int codec, int size, List<int> body) {
+        final header = ByteData(8)
+          ..setUint8(0, 0x46)
+          ..setUint8(1, 0x43)
+          ..setUint8(2, codec)
+          ..setUint32(4, size, Endian.little);
+        return Uint8List.fromList([...header.buffer.asUint8List(), ...body]);
+      }
+
+      test('decodes zlib envelopes', () {
+        final original =
+            Uint8List.fromList(List.generate(4000, (i) => (i ~/ 8) % 256));
+        final data = envelope(UnrealBinaryProtocol.envelopeCodecZlib,
+            original.length, zlib.encode(original));
+
+        expect(protocol.isCompressed(data), isTrue);
+        expect(protocol.decompressData(data), equals(original));
+      });
+
+      test('decodes LZ4 blocks with overlapping matches', () {
+        // Literals "abcd", then an 8 byte match at offset 4
+        final data = envelope(UnrealBinaryProtocol.envelopeCodecLz4, 12,
+            [0x44, 0x61, 0x62, 0x63, 0x64, 0x04, 0x00]);
+
+        expect(utf8.decode(protocol.decompressData(data)),
+            equals('abcdabcdabcd'));
+      });
+
+      test('rejects envelopes whose size does not match', () {
+        final data = envelope(UnrealBinaryProtocol.envelopeCodecLz4, 13,
+            [0x44, 0x61, 0x62, 0x63, 0x64, 0x04, 0x00]);
+
+        expect(() => protocol.decompressData(data),
+            throwsA(isA<BinaryProtocolException>()));
+      });
+
+      test('leaves unknown codecs untouched', () {
+        final data = envelope(9, 3, [1, 2, 3]);
+
+        expect(protocol.isCompressed(data), isFalse);
+        expect(protocol.decompressData(data), equals(data));
+      });
+    });
+
     group('Checksum verification', () {
       test('verifyChecksum validates correctly', () {
         final data = Uint8List.fromList([1, 2, 3, 4, 5]);
@@ -303,6 +350,65 @@ void main() {
       });
     });
 
+    group('Batch frames', () {
+      Uint8List buildFrame(List<List<String>> messages) {
+        final bytes = BytesBuilder();
+        final header = ByteData(8)
+          ..setUint8(0, 0x46)
+          ..setUint8(1, 0x42)
+          ..setUint8(2, 1)
+          ..setUint32(4, messages.length, Endian.little);
+        bytes.add(header.buffer.asUint8List());
+        for (final message in messages) {
+          for (final field in message) {
+            final encoded = utf8.encode(field);
+            final length = ByteData(4)
+              ..setUint32(0, encoded.length, Endian.little);
+            bytes.add(length.buffer.asUint8List());
+            bytes.add(encoded);
+          }
+        }
+        return bytes.toBytes();
+      }
+
+      test('decodes messages in order', () {
+        final frame = buildFrame([
+          ['GameManager', 'onScore', '{"score":10}'],
+          ['Player', 'onMove', ''],
+          ['Chat', 'onText', 'héllo ✓'],
+        ]);
+
+        expect(protocol.isBatchFrame(frame), isTrue);
+
+        final messages = protocol.decodeBatchFrame(frame);
+        expect(messages.length, equals(3));
+        expect(messages[0].target, equals('GameManager'));
+        expect(messages[0].data, equals('{"score":10}'));
+        expect(messages[1].data, isEmpty);
+        expect(messages[2].data, equals('héllo ✓'));
+      });
+
+      test('rejects non-batch data', () {
+        final data = Uint8List.fromList([1, 2, 3, 4, 5, 6, 7, 8]);
+        expect(protocol.isBatchFrame(data), isFalse);
+        expect(
+          () => protocol.decodeBatchFrame(data),
+          throwsA(isA<BinaryProtocolException>()),
+        );
+      });
+
+      test('rejects truncated frames', () {
+        final frame = buildFrame([
+          ['GameManager', 'onScore', '{"score":10}'],
+        ]);
+        expect(
+          () => protocol.decodeBatchFrame(
+              Uint8List.sublistView(frame, 0, frame.length - 3)),
+          throwsA(isA<BinaryProtocolException>()),
+        );
+      });
+    });
+
     group('Configuration', () {
       test('configure changes chunk size', () {
         protocol.configure(chunkSize: 1024);
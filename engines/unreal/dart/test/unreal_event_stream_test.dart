@@ -0,0 +1,67 @@
+import 'package:flutter/services.dart';
+import 'package:flutter_test/flutter_test.dart';
+import 'package:gameframework_unreal/src/unreal_event_stream.dart';
+
+void main() {
+  TestWidgetsFlutterBinding.ensureInitialized();
+
+  Map<String, Object> message(String target, String method, String data) {
+    return {
+      'event': 'onMessage',
+      'data': {'target': target, 'method': method, 'data': data},
+    };
+  }
+
+  group('UnrealEventStream', () {
+    test('flattens single events and batches', () {
+      final single = message('Player', 'onScore', '10');
+      expect(UnrealEventStream.flatten(single), [single]);
+
+      final batch = [
+        message('Player', 'onStateSync', '3'),
+        {'event': 'onSceneLoaded', 'data': null},
+      ];
+      expect(UnrealEventStream.flatten(batch), batch);
+      expect(UnrealEventStream.flatten(null), isEmpty);
+    });
+
+    test('asks the plugin to coalesce message keys', () async {
+      final messenger =
+          TestDefaultBinaryMessengerBinding.instance.defaultBinaryMessenger;
+      const codec = StandardMethodCodec();
+      Object? listenArguments;
+      messenger.setMockMessageHandler(UnrealEventStream.channel,
+          (ByteData? data) async {
+        final call = codec.decodeMethodCall(data);
+        if (call.method != 'listen') {
+          return codec.encodeSuccessEnvelope(null);
+        }
+        listenArguments = call.arguments;
+        for (final event in [
+          message('Player', 'onScore', '10'),
+          [
+            message('Player', 'onStateSync', '3'),
+            message('Player', 'onScore', '20'),
+          ],
+        ]) {
+          await messenger.handlePlatformMessage(UnrealEventStream.channel,
+              codec.encodeSuccessEnvelope(event), (_) {});
+        }
+        return codec.encodeSuccessEnvelope(null);
+      });
+      addTearDown(
+          () => messenger.setMockMessageHandler(UnrealEventStream.channel, null));
+
+      final stream = UnrealEventStream(
+        coalesce: [UnrealEventStream.messageKey('Player', 'onStateSync')],
+      );
+      final messages = await stream.messages.take(3).toList();
+
+      expect(listenArguments, {
+        'coalesce': ['Player/onStateSync'],
+      });
+      expect(messages.map((m) => m.data), ['10', '3', '20']);
+      expect(messages[1].method, 'onStateSync');
+    });
+  });
+}
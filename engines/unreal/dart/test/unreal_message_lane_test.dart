@@ -0,0 +1,77 @@
+import 'dart:convert';
+import 'dart:typed_data';
+
+import 'package:flutter/services.dart';
+import 'package:flutter_test/flutter_test.dart';
+import 'package:gameframework/gameframework.dart';
+import 'package:gameframework_unreal/src/unreal_message_lane.dart';
+
+void main() {
+  TestWidgetsFlutterBinding.ensureInitialized();
+
+  List<List<Object>> decodeFrames(ByteData data) {
+    final frames = <List<Object>>[];
+    var offset = 0;
+    while (offset < data.lengthInBytes) {
+      final length = data.getUint32(offset, Endian.little);
+      final type = data.getUint8(offset + 4);
+      final op = data.getUint8(offset + 5);
+      final requestId = data.getUint32(offset + 8, Endian.little);
+      final end = offset + 4 + length;
+      offset += 12;
+
+      final fields = <String>[];
+      while (offset < end) {
+        final fieldLength = data.getUint32(offset, Endian.little);
+        fields.add(utf8.decode(
+            data.buffer.asUint8List(offset + 4, fieldLength)));
+        offset += 4 + fieldLength;
+      }
+      frames.add([type, op, requestId, ...fields]);
+    }
+    return frames;
+  }
+
+  group('UnrealMessageLane', () {
+    test('encodes posted request frames in order', () {
+      final data = UnrealMessageLane.encode(const [
+        UnrealLaneMessage('GameManager', 'onScore', '{"score":10}',
+            isJson: true),
+        UnrealLaneMessage('Player', 'Move', ''),
+        UnrealLaneMessage('Chat', 'Say', 'héllo ✓'),
+      ]);
+
+      expect(decodeFrames(data), [
+        [1, 2, 0, 'GameManager', 'onScore', '{"score":10}'],
+        [1, 1, 0, 'Player', 'Move', ''],
+        [1, 1, 0, 'Chat', 'Say', 'héllo ✓'],
+      ]);
+    });
+
+    test('reports the plugin status', () async {
+      final messenger =
+          TestDefaultBinaryMessengerBinding.instance.defaultBinaryMessenger;
+      final lane = UnrealMessageLane(messenger: messenger);
+      var status = 0;
+      ByteData? received;
+      messenger.setMockMessageHandler(UnrealMessageLane.channel,
+          (message) async {
+        received = message;
+        return ByteData(1)..setUint8(0, status);
+      });
+      addTearDown(() =>
+          messenger.setMockMessageHandler(UnrealMessageLane.channel, null));
+
+      await lane.sendMessage('Player', 'Move', '1,2');
+      expect(decodeFrames(received!), [
+        [1, 1, 0, 'Player', 'Move', '1,2'],
+      ]);
+
+      status = 1;
+      await expectLater(
+        lane.sendJsonMessage('Player', 'Move', {'x': 1}),
+        throwsA(isA<EngineCommunicationException>()),
+      );
+    });
+  });
+}
@@ -0,0 +1,88 @@
+import 'package:flutter/services.dart';
+import 'package:flutter_test/flutter_test.dart';
+import 'package:gameframework/gameframework.dart';
+import 'package:gameframework_unreal/src/unreal_state_mirror.dart';
+
+void main() {
+  TestWidgetsFlutterBinding.ensureInitialized();
+
+  const channel = MethodChannel('gameframework_unreal');
+  final messenger =
+      TestDefaultBinaryMessengerBinding.instance.defaultBinaryMessenger;
+
+  // Answers like the plugin: null while the version is still sinceVersion
+  var version = 1;
+  var fields = <String, Object>{'score': 10, 'isPaused': false};
+  final sinceVersions = <Object?>[];
+
+  setUp(() {
+    version = 1;
+    fields = {'score': 10, 'isPaused': false};
+    sinceVersions.clear();
+    messenger.setMockMethodCallHandler(channel, (call) async {
+      expect(call.method, 'stateMirror#read');
+      final since = (call.arguments as Map)['sinceVersion'];
+      sinceVersions.add(since);
+      if (since == version) {
+        return null;
+      }
+      return {'version': version, 'ageMs': 0.5, 'fields': fields};
+    });
+  });
+
+  tearDown(() => messenger.setMockMethodCallHandler(channel, null));
+
+  group('UnrealStateMirror', () {
+    test('reads typed fields', () async {
+      fields = {'score': 1200, 'health': 0.75, 'isPaused': true};
+      final snapshot = await UnrealStateMirror().read();
+
+      expect(snapshot.version, 1);
+      expect(snapshot.ageMs, 0.5);
+      expect(snapshot['score'], 1200);
+      expect(snapshot['health'], 0.75);
+      expect(snapshot['isPaused'], true);
+      expect(snapshot['level'], isNull);
+    });
+
+    test('keeps the last snapshot while the version is unchanged', () async {
+      final mirror = UnrealStateMirror();
+      final first = await mirror.read();
+      expect(await mirror.read(), same(first));
+
+      version = 2;
+      fields = {'score': 20, 'isPaused': false};
+      final second = await mirror.read();
+      expect(second.version, 2);
+      expect(second['score'], 20);
+      expect(sinceVersions, [-1, 1, 1]);
+    });
+
+    test('watch reports changes only', () async {
+      final mirror = UnrealStateMirror();
+      final scores = <Object?>[];
+      final subscription = mirror
+          .watch(interval: const Duration(milliseconds: 5))
+          .listen((snapshot) => scores.add(snapshot['score']));
+
+      await Future<void>.delayed(const Duration(milliseconds: 30));
+      version = 2;
+      fields = {'score': 11, 'isPaused': false};
+      await Future<void>.delayed(const Duration(milliseconds: 30));
+      await subscription.cancel();
+
+      expect(scores, [10, 11]);
+    });
+
+    test('reports plugin errors', () async {
+      messenger.setMockMethodCallHandler(channel, (call) async {
+        throw PlatformException(code: 'UNAVAILABLE');
+      });
+
+      await expectLater(
+        UnrealStateMirror().read(),
+        throwsA(isA<EngineCommunicationException>()),
+      );
+    });
+  });
+}
@@ -0,0 +1,1259 @@
+// Copyright Epic Games, Inc. All Rights Reserved.
+
+#include "MockJNIEnv.h"
+#include "CoreMinimal.h"
+#include "android/native_window_jni.h"
+#include <cstdlib>
+#include <cstring>
+#include <thread>
+
+// ============================================================
+// MARK: - Object Model
+// ============================================================
+
+namespace MockJNI
+{
+	struct FClass;
+
+	/** Reference bookkeeping shared by every mock Java object */
+	struct FRefs
+	{
+		virtual ~FRefs() = default;
+
+		FClass* Class = nullptr;
+		int32_t LocalRefs = 0;
+		int32_t GlobalRefs = 0;
+
+		/** Held by another Java object (a map entry, an iterator's map) */
+		int32_t Holds = 0;
+
+		/** Never freed: classes, and surfaces whose window native code may keep */
+		bool bPinned = false;
+
+		/** Objects this one keeps alive */
+		std::vector<jobject> Held;
+	};
+
+	/** Argument or return value of a Java method */
+	struct FValue
+	{
+		jobject Object = nullptr;
+		int64_t Int = 0;
+		double Float = 0.0;
+	};
+
+	typedef std::function<FValue(jobject Self, const std::vector<FValue>& Args)> FHandler;
+
+	struct FMethod
+	{
+		std::string Name;
+		std::string Signature;
+		bool bStatic = false;
+		FHandler Handler;
+
+		/** Argument type codes from the signature, one per argument: L, I, J or D (after promotion) */
+		std::vector<char> ArgTypes;
+		char ReturnType = 'V';
+	};
+
+	struct FClass : _jclass, FRefs
+	{
+		std::string Name;
+		FClass* Super = nullptr;
+		std::unordered_map<std::string, FMethod*> Methods;
+	};
+
+	struct FJavaString : _jstring, FRefs
+	{
+		std::u16string Value;
+	};
+
+	struct FByteArray : _jbyteArray, FRefs
+	{
+		std::vector<uint8_t> Bytes;
+	};
+
+	/** Every other object; which fields mean anything depends on the class */
+	struct FObject : _jobject, FRefs
+	{
+		int64_t IntValue = 0;
+		size_t Position = 0;
+		void* Address = nullptr;
+		int64_t Capacity = 0;
+		ANativeWindow Window = { 0, 0, 0 };
+	};
+
+	/** Split "(Ljava/lang/String;I[B)V" into promoted argument types and the return type */
+	static void ParseSignature(const std::string& Signature, std::vector<char>& OutArgs, char& OutReturn)
+	{
+		OutArgs.clear();
+		size_t Index = 1;
+		while (Index < Signature.size() && Signature[Index] != ')')
+		{
+			char Type = Signature[Index];
+			while (Type == '[')
+			{
+				Type = 'L';
+				++Index;
+				if (Signature[Index] != '[' && Signature[Index] != 'L')
+				{
+					break;
+				}
+			}
+
+			if (Signature[Index] == 'L')
+			{
+				Index = Signature.find(';', Index);
+				Type = 'L';
+			}
+
+			switch (Type)
+			{
+			case 'L': OutArgs.push_back('L'); break;
+			case 'J': OutArgs.push_back('J'); break;
+			case 'F':
+			case 'D': OutArgs.push_back('D'); break;
+			default: OutArgs.push_back('I'); break;
+			}
+			++Index;
+		}
+
+		const char Return = Index + 1 < Signature.size() ? Signature[Index + 1] : 'V';
+		OutReturn = Return == '[' ? 'L' : Return;
+	}
+
+	static thread_local bool bThreadAttached = false;
+	static std::thread::id MainThread;
+}
+
+using namespace MockJNI;
+
+// ============================================================
+// MARK: - FImpl
+// ============================================================
+
+struct FMockJNI::FImpl
+{
+	FMockJNI& Owner;
+
+	JNINativeInterface Functions;
+	JNIInvokeInterface InvokeFunctions;
+
+	FMockJNICounters Counters;
+
+	std::unordered_map<_jobject*, std::unique_ptr<_jobject>> Live;
+	std::unordered_map<std::string, FClass*> Classes;
+	std::vector<std::unique_ptr<FMethod>> Methods;
+	int32_t NumControllerClasses = 0;
+
+	explicit FImpl(FMockJNI& InOwner)
+		: Owner(InOwner)
+	{
+	}
+
+	static FImpl& From(JNIEnv* Env) { return *FMockJNI::Get().Impl; }
+	static std::recursive_mutex& GetMutex() { return FMockJNI::Get().Mutex; }
+
+	// ------------------------------------------------------------
+	// Errors and exceptions
+	// ------------------------------------------------------------
+
+	void Error(const std::string& Message)
+	{
+		Owner.Errors.push_back(Message);
+	}
+
+	void Throw(const std::string& Exception)
+	{
+		if (Owner.PendingException.empty())
+		{
+			Owner.PendingException = Exception;
+		}
+	}
+
+	void ClearException()
+	{
+		Owner.PendingException.clear();
+	}
+
+	/** JNI functions other than the exception and delete functions must not run with an exception pending */
+	void CheckNoPending(const char* Function)
+	{
+		if (!Owner.PendingException.empty())
+		{
+			Error(std::string(Function) + " called with " + Owner.PendingException + " pending");
+		}
+	}
+
+	// ------------------------------------------------------------
+	// References
+	// ------------------------------------------------------------
+
+	FRefs* Resolve(jobject Object, const char* Function)
+	{
+		if (!Object)
+		{
+			return nullptr;
+		}
+
+		const auto It = Live.find(Object);
+		if (It == Live.end())
+		{
+			Error(std::string(Function) + " used a deleted or unknown reference");
+			return nullptr;
+		}
+		return dynamic_cast<FRefs*>(It->second.get());
+	}
+
+	template <typename T>
+	T* ResolveAs(jobject Object, const char* Function)
+	{
+		FRefs* Refs = Resolve(Object, Function);
+		T* Typed = Refs ? dynamic_cast<T*>(Refs) : nullptr;
+		if (Refs && !Typed)
+		{
+			Error(std::string(Function) + " got an object of the wrong type");
+		}
+		return Typed;
+	}
+
+	template <typename T>
+	T* Allocate(FClass* Class)
+	{
+		std::unique_ptr<T> Object(new T());
+		T* Raw = Object.get();
+		Raw->Class = Class;
+		Live.emplace(static_cast<_jobject*>(Raw), std::move(Object));
+		return Raw;
+	}
+
+	/** Hand an object to native code as a new local reference */
+	jobject NewLocal(jobject Object)
+	{
+		if (FRefs* Refs = Resolve(Object, "NewLocal"))
+		{
+			++Refs->LocalRefs;
+			++Counters.LocalRefsCreated;
+		}
+		return Object;
+	}
+
+	void Hold(jobject Holder, jobject Object)
+	{
+		FRefs* HolderRefs = Resolve(Holder, "Hold");
+		FRefs* Refs = Resolve(Object, "Hold");
+		if (HolderRefs && Refs)
+		{
+			++Refs->Holds;
+			HolderRefs->Held.push_back(Object);
+		}
+	}
+
+	void MaybeFree(jobject Object)
+	{
+		const auto It = Live.find(Object);
+		if (It == Live.end())
+		{
+			return;
+		}
+
+		FRefs* Refs = dynamic_cast<FRefs*>(It->second.get());
+		if (Refs->bPinned || Refs->LocalRefs > 0 || Refs->GlobalRefs > 0 || Refs->Holds > 0)
+		{
+			return;
+		}
+
+		std::vector<jobject> Held = std::move(Refs->Held);
+		Live.erase(It);
+
+		for (jobject Child : Held)
+		{
+			const auto ChildIt = Live.find(Child);
+			if (ChildIt != Live.end())
+			{
+				--dynamic_cast<FRefs*>(ChildIt->second.get())->Holds;
+				MaybeFree(Child);
+			}
+		}
+	}
+
+	// ------------------------------------------------------------
+	// Classes and methods
+	// ------------------------------------------------------------
+
+	FClass* DefineClass(const std::string& Name, FClass* Super = nullptr)
+	{
+		FClass* Class = Allocate<FClass>(nullptr);
+		Class->Name = Name;
+		Class->Super = Super;
+		Class->bPinned = true;
+		Classes[Name] = Class;
+		return Class;
+	}
+
+	FMethod* DefineMethod(FClass* Class, const std::string& Name, const std::string& Signature, FHandler Handler, bool bStatic = false)
+	{
+		std::unique_ptr<FMethod> Method(new FMethod());
+		Method->Name = Name;
+		Method->Signature = Signature;
+		Method->bStatic = bStatic;
+		Method->Handler = std::move(Handler);
+		ParseSignature(Signature, Method->ArgTypes, Method->ReturnType);
+
+		FMethod* Raw = Method.get();
+		Methods.push_back(std::move(Method));
+		Class->Methods[Name + Signature] = Raw;
+		return Raw;
+	}
+
+	FMethod* FindMethod(FClass* Class, const std::string& Name, const std::string& Signature)
+	{
+		for (FClass* Current = Class; Current; Current = Current->Super)
+		{
+			const auto It = Current->Methods.find(Name + Signature);
+			if (It != Current->Methods.end())
+			{
+				return It->second;
+			}
+		}
+		return nullptr;
+	}
+
+	FJavaString* MakeString(const std::u16string& Value)
+	{
+		FJavaString* String = Allocate<FJavaString>(Classes["java/lang/String"]);
+		String->Value = Value;
+		return String;
+	}
+
+	std::vector<FValue> ReadArgs(const FMethod* Method, va_list Args)
+	{
+		std::vector<FValue> Values;
+		for (const char Type : Method->ArgTypes)
+		{
+			FValue Value;
+			switch (Type)
+			{
+			case 'L': Value.Object = va_arg(Args, jobject); break;
+			case 'J': Value.Int = va_arg(Args, jlong); break;
+			case 'D': Value.Float = va_arg(Args, double); break;
+			default: Value.Int = va_arg(Args, int); break;
+			}
+
+			if (Type == 'L' && Value.Object && !Resolve(Value.Object, Method->Name.c_str()))
+			{
+				Value.Object = nullptr;
+			}
+			Values.push_back(Value);
+		}
+		return Values;
+	}
+
+	FValue Invoke(jobject Self, jmethodID MethodID, va_list Args, const char* Function, bool bStatic)
+	{
+		++Counters.CallMethod;
+		CheckNoPending(Function);
+
+		FMethod* Method = reinterpret_cast<FMethod*>(MethodID);
+		if (!Method)
+		{
+			Error(std::string(Function) + " called with a null method ID");
+			return FValue();
+		}
+		if (Method->bStatic != bStatic)
+		{
+			Error(std::string(Function) + " called " + Method->Name + " with the wrong static-ness");
+			return FValue();
+		}
+		if (!bStatic && !Resolve(Self, Function))
+		{
+			if (!Self)
+			{
+				Error(std::string(Function) + " called " + Method->Name + " on null");
+			}
+			return FValue();
+		}
+
+		FValue Result = Method->Handler(Self, ReadArgs(Method, Args));
+		if (Result.Object)
+		{
+			NewLocal(Result.Object);
+		}
+		return Result;
+	}
+
+	// ------------------------------------------------------------
+	// Built-in Java classes
+	// ------------------------------------------------------------
+
+	std::u16string ToJavaString(jobject Object)
+	{
+		FRefs* Refs = Resolve(Object, "toString");
+		if (FJavaString* String = dynamic_cast<FJavaString*>(Refs))
+		{
+			return String->Value;
+		}
+		if (Refs && Refs->Class == Classes["java/lang/Integer"])
+		{
+			const std::string Digits = std::to_string(static_cast<FObject*>(Refs)->IntValue);
+			return std::u16string(Digits.begin(), Digits.end());
+		}
+		return u"java.lang.Object";
+	}
+
+	void DefineBuiltins()
+	{
+		FClass* Object = DefineClass("java/lang/Object");
+		DefineMethod(Object, "toString", "()Ljava/lang/String;", [this](jobject Self, const std::vector<FValue>&)
+		{
+			FValue Result;
+			Result.Object = MakeString(ToJavaString(Self));
+			return Result;
+		});
+
+		DefineClass("java/lang/String", Object);
+		DefineClass("java/nio/ByteBuffer", Object);
+		DefineClass("android/view/Surface", Object);
+
+		FClass* Integer = DefineClass("java/lang/Integer", Object);
+		DefineMethod(Integer, "valueOf", "(I)Ljava/lang/Integer;", [this, Integer](jobject, const std::vector<FValue>& Args)
+		{
+			FObject* Boxed = Allocate<FObject>(Integer);
+			Boxed->IntValue = Args[0].Int;
+			FValue Result;
+			Result.Object = Boxed;
+			return Result;
+		}, true);
+
+		FClass* Map = DefineClass("java/util/Map", Object);
+		FClass* Set = DefineClass("java/util/Set", Object);
+		FClass* Iterator = DefineClass("java/util/Iterator", Object);
+		FClass* Entry = DefineClass("java/util/Map$Entry", Object);
+		FClass* HashMap = DefineClass("java/util/HashMap", Map);
+
+		DefineMethod(Map, "entrySet", "()Ljava/util/Set;", [this, Set](jobject Self, const std::vector<FValue>&)
+		{
+			FObject* EntrySet = Allocate<FObject>(Set);
+			Hold(EntrySet, Self);
+			FValue Result;
+			Result.Object = EntrySet;
+			return Result;
+		});
+
+		DefineMethod(Set, "iterator", "()Ljava/util/Iterator;", [this, Iterator](jobject Self, const std::vector<FValue>&)
+		{
+			FObject* Iter = Allocate<FObject>(Iterator);
+			Hold(Iter, ResolveAs<FObject>(Self, "iterator")->Held[0]);
+			FValue Result;
+			Result.Object = Iter;
+			return Result;
+		});
+
+		DefineMethod(Iterator, "hasNext", "()Z", [this](jobject Self, const std::vector<FValue>&)
+		{
+			FObject* Iter = ResolveAs<FObject>(Self, "hasNext");
+			FObject* Target = ResolveAs<FObject>(Iter->Held[0], "hasNext");
+			FValue Result;
+			Result.Int = Iter->Position * 2 < Target->Held.size() ? JNI_TRUE : JNI_FALSE;
+			return Result;
+		});
+
+		DefineMethod(Iterator, "next", "()Ljava/lang/Object;", [this, Entry](jobject Self, const std::vector<FValue>&)
+		{
+			FObject* Iter = ResolveAs<FObject>(Self, "next");
+			FObject* Target = ResolveAs<FObject>(Iter->Held[0], "next");
+			FValue Result;
+			if (Iter->Position * 2 >= Target->Held.size())
+			{
+				Throw("java/util/NoSuchElementException");
+				return Result;
+			}
+
+			FObject* Pair = Allocate<FObject>(Entry);
+			Hold(Pair, Target->Held[Iter->Position * 2]);
+			Hold(Pair, Target->Held[Iter->Position * 2 + 1]);
+			++Iter->Position;
+			Result.Object = Pair;
+			return Result;
+		});
+
+		DefineMethod(Entry, "getKey", "()Ljava/lang/Object;", [this](jobject Self, const std::vector<FValue>&)
+		{
+			FValue Result;
+			Result.Object = ResolveAs<FObject>(Self, "getKey")->Held[0];
+			return Result;
+		});
+
+		DefineMethod(Entry, "getValue", "()Ljava/lang/Object;", [this](jobject Self, const std::vector<FValue>&)
+		{
+			FValue Result;
+			Result.Object = ResolveAs<FObject>(Self, "getValue")->Held[1];
+			return Result;
+		});
+
+		DefineMethod(HashMap, "<init>", "(I)V", [](jobject, const std::vector<FValue>&)
+		{
+			return FValue();
+		});
+
+		DefineMethod(HashMap, "put", "(Ljava/lang/Object;Ljava/lang/Object;)Ljava/lang/Object;", [this](jobject Self, const std::vector<FValue>& Args)
+		{
+			FObject* Target = ResolveAs<FObject>(Self, "put");
+			FValue Result;
+			if (!Args[0].Object || !Args[1].Object)
+			{
+				Error("HashMap.put with a null key or value");
+				return Result;
+			}
+
+			const std::u16string Key = ToJavaString(Args[0].Object);
+			for (size_t Index = 0; Index < Target->Held.size(); Index += 2)
+			{
+				if (ToJavaString(Target->Held[Index]) == Key)
+				{
+					// The previous value is returned as a local reference before the map lets go of it
+					Result.Object = Target->Held[Index + 1];
+					--Resolve(Result.Object, "put")->Holds;
+					Target->Held[Index + 1] = Args[1].Object;
+					++Resolve(Args[1].Object, "put")->Holds;
+					return Result;
+				}
+			}
+
+			Hold(Self, Args[0].Object);
+			Hold(Self, Args[1].Object);
+			return Result;
+		});
+	}
+
+	// ------------------------------------------------------------
+	// Controller
+	// ------------------------------------------------------------
+
+	void RecordCall(const FMethod* Method, const std::vector<FValue>& Args)
+	{
+		FMockCall Call;
+		Call.Method = Method->Name;
+
+		for (size_t Index = 0; Index < Args.size(); ++Index)
+		{
+			if (Method->ArgTypes[Index] != 'L')
+			{
+				Call.Numbers.push_back(Method->ArgTypes[Index] == 'D' ? (int64_t)Args[Index].Float : Args[Index].Int);
+				continue;
+			}
+
+			FRefs* Refs = Resolve(Args[Index].Object, Method->Name.c_str());
+			if (FJavaString* String = dynamic_cast<FJavaString*>(Refs))
+			{
+				Call.Strings.push_back(String->Value);
+			}
+			else if (FByteArray* Array = dynamic_cast<FByteArray*>(Refs))
+			{
+				Call.Bytes = Array->Bytes;
+			}
+			else if (FObject* Buffer = dynamic_cast<FObject*>(Refs); Buffer && Buffer->Address)
+			{
+				const uint8_t* Bytes = static_cast<const uint8_t*>(Buffer->Address);
+				Call.Bytes.assign(Bytes, Bytes + Buffer->Capacity);
+			}
+			else if (!Refs)
+			{
+				Call.Strings.push_back(std::u16string());
+			}
+		}
+
+		Owner.Calls.push_back(std::move(Call));
+
+		if (Method->Name == Owner.ThrowingMethod)
+		{
+			Throw("java/lang/RuntimeException");
+		}
+	}
+
+	void DefineControllerMethod(FClass* Class, const char* Name, const char* Signature)
+	{
+		FMethod* Method = DefineMethod(Class, Name, Signature, nullptr);
+		Method->Handler = [this, Method](jobject, const std::vector<FValue>& Args)
+		{
+			RecordCall(Method, Args);
+			return FValue();
+		};
+	}
+};
+
+// ============================================================
+// MARK: - Function Table
+// ============================================================
+
+namespace MockJNI
+{
+	static FMockJNI::FImpl& Impl(JNIEnv* Env) { return FMockJNI::FImpl::From(Env); }
+
+	#define MOCK_JNI_LOCK std::lock_guard<std::recursive_mutex> Lock(FMockJNI::FImpl::GetMutex())
+
+	static jclass FindClass(JNIEnv* Env, const char* Name)
+	{
+		MOCK_JNI_LOCK;
+		FMockJNI::FImpl& Self = Impl(Env);
+		++Self.Counters.FindClass;
+		Self.CheckNoPending("FindClass");
+
+		const auto It = Self.Classes.find(Name);
+		if (It == Self.Classes.end())
+		{
+			Self.Throw("java/lang/NoClassDefFoundError");
+			return nullptr;
+		}
+		return (jclass)Self.NewLocal(It->second);
+	}
+
+	static jboolean ExceptionCheck(JNIEnv* Env)
+	{
+		MOCK_JNI_LOCK;
+		++Impl(Env).Counters.ExceptionCheck;
+		return Impl(Env).Owner.HasPendingException() ? JNI_TRUE : JNI_FALSE;
+	}
+
+	static void ExceptionDescribe(JNIEnv* Env)
+	{
+	}
+
+	static void ExceptionClear(JNIEnv* Env)
+	{
+		MOCK_JNI_LOCK;
+		Impl(Env).ClearException();
+	}
+
+	static jobject NewGlobalRef(JNIEnv* Env, jobject Object)
+	{
+		MOCK_JNI_LOCK;
+		FMockJNI::FImpl& Self = Impl(Env);
+		++Self.Counters.NewGlobalRef;
+		Self.CheckNoPending("NewGlobalRef");
+
+		FRefs* Refs = Self.Resolve(Object, "NewGlobalRef");
+		if (!Refs)
+		{
+			return nullptr;
+		}
+		++Refs->GlobalRefs;
+		return Object;
+	}
+
+	static void DeleteGlobalRef(JNIEnv* Env, jobject Object)
+	{
+		MOCK_JNI_LOCK;
+		FMockJNI::FImpl& Self = Impl(Env);
+		++Self.Counters.DeleteGlobalRef;
+
+		FRefs* Refs = Self.Resolve(Object, "DeleteGlobalRef");
+		if (!Refs)
+		{
+			return;
+		}
+		if (Refs->GlobalRefs <= 0)
+		{
+			Self.Error("DeleteGlobalRef on an object with no global reference");
+			return;
+		}
+		--Refs->GlobalRefs;
+		Self.MaybeFree(Object);
+	}
+
+	static void DeleteLocalRef(JNIEnv* Env, jobject Object)
+	{
+		MOCK_JNI_LOCK;
+		FMockJNI::FImpl& Self = Impl(Env);
+		++Self.Counters.DeleteLocalRef;
+
+		FRefs* Refs = Self.Resolve(Object, "DeleteLocalRef");
+		if (!Refs)
+		{
+			return;
+		}
+		if (Refs->LocalRefs <= 0)
+		{
+			Self.Error("DeleteLocalRef on an object with no local reference");
+			return;
+		}
+		--Refs->LocalRefs;
+		Self.MaybeFree(Object);
+	}
+
+	static jboolean IsSameObject(JNIEnv* Env, jobject A, jobject B)
+	{
+		return A == B ? JNI_TRUE : JNI_FALSE;
+	}
+
+	static jobject NewLocalRef(JNIEnv* Env, jobject Object)
+	{
+		MOCK_JNI_LOCK;
+		FMockJNI::FImpl& Self = Impl(Env);
+		Self.CheckNoPending("NewLocalRef");
+		return Self.NewLocal(Object);
+	}
+
+	static jobject NewObjectV(JNIEnv* Env, jclass Class, jmethodID Method, va_list Args)
+	{
+		MOCK_JNI_LOCK;
+		FMockJNI::FImpl& Self = Impl(Env);
+		++Self.Counters.NewObject;
+		Self.CheckNoPending("NewObject");
+
+		FClass* Target = Self.ResolveAs<FClass>(Class, "NewObject");
+		if (!Target)
+		{
+			return nullptr;
+		}
+
+		FObject* Object = Self.Allocate<FObject>(Target);
+		FMethod* Constructor = reinterpret_cast<FMethod*>(Method);
+		if (Constructor && Constructor->Handler)
+		{
+			Constructor->Handler(Object, Self.ReadArgs(Constructor, Args));
+		}
+		return Self.NewLocal(Object);
+	}
+
+	static jclass GetObjectClass(JNIEnv* Env, jobject Object)
+	{
+		MOCK_JNI_LOCK;
+		FMockJNI::FImpl& Self = Impl(Env);
+		Self.CheckNoPending("GetObjectClass");
+
+		FRefs* Refs = Self.Resolve(Object, "GetObjectClass");
+		return Refs ? (jclass)Self.NewLocal(Refs->Class) : nullptr;
+	}
+
+	static jmethodID LookupMethod(JNIEnv* Env, jclass Class, const char* Name, const char* Signature, bool bStatic)
+	{
+		MOCK_JNI_LOCK;
+		FMockJNI::FImpl& Self = Impl(Env);
+		++Self.Counters.GetMethodID;
+		Self.CheckNoPending("GetMethodID");
+
+		FClass* Target = Self.ResolveAs<FClass>(Class, "GetMethodID");
+		FMethod* Method = Target ? Self.FindMethod(Target, Name, Signature) : nullptr;
+		if (!Method || Method->bStatic != bStatic)
+		{
+			Self.Throw("java/lang/NoSuchMethodError");
+			return nullptr;
+		}
+		return reinterpret_cast<jmethodID>(Method);
+	}
+
+	static jmethodID GetMethodID(JNIEnv* Env, jclass Class, const char* Name, const char* Signature)
+	{
+		return LookupMethod(Env, Class, Name, Signature, false);
+	}
+
+	static jmethodID GetStaticMethodID(JNIEnv* Env, jclass Class, const char* Name, const char* Signature)
+	{
+		return LookupMethod(Env, Class, Name, Signature, true);
+	}
+
+	static jobject CallObjectMethodV(JNIEnv* Env, jobject Object, jmethodID Method, va_list Args)
+	{
+		MOCK_JNI_LOCK;
+		return Impl(Env).Invoke(Object, Method, Args, "CallObjectMethod", false).Object;
+	}
+
+	static jboolean CallBooleanMethodV(JNIEnv* Env, jobject Object, jmethodID Method, va_list Args)
+	{
+		MOCK_JNI_LOCK;
+		return Impl(Env).Invoke(Object, Method, Args, "CallBooleanMethod", false).Int ? JNI_TRUE : JNI_FALSE;
+	}
+
+	static void CallVoidMethodV(JNIEnv* Env, jobject Object, jmethodID Method, va_list Args)
+	{
+		MOCK_JNI_LOCK;
+		Impl(Env).Invoke(Object, Method, Args, "CallVoidMethod", false);
+	}
+
+	static jobject CallStaticObjectMethodV(JNIEnv* Env, jclass Class, jmethodID Method, va_list Args)
+	{
+		MOCK_JNI_LOCK;
+		return Impl(Env).Invoke(Class, Method, Args, "CallStaticObjectMethod", true).Object;
+	}
+
+	static jstring NewString(JNIEnv* Env, const jchar* Chars, jsize Length)
+	{
+		MOCK_JNI_LOCK;
+		FMockJNI::FImpl& Self = Impl(Env);
+		++Self.Counters.NewString;
+		Self.CheckNoPending("NewString");
+
+		if (Length < 0 || (Length > 0 && !Chars))
+		{
+			Self.Error("NewString with an invalid buffer");
+			return nullptr;
+		}
+		return (jstring)Self.NewLocal(Self.MakeString(std::u16string(reinterpret_cast<const char16_t*>(Chars), Length)));
+	}
+
+	static jsize GetStringLength(JNIEnv* Env, jstring String)
+	{
+		MOCK_JNI_LOCK;
+		FMockJNI::FImpl& Self = Impl(Env);
+		Self.CheckNoPending("GetStringLength");
+
+		FJavaString* Target = Self.ResolveAs<FJavaString>(String, "GetStringLength");
+		return Target ? (jsize)Target->Value.size() : 0;
+	}
+
+	static jstring NewStringUTF(JNIEnv* Env, const char* Bytes)
+	{
+		MOCK_JNI_LOCK;
+		FMockJNI::FImpl& Self = Impl(Env);
+		++Self.Counters.NewStringUTF;
+		Self.CheckNoPending("NewStringUTF");
+
+		if (!Bytes)
+		{
+			return nullptr;
+		}
+		return (jstring)Self.NewLocal(Self.MakeString(HostStrings::Utf8ToUtf16(Bytes, (int32)std::strlen(Bytes))));
+	}
+
+	static const char* GetStringUTFChars(JNIEnv* Env, jstring String, jboolean* IsCopy)
+	{
+		MOCK_JNI_LOCK;
+		FMockJNI::FImpl& Self = Impl(Env);
+		++Self.Counters.ReadString;
+		Self.CheckNoPending("GetStringUTFChars");
+
+		FJavaString* Target = Self.ResolveAs<FJavaString>(String, "GetStringUTFChars");
+		if (!Target)
+		{
+			return nullptr;
+		}
+
+		const std::string Utf8 = HostStrings::Utf16ToUtf8(Target->Value.data(), (int32)Target->Value.size());
+		char* Copy = static_cast<char*>(std::malloc(Utf8.size() + 1));
+		std::memcpy(Copy, Utf8.c_str(), Utf8.size() + 1);
+		if (IsCopy)
+		{
+			*IsCopy = JNI_TRUE;
+		}
+		return Copy;
+	}
+
+	static void ReleaseStringUTFChars(JNIEnv* Env, jstring String, const char* Chars)
+	{
+		std::free(const_cast<char*>(Chars));
+	}
+
+	static void GetStringRegion(JNIEnv* Env, jstring String, jsize Start, jsize Length, jchar* Buffer)
+	{
+		MOCK_JNI_LOCK;
+		FMockJNI::FImpl& Self = Impl(Env);
+		++Self.Counters.ReadString;
+		Self.CheckNoPending("GetStringRegion");
+
+		FJavaString* Target = Self.ResolveAs<FJavaString>(String, "GetStringRegion");
+		if (!Target)
+		{
+			return;
+		}
+		if (Start < 0 || Length < 0 || (size_t)Start + Length > Target->Value.size())
+		{
+			Self.Throw("java/lang/StringIndexOutOfBoundsException");
+			return;
+		}
+		std::memcpy(Buffer, Target->Value.data() + Start, Length * sizeof(jchar));
+	}
+
+	static jsize GetArrayLength(JNIEnv* Env, jarray Array)
+	{
+		MOCK_JNI_LOCK;
+		FMockJNI::FImpl& Self = Impl(Env);
+		Self.CheckNoPending("GetArrayLength");
+
+		FByteArray* Target = Self.ResolveAs<FByteArray>(Array, "GetArrayLength");
+		return Target ? (jsize)Target->Bytes.size() : 0;
+	}
+
+	static jbyteArray NewByteArray(JNIEnv* Env, jsize Length)
+	{
+		MOCK_JNI_LOCK;
+		FMockJNI::FImpl& Self = Impl(Env);
+		++Self.Counters.NewByteArray;
+		Self.CheckNoPending("NewByteArray");
+
+		if (Length < 0)
+		{
+			Self.Throw("java/lang/NegativeArraySizeException");
+			return nullptr;
+		}
+
+		FByteArray* Array = Self.Allocate<FByteArray>(Self.Classes["java/lang/Object"]);
+		Array->Bytes.assign(Length, 0);
+		return (jbyteArray)Self.NewLocal(Array);
+	}
+
+	static void CopyByteArrayRegion(JNIEnv* Env, jbyteArray Array, jsize Start, jsize Length, jbyte* Out, const jbyte* In)
+	{
+		MOCK_JNI_LOCK;
+		FMockJNI::FImpl& Self = Impl(Env);
+		++Self.Counters.ByteArrayCopy;
+		Self.CheckNoPending("ByteArrayRegion");
+
+		FByteArray* Target = Self.ResolveAs<FByteArray>(Array, "ByteArrayRegion");
+		if (!Target)
+		{
+			return;
+		}
+		if (Start < 0 || Length < 0 || (size_t)Start + Length > Target->Bytes.size())
+		{
+			Self.Throw("java/lang/ArrayIndexOutOfBoundsException");
+			return;
+		}
+
+		if (Out)
+		{
+			std::memcpy(Out, Target->Bytes.data() + Start, Length);
+		}
+		else
+		{
+			std::memcpy(Target->Bytes.data() + Start, In, Length);
+		}
+	}
+
+	static void GetByteArrayRegion(JNIEnv* Env, jbyteArray Array, jsize Start, jsize Length, jbyte* Buffer)
+	{
+		CopyByteArrayRegion(Env, Array, Start, Length, Buffer, nullptr);
+	}
+
+	static void SetByteArrayRegion(JNIEnv* Env, jbyteArray Array, jsize Start, jsize Length, const jbyte* Buffer)
+	{
+		CopyByteArrayRegion(Env, Array, Start, Length, nullptr, Buffer);
+	}
+
+	static jint GetJavaVM(JNIEnv* Env, JavaVM** VM)
+	{
+		*VM = FMockJNI::Get().GetVM();
+		return JNI_OK;
+	}
+
+	static jobject NewDirectByteBuffer(JNIEnv* Env, void* Address, jlong Capacity)
+	{
+		MOCK_JNI_LOCK;
+		FMockJNI::FImpl& Self = Impl(Env);
+		++Self.Counters.NewDirectByteBuffer;
+		Self.CheckNoPending("NewDirectByteBuffer");
+
+		if (!Address || Capacity < 0)
+		{
+			Self.Error("NewDirectByteBuffer with an invalid buffer");
+			return nullptr;
+		}
+
+		FObject* Buffer = Self.Allocate<FObject>(Self.Classes["java/nio/ByteBuffer"]);
+		Buffer->Address = Address;
+		Buffer->Capacity = Capacity;
+		return Self.NewLocal(Buffer);
+	}
+
+	static void* GetDirectBufferAddress(JNIEnv* Env, jobject Buffer)
+	{
+		MOCK_JNI_LOCK;
+		FObject* Target = Impl(Env).ResolveAs<FObject>(Buffer, "GetDirectBufferAddress");
+		return Target ? Target->Address : nullptr;
+	}
+
+	static jlong GetDirectBufferCapacity(JNIEnv* Env, jobject Buffer)
+	{
+		MOCK_JNI_LOCK;
+		FObject* Target = Impl(Env).ResolveAs<FObject>(Buffer, "GetDirectBufferCapacity");
+		return Target && Target->Address ? Target->Capacity : -1;
+	}
+
+	// JavaVM
+
+	static jint DetachCurrentThread(JavaVM* VM)
+	{
+		MOCK_JNI_LOCK;
+		++Impl(nullptr).Counters.DetachCurrentThread;
+		if (!bThreadAttached)
+		{
+			return JNI_ERR;
+		}
+		bThreadAttached = false;
+		return JNI_OK;
+	}
+
+	static jint GetEnv(JavaVM* VM, void** Env, jint Version)
+	{
+		if (bThreadAttached || std::this_thread::get_id() == MainThread)
+		{
+			*Env = FMockJNI::Get().GetEnv();
+			return JNI_OK;
+		}
+		*Env = nullptr;
+		return JNI_EDETACHED;
+	}
+
+	static jint AttachCurrentThread(JavaVM* VM, JNIEnv** Env, void* Args)
+	{
+		MOCK_JNI_LOCK;
+		++Impl(nullptr).Counters.AttachCurrentThread;
+		bThreadAttached = true;
+		*Env = FMockJNI::Get().GetEnv();
+		return JNI_OK;
+	}
+
+	#undef MOCK_JNI_LOCK
+}
+
+// ============================================================
+// MARK: - FMockJNI
+// ============================================================
+
+int64_t FMockJNICounters::Total() const
+{
+	return FindClass + GetMethodID + NewObject + CallMethod + NewString + NewStringUTF + ReadString
+		+ NewByteArray + ByteArrayCopy + NewDirectByteBuffer + DeleteLocalRef + NewGlobalRef
+		+ DeleteGlobalRef + ExceptionCheck;
+}
+
+FMockJNICounters FMockJNICounters::operator-(const FMockJNICounters& Other) const
+{
+	FMockJNICounters Result;
+	Result.FindClass = FindClass - Other.FindClass;
+	Result.GetMethodID = GetMethodID - Other.GetMethodID;
+	Result.NewObject = NewObject - Other.NewObject;
+	Result.CallMethod = CallMethod - Other.CallMethod;
+	Result.NewString = NewString - Other.NewString;
+	Result.NewStringUTF = NewStringUTF - Other.NewStringUTF;
+	Result.ReadString = ReadString - Other.ReadString;
+	Result.NewByteArray = NewByteArray - Other.NewByteArray;
+	Result.ByteArrayCopy = ByteArrayCopy - Other.ByteArrayCopy;
+	Result.NewDirectByteBuffer = NewDirectByteBuffer - Other.NewDirectByteBuffer;
+	Result.LocalRefsCreated = LocalRefsCreated - Other.LocalRefsCreated;
+	Result.DeleteLocalRef = DeleteLocalRef - Other.DeleteLocalRef;
+	Result.NewGlobalRef = NewGlobalRef - Other.NewGlobalRef;
+	Result.DeleteGlobalRef = DeleteGlobalRef - Other.DeleteGlobalRef;
+	Result.ExceptionCheck = ExceptionCheck - Other.ExceptionCheck;
+	Result.AttachCurrentThread = AttachCurrentThread - Other.AttachCurrentThread;
+	Result.DetachCurrentThread = DetachCurrentThread - Other.DetachCurrentThread;
+	return Result;
+}
+
+FMockJNI& FMockJNI::Get()
+{
+	static FMockJNI Instance;
+	return Instance;
+}
+
+FMockJNI::FMockJNI()
+	: Impl(new FImpl(*this))
+{
+	MainThread = std::this_thread::get_id();
+
+	JNINativeInterface& Functions = Impl->Functions;
+	Functions.FindClass = &MockJNI::FindClass;
+	Functions.ExceptionCheck = &MockJNI::ExceptionCheck;
+	Functions.ExceptionDescribe = &MockJNI::ExceptionDescribe;
+	Functions.ExceptionClear = &MockJNI::ExceptionClear;
+	Functions.NewGlobalRef = &MockJNI::NewGlobalRef;
+	Functions.DeleteGlobalRef = &MockJNI::DeleteGlobalRef;
+	Functions.DeleteLocalRef = &MockJNI::DeleteLocalRef;
+	Functions.IsSameObject = &MockJNI::IsSameObject;
+	Functions.NewLocalRef = &MockJNI::NewLocalRef;
+	Functions.NewObjectV = &MockJNI::NewObjectV;
+	Functions.GetObjectClass = &MockJNI::GetObjectClass;
+	Functions.GetMethodID = &MockJNI::GetMethodID;
+	Functions.CallObjectMethodV = &MockJNI::CallObjectMethodV;
+	Functions.CallBooleanMethodV = &MockJNI::CallBooleanMethodV;
+	Functions.CallVoidMethodV = &MockJNI::CallVoidMethodV;
+	Functions.GetStaticMethodID = &MockJNI::GetStaticMethodID;
+	Functions.CallStaticObjectMethodV = &MockJNI::CallStaticObjectMethodV;
+	Functions.NewString = &MockJNI::NewString;
+	Functions.GetStringLength = &MockJNI::GetStringLength;
+	Functions.NewStringUTF = &MockJNI::NewStringUTF;
+	Functions.GetStringUTFChars = &MockJNI::GetStringUTFChars;
+	Functions.ReleaseStringUTFChars = &MockJNI::ReleaseStringUTFChars;
+	Functions.GetStringRegion = &MockJNI::GetStringRegion;
+	Functions.GetArrayLength = &MockJNI::GetArrayLength;
+	Functions.NewByteArray = &MockJNI::NewByteArray;
+	Functions.GetByteArrayRegion = &MockJNI::GetByteArrayRegion;
+	Functions.SetByteArrayRegion = &MockJNI::SetByteArrayRegion;
+	Functions.GetJavaVM = &MockJNI::GetJavaVM;
+	Functions.NewDirectByteBuffer = &MockJNI::NewDirectByteBuffer;
+	Functions.GetDirectBufferAddress = &MockJNI::GetDirectBufferAddress;
+	Functions.GetDirectBufferCapacity = &MockJNI::GetDirectBufferCapacity;
+	Env.functions = &Functions;
+
+	JNIInvokeInterface& InvokeFunctions = Impl->InvokeFunctions;
+	InvokeFunctions.DetachCurrentThread = &MockJNI::DetachCurrentThread;
+	InvokeFunctions.GetEnv = &MockJNI::GetEnv;
+	InvokeFunctions.AttachCurrentThread = &MockJNI::AttachCurrentThread;
+	VM.functions = &InvokeFunctions;
+
+	Impl->DefineBuiltins();
+}
+
+jobject FMockJNI::NewController(std::initializer_list<const char*> WithoutMethods)
+{
+	static const char* const Callbacks[][2] =
+	{
+		{ "onMessageFromUnreal", "(Ljava/lang/String;Ljava/lang/String;Ljava/lang/String;)V" },
+		{ "onLevelLoaded", "(Ljava/lang/String;I)V" },
+		{ "onBinaryMessageFromUnreal", "(Ljava/lang/String;Ljava/lang/String;[BZI)V" },
+		{ "onBinaryBufferFromUnreal", "(Ljava/lang/String;Ljava/lang/String;Ljava/nio/ByteBuffer;IZI)V" },
+		{ "onMessageBatchFromUnreal", "(Ljava/nio/ByteBuffer;II)V" },
+		{ "onBinaryChunkHeaderFromUnreal", "(Ljava/lang/String;Ljava/lang/String;Ljava/lang/String;III)V" },
+		{ "onBinaryChunkDataFromUnreal", "(Ljava/lang/String;Ljava/lang/String;Ljava/lang/String;I[B)V" },
+		{ "onBinaryChunkFooterFromUnreal", "(Ljava/lang/String;Ljava/lang/String;Ljava/lang/String;II)V" },
+		{ "onBinaryProgressFromUnreal", "(Ljava/lang/String;IIJJ)V" },
+	};
+
+	std::lock_guard<std::recursive_mutex> Lock(Mutex);
+
+	// Only the first controller class is findable by name, like a single loaded class
+	FClass* Object = Impl->Classes["java/lang/Object"];
+	FClass* Class = Impl->Allocate<FClass>(nullptr);
+	Class->Name = ControllerClassName;
+	Class->Super = Object;
+	Class->bPinned = true;
+	if (Impl->NumControllerClasses++ == 0)
+	{
+		Impl->Classes[ControllerClassName] = Class;
+	}
+
+	for (const auto& Callback : Callbacks)
+	{
+		bool bSkip = false;
+		for (const char* Without : WithoutMethods)
+		{
+			bSkip |= std::strcmp(Without, Callback[0]) == 0;
+		}
+		if (!bSkip)
+		{
+			Impl->DefineControllerMethod(Class, Callback[0], Callback[1]);
+		}
+	}
+
+	return Impl->NewLocal(Impl->Allocate<FObject>(Class));
+}
+
+jstring FMockJNI::NewJavaString(const std::u16string& Value)
+{
+	std::lock_guard<std::recursive_mutex> Lock(Mutex);
+	return (jstring)Impl->NewLocal(Impl->MakeString(Value));
+}
+
+jbyteArray FMockJNI::NewJavaByteArray(const std::vector<uint8_t>& Bytes)
+{
+	std::lock_guard<std::recursive_mutex> Lock(Mutex);
+	FByteArray* Array = Impl->Allocate<FByteArray>(Impl->Classes["java/lang/Object"]);
+	Array->Bytes = Bytes;
+	return (jbyteArray)Impl->NewLocal(Array);
+}
+
+jobject FMockJNI::NewJavaDirectBuffer(void* Address, int64_t Capacity)
+{
+	std::lock_guard<std::recursive_mutex> Lock(Mutex);
+	FObject* Buffer = Impl->Allocate<FObject>(Impl->Classes["java/nio/ByteBuffer"]);
+	Buffer->Address = Address;
+	Buffer->Capacity = Capacity;
+	return Impl->NewLocal(Buffer);
+}
+
+jobject FMockJNI::NewJavaHashMap(const std::vector<std::pair<std::u16string, std::u16string>>& Entries)
+{
+	std::lock_guard<std::recursive_mutex> Lock(Mutex);
+	FObject* Map = Impl->Allocate<FObject>(Impl->Classes["java/util/HashMap"]);
+	for (const auto& Entry : Entries)
+	{
+		Impl->Hold(Map, Impl->MakeString(Entry.first));
+		Impl->Hold(Map, Impl->MakeString(Entry.second));
+	}
+	return Impl->NewLocal(Map);
+}
+
+jobject FMockJNI::NewSurface(int32_t Width, int32_t Height)
+{
+	std::lock_guard<std::recursive_mutex> Lock(Mutex);
+	FObject* Surface = Impl->Allocate<FObject>(Impl->Classes["android/view/Surface"]);
+	Surface->Window = { Width, Height, 0 };
+	Surface->bPinned = true;
+	return Impl->NewLocal(Surface);
+}
+
+std::u16string FMockJNI::ReadString(jobject String)
+{
+	std::lock_guard<std::recursive_mutex> Lock(Mutex);
+	return String ? Impl->ToJavaString(String) : std::u16string();
+}
+
+std::vector<std::pair<std::u16string, std::u16string>> FMockJNI::ReadMap(jobject Map)
+{
+	std::lock_guard<std::recursive_mutex> Lock(Mutex);
+	std::vector<std::pair<std::u16string, std::u16string>> Entries;
+	if (FObject* Target = Impl->ResolveAs<FObject>(Map, "ReadMap"))
+	{
+		for (size_t Index = 0; Index + 1 < Target->Held.size(); Index += 2)
+		{
+			Entries.emplace_back(Impl->ToJavaString(Target->Held[Index]), Impl->ToJavaString(Target->Held[Index + 1]));
+		}
+	}
+	return Entries;
+}
+
+FMockJNICounters FMockJNI::GetCounters() const
+{
+	std::lock_guard<std::recursive_mutex> Lock(Mutex);
+	return Impl->Counters;
+}
+
+int64_t FMockJNI::GetLiveLocalRefs() const
+{
+	std::lock_guard<std::recursive_mutex> Lock(Mutex);
+	int64_t Total = 0;
+	for (const auto& Entry : Impl->Live)
+	{
+		Total += dynamic_cast<const FRefs*>(Entry.second.get())->LocalRefs;
+	}
+	return Total;
+}
+
+int64_t FMockJNI::GetLiveGlobalRefs() const
+{
+	std::lock_guard<std::recursive_mutex> Lock(Mutex);
+	int64_t Total = 0;
+	for (const auto& Entry : Impl->Live)
+	{
+		Total += dynamic_cast<const FRefs*>(Entry.second.get())->GlobalRefs;
+	}
+	return Total;
+}
+
+void FMockJNI::ResetRecording()
+{
+	std::lock_guard<std::recursive_mutex> Lock(Mutex);
+	Calls.clear();
+	Errors.clear();
+	PendingException.clear();
+	ThrowingMethod.clear();
+}
+
+// ============================================================
+// MARK: - Native Window
+// ============================================================
+
+ANativeWindow* ANativeWindow_fromSurface(JNIEnv* Env, jobject Surface)
+{
+	std::lock_guard<std::recursive_mutex> Lock(FMockJNI::FImpl::GetMutex());
+
+	FObject* Target = FMockJNI::FImpl::From(Env).ResolveAs<FObject>(Surface, "ANativeWindow_fromSurface");
+	if (!Target || Target->Window.Width <= 0)
+	{
+		return nullptr;
+	}
+
+	// Like the NDK, the caller owns one reference
+	++Target->Window.RefCount;
+	return &Target->Window;
+}
@@ -0,0 +1,154 @@
+// Copyright Epic Games, Inc. All Rights Reserved.
+
+#pragma once
+
+#include <jni.h>
+#include <cstdint>
+#include <functional>
+#include <initializer_list>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <unordered_map>
+#include <utility>
+#include <vector>
+
+/**
+ * Mock JNIEnv
+ *
+ * A JVM-less JNI function table for driving the Android bridge on a desktop host. It models
+ * just enough of Java for the bridge: strings, byte[] and direct ByteBuffers, the java.util
+ * collections JMapToTMap / TMapToJMap walk, and an UnrealEngineController whose callbacks
+ * record their arguments.
+ *
+ * Every JNI function is counted, and local and global references are tracked per object,
+ * so tests can put hard budgets on FindClass / GetMethodID / string creation per operation
+ * and catch leaked or double-deleted references. Misuse that a real VM would abort on
+ * (stale references, calls with a pending exception) is recorded in GetErrors().
+ *
+ * One instance serves the whole process, as the bridge caches the JavaVM and JNIEnv.
+ */
+
+/** Number of calls per JNI function; subtract two snapshots to get the cost of an operation */
+struct FMockJNICounters
+{
+	int64_t FindClass = 0;
+	int64_t GetMethodID = 0;
+	int64_t NewObject = 0;
+	int64_t CallMethod = 0;
+	int64_t NewString = 0;
+	int64_t NewStringUTF = 0;
+	int64_t ReadString = 0;
+	int64_t NewByteArray = 0;
+	int64_t ByteArrayCopy = 0;
+	int64_t NewDirectByteBuffer = 0;
+	int64_t LocalRefsCreated = 0;
+	int64_t DeleteLocalRef = 0;
+	int64_t NewGlobalRef = 0;
+	int64_t DeleteGlobalRef = 0;
+	int64_t ExceptionCheck = 0;
+	int64_t AttachCurrentThread = 0;
+	int64_t DetachCurrentThread = 0;
+
+	/** Every call that crosses into the VM, i.e. everything above except attach/detach */
+	int64_t Total() const;
+
+	FMockJNICounters operator-(const FMockJNICounters& Other) const;
+};
+
+/** One callback made on the mock controller */
+struct FMockCall
+{
+	std::string Method;
+
+	/** jstring arguments in order, as UTF-16 */
+	std::vector<std::u16string> Strings;
+
+	/** Primitive arguments in order */
+	std::vector<int64_t> Numbers;
+
+	/** Contents of the byte[] or ByteBuffer argument, if any */
+	std::vector<uint8_t> Bytes;
+};
+
+class FMockJNI
+{
+public:
+	static constexpr const char* ControllerClassName = "com/xraph/gameframework/unreal/UnrealEngineController";
+
+	static FMockJNI& Get();
+
+	JNIEnv* GetEnv() { return &Env; }
+	JavaVM* GetVM() { return &VM; }
+
+	// ============================================================
+	// MARK: - Java Side
+	// ============================================================
+
+	/**
+	 * New UnrealEngineController with every callback the bridge knows, minus the ones listed
+	 * Each controller gets its own class, so older controllers can be modelled by leaving
+	 * callbacks out. Returns a local reference.
+	 */
+	jobject NewController(std::initializer_list<const char*> WithoutMethods = {});
+
+	/** Make the named controller callback throw on its next calls until cleared */
+	void SetThrowingMethod(const std::string& Method) { ThrowingMethod = Method; }
+
+	/** Local references to Java values */
+	jstring NewJavaString(const std::u16string& Value);
+	jbyteArray NewJavaByteArray(const std::vector<uint8_t>& Bytes);
+	jobject NewJavaDirectBuffer(void* Address, int64_t Capacity);
+	jobject NewJavaHashMap(const std::vector<std::pair<std::u16string, std::u16string>>& Entries);
+
+	/** Local reference to a Surface backed by a native window of the given size */
+	jobject NewSurface(int32_t Width, int32_t Height);
+
+	/** Read Java values back */
+	std::u16string ReadString(jobject String);
+	std::vector<std::pair<std::u16string, std::u16string>> ReadMap(jobject Map);
+
+	// ============================================================
+	// MARK: - Inspection
+	// ============================================================
+
+	const std::vector<FMockCall>& GetCalls() const { return Calls; }
+	void ClearCalls() { Calls.clear(); }
+
+	FMockJNICounters GetCounters() const;
+
+	/** References currently held by native code */
+	int64_t GetLiveLocalRefs() const;
+	int64_t GetLiveGlobalRefs() const;
+
+	/** Misuse a real VM would abort on */
+	const std::vector<std::string>& GetErrors() const { return Errors; }
+
+	/** True while a Java exception is pending */
+	bool HasPendingException() const { return !PendingException.empty(); }
+
+	/** Forget calls, errors and any pending exception; counters keep running */
+	void ResetRecording();
+
+	// ============================================================
+	// MARK: - Internals used by the function table
+	// ============================================================
+
+	struct FImpl;
+
+private:
+	FMockJNI();
+
+	JNIEnv Env;
+	JavaVM VM;
+
+	std::vector<FMockCall> Calls;
+	std::vector<std::string> Errors;
+	std::string PendingException;
+	std::string ThrowingMethod;
+
+	mutable std::recursive_mutex Mutex;
+
+	friend struct FImpl;
+	std::unique_ptr<FImpl> Impl;
+};
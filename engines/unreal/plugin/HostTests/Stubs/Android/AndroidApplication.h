@@ -0,0 +1,14 @@
+// Copyright Epic Games, Inc. All Rights Reserved.
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include <jni.h>
+
+/** Hands out the mock environment in place of the engine's */
+class FAndroidApplication
+{
+public:
+	static JNIEnv* GetJavaEnv(bool bRequireGlobalThis = true);
+	static jobject GetGameActivityThis();
+};
@@ -0,0 +1,19 @@
+// Copyright Epic Games, Inc. All Rights Reserved.
+
+#pragma once
+
+#include "CoreMinimal.h"
+
+/** Records the hardware window handed to the engine */
+class FAndroidWindow
+{
+public:
+	static void* GetHardwareWindow_EventThread();
+	static void SetHardwareWindow_EventThread(void* InWindow);
+	static void SetWindowDimensions_EventThread(void* InWindow);
+
+	// Host only
+	static int32 NumSetHardwareWindowCalls;
+	static int32 NumSetWindowDimensionsCalls;
+	static void Reset();
+};
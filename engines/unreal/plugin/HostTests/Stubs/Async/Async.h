@@ -0,0 +1,29 @@
+// Copyright Epic Games, Inc. All Rights Reserved.
+
+#pragma once
+
+#include "CoreMinimal.h"
+
+namespace ENamedThreads
+{
+	enum Type
+	{
+		GameThread,
+		AnyThread
+	};
+}
+
+/** Game thread tasks wait here until the test runs them */
+struct FHostTaskQueue
+{
+	static void Enqueue(std::function<void()>&& Task);
+
+	/** Run every queued task on the calling thread; returns how many ran */
+	static int32 RunAll();
+};
+
+template <typename FunctorType>
+void AsyncTask(ENamedThreads::Type Thread, FunctorType&& Function)
+{
+	FHostTaskQueue::Enqueue(std::function<void()>(std::forward<FunctorType>(Function)));
+}
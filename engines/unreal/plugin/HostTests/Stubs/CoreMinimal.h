@@ -0,0 +1,386 @@
+// Copyright Epic Games, Inc. All Rights Reserved.
+
+#pragma once
+
+/**
+ * Host CoreMinimal.h
+ *
+ * Just enough of Unreal's core types for the Android bridge sources to build on a desktop
+ * Linux host. TCHAR is UTF-16 as on Android, so string handling takes the same paths as on
+ * a device. Containers are thin wrappers over the standard library; only the members the
+ * plugin uses exist.
+ */
+
+#include <algorithm>
+#include <cmath>
+#include <cstdint>
+#include <cstdlib>
+#include <cstring>
+#include <functional>
+#include <string>
+#include <type_traits>
+#include <unordered_map>
+#include <utility>
+#include <vector>
+
+#ifndef PLATFORM_ANDROID
+#define PLATFORM_ANDROID 1
+#endif
+#define PLATFORM_IOS 0
+#define PLATFORM_MAC 0
+#define WITH_DEV_AUTOMATION_TESTS 0
+
+#define FLUTTERPLUGIN_API
+
+// Reflection markup is for UnrealHeaderTool only
+#define UENUM(...)
+#define USTRUCT(...)
+#define UPROPERTY(...)
+#define GENERATED_BODY()
+
+// ============================================================
+// MARK: - Types
+// ============================================================
+
+typedef int8_t int8;
+typedef int16_t int16;
+typedef int32_t int32;
+typedef int64_t int64;
+typedef uint8_t uint8;
+typedef uint16_t uint16;
+typedef uint32_t uint32;
+typedef uint64_t uint64;
+
+typedef char ANSICHAR;
+typedef char16_t UTF16CHAR;
+typedef char16_t TCHAR;
+
+#define TEXT(x) u##x
+#define INDEX_NONE (-1)
+#define UE_ARRAY_COUNT(Array) ((int32)(sizeof(Array) / sizeof((Array)[0])))
+
+template <typename T>
+constexpr std::remove_reference_t<T>&& MoveTemp(T&& Value)
+{
+	return static_cast<std::remove_reference_t<T>&&>(Value);
+}
+
+template <typename KeyType, typename ValueType>
+struct TPair
+{
+	KeyType Key;
+	ValueType Value;
+};
+
+// ============================================================
+// MARK: - Memory and Math
+// ============================================================
+
+struct FMemory
+{
+	static void* Malloc(size_t Size, uint32 Alignment = 16)
+	{
+		const size_t Aligned = (std::max<size_t>(Size, 1) + Alignment - 1) / Alignment * Alignment;
+		return std::aligned_alloc(Alignment, Aligned);
+	}
+	static void Free(void* Pointer) { std::free(Pointer); }
+	static void* Memcpy(void* Dest, const void* Src, size_t Size) { return Size ? std::memcpy(Dest, Src, Size) : Dest; }
+	static void* Memset(void* Dest, uint8 Value, size_t Size) { return std::memset(Dest, Value, Size); }
+	static void Memzero(void* Dest, size_t Size) { std::memset(Dest, 0, Size); }
+};
+
+struct FMath
+{
+	template <typename T> static constexpr T Max(T A, T B) { return A < B ? B : A; }
+	template <typename T> static constexpr T Min(T A, T B) { return A < B ? A : B; }
+	template <typename T> static constexpr T Clamp(T X, T Low, T High) { return X < Low ? Low : (High < X ? High : X); }
+
+	static int32 RoundToInt(double Value) { return (int32)std::floor(Value + 0.5); }
+	static uint32 FloorLog2(uint32 Value) { return Value ? 31 - __builtin_clz(Value) : 0; }
+	static uint32 RoundUpToPowerOfTwo(uint32 Value) { return Value <= 1 ? 1 : 1u << (32 - __builtin_clz(Value - 1)); }
+};
+
+// ============================================================
+// MARK: - Containers
+// ============================================================
+
+template <typename T>
+class TArray
+{
+public:
+	TArray() = default;
+	TArray(std::initializer_list<T> Init) : Items(Init) {}
+	TArray(const T* Data, int32 Count) : Items(Data, Data + Count) {}
+
+	int32 Num() const { return (int32)Items.size(); }
+	bool IsEmpty() const { return Items.empty(); }
+	bool IsValidIndex(int32 Index) const { return Index >= 0 && Index < Num(); }
+
+	T* GetData() { return Items.data(); }
+	const T* GetData() const { return Items.data(); }
+
+	T& operator[](int32 Index) { return Items[Index]; }
+	const T& operator[](int32 Index) const { return Items[Index]; }
+	T& Last() { return Items.back(); }
+
+	int32 Add(const T& Item) { Items.push_back(Item); return Num() - 1; }
+	int32 Add(T&& Item) { Items.push_back(MoveTemp(Item)); return Num() - 1; }
+	int32 AddDefaulted() { Items.emplace_back(); return Num() - 1; }
+	int32 AddUninitialized(int32 Count) { const int32 Index = Num(); Items.resize(Items.size() + Count); return Index; }
+	void Append(const T* Data, int32 Count) { Items.insert(Items.end(), Data, Data + Count); }
+	void Append(const TArray& Other) { Items.insert(Items.end(), Other.Items.begin(), Other.Items.end()); }
+
+	T Pop() { T Item = MoveTemp(Items.back()); Items.pop_back(); return Item; }
+	void RemoveAt(int32 Index) { Items.erase(Items.begin() + Index); }
+
+	void SetNum(int32 Count) { Items.resize(Count); }
+	void SetNumUninitialized(int32 Count) { Items.resize(Count); }
+	void SetNumZeroed(int32 Count) { Items.assign(Count, T()); }
+	void Reserve(int32 Count) { Items.reserve(Count); }
+	void Reset() { Items.clear(); }
+	void Empty() { Items.clear(); Items.shrink_to_fit(); }
+
+	bool operator==(const TArray& Other) const { return Items == Other.Items; }
+	bool operator!=(const TArray& Other) const { return Items != Other.Items; }
+
+	auto begin() { return Items.begin(); }
+	auto end() { return Items.end(); }
+	auto begin() const { return Items.begin(); }
+	auto end() const { return Items.end(); }
+
+private:
+	std::vector<T> Items;
+};
+
+template <typename T>
+class TConstArrayView
+{
+public:
+	TConstArrayView() = default;
+	TConstArrayView(const T* InData, int32 InNum) : Data(InData), Count(InNum) {}
+	TConstArrayView(const TArray<T>& Array) : Data(Array.GetData()), Count(Array.Num()) {}
+
+	int32 Num() const { return Count; }
+	const T* GetData() const { return Data; }
+	const T& operator[](int32 Index) const { return Data[Index]; }
+
+private:
+	const T* Data = nullptr;
+	int32 Count = 0;
+};
+
+template <typename FunctionType>
+class TFunctionRef;
+
+template <typename ReturnType, typename... ArgTypes>
+class TFunctionRef<ReturnType(ArgTypes...)>
+{
+public:
+	template <typename FunctorType>
+	TFunctionRef(FunctorType&& Functor)
+		: Object((void*)&Functor)
+		, Callable([](void* Target, ArgTypes... Args) -> ReturnType
+		{
+			return (*(std::remove_reference_t<FunctorType>*)Target)(std::forward<ArgTypes>(Args)...);
+		})
+	{
+	}
+
+	ReturnType operator()(ArgTypes... Args) const { return Callable(Object, std::forward<ArgTypes>(Args)...); }
+
+private:
+	void* Object;
+	ReturnType (*Callable)(void*, ArgTypes...);
+};
+
+// ============================================================
+// MARK: - Strings
+// ============================================================
+
+class FString
+{
+public:
+	FString() = default;
+	FString(const TCHAR* String) { if (String && *String) { Assign(String, (int32)std::char_traits<TCHAR>::length(String)); } }
+	FString(int32 Length, const TCHAR* String) { if (Length > 0) { Assign(String, Length); } }
+
+	const TCHAR* operator*() const { return Chars.Num() ? Chars.GetData() : TEXT(""); }
+	int32 Len() const { return Chars.Num() ? Chars.Num() - 1 : 0; }
+	bool IsEmpty() const { return Len() == 0; }
+
+	TArray<TCHAR>& GetCharArray() { return Chars; }
+	const TArray<TCHAR>& GetCharArray() const { return Chars; }
+
+	bool operator==(const FString& Other) const { return Len() == Other.Len() && std::char_traits<TCHAR>::compare(**this, *Other, Len()) == 0; }
+	bool operator!=(const FString& Other) const { return !(*this == Other); }
+
+	/** printf-style; the format must be ASCII */
+	static FString Printf(const TCHAR* Format, ...);
+
+	FString operator+(const FString& Other) const
+	{
+		FString Result(*this);
+		Result.Chars.SetNum(Len());
+		Result.Chars.Append(*Other, Other.Len() + 1);
+		return Result;
+	}
+
+private:
+	void Assign(const TCHAR* String, int32 Length)
+	{
+		Chars.SetNumUninitialized(Length + 1);
+		std::char_traits<TCHAR>::copy(Chars.GetData(), String, Length);
+		Chars[Length] = 0;
+	}
+
+	TArray<TCHAR> Chars;
+};
+
+namespace std
+{
+	template <>
+	struct hash<FString>
+	{
+		size_t operator()(const FString& String) const { return std::hash<std::u16string_view>()(std::u16string_view(*String, String.Len())); }
+	};
+}
+
+struct FCString
+{
+	static int32 Atoi(const TCHAR* String)
+	{
+		int32 Sign = 1;
+		int32 Value = 0;
+		if (*String == '-') { Sign = -1; ++String; }
+		for (; *String >= '0' && *String <= '9'; ++String) { Value = Value * 10 + (*String - '0'); }
+		return Sign * Value;
+	}
+};
+
+namespace HostStrings
+{
+	std::u16string Utf8ToUtf16(const char* Utf8, int32 Length);
+	std::string Utf16ToUtf8(const char16_t* Utf16, int32 Length);
+}
+
+/** UTF-16 <-> UTF-8, mirroring TStringConversion: the result lives as long as the converter */
+template <typename ToType>
+class THostStringConversion
+{
+public:
+	template <typename FromType>
+	THostStringConversion(const FromType* Source, int32 Length = -1)
+	{
+		if constexpr (std::is_same_v<ToType, ANSICHAR>)
+		{
+			Converted = HostStrings::Utf16ToUtf8((const char16_t*)Source, Length < 0 ? (int32)std::char_traits<char16_t>::length((const char16_t*)Source) : Length);
+		}
+		else if constexpr (std::is_same_v<FromType, ANSICHAR>)
+		{
+			Converted = HostStrings::Utf8ToUtf16(Source, Length < 0 ? (int32)std::strlen(Source) : Length);
+		}
+		else
+		{
+			Converted.assign((const ToType*)Source, Length < 0 ? std::char_traits<ToType>::length((const ToType*)Source) : Length);
+		}
+	}
+
+	const ToType* Get() const { return Converted.c_str(); }
+	int32 Length() const { return (int32)Converted.size(); }
+
+private:
+	std::basic_string<ToType> Converted;
+};
+
+typedef THostStringConversion<ANSICHAR> FTCHARToUTF8;
+typedef THostStringConversion<TCHAR> FUTF8ToTCHAR;
+
+template <typename ToType, typename FromType>
+THostStringConversion<ToType> StringCast(const FromType* Source, int32 Length = -1)
+{
+	return THostStringConversion<ToType>(Source, Length);
+}
+
+#define UTF8_TO_TCHAR(String) (FUTF8ToTCHAR((const ANSICHAR*)(String)).Get())
+#define TCHAR_TO_UTF8(String) (FTCHARToUTF8((const TCHAR*)(String)).Get())
+
+template <typename KeyType, typename ValueType>
+class TMap
+{
+public:
+	int32 Num() const { return (int32)Pairs.size(); }
+
+	ValueType& Add(const KeyType& Key, const ValueType& Value)
+	{
+		if (ValueType* Existing = Find(Key))
+		{
+			*Existing = Value;
+			return *Existing;
+		}
+		Index.emplace(Key, Pairs.size());
+		Pairs.push_back({ Key, Value });
+		return Pairs.back().Value;
+	}
+
+	ValueType* Find(const KeyType& Key)
+	{
+		const auto It = Index.find(Key);
+		return It != Index.end() ? &Pairs[It->second].Value : nullptr;
+	}
+	const ValueType* Find(const KeyType& Key) const { return const_cast<TMap*>(this)->Find(Key); }
+
+	bool Contains(const KeyType& Key) const { return Index.count(Key) != 0; }
+	ValueType& operator[](const KeyType& Key) { return *Find(Key); }
+	const ValueType& operator[](const KeyType& Key) const { return *Find(Key); }
+
+	void Empty() { Pairs.clear(); Index.clear(); }
+
+	auto begin() { return Pairs.begin(); }
+	auto end() { return Pairs.end(); }
+	auto begin() const { return Pairs.begin(); }
+	auto end() const { return Pairs.end(); }
+
+private:
+	std::vector<TPair<KeyType, ValueType>> Pairs;
+	std::unordered_map<KeyType, size_t> Index;
+};
+
+// ============================================================
+// MARK: - Logging
+// ============================================================
+
+namespace ELogVerbosity
+{
+	enum Type : uint8
+	{
+		Fatal,
+		Error,
+		Warning,
+		Display,
+		Log,
+		Verbose,
+		VeryVerbose
+	};
+}
+
+/** Counts log lines by verbosity; arguments are not formatted */
+struct FHostLog
+{
+	static void Write(ELogVerbosity::Type Verbosity, const TCHAR* Format);
+	static int32 Count(ELogVerbosity::Type Verbosity);
+	static void Reset();
+};
+
+#define UE_LOG(CategoryName, Verbosity, Format, ...) FHostLog::Write(ELogVerbosity::Verbosity, Format)
+
+// ============================================================
+// MARK: - Threads
+// ============================================================
+
+struct FPlatformTLS
+{
+	static uint32 GetCurrentThreadId();
+};
+
+/** True on the thread that loaded the harness */
+bool IsInGameThread();
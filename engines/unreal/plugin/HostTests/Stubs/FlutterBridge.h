@@ -0,0 +1,54 @@
+// Copyright Epic Games, Inc. All Rights Reserved.
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "FlutterIngressMessage.h"
+#include "FlutterRenderScale.h"
+
+/**
+ * Host AFlutterBridge
+ *
+ * Stands in for the actor so the Android bridge's native entry points can be driven without
+ * a world. Every call the Android code makes is recorded for the tests to inspect.
+ */
+class AFlutterBridge
+{
+public:
+	// Ingress queue
+	static bool EnqueueFromFlutter(FFlutterIngressMessage&& Message);
+	static TArray<FFlutterIngressMessage> Ingress;
+
+	// Surface
+	void OnSurfaceReady(int32 Width, int32 Height);
+	void OnSurfaceSizeChanged(int32 Width, int32 Height);
+	void OnSurfaceDestroyed();
+
+	// Lifecycle
+	void OnEnginePause();
+	void OnEngineResume();
+	void OnEngineQuit();
+
+	// Commands
+	void SetBinaryChunkSize(int32 Size);
+	void ExecuteConsoleCommand(const FString& Command);
+	void LoadLevel(const FString& LevelName);
+
+	// Quality settings
+	void ApplyQualitySettings(int32 QualityLevel, int32 AntiAliasing, int32 Shadow, int32 PostProcess, int32 Texture, int32 Effects, int32 Foliage, int32 ViewDistance);
+	TMap<FString, int32> GetQualitySettings() const;
+
+	// Render scale
+	void SetRenderScaleSettings(const FFlutterRenderScaleSettings& Settings);
+
+	/** Name of every call, in order, e.g. "OnSurfaceReady" */
+	TArray<FString> Calls;
+
+	int32 SurfaceWidth = 0;
+	int32 SurfaceHeight = 0;
+	int32 BinaryChunkSize = 0;
+	FString LastCommand;
+	FString LastLevel;
+	int32 Quality[8] = { -1, -1, -1, -1, -1, -1, -1, -1 };
+	FFlutterRenderScaleSettings RenderScaleSettings;
+};
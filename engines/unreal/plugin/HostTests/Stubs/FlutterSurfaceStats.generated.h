@@ -0,0 +1,4 @@
+// Copyright Epic Games, Inc. All Rights Reserved.
+
+// UnrealHeaderTool output is not needed on the host
+#pragma once
@@ -0,0 +1,16 @@
+// Copyright Epic Games, Inc. All Rights Reserved.
+
+#pragma once
+
+#include "CoreMinimal.h"
+
+class FThreadManager
+{
+public:
+	/** Host threads have no engine name */
+	static const FString& GetThreadName(uint32 ThreadId)
+	{
+		static const FString Empty;
+		return Empty;
+	}
+};
@@ -0,0 +1,346 @@
+// Copyright Epic Games, Inc. All Rights Reserved.
+
+#include "CoreMinimal.h"
+#include "FlutterBridge.h"
+#include "MockJNIEnv.h"
+#include "Android/AndroidApplication.h"
+#include "Android/AndroidWindow.h"
+#include "Async/Async.h"
+#include "android/native_window.h"
+#include <atomic>
+#include <cstdarg>
+#include <cstdio>
+#include <mutex>
+#include <thread>
+
+// ============================================================
+// MARK: - Strings
+// ============================================================
+
+std::u16string HostStrings::Utf8ToUtf16(const char* Utf8, int32 Length)
+{
+	std::u16string Result;
+	Result.reserve(Length);
+
+	for (int32 Index = 0; Index < Length;)
+	{
+		const uint8 Lead = (uint8)Utf8[Index];
+		uint32 CodePoint = 0xFFFD;
+		int32 Extra = 0;
+		if (Lead < 0x80) { CodePoint = Lead; }
+		else if ((Lead & 0xE0) == 0xC0) { CodePoint = Lead & 0x1F; Extra = 1; }
+		else if ((Lead & 0xF0) == 0xE0) { CodePoint = Lead & 0x0F; Extra = 2; }
+		else if ((Lead & 0xF8) == 0xF0) { CodePoint = Lead & 0x07; Extra = 3; }
+		++Index;
+
+		for (; Extra > 0 && Index < Length && ((uint8)Utf8[Index] & 0xC0) == 0x80; --Extra, ++Index)
+		{
+			CodePoint = (CodePoint << 6) | ((uint8)Utf8[Index] & 0x3F);
+		}
+		if (Extra > 0)
+		{
+			CodePoint = 0xFFFD;
+		}
+
+		if (CodePoint >= 0x10000)
+		{
+			CodePoint -= 0x10000;
+			Result.push_back((char16_t)(0xD800 + (CodePoint >> 10)));
+			Result.push_back((char16_t)(0xDC00 + (CodePoint & 0x3FF)));
+		}
+		else
+		{
+			Result.push_back((char16_t)CodePoint);
+		}
+	}
+	return Result;
+}
+
+std::string HostStrings::Utf16ToUtf8(const char16_t* Utf16, int32 Length)
+{
+	std::string Result;
+	Result.reserve(Length);
+
+	for (int32 Index = 0; Index < Length; ++Index)
+	{
+		uint32 CodePoint = Utf16[Index];
+		if (CodePoint >= 0xD800 && CodePoint < 0xDC00 && Index + 1 < Length && Utf16[Index + 1] >= 0xDC00 && Utf16[Index + 1] < 0xE000)
+		{
+			CodePoint = 0x10000 + ((CodePoint - 0xD800) << 10) + (Utf16[++Index] - 0xDC00);
+		}
+		else if (CodePoint >= 0xD800 && CodePoint < 0xE000)
+		{
+			CodePoint = 0xFFFD;
+		}
+
+		if (CodePoint < 0x80)
+		{
+			Result.push_back((char)CodePoint);
+		}
+		else if (CodePoint < 0x800)
+		{
+			Result.push_back((char)(0xC0 | (CodePoint >> 6)));
+			Result.push_back((char)(0x80 | (CodePoint & 0x3F)));
+		}
+		else if (CodePoint < 0x10000)
+		{
+			Result.push_back((char)(0xE0 | (CodePoint >> 12)));
+			Result.push_back((char)(0x80 | ((CodePoint >> 6) & 0x3F)));
+			Result.push_back((char)(0x80 | (CodePoint & 0x3F)));
+		}
+		else
+		{
+			Result.push_back((char)(0xF0 | (CodePoint >> 18)));
+			Result.push_back((char)(0x80 | ((CodePoint >> 12) & 0x3F)));
+			Result.push_back((char)(0x80 | ((CodePoint >> 6) & 0x3F)));
+			Result.push_back((char)(0x80 | (CodePoint & 0x3F)));
+		}
+	}
+	return Result;
+}
+
+FString FString::Printf(const TCHAR* Format, ...)
+{
+	const std::string Utf8Format = HostStrings::Utf16ToUtf8(Format, (int32)std::char_traits<TCHAR>::length(Format));
+
+	va_list Args;
+	va_start(Args, Format);
+	va_list Measure;
+	va_copy(Measure, Args);
+	const int Length = std::vsnprintf(nullptr, 0, Utf8Format.c_str(), Measure);
+	va_end(Measure);
+
+	std::string Utf8(Length > 0 ? Length : 0, '\0');
+	if (Length > 0)
+	{
+		std::vsnprintf(Utf8.data(), Length + 1, Utf8Format.c_str(), Args);
+	}
+	va_end(Args);
+
+	const std::u16string Utf16 = HostStrings::Utf8ToUtf16(Utf8.data(), (int32)Utf8.size());
+	return FString((int32)Utf16.size(), Utf16.data());
+}
+
+// ============================================================
+// MARK: - Logging and Threads
+// ============================================================
+
+namespace HostStubs
+{
+	static std::atomic<int32> LogCounts[ELogVerbosity::VeryVerbose + 1];
+
+	/** The thread that runs static initialisation is the game thread, as it runs the tests */
+	static const std::thread::id GameThreadId = std::this_thread::get_id();
+
+	static std::mutex TaskMutex;
+	static std::vector<std::function<void()>> Tasks;
+}
+
+void FHostLog::Write(ELogVerbosity::Type Verbosity, const TCHAR* Format)
+{
+	HostStubs::LogCounts[Verbosity].fetch_add(1, std::memory_order_relaxed);
+}
+
+int32 FHostLog::Count(ELogVerbosity::Type Verbosity)
+{
+	return HostStubs::LogCounts[Verbosity].load(std::memory_order_relaxed);
+}
+
+void FHostLog::Reset()
+{
+	for (std::atomic<int32>& Count : HostStubs::LogCounts)
+	{
+		Count.store(0, std::memory_order_relaxed);
+	}
+}
+
+uint32 FPlatformTLS::GetCurrentThreadId()
+{
+	return (uint32)std::hash<std::thread::id>()(std::this_thread::get_id());
+}
+
+bool IsInGameThread()
+{
+	return std::this_thread::get_id() == HostStubs::GameThreadId;
+}
+
+void FHostTaskQueue::Enqueue(std::function<void()>&& Task)
+{
+	std::lock_guard<std::mutex> Lock(HostStubs::TaskMutex);
+	HostStubs::Tasks.push_back(MoveTemp(Task));
+}
+
+int32 FHostTaskQueue::RunAll()
+{
+	std::vector<std::function<void()>> Pending;
+	{
+		std::lock_guard<std::mutex> Lock(HostStubs::TaskMutex);
+		Pending.swap(HostStubs::Tasks);
+	}
+
+	for (std::function<void()>& Task : Pending)
+	{
+		Task();
+	}
+	return (int32)Pending.size();
+}
+
+// ============================================================
+// MARK: - Android Platform
+// ============================================================
+
+JNIEnv* FAndroidApplication::GetJavaEnv(bool bRequireGlobalThis)
+{
+	return FMockJNI::Get().GetEnv();
+}
+
+jobject FAndroidApplication::GetGameActivityThis()
+{
+	return nullptr;
+}
+
+namespace HostStubs
+{
+	static void* HardwareWindow = nullptr;
+}
+
+int32 FAndroidWindow::NumSetHardwareWindowCalls = 0;
+int32 FAndroidWindow::NumSetWindowDimensionsCalls = 0;
+
+void* FAndroidWindow::GetHardwareWindow_EventThread()
+{
+	return HostStubs::HardwareWindow;
+}
+
+void FAndroidWindow::SetHardwareWindow_EventThread(void* InWindow)
+{
+	HostStubs::HardwareWindow = InWindow;
+	++NumSetHardwareWindowCalls;
+}
+
+void FAndroidWindow::SetWindowDimensions_EventThread(void* InWindow)
+{
+	++NumSetWindowDimensionsCalls;
+}
+
+void FAndroidWindow::Reset()
+{
+	HostStubs::HardwareWindow = nullptr;
+	NumSetHardwareWindowCalls = 0;
+	NumSetWindowDimensionsCalls = 0;
+}
+
+void ANativeWindow_acquire(ANativeWindow* Window)
+{
+	++Window->RefCount;
+}
+
+void ANativeWindow_release(ANativeWindow* Window)
+{
+	--Window->RefCount;
+}
+
+int32_t ANativeWindow_getWidth(ANativeWindow* Window)
+{
+	return Window->Width;
+}
+
+int32_t ANativeWindow_getHeight(ANativeWindow* Window)
+{
+	return Window->Height;
+}
+
+// ============================================================
+// MARK: - AFlutterBridge
+// ============================================================
+
+TArray<FFlutterIngressMessage> AFlutterBridge::Ingress;
+
+bool AFlutterBridge::EnqueueFromFlutter(FFlutterIngressMessage&& Message)
+{
+	Ingress.Add(MoveTemp(Message));
+	return true;
+}
+
+void AFlutterBridge::OnSurfaceReady(int32 Width, int32 Height)
+{
+	Calls.Add(TEXT("OnSurfaceReady"));
+	SurfaceWidth = Width;
+	SurfaceHeight = Height;
+}
+
+void AFlutterBridge::OnSurfaceSizeChanged(int32 Width, int32 Height)
+{
+	Calls.Add(TEXT("OnSurfaceSizeChanged"));
+	SurfaceWidth = Width;
+	SurfaceHeight = Height;
+}
+
+void AFlutterBridge::OnSurfaceDestroyed()
+{
+	Calls.Add(TEXT("OnSurfaceDestroyed"));
+	SurfaceWidth = 0;
+	SurfaceHeight = 0;
+}
+
+void AFlutterBridge::OnEnginePause()
+{
+	Calls.Add(TEXT("OnEnginePause"));
+}
+
+void AFlutterBridge::OnEngineResume()
+{
+	Calls.Add(TEXT("OnEngineResume"));
+}
+
+void AFlutterBridge::OnEngineQuit()
+{
+	Calls.Add(TEXT("OnEngineQuit"));
+}
+
+void AFlutterBridge::SetBinaryChunkSize(int32 Size)
+{
+	Calls.Add(TEXT("SetBinaryChunkSize"));
+	BinaryChunkSize = Size;
+}
+
+void AFlutterBridge::ExecuteConsoleCommand(const FString& Command)
+{
+	Calls.Add(TEXT("ExecuteConsoleCommand"));
+	LastCommand = Command;
+}
+
+void AFlutterBridge::LoadLevel(const FString& LevelName)
+{
+	Calls.Add(TEXT("LoadLevel"));
+	LastLevel = LevelName;
+}
+
+void AFlutterBridge::SetRenderScaleSettings(const FFlutterRenderScaleSettings& Settings)
+{
+	Calls.Add(TEXT("SetRenderScaleSettings"));
+	RenderScaleSettings = Settings;
+}
+
+void AFlutterBridge::ApplyQualitySettings(int32 QualityLevel, int32 AntiAliasing, int32 Shadow, int32 PostProcess, int32 Texture, int32 Effects, int32 Foliage, int32 ViewDistance)
+{
+	Calls.Add(TEXT("ApplyQualitySettings"));
+	const int32 Values[8] = { QualityLevel, AntiAliasing, Shadow, PostProcess, Texture, Effects, Foliage, ViewDistance };
+	FMemory::Memcpy(Quality, Values, sizeof(Quality));
+}
+
+TMap<FString, int32> AFlutterBridge::GetQualitySettings() const
+{
+	static const TCHAR* const Keys[8] =
+	{
+		TEXT("qualityLevel"), TEXT("antiAliasingQuality"), TEXT("shadowQuality"), TEXT("postProcessQuality"),
+		TEXT("textureQuality"), TEXT("effectsQuality"), TEXT("foliageQuality"), TEXT("viewDistanceQuality")
+	};
+
+	TMap<FString, int32> Settings;
+	for (int32 Index = 0; Index < 8; ++Index)
+	{
+		Settings.Add(Keys[Index], Quality[Index]);
+	}
+	return Settings;
+}
@@ -0,0 +1,18 @@
+// Copyright Epic Games, Inc. All Rights Reserved.
+
+#pragma once
+
+#include <cstdint>
+
+/** A window of fixed size; the harness creates one per mock Surface */
+struct ANativeWindow
+{
+	int32_t Width;
+	int32_t Height;
+	int32_t RefCount;
+};
+
+void ANativeWindow_acquire(ANativeWindow* Window);
+void ANativeWindow_release(ANativeWindow* Window);
+int32_t ANativeWindow_getWidth(ANativeWindow* Window);
+int32_t ANativeWindow_getHeight(ANativeWindow* Window);
@@ -0,0 +1,9 @@
+// Copyright Epic Games, Inc. All Rights Reserved.
+
+#pragma once
+
+#include "android/native_window.h"
+#include <jni.h>
+
+/** Window for a Surface made with FMockJNI::NewSurface(), or null */
+ANativeWindow* ANativeWindow_fromSurface(JNIEnv* Env, jobject Surface);
@@ -0,0 +1,210 @@
+// Copyright Epic Games, Inc. All Rights Reserved.
+
+#pragma once
+
+/**
+ * Host jni.h
+ *
+ * The subset of the JNI interface used by the Android bridge, laid out like the NDK header:
+ * JNIEnv and JavaVM are thin wrappers around a function table, so MockJNIEnv can supply
+ * the table without a JVM. Only the functions the bridge calls are present.
+ */
+
+#include <cstdarg>
+#include <cstdint>
+
+typedef uint8_t jboolean;
+typedef int8_t jbyte;
+typedef uint16_t jchar;
+typedef int16_t jshort;
+typedef int32_t jint;
+typedef int64_t jlong;
+typedef float jfloat;
+typedef double jdouble;
+typedef jint jsize;
+
+class _jobject
+{
+public:
+	virtual ~_jobject() = default;
+};
+class _jclass : public _jobject {};
+class _jstring : public _jobject {};
+class _jthrowable : public _jobject {};
+class _jarray : public _jobject {};
+class _jbyteArray : public _jarray {};
+
+typedef _jobject* jobject;
+typedef _jclass* jclass;
+typedef _jstring* jstring;
+typedef _jthrowable* jthrowable;
+typedef _jarray* jarray;
+typedef _jbyteArray* jbyteArray;
+
+struct _jmethodID;
+typedef struct _jmethodID* jmethodID;
+
+#define JNI_FALSE 0
+#define JNI_TRUE 1
+
+#define JNI_OK 0
+#define JNI_ERR (-1)
+#define JNI_EDETACHED (-2)
+#define JNI_EVERSION (-3)
+
+#define JNI_VERSION_1_6 0x00010006
+
+#define JNIEXPORT __attribute__((visibility("default")))
+#define JNICALL
+
+struct _JNIEnv;
+struct _JavaVM;
+typedef _JNIEnv JNIEnv;
+typedef _JavaVM JavaVM;
+
+struct JavaVMAttachArgs
+{
+	jint version;
+	const char* name;
+	jobject group;
+};
+
+struct JNINativeInterface
+{
+	jclass (*FindClass)(JNIEnv*, const char*);
+	jboolean (*ExceptionCheck)(JNIEnv*);
+	void (*ExceptionDescribe)(JNIEnv*);
+	void (*ExceptionClear)(JNIEnv*);
+
+	jobject (*NewGlobalRef)(JNIEnv*, jobject);
+	void (*DeleteGlobalRef)(JNIEnv*, jobject);
+	void (*DeleteLocalRef)(JNIEnv*, jobject);
+	jboolean (*IsSameObject)(JNIEnv*, jobject, jobject);
+	jobject (*NewLocalRef)(JNIEnv*, jobject);
+
+	jobject (*NewObjectV)(JNIEnv*, jclass, jmethodID, va_list);
+	jclass (*GetObjectClass)(JNIEnv*, jobject);
+	jmethodID (*GetMethodID)(JNIEnv*, jclass, const char*, const char*);
+	jobject (*CallObjectMethodV)(JNIEnv*, jobject, jmethodID, va_list);
+	jboolean (*CallBooleanMethodV)(JNIEnv*, jobject, jmethodID, va_list);
+	void (*CallVoidMethodV)(JNIEnv*, jobject, jmethodID, va_list);
+	jmethodID (*GetStaticMethodID)(JNIEnv*, jclass, const char*, const char*);
+	jobject (*CallStaticObjectMethodV)(JNIEnv*, jclass, jmethodID, va_list);
+
+	jstring (*NewString)(JNIEnv*, const jchar*, jsize);
+	jsize (*GetStringLength)(JNIEnv*, jstring);
+	jstring (*NewStringUTF)(JNIEnv*, const char*);
+	const char* (*GetStringUTFChars)(JNIEnv*, jstring, jboolean*);
+	void (*ReleaseStringUTFChars)(JNIEnv*, jstring, const char*);
+	void (*GetStringRegion)(JNIEnv*, jstring, jsize, jsize, jchar*);
+
+	jsize (*GetArrayLength)(JNIEnv*, jarray);
+	jbyteArray (*NewByteArray)(JNIEnv*, jsize);
+	void (*GetByteArrayRegion)(JNIEnv*, jbyteArray, jsize, jsize, jbyte*);
+	void (*SetByteArrayRegion)(JNIEnv*, jbyteArray, jsize, jsize, const jbyte*);
+
+	jint (*GetJavaVM)(JNIEnv*, JavaVM**);
+
+	jobject (*NewDirectByteBuffer)(JNIEnv*, void*, jlong);
+	void* (*GetDirectBufferAddress)(JNIEnv*, jobject);
+	jlong (*GetDirectBufferCapacity)(JNIEnv*, jobject);
+};
+
+struct _JNIEnv
+{
+	const JNINativeInterface* functions;
+
+	jclass FindClass(const char* Name) { return functions->FindClass(this, Name); }
+	jboolean ExceptionCheck() { return functions->ExceptionCheck(this); }
+	void ExceptionDescribe() { functions->ExceptionDescribe(this); }
+	void ExceptionClear() { functions->ExceptionClear(this); }
+
+	jobject NewGlobalRef(jobject Object) { return functions->NewGlobalRef(this, Object); }
+	void DeleteGlobalRef(jobject Object) { functions->DeleteGlobalRef(this, Object); }
+	void DeleteLocalRef(jobject Object) { functions->DeleteLocalRef(this, Object); }
+	jboolean IsSameObject(jobject A, jobject B) { return functions->IsSameObject(this, A, B); }
+	jobject NewLocalRef(jobject Object) { return functions->NewLocalRef(this, Object); }
+
+	jobject NewObject(jclass Class, jmethodID Method, ...)
+	{
+		va_list Args;
+		va_start(Args, Method);
+		jobject Result = functions->NewObjectV(this, Class, Method, Args);
+		va_end(Args);
+		return Result;
+	}
+
+	jclass GetObjectClass(jobject Object) { return functions->GetObjectClass(this, Object); }
+	jmethodID GetMethodID(jclass Class, const char* Name, const char* Signature) { return functions->GetMethodID(this, Class, Name, Signature); }
+
+	jobject CallObjectMethod(jobject Object, jmethodID Method, ...)
+	{
+		va_list Args;
+		va_start(Args, Method);
+		jobject Result = functions->CallObjectMethodV(this, Object, Method, Args);
+		va_end(Args);
+		return Result;
+	}
+
+	jboolean CallBooleanMethod(jobject Object, jmethodID Method, ...)
+	{
+		va_list Args;
+		va_start(Args, Method);
+		jboolean Result = functions->CallBooleanMethodV(this, Object, Method, Args);
+		va_end(Args);
+		return Result;
+	}
+
+	void CallVoidMethod(jobject Object, jmethodID Method, ...)
+	{
+		va_list Args;
+		va_start(Args, Method);
+		functions->CallVoidMethodV(this, Object, Method, Args);
+		va_end(Args);
+	}
+
+	jmethodID GetStaticMethodID(jclass Class, const char* Name, const char* Signature) { return functions->GetStaticMethodID(this, Class, Name, Signature); }
+
+	jobject CallStaticObjectMethod(jclass Class, jmethodID Method, ...)
+	{
+		va_list Args;
+		va_start(Args, Method);
+		jobject Result = functions->CallStaticObjectMethodV(this, Class, Method, Args);
+		va_end(Args);
+		return Result;
+	}
+
+	jstring NewString(const jchar* Chars, jsize Length) { return functions->NewString(this, Chars, Length); }
+	jsize GetStringLength(jstring String) { return functions->GetStringLength(this, String); }
+	jstring NewStringUTF(const char* Bytes) { return functions->NewStringUTF(this, Bytes); }
+	const char* GetStringUTFChars(jstring String, jboolean* IsCopy) { return functions->GetStringUTFChars(this, String, IsCopy); }
+	void ReleaseStringUTFChars(jstring String, const char* Chars) { functions->ReleaseStringUTFChars(this, String, Chars); }
+	void GetStringRegion(jstring String, jsize Start, jsize Length, jchar* Buffer) { functions->GetStringRegion(this, String, Start, Length, Buffer); }
+
+	jsize GetArrayLength(jarray Array) { return functions->GetArrayLength(this, Array); }
+	jbyteArray NewByteArray(jsize Length) { return functions->NewByteArray(this, Length); }
+	void GetByteArrayRegion(jbyteArray Array, jsize Start, jsize Length, jbyte* Buffer) { functions->GetByteArrayRegion(this, Array, Start, Length, Buffer); }
+	void SetByteArrayRegion(jbyteArray Array, jsize Start, jsize Length, const jbyte* Buffer) { functions->SetByteArrayRegion(this, Array, Start, Length, Buffer); }
+
+	jint GetJavaVM(JavaVM** VM) { return functions->GetJavaVM(this, VM); }
+
+	jobject NewDirectByteBuffer(void* Address, jlong Capacity) { return functions->NewDirectByteBuffer(this, Address, Capacity); }
+	void* GetDirectBufferAddress(jobject Buffer) { return functions->GetDirectBufferAddress(this, Buffer); }
+	jlong GetDirectBufferCapacity(jobject Buffer) { return functions->GetDirectBufferCapacity(this, Buffer); }
+};
+
+struct JNIInvokeInterface
+{
+	jint (*DetachCurrentThread)(JavaVM*);
+	jint (*GetEnv)(JavaVM*, void**, jint);
+	jint (*AttachCurrentThread)(JavaVM*, JNIEnv**, void*);
+};
+
+struct _JavaVM
+{
+	const JNIInvokeInterface* functions;
+
+	jint DetachCurrentThread() { return functions->DetachCurrentThread(this); }
+	jint GetEnv(void** Env, jint Version) { return functions->GetEnv(this, Env, Version); }
+	jint AttachCurrentThread(JNIEnv** Env, void* Args) { return functions->AttachCurrentThread(this, Env, Args); }
+};
@@ -0,0 +1,201 @@
+// Copyright Epic Games, Inc. All Rights Reserved.
+
+#include "FlutterBridgeAndroidFixture.h"
+#include "FlutterMessageBatch.h"
+#include <chrono>
+#include <cstdio>
+
+/**
+ * Host benchmarks
+ *
+ * Timings here measure the native side against the mock, not a real VM, so they are only
+ * useful for comparing one build with the next. The JNI call counts are exact and are
+ * what the assertions hold to.
+ */
+namespace FlutterBridgeAndroidBenchmarks
+{
+	static double SecondsSince(std::chrono::steady_clock::time_point Start)
+	{
+		return std::chrono::duration<double>(std::chrono::steady_clock::now() - Start).count();
+	}
+}
+
+// ============================================================
+// MARK: - Crossings
+// ============================================================
+
+TEST_F(FFlutterBridgeAndroidTest, BenchmarkJNICrossings)
+{
+	using namespace FlutterBridgeAndroidBenchmarks;
+
+	const int32 Frames = 60;
+	const int32 MessagesPerFrame = 32;
+	const FString Data = TEXT("{\"rotation\":{\"pitch\":0.0,\"yaw\":123.4,\"roll\":0.0},\"speed\":45.0}");
+
+	// The same frames once per message and once batched, the way FlushOutgoingBatch sends them
+	int64 Upcalls[2];
+	int64 JNICalls[2];
+	double Seconds[2];
+	FFlutterMessageBatchWriter Writer;
+	for (int32 Pass = 0; Pass < 2; ++Pass)
+	{
+		const int64 StartUpcalls = FlutterBridge_GetJavaUpcallCount_Android();
+		const FMockJNICounters StartCounters = Mock.GetCounters();
+		const auto StartTime = std::chrono::steady_clock::now();
+		for (int32 Frame = 0; Frame < Frames; ++Frame)
+		{
+			for (int32 Message = 0; Message < MessagesPerFrame; ++Message)
+			{
+				if (Pass == 0)
+				{
+					FlutterBridge_SendToFlutter_Android(TEXT("RotatingCube"), TEXT("onStateSync"), Data);
+				}
+				else
+				{
+					Writer.Add(TEXT("RotatingCube"), TEXT("onStateSync"), Data);
+				}
+			}
+
+			if (Pass == 1)
+			{
+				ASSERT_TRUE(FlutterBridge_SendMessageBatch_Android(Writer.GetFrame(), Writer.Num()));
+				Java_com_xraph_gameframework_unreal_UnrealEngineController_nativeReleaseBuffer(Env, Controller, (jint)LastCall().Numbers[1]);
+				Writer.Reset();
+			}
+		}
+		Seconds[Pass] = SecondsSince(StartTime);
+		Upcalls[Pass] = FlutterBridge_GetJavaUpcallCount_Android() - StartUpcalls;
+		JNICalls[Pass] = (Mock.GetCounters() - StartCounters).Total();
+		Mock.ClearCalls();
+	}
+
+	EXPECT_EQ(Upcalls[0], Frames * MessagesPerFrame);
+	EXPECT_EQ(Upcalls[1], Frames);
+	EXPECT_LT(JNICalls[1] * 10, JNICalls[0]);
+
+	std::printf("[ BENCH    ] %d frames x %d messages: per message %lld upcalls, %lld JNI calls, %.1f us/frame; batched %lld upcalls, %lld JNI calls, %.1f us/frame\n",
+		Frames,
+		MessagesPerFrame,
+		(long long)Upcalls[0],
+		(long long)JNICalls[0],
+		Seconds[0] * 1e6 / Frames,
+		(long long)Upcalls[1],
+		(long long)JNICalls[1],
+		Seconds[1] * 1e6 / Frames);
+}
+
+// ============================================================
+// MARK: - Binary Sends
+// ============================================================
+
+TEST_F(FFlutterBridgeAndroidTest, BenchmarkBinarySend)
+{
+	using namespace FlutterBridgeAndroidBenchmarks;
+
+	const int32 Iterations = 64;
+	TArray<uint8> Payload;
+	Payload.SetNumUninitialized(256 * 1024);
+	for (int32 Index = 0; Index < Payload.Num(); ++Index)
+	{
+		Payload[Index] = (uint8)Index;
+	}
+
+	// The real send path: pooled direct buffers released by Java, then the byte[] fallback
+	FMockJNICounters Costs[2];
+	double Seconds[2];
+	for (int32 Pass = 0; Pass < 2; ++Pass)
+	{
+		if (Pass == 1)
+		{
+			StopController();
+			StartController({ "onBinaryBufferFromUnreal" });
+		}
+
+		const FMockJNICounters Before = Mock.GetCounters();
+		const auto StartTime = std::chrono::steady_clock::now();
+		for (int32 Iteration = 0; Iteration < Iterations; ++Iteration)
+		{
+			FlutterBridge_SendBinaryToFlutter_Android(TEXT("Assets"), TEXT("onTexture"), Payload, false, 0);
+			if (Pass == 0)
+			{
+				Java_com_xraph_gameframework_unreal_UnrealEngineController_nativeReleaseBuffer(Env, Controller, (jint)LastCall().Numbers[0]);
+			}
+			Mock.ClearCalls();
+		}
+		Seconds[Pass] = SecondsSince(StartTime);
+		Costs[Pass] = Mock.GetCounters() - Before;
+	}
+
+	EXPECT_EQ(Costs[0].NewByteArray, 0);
+	EXPECT_EQ(Costs[0].NewDirectByteBuffer, Iterations);
+	EXPECT_EQ(Costs[1].NewByteArray, Iterations);
+
+	const double Megabytes = (double)Payload.Num() * Iterations / (1024.0 * 1024.0);
+	std::printf("[ BENCH    ] %d KB binary sends: direct buffer %.0f MB/s, byte[] %.0f MB/s\n",
+		Payload.Num() / 1024,
+		Megabytes / Seconds[0],
+		Megabytes / Seconds[1]);
+}
+
+// ============================================================
+// MARK: - Marshalling
+// ============================================================
+
+TEST_F(FFlutterBridgeAndroidTest, BenchmarkStringMarshalling)
+{
+	using namespace FlutterBridgeAndroidBenchmarks;
+
+	const int32 Iterations = 20000;
+	const FString Payload = TEXT("{\"player\":\"Zoë\",\"position\":[12.5,0.0,-3.25],\"health\":87,\"tag\":\"\U0001F3C6\"}");
+
+	const FMockJNICounters Before = Mock.GetCounters();
+	const auto StartTime = std::chrono::steady_clock::now();
+	for (int32 Index = 0; Index < Iterations; ++Index)
+	{
+		jstring Java = FStringToJString(Env, Payload);
+		const FString RoundTrip = JStringToFString(Env, Java);
+		Env->DeleteLocalRef(Java);
+		ASSERT_EQ(RoundTrip.Len(), Payload.Len());
+	}
+	const double Seconds = SecondsSince(StartTime);
+	const FMockJNICounters Cost = Mock.GetCounters() - Before;
+
+	// One call each way, whatever the content
+	EXPECT_EQ(Cost.NewString, Iterations);
+	EXPECT_EQ(Cost.ReadString, Iterations);
+	EXPECT_EQ(Cost.NewStringUTF, 0);
+
+	std::printf("[ BENCH    ] %d-char string round trip: %.0f ns\n", Payload.Len(), Seconds * 1e9 / Iterations);
+}
+
+TEST_F(FFlutterBridgeAndroidTest, BenchmarkMapConversion)
+{
+	using namespace FlutterBridgeAndroidBenchmarks;
+
+	const int32 Iterations = 2000;
+	jobject Settings = Mock.NewJavaHashMap({
+		{ u"qualityLevel", u"3" }, { u"antiAliasingQuality", u"2" }, { u"shadowQuality", u"1" }, { u"postProcessQuality", u"2" },
+		{ u"textureQuality", u"3" }, { u"effectsQuality", u"2" }, { u"foliageQuality", u"1" }, { u"viewDistanceQuality", u"2" } });
+
+	const int64 LocalRefs = Mock.GetLiveLocalRefs();
+	const FMockJNICounters Before = Mock.GetCounters();
+	const auto StartTime = std::chrono::steady_clock::now();
+	for (int32 Index = 0; Index < Iterations; ++Index)
+	{
+		const TMap<FString, FString> Map = JMapToTMap(Env, Settings);
+		ASSERT_EQ(Map.Num(), 8);
+	}
+	const double Seconds = SecondsSince(StartTime);
+	const FMockJNICounters Cost = Mock.GetCounters() - Before;
+
+	EXPECT_EQ(Cost.FindClass, 0);
+	EXPECT_EQ(Cost.GetMethodID, 0);
+	EXPECT_EQ(Mock.GetLiveLocalRefs(), LocalRefs);
+
+	// entrySet, iterator, then hasNext/next/getKey/getValue/toString per entry and a final hasNext
+	EXPECT_EQ(Cost.CallMethod, Iterations * (2 + 8 * 5 + 1));
+
+	std::printf("[ BENCH    ] 8-entry Map to TMap: %.0f ns, %lld JNI calls\n", Seconds * 1e9 / Iterations, (long long)(Cost.Total() / Iterations));
+
+	Env->DeleteLocalRef(Settings);
+}
@@ -0,0 +1,126 @@
+// Copyright Epic Games, Inc. All Rights Reserved.
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "FlutterBridge.h"
+#include "FlutterJNIStrings.h"
+#include "FlutterSurfaceStats.h"
+#include "MockJNIEnv.h"
+#include "Android/AndroidWindow.h"
+#include <gtest/gtest.h>
+#include <string>
+
+// ============================================================
+// MARK: - Bridge Entry Points
+// ============================================================
+
+extern "C"
+{
+	jboolean Java_com_xraph_gameframework_unreal_UnrealEngineController_nativeCreate(JNIEnv* Env, jobject Obj, jobject Config);
+	void Java_com_xraph_gameframework_unreal_UnrealEngineController_nativeQuit(JNIEnv* Env, jobject Obj);
+	void Java_com_xraph_gameframework_unreal_UnrealEngineController_nativeSetSurface(JNIEnv* Env, jobject Obj, jobject Surface);
+	void Java_com_xraph_gameframework_unreal_UnrealEngineController_nativeSurfaceChanged(JNIEnv* Env, jobject Obj, jint Width, jint Height);
+	void Java_com_xraph_gameframework_unreal_UnrealEngineController_nativeSendMessage(JNIEnv* Env, jobject Obj, jstring Target, jstring Method, jstring Data);
+	void Java_com_xraph_gameframework_unreal_UnrealEngineController_nativeSendBinaryMessage(JNIEnv* Env, jobject Obj, jstring Target, jstring Method, jbyteArray Data, jint Checksum);
+	void Java_com_xraph_gameframework_unreal_UnrealEngineController_nativeSendBinaryBuffer(JNIEnv* Env, jobject Obj, jstring Target, jstring Method, jobject Data, jint Length, jint Checksum);
+	void Java_com_xraph_gameframework_unreal_UnrealEngineController_nativeReleaseBuffer(JNIEnv* Env, jobject Obj, jint BufferId);
+	void Java_com_xraph_gameframework_unreal_UnrealEngineController_nativeSetBinaryChunkSize(JNIEnv* Env, jobject Obj, jint Size);
+	void Java_com_xraph_gameframework_unreal_UnrealEngineController_nativeExecuteConsoleCommand(JNIEnv* Env, jobject Obj, jstring Command);
+	void Java_com_xraph_gameframework_unreal_UnrealEngineController_nativeLoadLevel(JNIEnv* Env, jobject Obj, jstring LevelName);
+	void Java_com_xraph_gameframework_unreal_UnrealEngineController_nativeApplyQualitySettings(JNIEnv* Env, jobject Obj, jobject Settings);
+	jobject Java_com_xraph_gameframework_unreal_UnrealEngineController_nativeGetQualitySettings(JNIEnv* Env, jobject Obj);
+	jstring Java_com_xraph_gameframework_unreal_UnrealEngineController_nativeGetSurfaceStatistics(JNIEnv* Env, jobject Obj);
+	void Java_com_xraph_gameframework_unreal_UnrealEngineController_nativeSetRenderScale(JNIEnv* Env, jobject Obj, jint Mode, jfloat Scale, jfloat MinScale, jfloat MaxScale, jfloat TargetFrameRate);
+}
+
+TMap<FString, FString> JMapToTMap(JNIEnv* Env, jobject JavaMap);
+jobject TMapToJMap(JNIEnv* Env, const TMap<FString, int32>& Map);
+
+void FlutterBridge_SendToFlutter_Android(const FString& Target, const FString& Method, const FString& Data);
+void FlutterBridge_SendBinaryToFlutter_Android(const FString& Target, const FString& Method, const TArray<uint8>& Data, bool bIsCompressed, int32 Checksum);
+bool FlutterBridge_SendMessageBatch_Android(const TArray<uint8>& Frame, int32 NumMessages);
+bool FlutterBridge_SendBinaryChunkHeader_Android(const FString& Target, const FString& Method, const FString& TransferId, int32 TotalSize, int32 TotalChunks, int32 Checksum);
+void FlutterBridge_SendBinaryChunkData_Android(const FString& Target, const FString& Method, const FString& TransferId, int32 ChunkIndex, TConstArrayView<uint8> Data);
+void FlutterBridge_SendBinaryChunkFooter_Android(const FString& Target, const FString& Method, const FString& TransferId, int32 TotalChunks, int32 Checksum);
+int64 FlutterBridge_GetJavaUpcallCount_Android();
+void FlutterBridge_NotifyLevelLoaded_Android(const FString& LevelName, int32 BuildIndex);
+void FlutterBridge_SetInstance_Android(AFlutterBridge* Instance);
+void FlutterBridge_ClearInstance_Android(AFlutterBridge* Instance);
+
+// ============================================================
+// MARK: - Fixture
+// ============================================================
+
+inline FString ToFString(const std::u16string& String)
+{
+	return FString((int32)String.size(), String.data());
+}
+
+inline std::u16string ToU16(const FString& String)
+{
+	return std::u16string(*String, String.Len());
+}
+
+/**
+ * A bridge started the way the engine and Java start it: the actor registers itself, then
+ * the controller calls nativeCreate. TearDown quits the controller and checks that the
+ * bridge released every global reference and never misused the JNI.
+ */
+class FFlutterBridgeAndroidTest : public ::testing::Test
+{
+protected:
+	void SetUp() override
+	{
+		Mock.ResetRecording();
+		FAndroidWindow::Reset();
+		AFlutterBridge::Ingress.Reset();
+
+		FlutterBridge_SetInstance_Android(&Bridge);
+		StartController({});
+	}
+
+	void TearDown() override
+	{
+		StopController();
+		FlutterBridge_ClearInstance_Android(&Bridge);
+
+		EXPECT_FALSE(Mock.HasPendingException());
+		EXPECT_EQ(Mock.GetLiveGlobalRefs(), 0) << "Global references leaked";
+		EXPECT_EQ(Mock.GetLiveLocalRefs(), 0) << "Local references leaked";
+		for (const std::string& Error : Mock.GetErrors())
+		{
+			ADD_FAILURE() << "JNI misuse: " << Error;
+		}
+	}
+
+	/** Replace the controller, e.g. with one that lacks some callbacks */
+	void StartController(std::initializer_list<const char*> WithoutMethods)
+	{
+		Controller = Mock.NewController(WithoutMethods);
+		Java_com_xraph_gameframework_unreal_UnrealEngineController_nativeCreate(Env, Controller, nullptr);
+	}
+
+	void StopController()
+	{
+		if (Controller)
+		{
+			Java_com_xraph_gameframework_unreal_UnrealEngineController_nativeQuit(Env, Controller);
+			Env->DeleteLocalRef(Controller);
+			Controller = nullptr;
+
+			// nativeQuit forgets the bridge along with the controller
+			FlutterBridge_SetInstance_Android(&Bridge);
+		}
+	}
+
+	const FMockCall& LastCall() const
+	{
+		return Mock.GetCalls().back();
+	}
+
+	FMockJNI& Mock = FMockJNI::Get();
+	JNIEnv* Env = FMockJNI::Get().GetEnv();
+	jobject Controller = nullptr;
+	AFlutterBridge Bridge;
+};
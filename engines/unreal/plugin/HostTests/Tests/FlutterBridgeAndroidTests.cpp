@@ -0,0 +1,468 @@
+// Copyright Epic Games, Inc. All Rights Reserved.
+
+#include "FlutterBridgeAndroidFixture.h"
+#include "FlutterJNICache.h"
+#include "FlutterJNIThread.h"
+#include "FlutterMessageBatch.h"
+#include "Async/Async.h"
+#include <thread>
+
+// ============================================================
+// MARK: - JNI Cache
+// ============================================================
+
+TEST_F(FFlutterBridgeAndroidTest, CreateLooksUpClassesAndCallbacksOnce)
+{
+	StopController();
+	FlutterBridge_ClearInstance_Android(&Bridge);
+
+	// Seven helper classes plus the controller's class, which comes from GetObjectClass
+	const FMockJNICounters Before = Mock.GetCounters();
+	StartController({});
+	const FMockJNICounters First = Mock.GetCounters() - Before;
+	EXPECT_EQ(First.FindClass, 7);
+	EXPECT_EQ(First.GetMethodID, 10 + 9);
+
+	// Everything after that is cached
+	const FMockJNICounters Again = Mock.GetCounters();
+	Java_com_xraph_gameframework_unreal_UnrealEngineController_nativeCreate(Env, Controller, nullptr);
+	FlutterBridge_SetInstance_Android(&Bridge);
+	const FMockJNICounters Second = Mock.GetCounters() - Again;
+	EXPECT_EQ(Second.FindClass, 0);
+	EXPECT_EQ(Second.GetMethodID, 0);
+}
+
+TEST_F(FFlutterBridgeAndroidTest, OlderControllerWithoutOptionalCallbacks)
+{
+	StopController();
+	StartController({ "onBinaryBufferFromUnreal", "onMessageBatchFromUnreal" });
+
+	// Missing callbacks are looked up once and leave no exception behind
+	EXPECT_FALSE(Mock.HasPendingException());
+	EXPECT_EQ(FFlutterJNICache::Get().OnBinaryBufferFromUnreal, nullptr);
+	EXPECT_EQ(FFlutterJNICache::Get().OnMessageBatchFromUnreal, nullptr);
+	EXPECT_NE(FFlutterJNICache::Get().OnMessageFromUnreal, nullptr);
+}
+
+// ============================================================
+// MARK: - Native to Java
+// ============================================================
+
+TEST_F(FFlutterBridgeAndroidTest, SendToFlutterCallBudget)
+{
+	const FString Data = TEXT("{\"score\":10}");
+
+	// The first send caches Target and Method as global jstrings
+	FlutterBridge_SendToFlutter_Android(TEXT("GameManager"), TEXT("onScore"), Data);
+
+	const int64 LocalRefs = Mock.GetLiveLocalRefs();
+	const FMockJNICounters Before = Mock.GetCounters();
+	FlutterBridge_SendToFlutter_Android(TEXT("GameManager"), TEXT("onScore"), Data);
+	const FMockJNICounters Cost = Mock.GetCounters() - Before;
+
+	EXPECT_EQ(Cost.FindClass, 0);
+	EXPECT_EQ(Cost.GetMethodID, 0);
+	EXPECT_EQ(Cost.NewString, 1) << "Only the payload is converted";
+	EXPECT_EQ(Cost.NewStringUTF, 0);
+	EXPECT_EQ(Cost.CallMethod, 1);
+	EXPECT_EQ(Mock.GetLiveLocalRefs(), LocalRefs);
+
+	ASSERT_EQ(Mock.GetCalls().size(), 2u);
+	EXPECT_EQ(LastCall().Method, "onMessageFromUnreal");
+	EXPECT_EQ(LastCall().Strings, (std::vector<std::u16string>{ u"GameManager", u"onScore", u"{\"score\":10}" }));
+}
+
+TEST_F(FFlutterBridgeAndroidTest, SendToFlutterPreservesUtf16)
+{
+	// Non-BMP characters cross as surrogate pairs, not as modified UTF-8
+	const std::u16string Data = u"café 日本 \U0001F600";
+	FlutterBridge_SendToFlutter_Android(TEXT("Chat"), TEXT("onText"), ToFString(Data));
+
+	EXPECT_EQ(LastCall().Strings[2], Data);
+	EXPECT_EQ(Mock.GetCounters().NewStringUTF, 0);
+}
+
+TEST_F(FFlutterBridgeAndroidTest, CachedStringOutlivesCacheClear)
+{
+	// EndPlay clears the cache while a worker thread may still be using a cached name
+	FScopedJavaString Target(Env, TEXT("GameManager"), true);
+	FFlutterJStringCache::Get().Clear(Env);
+
+	EXPECT_EQ(ToU16(JStringToFString(Env, Target.Get())), u"GameManager");
+}
+
+TEST_F(FFlutterBridgeAndroidTest, SendToFlutterClearsJavaException)
+{
+	Mock.SetThrowingMethod("onMessageFromUnreal");
+	FlutterBridge_SendToFlutter_Android(TEXT("GameManager"), TEXT("onScore"), TEXT("{}"));
+	EXPECT_FALSE(Mock.HasPendingException());
+
+	// The next send is unaffected
+	Mock.SetThrowingMethod(std::string());
+	FlutterBridge_SendToFlutter_Android(TEXT("GameManager"), TEXT("onScore"), TEXT("{}"));
+	EXPECT_EQ(Mock.GetCalls().size(), 2u);
+}
+
+TEST_F(FFlutterBridgeAndroidTest, SendToFlutterFromWorkerThread)
+{
+	const int32 AttachedBefore = FFlutterJNIThread::GetNumAttachedThreads();
+	const FMockJNICounters Before = Mock.GetCounters();
+
+	std::thread Worker([]()
+	{
+		FlutterBridge_SendToFlutter_Android(TEXT("Worker"), TEXT("onProgress"), TEXT("50"));
+		FlutterBridge_SendToFlutter_Android(TEXT("Worker"), TEXT("onProgress"), TEXT("100"));
+	});
+	Worker.join();
+
+	// Attached once for both sends, detached as the thread exited
+	const FMockJNICounters Cost = Mock.GetCounters() - Before;
+	EXPECT_EQ(Cost.AttachCurrentThread, 1);
+	EXPECT_EQ(Cost.DetachCurrentThread, 1);
+	EXPECT_EQ(FFlutterJNIThread::GetNumAttachedThreads(), AttachedBefore);
+	EXPECT_EQ(Mock.GetCalls().size(), 2u);
+}
+
+TEST_F(FFlutterBridgeAndroidTest, BinaryUsesPooledDirectBuffer)
+{
+	const TArray<uint8> Data = { 1, 2, 3, 4, 5, 6, 7, 8 };
+
+	const FMockJNICounters Before = Mock.GetCounters();
+	FlutterBridge_SendBinaryToFlutter_Android(TEXT("Assets"), TEXT("onChunk"), Data, true, 1234);
+	const FMockJNICounters Cost = Mock.GetCounters() - Before;
+
+	EXPECT_EQ(Cost.NewByteArray, 0);
+	EXPECT_EQ(Cost.NewDirectByteBuffer, 1);
+	ASSERT_EQ(LastCall().Method, "onBinaryBufferFromUnreal");
+	EXPECT_EQ(LastCall().Bytes, std::vector<uint8_t>(Data.begin(), Data.end()));
+	ASSERT_EQ(LastCall().Numbers.size(), 3u);
+	EXPECT_EQ(LastCall().Numbers[1], 1);
+	EXPECT_EQ(LastCall().Numbers[2], 1234);
+
+	// Java hands the buffer back once; a second release is rejected
+	const int32 BufferId = (int32)LastCall().Numbers[0];
+	const int32 Warnings = FHostLog::Count(ELogVerbosity::Warning);
+	Java_com_xraph_gameframework_unreal_UnrealEngineController_nativeReleaseBuffer(Env, Controller, BufferId);
+	EXPECT_EQ(FHostLog::Count(ELogVerbosity::Warning), Warnings);
+	Java_com_xraph_gameframework_unreal_UnrealEngineController_nativeReleaseBuffer(Env, Controller, BufferId);
+	EXPECT_EQ(FHostLog::Count(ELogVerbosity::Warning), Warnings + 1);
+}
+
+TEST_F(FFlutterBridgeAndroidTest, BinaryFallsBackToByteArray)
+{
+	StopController();
+	StartController({ "onBinaryBufferFromUnreal" });
+
+	const TArray<uint8> Data = { 9, 8, 7 };
+	FlutterBridge_SendBinaryToFlutter_Android(TEXT("Assets"), TEXT("onChunk"), Data, false, 42);
+
+	ASSERT_EQ(LastCall().Method, "onBinaryMessageFromUnreal");
+	EXPECT_EQ(LastCall().Bytes, (std::vector<uint8_t>{ 9, 8, 7 }));
+	EXPECT_EQ(LastCall().Numbers, (std::vector<int64_t>{ 0, 42 }));
+}
+
+TEST_F(FFlutterBridgeAndroidTest, MessageBatchIsOneCrossing)
+{
+	FFlutterMessageBatchWriter Writer;
+	for (int32 Index = 0; Index < 16; ++Index)
+	{
+		Writer.Add(TEXT("RotatingCube"), TEXT("onStateSync"), TEXT("{\"yaw\":1.0}"));
+	}
+
+	const int64 Upcalls = FlutterBridge_GetJavaUpcallCount_Android();
+	ASSERT_TRUE(FlutterBridge_SendMessageBatch_Android(Writer.GetFrame(), Writer.Num()));
+	EXPECT_EQ(FlutterBridge_GetJavaUpcallCount_Android() - Upcalls, 1);
+
+	ASSERT_EQ(LastCall().Method, "onMessageBatchFromUnreal");
+	EXPECT_EQ(LastCall().Numbers[0], 16);
+	EXPECT_TRUE(FFlutterMessageBatch::IsBatchFrame(TArray<uint8>(LastCall().Bytes.data(), (int32)LastCall().Bytes.size())));
+
+	Java_com_xraph_gameframework_unreal_UnrealEngineController_nativeReleaseBuffer(Env, Controller, (jint)LastCall().Numbers[1]);
+}
+
+TEST_F(FFlutterBridgeAndroidTest, MessageBatchReportsJavaFailure)
+{
+	FFlutterMessageBatchWriter Writer;
+	Writer.Add(TEXT("A"), TEXT("b"), TEXT("c"));
+
+	// The caller falls back to a binary message, and the buffer goes back to the pool
+	Mock.SetThrowingMethod("onMessageBatchFromUnreal");
+	EXPECT_FALSE(FlutterBridge_SendMessageBatch_Android(Writer.GetFrame(), Writer.Num()));
+	EXPECT_FALSE(Mock.HasPendingException());
+
+	const int32 Warnings = FHostLog::Count(ELogVerbosity::Warning);
+	Java_com_xraph_gameframework_unreal_UnrealEngineController_nativeReleaseBuffer(Env, Controller, (jint)LastCall().Numbers[1]);
+	EXPECT_EQ(FHostLog::Count(ELogVerbosity::Warning), Warnings + 1);
+}
+
+TEST_F(FFlutterBridgeAndroidTest, ChunkSendClearsJavaException)
+{
+	const TArray<uint8> Data = { 1, 2, 3, 4 };
+
+	EXPECT_TRUE(FlutterBridge_SendBinaryChunkHeader_Android(TEXT("Assets"), TEXT("onChunk"), TEXT("t1"), 8, 2, 42));
+	Mock.SetThrowingMethod("onBinaryChunkDataFromUnreal");
+	FlutterBridge_SendBinaryChunkData_Android(TEXT("Assets"), TEXT("onChunk"), TEXT("t1"), 0, Data);
+	EXPECT_FALSE(Mock.HasPendingException());
+
+	// The rest of the transfer is unaffected
+	Mock.SetThrowingMethod(std::string());
+	FlutterBridge_SendBinaryChunkData_Android(TEXT("Assets"), TEXT("onChunk"), TEXT("t1"), 1, Data);
+	ASSERT_EQ(LastCall().Method, "onBinaryChunkDataFromUnreal");
+	EXPECT_EQ(LastCall().Numbers[0], 1);
+
+	FlutterBridge_SendBinaryChunkFooter_Android(TEXT("Assets"), TEXT("onChunk"), TEXT("t1"), 2, 42);
+	EXPECT_EQ(LastCall().Method, "onBinaryChunkFooterFromUnreal");
+	EXPECT_EQ(Mock.GetCalls().size(), 4u);
+}
+
+TEST_F(FFlutterBridgeAndroidTest, NotifyLevelLoaded)
+{
+	FlutterBridge_NotifyLevelLoaded_Android(TEXT("/Game/Maps/Arena"), 3);
+
+	ASSERT_EQ(LastCall().Method, "onLevelLoaded");
+	EXPECT_EQ(LastCall().Strings[0], u"/Game/Maps/Arena");
+	EXPECT_EQ(LastCall().Numbers[0], 3);
+}
+
+// ============================================================
+// MARK: - Java to Native
+// ============================================================
+
+TEST_F(FFlutterBridgeAndroidTest, SendMessageQueuesUtf16)
+{
+	const std::u16string Data = u"{\"name\":\"Jürgen \U0001F3AE\"}";
+	jstring Target = Mock.NewJavaString(u"Player");
+	jstring Method = Mock.NewJavaString(u"onRename");
+	jstring JavaData = Mock.NewJavaString(Data);
+
+	const FMockJNICounters Before = Mock.GetCounters();
+	Java_com_xraph_gameframework_unreal_UnrealEngineController_nativeSendMessage(Env, Controller, Target, Method, JavaData);
+	const FMockJNICounters Cost = Mock.GetCounters() - Before;
+
+	// One bulk copy per string and nothing created on the Java side
+	EXPECT_EQ(Cost.ReadString, 3);
+	EXPECT_EQ(Cost.LocalRefsCreated, 0);
+	EXPECT_EQ(Cost.FindClass + Cost.GetMethodID + Cost.CallMethod, 0);
+
+	ASSERT_EQ(AFlutterBridge::Ingress.Num(), 1);
+	const FFlutterIngressMessage& Message = AFlutterBridge::Ingress[0];
+	EXPECT_EQ(Message.Kind, FFlutterIngressMessage::EKind::Message);
+	EXPECT_TRUE(Message.Target == TEXT("Player"));
+	EXPECT_TRUE(Message.Method == TEXT("onRename"));
+	EXPECT_EQ(ToU16(Message.Data), Data);
+
+	Env->DeleteLocalRef(Target);
+	Env->DeleteLocalRef(Method);
+	Env->DeleteLocalRef(JavaData);
+}
+
+TEST_F(FFlutterBridgeAndroidTest, SendMessageWithEmptyAndNullStrings)
+{
+	jstring Target = Mock.NewJavaString(u"Player");
+	jstring Empty = Mock.NewJavaString(u"");
+	Java_com_xraph_gameframework_unreal_UnrealEngineController_nativeSendMessage(Env, Controller, Target, Empty, nullptr);
+
+	ASSERT_EQ(AFlutterBridge::Ingress.Num(), 1);
+	EXPECT_TRUE(AFlutterBridge::Ingress[0].Method.IsEmpty());
+	EXPECT_TRUE(AFlutterBridge::Ingress[0].Data.IsEmpty());
+
+	Env->DeleteLocalRef(Target);
+	Env->DeleteLocalRef(Empty);
+}
+
+TEST_F(FFlutterBridgeAndroidTest, SendBinaryFromByteArrayAndBuffer)
+{
+	jstring Target = Mock.NewJavaString(u"Assets");
+	jstring Method = Mock.NewJavaString(u"onUpload");
+
+	jbyteArray Array = Mock.NewJavaByteArray({ 1, 2, 3 });
+	Java_com_xraph_gameframework_unreal_UnrealEngineController_nativeSendBinaryMessage(Env, Controller, Target, Method, Array, 7);
+
+	// Only the first Length bytes of a direct buffer are read
+	uint8 Native[6] = { 10, 20, 30, 40, 50, 60 };
+	jobject Buffer = Mock.NewJavaDirectBuffer(Native, sizeof(Native));
+	Java_com_xraph_gameframework_unreal_UnrealEngineController_nativeSendBinaryBuffer(Env, Controller, Target, Method, Buffer, 4, 8);
+
+	ASSERT_EQ(AFlutterBridge::Ingress.Num(), 2);
+	EXPECT_TRUE(AFlutterBridge::Ingress[0].BinaryData == (TArray<uint8>{ 1, 2, 3 }));
+	EXPECT_EQ(AFlutterBridge::Ingress[0].Checksum, 7);
+	EXPECT_TRUE(AFlutterBridge::Ingress[1].BinaryData == (TArray<uint8>{ 10, 20, 30, 40 }));
+	EXPECT_EQ(AFlutterBridge::Ingress[1].Checksum, 8);
+
+	Env->DeleteLocalRef(Target);
+	Env->DeleteLocalRef(Method);
+	Env->DeleteLocalRef(Array);
+	Env->DeleteLocalRef(Buffer);
+}
+
+TEST_F(FFlutterBridgeAndroidTest, ConsoleCommandAndLoadLevel)
+{
+	jstring Command = Mock.NewJavaString(u"stat fps");
+	jstring Level = Mock.NewJavaString(u"/Game/Maps/Lobby");
+	Java_com_xraph_gameframework_unreal_UnrealEngineController_nativeExecuteConsoleCommand(Env, Controller, Command);
+	Java_com_xraph_gameframework_unreal_UnrealEngineController_nativeLoadLevel(Env, Controller, Level);
+
+	EXPECT_TRUE(Bridge.LastCommand == TEXT("stat fps"));
+	EXPECT_TRUE(Bridge.LastLevel == TEXT("/Game/Maps/Lobby"));
+
+	Env->DeleteLocalRef(Command);
+	Env->DeleteLocalRef(Level);
+}
+
+TEST_F(FFlutterBridgeAndroidTest, ApplyQualitySettingsFromMap)
+{
+	jobject Settings = Mock.NewJavaHashMap({ { u"qualityLevel", u"3" }, { u"shadowQuality", u"1" }, { u"viewDistanceQuality", u"2" } });
+
+	const int64 LocalRefs = Mock.GetLiveLocalRefs();
+	const FMockJNICounters Before = Mock.GetCounters();
+	Java_com_xraph_gameframework_unreal_UnrealEngineController_nativeApplyQualitySettings(Env, Controller, Settings);
+	const FMockJNICounters Cost = Mock.GetCounters() - Before;
+
+	EXPECT_EQ(Cost.FindClass, 0);
+	EXPECT_EQ(Cost.GetMethodID, 0);
+	EXPECT_EQ(Mock.GetLiveLocalRefs(), LocalRefs) << "Every entry's local references are deleted";
+
+	const int32 Expected[8] = { 3, -1, 1, -1, -1, -1, -1, 2 };
+	for (int32 Index = 0; Index < 8; ++Index)
+	{
+		EXPECT_EQ(Bridge.Quality[Index], Expected[Index]) << "Setting " << Index;
+	}
+
+	Env->DeleteLocalRef(Settings);
+}
+
+TEST_F(FFlutterBridgeAndroidTest, GetQualitySettingsAsMap)
+{
+	const int32 Values[8] = { 2, 3, 1, 0, 3, 2, 1, 0 };
+	FMemory::Memcpy(Bridge.Quality, Values, sizeof(Values));
+
+	const int64 LocalRefs = Mock.GetLiveLocalRefs();
+	const FMockJNICounters Before = Mock.GetCounters();
+	jobject Map = Java_com_xraph_gameframework_unreal_UnrealEngineController_nativeGetQualitySettings(Env, Controller);
+	const FMockJNICounters Cost = Mock.GetCounters() - Before;
+
+	EXPECT_EQ(Cost.FindClass, 0);
+	EXPECT_EQ(Cost.GetMethodID, 0);
+	EXPECT_EQ(Cost.NewObject, 1);
+	EXPECT_EQ(Mock.GetLiveLocalRefs(), LocalRefs + 1) << "Only the returned map is left for Java";
+
+	const auto Entries = Mock.ReadMap(Map);
+	ASSERT_EQ(Entries.size(), 8u);
+	EXPECT_EQ(Entries[0].first, u"qualityLevel");
+	EXPECT_EQ(Entries[0].second, u"2");
+	EXPECT_EQ(Entries[7].first, u"viewDistanceQuality");
+	EXPECT_EQ(Entries[7].second, u"0");
+
+	Env->DeleteLocalRef(Map);
+}
+
+TEST_F(FFlutterBridgeAndroidTest, SetBinaryChunkSizeRunsOnGameThread)
+{
+	Java_com_xraph_gameframework_unreal_UnrealEngineController_nativeSetBinaryChunkSize(Env, Controller, 65536);
+	EXPECT_EQ(Bridge.BinaryChunkSize, 0);
+
+	EXPECT_EQ(FHostTaskQueue::RunAll(), 1);
+	EXPECT_EQ(Bridge.BinaryChunkSize, 65536);
+}
+
+TEST_F(FFlutterBridgeAndroidTest, SetRenderScaleRunsOnGameThread)
+{
+	Java_com_xraph_gameframework_unreal_UnrealEngineController_nativeSetRenderScale(Env, Controller, 2, 0.8f, 0.5f, 1.0f, 60.0f);
+	EXPECT_TRUE(Bridge.Calls.IsEmpty());
+
+	EXPECT_EQ(FHostTaskQueue::RunAll(), 1);
+	ASSERT_FALSE(Bridge.Calls.IsEmpty());
+	EXPECT_TRUE(Bridge.Calls.Last() == TEXT("SetRenderScaleSettings"));
+	EXPECT_EQ(Bridge.RenderScaleSettings.Mode, EFlutterRenderScaleMode::Dynamic);
+	EXPECT_FLOAT_EQ(Bridge.RenderScaleSettings.Scale, 0.8f);
+	EXPECT_FLOAT_EQ(Bridge.RenderScaleSettings.MinScale, 0.5f);
+	EXPECT_FLOAT_EQ(Bridge.RenderScaleSettings.MaxScale, 1.0f);
+	EXPECT_FLOAT_EQ(Bridge.RenderScaleSettings.TargetFrameRate, 60.0f);
+
+	// Modes from a newer Dart side are clamped to the highest known one
+	Java_com_xraph_gameframework_unreal_UnrealEngineController_nativeSetRenderScale(Env, Controller, 7, 1.0f, 0.5f, 1.0f, 60.0f);
+	EXPECT_EQ(FHostTaskQueue::RunAll(), 1);
+	EXPECT_EQ(Bridge.RenderScaleSettings.Mode, EFlutterRenderScaleMode::Dynamic);
+}
+
+// ============================================================
+// MARK: - Surface
+// ============================================================
+
+TEST_F(FFlutterBridgeAndroidTest, SurfaceLifecycle)
+{
+	jobject Surface = Mock.NewSurface(1920, 1080);
+	Java_com_xraph_gameframework_unreal_UnrealEngineController_nativeSetSurface(Env, Controller, Surface);
+
+	ASSERT_FALSE(Bridge.Calls.IsEmpty());
+	EXPECT_TRUE(Bridge.Calls.Last() == TEXT("OnSurfaceReady"));
+	EXPECT_EQ(Bridge.SurfaceWidth, 1920);
+	EXPECT_EQ(Bridge.SurfaceHeight, 1080);
+	EXPECT_NE(FAndroidWindow::GetHardwareWindow_EventThread(), nullptr);
+	EXPECT_EQ(FAndroidWindow::NumSetHardwareWindowCalls, 1);
+
+	Java_com_xraph_gameframework_unreal_UnrealEngineController_nativeSurfaceChanged(Env, Controller, 1280, 720);
+	EXPECT_TRUE(Bridge.Calls.Last() == TEXT("OnSurfaceSizeChanged"));
+	EXPECT_EQ(Bridge.SurfaceWidth, 1280);
+
+	Java_com_xraph_gameframework_unreal_UnrealEngineController_nativeSetSurface(Env, Controller, nullptr);
+	EXPECT_TRUE(Bridge.Calls.Last() == TEXT("OnSurfaceDestroyed"));
+	EXPECT_EQ(FAndroidWindow::GetHardwareWindow_EventThread(), nullptr);
+
+	Env->DeleteLocalRef(Surface);
+}
+
+TEST_F(FFlutterBridgeAndroidTest, SurfaceStatistics)
+{
+	FFlutterSurfaceStats& Stats = FFlutterSurfaceStats::Get();
+	Stats.Reset();
+
+	jobject Surface = Mock.NewSurface(1080, 2340);
+	Java_com_xraph_gameframework_unreal_UnrealEngineController_nativeSetSurface(Env, Controller, Surface);
+	const double ReadyTime = Stats.GetStatistics().LastReadyTime;
+	EXPECT_GT(ReadyTime, 0.0);
+	EXPECT_GE(ReadyTime, Stats.GetStatistics().LastCreatedTime);
+
+	// End of frame is reported by the actor on the game thread; feed it a steady 60 Hz
+	double Now = ReadyTime + 0.025;
+	Stats.OnFrame(Now);
+	for (int32 Frame = 0; Frame < 30; ++Frame)
+	{
+		Now += 1.0 / 60.0;
+		Stats.OnFrame(Now);
+	}
+
+	// Rotation stalls rendering for four frame times
+	Java_com_xraph_gameframework_unreal_UnrealEngineController_nativeSurfaceChanged(Env, Controller, 2340, 1080);
+	const double ResizeTime = Stats.GetStatistics().LastResizeTime;
+	Now = FMath::Max(Now, ResizeTime) + 4.0 / 60.0;
+	Stats.OnFrame(Now);
+	for (int32 Frame = 0; Frame < FFlutterSurfaceStats::SettleFrames; ++Frame)
+	{
+		Now += 1.0 / 60.0;
+		Stats.OnFrame(Now);
+	}
+
+	Java_com_xraph_gameframework_unreal_UnrealEngineController_nativeSetSurface(Env, Controller, nullptr);
+
+	const FFlutterSurfaceStatistics Result = Stats.GetStatistics();
+	EXPECT_EQ(Result.SurfacesCreated, 1);
+	EXPECT_EQ(Result.Resizes, 1);
+	EXPECT_EQ(Result.SurfacesDestroyed, 1);
+	EXPECT_NEAR(Result.LastTimeToFirstFrameMs, 25.0, 0.001);
+	EXPECT_NEAR(Result.BaselineFrameMs, 1000.0 / 60.0, 0.01);
+	EXPECT_EQ(Result.LastResizeDroppedFrames, 3);
+	EXPECT_GT(Result.LastResizeSettleMs, 0.0);
+
+	// Flutter reads the same numbers as JSON
+	jstring Json = Java_com_xraph_gameframework_unreal_UnrealEngineController_nativeGetSurfaceStatistics(Env, Controller);
+	ASSERT_NE(Json, nullptr);
+	const std::u16string Text = ToU16(JStringToFString(Env, Json));
+	EXPECT_NE(Text.find(u"\"surfacesCreated\":1,\"resizes\":1,\"surfacesDestroyed\":1,"), std::u16string::npos);
+	EXPECT_NE(Text.find(u"\"lastResizeDroppedFrames\":3,\"totalResizeDroppedFrames\":3,"), std::u16string::npos);
+	EXPECT_NE(Text.find(u"\"lastTimeToFirstFrameMs\":25.000,"), std::u16string::npos);
+	Env->DeleteLocalRef(Json);
+	Env->DeleteLocalRef(Surface);
+
+	Stats.Reset();
+}
@@ -47,6 +47,10 @@ public class FlutterPlugin : ModuleRules
 			);
 
 
+		// zlib for streaming GZip/zlib binary message compression
+		AddEngineThirdPartyPrivateStaticDependencies(Target, "zlib");
+
+
 		DynamicallyLoadedModuleNames.AddRange(
 			new string[]
 			{
@@ -4,6 +4,11 @@
 
 #if PLATFORM_ANDROID
 
+#include "FlutterJNICache.h"
+#include "FlutterJNIStrings.h"
+#include "FlutterJNIThread.h"
+#include "FlutterBufferPool.h"
+#include "FlutterSurfaceStats.h"
 #include "Android/AndroidJNI.h"
 #include "Android/AndroidApplication.h"
 #include "Android/AndroidWindow.h"
@@ -11,21 +16,22 @@
 #include "Engine/GameViewportClient.h"
 #include "Slate/SceneViewport.h"
 #include "RenderingThread.h"
+#include "Async/Async.h"
+#include "HAL/PlatformTime.h"
 #include <jni.h>
+#include <atomic>
 #include <android/native_window.h>
 #include <android/native_window_jni.h>
 
-// Global reference to the Java UnrealEngineController instance
-static jobject GUnrealEngineControllerInstance = nullptr;
-static jclass GUnrealEngineControllerClass = nullptr;
-
-// Cached method IDs for callbacks
-static jmethodID GOnMessageFromUnrealMethodID = nullptr;
-static jmethodID GOnLevelLoadedMethodID = nullptr;
-
 // Reference to FlutterBridge instance
 static AFlutterBridge* GFlutterBridgeInstance = nullptr;
 
+// Native memory behind the direct ByteBuffers handed to Java; returned via nativeReleaseBuffer
+static FFlutterBufferPool GDirectBufferPool;
+
+// Calls from native code into the Java controller, for measuring batching
+static std::atomic<int64> GJavaUpcallCount(0);
+
 // Native window for rendering (from Flutter's SurfaceView)
 static ANativeWindow* GNativeWindow = nullptr;
 static int32 GSurfaceWidth = 0;
@@ -36,34 +42,50 @@ static int32 GSurfaceHeight = 0;
 // ============================================================
 
 /**
- * Convert FString to jstring
+ * Copy a Java byte[] into a TArray
  */
-jstring FStringToJString(JNIEnv* Env, const FString& String)
+TArray<uint8> JByteArrayToTArray(JNIEnv* Env, jbyteArray JavaArray)
 {
-	if (!Env)
+	TArray<uint8> Result;
+
+	if (!Env || !JavaArray)
 	{
-		return nullptr;
+		return Result;
+	}
+
+	const jsize Length = Env->GetArrayLength(JavaArray);
+	Result.SetNumUninitialized(Length);
+	if (Length > 0)
+	{
+		Env->GetByteArrayRegion(JavaArray, 0, Length, reinterpret_cast<jbyte*>(Result.GetData()));
 	}
 
-	// Use FTCHARToUTF8 converter to avoid dangling pointer from TCHAR_TO_UTF8 macro
-	FTCHARToUTF8 Converter(*String);
-	return Env->NewStringUTF(Converter.Get());
+	return Result;
 }
 
 /**
- * Convert jstring to FString
+ * Copy the first Length bytes of a direct ByteBuffer into a TArray
+ * Reads the native memory in place, without a Java heap array in between.
  */
-FString JStringToFString(JNIEnv* Env, jstring JavaString)
+TArray<uint8> JDirectBufferToTArray(JNIEnv* Env, jobject JavaBuffer, int32 Length)
 {
-	if (!Env || !JavaString)
+	TArray<uint8> Result;
+
+	if (!Env || !JavaBuffer || Length <= 0)
 	{
-		return FString();
+		return Result;
 	}
 
-	const char* UTFString = Env->GetStringUTFChars(JavaString, nullptr);
-	FString Result(UTF8_TO_TCHAR(UTFString));
-	Env->ReleaseStringUTFChars(JavaString, UTFString);
+	const uint8* Address = static_cast<const uint8*>(Env->GetDirectBufferAddress(JavaBuffer));
+	const jlong Capacity = Env->GetDirectBufferCapacity(JavaBuffer);
+	if (!Address || Capacity < Length)
+	{
+		UE_LOG(LogTemp, Warning, TEXT("[FlutterBridge_Android] Not a direct buffer or too small: capacity=%lld, length=%d"), (long long)Capacity, Length);
+		return Result;
+	}
 
+	Result.SetNumUninitialized(Length);
+	FMemory::Memcpy(Result.GetData(), Address, Length);
 	return Result;
 }
 
@@ -74,51 +96,32 @@ TMap<FString, FString> JMapToTMap(JNIEnv* Env, jobject JavaMap)
 {
 	TMap<FString, FString> Result;
 
-	if (!Env || !JavaMap)
+	FFlutterJNICache& Cache = FFlutterJNICache::Get();
+	if (!Env || !JavaMap || !Cache.Initialize(Env))
 	{
 		return Result;
 	}
 
-	// Get Map class and methods
-	jclass MapClass = Env->FindClass("java/util/Map");
-	jmethodID EntrySetMethod = Env->GetMethodID(MapClass, "entrySet", "()Ljava/util/Set;");
-
-	// Get Set class and methods
-	jclass SetClass = Env->FindClass("java/util/Set");
-	jmethodID IteratorMethod = Env->GetMethodID(SetClass, "iterator", "()Ljava/util/Iterator;");
-
-	// Get Iterator class and methods
-	jclass IteratorClass = Env->FindClass("java/util/Iterator");
-	jmethodID HasNextMethod = Env->GetMethodID(IteratorClass, "hasNext", "()Z");
-	jmethodID NextMethod = Env->GetMethodID(IteratorClass, "next", "()Ljava/lang/Object;");
-
-	// Get Map.Entry class and methods
-	jclass EntryClass = Env->FindClass("java/util/Map$Entry");
-	jmethodID GetKeyMethod = Env->GetMethodID(EntryClass, "getKey", "()Ljava/lang/Object;");
-	jmethodID GetValueMethod = Env->GetMethodID(EntryClass, "getValue", "()Ljava/lang/Object;");
-
 	// Iterate through the map
-	jobject EntrySet = Env->CallObjectMethod(JavaMap, EntrySetMethod);
-	jobject Iterator = Env->CallObjectMethod(EntrySet, IteratorMethod);
+	jobject EntrySet = Env->CallObjectMethod(JavaMap, Cache.MapEntrySet);
+	jobject Iterator = Env->CallObjectMethod(EntrySet, Cache.SetIterator);
 
-	while (Env->CallBooleanMethod(Iterator, HasNextMethod))
+	while (Env->CallBooleanMethod(Iterator, Cache.IteratorHasNext))
 	{
-		jobject Entry = Env->CallObjectMethod(Iterator, NextMethod);
-		jstring Key = (jstring)Env->CallObjectMethod(Entry, GetKeyMethod);
-		jobject Value = Env->CallObjectMethod(Entry, GetValueMethod);
+		jobject Entry = Env->CallObjectMethod(Iterator, Cache.IteratorNext);
+		jstring Key = (jstring)Env->CallObjectMethod(Entry, Cache.MapEntryGetKey);
+		jobject Value = Env->CallObjectMethod(Entry, Cache.MapEntryGetValue);
 
 		FString KeyString = JStringToFString(Env, Key);
 		FString ValueString;
 
-		// Handle different value types
+		// Object.toString() dispatches to the value's own type
 		if (Value)
 		{
-			jclass ObjectClass = Env->GetObjectClass(Value);
-			jmethodID ToStringMethod = Env->GetMethodID(ObjectClass, "toString", "()Ljava/lang/String;");
-			jstring ValueStr = (jstring)Env->CallObjectMethod(Value, ToStringMethod);
+			jstring ValueStr = (jstring)Env->CallObjectMethod(Value, Cache.ObjectToString);
 			ValueString = JStringToFString(Env, ValueStr);
 			Env->DeleteLocalRef(ValueStr);
-			Env->DeleteLocalRef(ObjectClass);
+			Env->DeleteLocalRef(Value);
 		}
 
 		Result.Add(KeyString, ValueString);
@@ -129,10 +132,6 @@ TMap<FString, FString> JMapToTMap(JNIEnv* Env, jobject JavaMap)
 
 	Env->DeleteLocalRef(Iterator);
 	Env->DeleteLocalRef(EntrySet);
-	Env->DeleteLocalRef(MapClass);
-	Env->DeleteLocalRef(SetClass);
-	Env->DeleteLocalRef(IteratorClass);
-	Env->DeleteLocalRef(EntryClass);
 
 	return Result;
 }
@@ -142,35 +141,28 @@ TMap<FString, FString> JMapToTMap(JNIEnv* Env, jobject JavaMap)
  */
 jobject TMapToJMap(JNIEnv* Env, const TMap<FString, int32>& Map)
 {
-	if (!Env)
+	FFlutterJNICache& Cache = FFlutterJNICache::Get();
+	if (!Env || !Cache.Initialize(Env))
 	{
 		return nullptr;
 	}
 
-	// Create HashMap
-	jclass HashMapClass = Env->FindClass("java/util/HashMap");
-	jmethodID HashMapConstructor = Env->GetMethodID(HashMapClass, "<init>", "()V");
-	jmethodID PutMethod = Env->GetMethodID(HashMapClass, "put", "(Ljava/lang/Object;Ljava/lang/Object;)Ljava/lang/Object;");
-
-	jobject HashMap = Env->NewObject(HashMapClass, HashMapConstructor);
-
-	// Get Integer class
-	jclass IntegerClass = Env->FindClass("java/lang/Integer");
-	jmethodID IntegerConstructor = Env->GetMethodID(IntegerClass, "<init>", "(I)V");
+	// Sized up front so put() never rehashes
+	jobject HashMap = Env->NewObject(Cache.HashMapClass, Cache.HashMapInit, (jint)(Map.Num() * 4 / 3 + 1));
 
-	// Add all entries
 	for (const auto& Entry : Map)
 	{
 		jstring Key = FStringToJString(Env, Entry.Key);
-		jobject Value = Env->NewObject(IntegerClass, IntegerConstructor, Entry.Value);
-		Env->CallObjectMethod(HashMap, PutMethod, Key, Value);
+		jobject Value = Env->CallStaticObjectMethod(Cache.IntegerClass, Cache.IntegerValueOf, (jint)Entry.Value);
+		jobject Previous = Env->CallObjectMethod(HashMap, Cache.HashMapPut, Key, Value);
+		if (Previous)
+		{
+			Env->DeleteLocalRef(Previous);
+		}
 		Env->DeleteLocalRef(Key);
 		Env->DeleteLocalRef(Value);
 	}
 
-	Env->DeleteLocalRef(HashMapClass);
-	Env->DeleteLocalRef(IntegerClass);
-
 	return HashMap;
 }
 
@@ -189,25 +181,15 @@ extern "C"
 	{
 		UE_LOG(LogTemp, Log, TEXT("[FlutterBridge_Android] nativeCreate called"));
 
-		// Store controller instance
-		if (!GUnrealEngineControllerInstance)
+		FFlutterJNIThread::SetJavaVM(Env);
+
+		// Store controller instance and cache its callbacks
+		FFlutterJNICache& Cache = FFlutterJNICache::Get();
+		if (!Cache.Controller)
 		{
-			GUnrealEngineControllerInstance = Env->NewGlobalRef(Obj);
-			GUnrealEngineControllerClass = (jclass)Env->NewGlobalRef(Env->GetObjectClass(Obj));
-
-			// Cache method IDs
-			GOnMessageFromUnrealMethodID = Env->GetMethodID(
-				GUnrealEngineControllerClass,
-				"onMessageFromUnreal",
-				"(Ljava/lang/String;Ljava/lang/String;Ljava/lang/String;)V"
-			);
-
-			GOnLevelLoadedMethodID = Env->GetMethodID(
-				GUnrealEngineControllerClass,
-				"onLevelLoaded",
-				"(Ljava/lang/String;I)V"
-			);
+			Cache.SetController(Env, Obj);
 		}
+		Cache.Initialize(Env);
 
 		// Parse config (if needed)
 		// TMap<FString, FString> ConfigMap = JMapToTMap(Env, Config);
@@ -308,6 +290,8 @@ extern "C"
 	{
 		UE_LOG(LogTemp, Log, TEXT("[FlutterBridge_Android] nativeSetSurface called"));
 
+		const double StartTime = FPlatformTime::Seconds();
+
 		// Release previous native window if any
 		if (GNativeWindow != nullptr)
 		{
@@ -361,6 +345,8 @@ extern "C"
 					FAndroidWindow::SetWindowDimensions_EventThread(GNativeWindow);
 				}
 				
+				FFlutterSurfaceStats::Get().OnSurfaceReady(StartTime, FPlatformTime::Seconds(), GSurfaceWidth, GSurfaceHeight);
+
 				// Notify FlutterBridge if available
 				if (GFlutterBridgeInstance)
 				{
@@ -381,6 +367,8 @@ extern "C"
 			// Clear the hardware window
 			UE_LOG(LogTemp, Log, TEXT("[FlutterBridge_Android] Clearing hardware window"));
 			FAndroidWindow::SetHardwareWindow_EventThread(nullptr);
+
+			FFlutterSurfaceStats::Get().OnSurfaceDestroyed(StartTime, FPlatformTime::Seconds());
 			
 			// Notify FlutterBridge if available
 			if (GFlutterBridgeInstance)
@@ -407,6 +395,8 @@ extern "C"
 		GSurfaceWidth = Width;
 		GSurfaceHeight = Height;
 
+		FFlutterSurfaceStats::Get().OnSurfaceResized(FPlatformTime::Seconds(), Width, Height);
+
 		if (GNativeWindow != nullptr)
 		{
 			// Update the native window buffer geometry if needed
@@ -490,43 +480,157 @@ extern "C"
 		}
 
 		// Clean up global references
-		if (GUnrealEngineControllerInstance)
-		{
-			Env->DeleteGlobalRef(GUnrealEngineControllerInstance);
-			GUnrealEngineControllerInstance = nullptr;
-		}
-
-		if (GUnrealEngineControllerClass)
-		{
-			Env->DeleteGlobalRef(GUnrealEngineControllerClass);
-			GUnrealEngineControllerClass = nullptr;
-		}
+		FFlutterJNICache::Get().Shutdown(Env);
 
 		GFlutterBridgeInstance = nullptr;
 	}
 
 	/**
 	 * Send message to Unreal
+	 *
+	 * Called on the Android main thread. The message is queued for the game thread,
+	 * so this returns without waiting for Unreal.
 	 */
 	JNIEXPORT void JNICALL
 	Java_com_xraph_gameframework_unreal_UnrealEngineController_nativeSendMessage(
 		JNIEnv* Env, jobject Obj, jstring Target, jstring Method, jstring Data)
 	{
-		FString TargetString = JStringToFString(Env, Target);
-		FString MethodString = JStringToFString(Env, Method);
-		FString DataString = JStringToFString(Env, Data);
+		FFlutterIngressMessage Message;
+		Message.Kind = FFlutterIngressMessage::EKind::Message;
+		Message.Target = JStringToFString(Env, Target);
+		Message.Method = JStringToFString(Env, Method);
+		Message.Data = JStringToFString(Env, Data);
 
-		UE_LOG(LogTemp, Log, TEXT("[FlutterBridge_Android] nativeSendMessage: Target=%s, Method=%s"),
-			*TargetString, *MethodString);
+		UE_LOG(LogTemp, Verbose, TEXT("[FlutterBridge_Android] nativeSendMessage: Target=%s, Method=%s"),
+			*Message.Target, *Message.Method);
 
-		if (GFlutterBridgeInstance)
+		AFlutterBridge::EnqueueFromFlutter(MoveTemp(Message));
+	}
+
+	/**
+	 * Send binary message to Unreal
+	 */
+	JNIEXPORT void JNICALL
+	Java_com_xraph_gameframework_unreal_UnrealEngineController_nativeSendBinaryMessage(
+		JNIEnv* Env, jobject Obj, jstring Target, jstring Method, jbyteArray Data, jint Checksum)
+	{
+		FFlutterIngressMessage Message;
+		Message.Kind = FFlutterIngressMessage::EKind::Binary;
+		Message.Target = JStringToFString(Env, Target);
+		Message.Method = JStringToFString(Env, Method);
+		Message.BinaryData = JByteArrayToTArray(Env, Data);
+		Message.Checksum = Checksum;
+
+		UE_LOG(LogTemp, Verbose, TEXT("[FlutterBridge_Android] nativeSendBinaryMessage: Target=%s, Method=%s, Size=%d"),
+			*Message.Target, *Message.Method, Message.BinaryData.Num());
+
+		AFlutterBridge::EnqueueFromFlutter(MoveTemp(Message));
+	}
+
+	/**
+	 * Send binary message to Unreal from a direct ByteBuffer
+	 * Only the first Length bytes are read; the buffer can be reused once this returns.
+	 */
+	JNIEXPORT void JNICALL
+	Java_com_xraph_gameframework_unreal_UnrealEngineController_nativeSendBinaryBuffer(
+		JNIEnv* Env, jobject Obj, jstring Target, jstring Method, jobject Data, jint Length, jint Checksum)
+	{
+		FFlutterIngressMessage Message;
+		Message.Kind = FFlutterIngressMessage::EKind::Binary;
+		Message.Target = JStringToFString(Env, Target);
+		Message.Method = JStringToFString(Env, Method);
+		Message.BinaryData = JDirectBufferToTArray(Env, Data, Length);
+		Message.Checksum = Checksum;
+
+		UE_LOG(LogTemp, Verbose, TEXT("[FlutterBridge_Android] nativeSendBinaryBuffer: Target=%s, Method=%s, Size=%d"),
+			*Message.Target, *Message.Method, Message.BinaryData.Num());
+
+		AFlutterBridge::EnqueueFromFlutter(MoveTemp(Message));
+	}
+
+	/**
+	 * Return a buffer passed to onBinaryBufferFromUnreal
+	 * Java must not touch the ByteBuffer afterwards; its memory is reused for the next message.
+	 */
+	JNIEXPORT void JNICALL
+	Java_com_xraph_gameframework_unreal_UnrealEngineController_nativeReleaseBuffer(
+		JNIEnv* Env, jobject Obj, jint BufferId)
+	{
+		if (!GDirectBufferPool.Release(BufferId))
 		{
-			GFlutterBridgeInstance->ReceiveFromFlutter(TargetString, MethodString, DataString);
+			UE_LOG(LogTemp, Warning, TEXT("[FlutterBridge_Android] nativeReleaseBuffer: unknown buffer %d"), BufferId);
 		}
-		else
+	}
+
+	/**
+	 * Start of a chunked binary transfer
+	 */
+	JNIEXPORT void JNICALL
+	Java_com_xraph_gameframework_unreal_UnrealEngineController_nativeBinaryChunkHeader(
+		JNIEnv* Env, jobject Obj, jstring Target, jstring Method, jstring TransferId, jint TotalSize, jint TotalChunks, jint Checksum)
+	{
+		FFlutterIngressMessage Message;
+		Message.Kind = FFlutterIngressMessage::EKind::ChunkHeader;
+		Message.Target = JStringToFString(Env, Target);
+		Message.Method = JStringToFString(Env, Method);
+		Message.TransferId = JStringToFString(Env, TransferId);
+		Message.TotalSize = TotalSize;
+		Message.TotalChunks = TotalChunks;
+		Message.Checksum = Checksum;
+
+		AFlutterBridge::EnqueueFromFlutter(MoveTemp(Message));
+	}
+
+	/**
+	 * One chunk of a chunked binary transfer
+	 */
+	JNIEXPORT void JNICALL
+	Java_com_xraph_gameframework_unreal_UnrealEngineController_nativeBinaryChunkData(
+		JNIEnv* Env, jobject Obj, jstring Target, jstring Method, jstring TransferId, jint ChunkIndex, jbyteArray Data)
+	{
+		FFlutterIngressMessage Message;
+		Message.Kind = FFlutterIngressMessage::EKind::ChunkData;
+		Message.Target = JStringToFString(Env, Target);
+		Message.Method = JStringToFString(Env, Method);
+		Message.TransferId = JStringToFString(Env, TransferId);
+		Message.ChunkIndex = ChunkIndex;
+		Message.BinaryData = JByteArrayToTArray(Env, Data);
+
+		AFlutterBridge::EnqueueFromFlutter(MoveTemp(Message));
+	}
+
+	/**
+	 * End of a chunked binary transfer
+	 */
+	JNIEXPORT void JNICALL
+	Java_com_xraph_gameframework_unreal_UnrealEngineController_nativeBinaryChunkFooter(
+		JNIEnv* Env, jobject Obj, jstring Target, jstring Method, jstring TransferId, jint TotalChunks, jint Checksum)
+	{
+		FFlutterIngressMessage Message;
+		Message.Kind = FFlutterIngressMessage::EKind::ChunkFooter;
+		Message.Target = JStringToFString(Env, Target);
+		Message.Method = JStringToFString(Env, Method);
+		Message.TransferId = JStringToFString(Env, TransferId);
+		Message.TotalChunks = TotalChunks;
+		Message.Checksum = Checksum;
+
+		AFlutterBridge::EnqueueFromFlutter(MoveTemp(Message));
+	}
+
+	/**
+	 * Set the chunk size used for binary transfers
+	 */
+	JNIEXPORT void JNICALL
+	Java_com_xraph_gameframework_unreal_UnrealEngineController_nativeSetBinaryChunkSize(
+		JNIEnv* Env, jobject Obj, jint Size)
+	{
+		AsyncTask(ENamedThreads::GameThread, [Size]()
 		{
-			UE_LOG(LogTemp, Warning, TEXT("[FlutterBridge_Android] FlutterBridge instance not set"));
-		}
+			if (GFlutterBridgeInstance)
+			{
+				GFlutterBridgeInstance->SetBinaryChunkSize(Size);
+			}
+		});
 	}
 
 	/**
@@ -641,76 +745,320 @@ extern "C"
 		// Convert to Java HashMap
 		return TMapToJMap(Env, Settings);
 	}
+
+	/**
+	 * Get surface lifecycle statistics as JSON
+	 * Works without a bridge instance, the statistics outlive it.
+	 */
+	JNIEXPORT jstring JNICALL
+	Java_com_xraph_gameframework_unreal_UnrealEngineController_nativeGetSurfaceStatistics(
+		JNIEnv* Env, jobject Obj)
+	{
+		const FString Json = FFlutterSurfaceStats::ToJson(FFlutterSurfaceStats::Get().GetStatistics());
+		return FStringToJString(Env, Json);
+	}
+
+	/**
+	 * Set the render scale mode
+	 * @param Mode - EFlutterRenderScaleMode: 0 native, 1 fixed, 2 dynamic
+	 */
+	JNIEXPORT void JNICALL
+	Java_com_xraph_gameframework_unreal_UnrealEngineController_nativeSetRenderScale(
+		JNIEnv* Env, jobject Obj, jint Mode, jfloat Scale, jfloat MinScale, jfloat MaxScale, jfloat TargetFrameRate)
+	{
+		FFlutterRenderScaleSettings Settings;
+		Settings.Mode = (EFlutterRenderScaleMode)FMath::Clamp((int32)Mode, 0, (int32)EFlutterRenderScaleMode::Dynamic);
+		Settings.Scale = Scale;
+		Settings.MinScale = MinScale;
+		Settings.MaxScale = MaxScale;
+		Settings.TargetFrameRate = TargetFrameRate;
+
+		// Console variables belong to the game thread
+		AsyncTask(ENamedThreads::GameThread, [Settings]()
+		{
+			if (GFlutterBridgeInstance)
+			{
+				GFlutterBridgeInstance->SetRenderScaleSettings(Settings);
+			}
+		});
+	}
 }
 
 // ============================================================
 // MARK: - Callbacks from Unreal to Flutter (via Java)
 // ============================================================
 
+/**
+ * Local reference to the Java controller for the duration of one upcall
+ * Sends may run on any thread, so nativeQuit can release the cached global reference
+ * while a call is in flight; the local reference keeps the controller alive until it ends.
+ */
+class FScopedJavaController
+{
+public:
+	explicit FScopedJavaController(JNIEnv* InEnv)
+		: Env(InEnv)
+		, Controller(FFlutterJNICache::Get().NewControllerRef(InEnv))
+	{
+	}
+
+	~FScopedJavaController()
+	{
+		if (Controller)
+		{
+			Env->DeleteLocalRef(Controller);
+		}
+	}
+
+	FScopedJavaController(const FScopedJavaController&) = delete;
+	FScopedJavaController& operator=(const FScopedJavaController&) = delete;
+
+	jobject Get() const { return Controller; }
+
+private:
+	JNIEnv* Env;
+	jobject Controller;
+};
+
+/**
+ * Clear an exception thrown by a Java callback
+ * Worker threads have no Java caller to report a pending exception to, and the next JNI
+ * call on the thread would abort with one pending.
+ * @return True if the callback threw
+ */
+static bool ClearJavaException(JNIEnv* Env, const TCHAR* Callback)
+{
+	if (!Env->ExceptionCheck())
+	{
+		return false;
+	}
+
+	Env->ExceptionDescribe();
+	Env->ExceptionClear();
+	UE_LOG(LogTemp, Error, TEXT("[FlutterBridge_Android] %s threw"), Callback);
+	return true;
+}
+
 /**
  * Send message to Flutter via Java
- * Called from AFlutterBridge::SendToFlutter()
+ * Called from AFlutterBridge::SendToFlutter() and AFlutterBridge::SendToFlutterFromAnyThread(),
+ * so this may run on any thread; worker threads are attached to the VM on first use.
  */
 void FlutterBridge_SendToFlutter_Android(const FString& Target, const FString& Method, const FString& Data)
 {
-	if (!GUnrealEngineControllerInstance || !GOnMessageFromUnrealMethodID)
+	JNIEnv* Env = FFlutterJNIThread::GetEnv();
+	if (!Env)
 	{
-		UE_LOG(LogTemp, Warning, TEXT("[FlutterBridge_Android] Cannot send to Flutter: Java instance not initialized"));
+		UE_LOG(LogTemp, Error, TEXT("[FlutterBridge_Android] Failed to get JNI environment"));
 		return;
 	}
 
-	JNIEnv* Env = FAndroidApplication::GetJavaEnv();
-	if (!Env)
+	const FFlutterJNICache& Cache = FFlutterJNICache::Get();
+	const FScopedJavaController Controller(Env);
+	const jmethodID OnMessageFromUnreal = Cache.OnMessageFromUnreal;
+	if (!Controller.Get() || !OnMessageFromUnreal)
 	{
-		UE_LOG(LogTemp, Error, TEXT("[FlutterBridge_Android] Failed to get JNI environment"));
+		UE_LOG(LogTemp, Warning, TEXT("[FlutterBridge_Android] Cannot send to Flutter: Java instance not initialized"));
 		return;
 	}
 
 	// Convert strings
-	jstring jTarget = FStringToJString(Env, Target);
-	jstring jMethod = FStringToJString(Env, Method);
-	jstring jData = FStringToJString(Env, Data);
+	const FScopedJavaString jTarget(Env, Target, true);
+	const FScopedJavaString jMethod(Env, Method, true);
+	const FScopedJavaString jData(Env, Data);
 
 	// Call Java method
+	GJavaUpcallCount.fetch_add(1, std::memory_order_relaxed);
 	Env->CallVoidMethod(
-		GUnrealEngineControllerInstance,
-		GOnMessageFromUnrealMethodID,
-		jTarget,
-		jMethod,
-		jData
+		Controller.Get(),
+		OnMessageFromUnreal,
+		jTarget.Get(),
+		jMethod.Get(),
+		jData.Get()
 	);
 
-	// Clean up local references
-	Env->DeleteLocalRef(jTarget);
-	Env->DeleteLocalRef(jMethod);
-	Env->DeleteLocalRef(jData);
+	if (ClearJavaException(Env, TEXT("onMessageFromUnreal")))
+	{
+		UE_LOG(LogTemp, Error, TEXT("[FlutterBridge_Android] Message not delivered: Target=%s, Method=%s"), *Target, *Method);
+		return;
+	}
 
 	UE_LOG(LogTemp, Log, TEXT("[FlutterBridge_Android] Message sent to Flutter: Target=%s, Method=%s"),
 		*Target, *Method);
 }
 
+/**
+ * Send a batch frame (see FFlutterMessageBatch) to Flutter in one call
+ * Called from AFlutterBridge::FlushOutgoingBatch() once per frame. The frame goes to Java in
+ * a pooled direct ByteBuffer, which Java returns with nativeReleaseBuffer after unpacking it.
+ * @return False if the controller has no batch callback or the call failed; the caller then
+ * sends the frame as a binary message
+ */
+bool FlutterBridge_SendMessageBatch_Android(const TArray<uint8>& Frame, int32 NumMessages)
+{
+	const FFlutterJNICache& Cache = FFlutterJNICache::Get();
+	if (!Cache.OnMessageBatchFromUnreal)
+	{
+		return false;
+	}
+
+	JNIEnv* Env = FFlutterJNIThread::GetEnv();
+	if (!Env)
+	{
+		UE_LOG(LogTemp, Error, TEXT("[FlutterBridge_Android] Failed to get JNI environment"));
+		return false;
+	}
+
+	const FScopedJavaController Controller(Env);
+	const jmethodID OnMessageBatchFromUnreal = Cache.OnMessageBatchFromUnreal;
+	if (!Controller.Get() || !OnMessageBatchFromUnreal)
+	{
+		return false;
+	}
+
+	uint8* Buffer = nullptr;
+	int32 Capacity = 0;
+	const int32 BufferId = GDirectBufferPool.Acquire(Frame.Num(), Buffer, Capacity);
+	if (BufferId == INDEX_NONE)
+	{
+		return false;
+	}
+
+	FMemory::Memcpy(Buffer, Frame.GetData(), Frame.Num());
+
+	jobject jFrame = Env->NewDirectByteBuffer(Buffer, Frame.Num());
+	if (!jFrame)
+	{
+		Env->ExceptionClear();
+		GDirectBufferPool.Release(BufferId);
+		return false;
+	}
+
+	GJavaUpcallCount.fetch_add(1, std::memory_order_relaxed);
+	Env->CallVoidMethod(
+		Controller.Get(),
+		OnMessageBatchFromUnreal,
+		jFrame,
+		(jint)NumMessages,
+		(jint)BufferId
+	);
+
+	// Java never kept the buffer if the call threw
+	const bool bFailed = ClearJavaException(Env, TEXT("onMessageBatchFromUnreal"));
+	if (bFailed)
+	{
+		GDirectBufferPool.Release(BufferId);
+	}
+
+	Env->DeleteLocalRef(jFrame);
+
+	UE_LOG(LogTemp, Verbose, TEXT("[FlutterBridge_Android] Message batch sent to Flutter: %d messages, %d bytes"),
+		NumMessages, Frame.Num());
+
+	return !bFailed;
+}
+
+/**
+ * Number of calls made into the Java controller so far
+ */
+int64 FlutterBridge_GetJavaUpcallCount_Android()
+{
+	return GJavaUpcallCount.load(std::memory_order_relaxed);
+}
+
+/**
+ * Send binary data to Flutter in a pooled direct ByteBuffer
+ * The payload never lands on the Java heap; Java returns the buffer with nativeReleaseBuffer
+ * once Flutter has consumed it.
+ * @return False if no buffer was available or the call failed; the caller falls back to byte[]
+ */
+static bool SendBinaryBufferToFlutter(JNIEnv* Env, jobject Controller, jmethodID OnBinaryBufferFromUnreal, const FString& Target, const FString& Method, const TArray<uint8>& Data, bool bIsCompressed, int32 Checksum)
+{
+	uint8* Buffer = nullptr;
+	int32 Capacity = 0;
+	const int32 BufferId = GDirectBufferPool.Acquire(Data.Num(), Buffer, Capacity);
+	if (BufferId == INDEX_NONE)
+	{
+		return false;
+	}
+
+	FMemory::Memcpy(Buffer, Data.GetData(), Data.Num());
+
+	// The ByteBuffer's capacity is the payload size, not the pooled capacity
+	jobject jData = Env->NewDirectByteBuffer(Buffer, Data.Num());
+	if (!jData)
+	{
+		Env->ExceptionClear();
+		GDirectBufferPool.Release(BufferId);
+		return false;
+	}
+
+	const FScopedJavaString jTarget(Env, Target, true);
+	const FScopedJavaString jMethod(Env, Method, true);
+
+	GJavaUpcallCount.fetch_add(1, std::memory_order_relaxed);
+	Env->CallVoidMethod(
+		Controller,
+		OnBinaryBufferFromUnreal,
+		jTarget.Get(),
+		jMethod.Get(),
+		jData,
+		(jint)BufferId,
+		(jboolean)bIsCompressed,
+		(jint)Checksum
+	);
+
+	// Java never saw the buffer if the call threw
+	const bool bFailed = ClearJavaException(Env, TEXT("onBinaryBufferFromUnreal"));
+	if (bFailed)
+	{
+		GDirectBufferPool.Release(BufferId);
+	}
+
+	Env->DeleteLocalRef(jData);
+
+	UE_LOG(LogTemp, Verbose, TEXT("[FlutterBridge_Android] Binary buffer %d sent to Flutter: Target=%s, Method=%s, Size=%d"),
+		BufferId, *Target, *Method, Data.Num());
+
+	return !bFailed;
+}
+
 /**
  * Send binary data to Flutter via Java
  * Called from AFlutterBridge::SendBinaryToFlutter()
  */
-void FlutterBridge_SendBinaryToFlutter_Android(const FString& Target, const FString& Method, const TArray<uint8>& Data, int32 Checksum)
+void FlutterBridge_SendBinaryToFlutter_Android(const FString& Target, const FString& Method, const TArray<uint8>& Data, bool bIsCompressed, int32 Checksum)
 {
-	if (!GUnrealEngineControllerInstance)
+	JNIEnv* Env = FFlutterJNIThread::GetEnv();
+	if (!Env)
+	{
+		UE_LOG(LogTemp, Error, TEXT("[FlutterBridge_Android] Failed to get JNI environment"));
+		return;
+	}
+
+	const FFlutterJNICache& Cache = FFlutterJNICache::Get();
+	const FScopedJavaController Controller(Env);
+	const jmethodID OnBinaryBufferFromUnreal = Cache.OnBinaryBufferFromUnreal;
+	const jmethodID OnBinaryMessageFromUnreal = Cache.OnBinaryMessageFromUnreal;
+	if (!Controller.Get() || (!OnBinaryMessageFromUnreal && !OnBinaryBufferFromUnreal))
 	{
 		UE_LOG(LogTemp, Warning, TEXT("[FlutterBridge_Android] Cannot send binary to Flutter: Java instance not initialized"));
 		return;
 	}
 
-	JNIEnv* Env = FAndroidApplication::GetJavaEnv();
-	if (!Env)
+	if (OnBinaryBufferFromUnreal && SendBinaryBufferToFlutter(Env, Controller.Get(), OnBinaryBufferFromUnreal, Target, Method, Data, bIsCompressed, Checksum))
+	{
+		return;
+	}
+
+	if (!OnBinaryMessageFromUnreal)
 	{
-		UE_LOG(LogTemp, Error, TEXT("[FlutterBridge_Android] Failed to get JNI environment"));
 		return;
 	}
 
 	// Convert strings
-	jstring jTarget = FStringToJString(Env, Target);
-	jstring jMethod = FStringToJString(Env, Method);
+	const FScopedJavaString jTarget(Env, Target, true);
+	const FScopedJavaString jMethod(Env, Method, true);
 
 	// Create byte array
 	jbyteArray jData = Env->NewByteArray(Data.Num());
@@ -719,14 +1067,25 @@ void FlutterBridge_SendBinaryToFlutter_Android(const FString& Target, const FStr
 		Env->SetByteArrayRegion(jData, 0, Data.Num(), reinterpret_cast<const jbyte*>(Data.GetData()));
 	}
 
-	// TODO: Call Java method for binary data once implemented in UnrealEngineController
-	// For now, log the binary data info
-	UE_LOG(LogTemp, Log, TEXT("[FlutterBridge_Android] Binary data to Flutter: Target=%s, Method=%s, Size=%d, Checksum=%d"),
-		*Target, *Method, Data.Num(), Checksum);
+	// Call Java method
+	GJavaUpcallCount.fetch_add(1, std::memory_order_relaxed);
+	Env->CallVoidMethod(
+		Controller.Get(),
+		OnBinaryMessageFromUnreal,
+		jTarget.Get(),
+		jMethod.Get(),
+		jData,
+		(jboolean)bIsCompressed,
+		(jint)Checksum
+	);
+
+	if (!ClearJavaException(Env, TEXT("onBinaryMessageFromUnreal")))
+	{
+		UE_LOG(LogTemp, Log, TEXT("[FlutterBridge_Android] Binary data sent to Flutter: Target=%s, Method=%s, Size=%d, Compressed=%d, Checksum=%d"),
+			*Target, *Method, Data.Num(), bIsCompressed ? 1 : 0, Checksum);
+	}
 
 	// Clean up local references
-	Env->DeleteLocalRef(jTarget);
-	Env->DeleteLocalRef(jMethod);
 	if (jData)
 	{
 		Env->DeleteLocalRef(jData);
@@ -734,38 +1093,204 @@ void FlutterBridge_SendBinaryToFlutter_Android(const FString& Target, const FStr
 }
 
 /**
- * Notify Flutter that a level has been loaded
+ * Start a chunked binary transfer to Flutter
+ * Called from AFlutterBridge when an outgoing transfer starts sending.
+ * @return False if the controller cannot take chunks or the call failed; the transfer is dropped
  */
-void FlutterBridge_NotifyLevelLoaded_Android(const FString& LevelName, int32 BuildIndex)
+bool FlutterBridge_SendBinaryChunkHeader_Android(const FString& Target, const FString& Method, const FString& TransferId, int32 TotalSize, int32 TotalChunks, int32 Checksum)
 {
-	if (!GUnrealEngineControllerInstance || !GOnLevelLoadedMethodID)
+	JNIEnv* Env = FFlutterJNIThread::GetEnv();
+	if (!Env)
 	{
-		UE_LOG(LogTemp, Warning, TEXT("[FlutterBridge_Android] Cannot notify level loaded: Java instance not initialized"));
+		UE_LOG(LogTemp, Error, TEXT("[FlutterBridge_Android] Failed to get JNI environment"));
+		return false;
+	}
+
+	const FScopedJavaController Controller(Env);
+	const jmethodID OnBinaryChunkHeaderFromUnreal = FFlutterJNICache::Get().OnBinaryChunkHeaderFromUnreal;
+	if (!Controller.Get() || !OnBinaryChunkHeaderFromUnreal)
+	{
+		UE_LOG(LogTemp, Warning, TEXT("[FlutterBridge_Android] Cannot send chunked binary to Flutter: Java instance not initialized"));
+		return false;
+	}
+
+	const FScopedJavaString jTarget(Env, Target, true);
+	const FScopedJavaString jMethod(Env, Method, true);
+	const FScopedJavaString jTransferId(Env, TransferId);
+
+	GJavaUpcallCount.fetch_add(1, std::memory_order_relaxed);
+	Env->CallVoidMethod(
+		Controller.Get(),
+		OnBinaryChunkHeaderFromUnreal,
+		jTarget.Get(),
+		jMethod.Get(),
+		jTransferId.Get(),
+		(jint)TotalSize,
+		(jint)TotalChunks,
+		(jint)Checksum
+	);
+
+	return !ClearJavaException(Env, TEXT("onBinaryChunkHeaderFromUnreal"));
+}
+
+/**
+ * Send one chunk of a chunked binary transfer to Flutter
+ */
+void FlutterBridge_SendBinaryChunkData_Android(const FString& Target, const FString& Method, const FString& TransferId, int32 ChunkIndex, TConstArrayView<uint8> Data)
+{
+	JNIEnv* Env = FFlutterJNIThread::GetEnv();
+	if (!Env)
+	{
+		UE_LOG(LogTemp, Error, TEXT("[FlutterBridge_Android] Failed to get JNI environment"));
 		return;
 	}
 
-	JNIEnv* Env = FAndroidApplication::GetJavaEnv();
+	const FScopedJavaController Controller(Env);
+	const jmethodID OnBinaryChunkDataFromUnreal = FFlutterJNICache::Get().OnBinaryChunkDataFromUnreal;
+	if (!Controller.Get() || !OnBinaryChunkDataFromUnreal)
+	{
+		return;
+	}
+
+	const FScopedJavaString jTarget(Env, Target, true);
+	const FScopedJavaString jMethod(Env, Method, true);
+	const FScopedJavaString jTransferId(Env, TransferId);
+
+	jbyteArray jData = Env->NewByteArray(Data.Num());
+	if (jData && Data.Num() > 0)
+	{
+		Env->SetByteArrayRegion(jData, 0, Data.Num(), reinterpret_cast<const jbyte*>(Data.GetData()));
+	}
+
+	GJavaUpcallCount.fetch_add(1, std::memory_order_relaxed);
+	Env->CallVoidMethod(
+		Controller.Get(),
+		OnBinaryChunkDataFromUnreal,
+		jTarget.Get(),
+		jMethod.Get(),
+		jTransferId.Get(),
+		(jint)ChunkIndex,
+		jData
+	);
+
+	ClearJavaException(Env, TEXT("onBinaryChunkDataFromUnreal"));
+
+	if (jData)
+	{
+		Env->DeleteLocalRef(jData);
+	}
+}
+
+/**
+ * Finish a chunked binary transfer to Flutter
+ */
+void FlutterBridge_SendBinaryChunkFooter_Android(const FString& Target, const FString& Method, const FString& TransferId, int32 TotalChunks, int32 Checksum)
+{
+	JNIEnv* Env = FFlutterJNIThread::GetEnv();
+	if (!Env)
+	{
+		UE_LOG(LogTemp, Error, TEXT("[FlutterBridge_Android] Failed to get JNI environment"));
+		return;
+	}
+
+	const FScopedJavaController Controller(Env);
+	const jmethodID OnBinaryChunkFooterFromUnreal = FFlutterJNICache::Get().OnBinaryChunkFooterFromUnreal;
+	if (!Controller.Get() || !OnBinaryChunkFooterFromUnreal)
+	{
+		return;
+	}
+
+	const FScopedJavaString jTarget(Env, Target, true);
+	const FScopedJavaString jMethod(Env, Method, true);
+	const FScopedJavaString jTransferId(Env, TransferId);
+
+	GJavaUpcallCount.fetch_add(1, std::memory_order_relaxed);
+	Env->CallVoidMethod(
+		Controller.Get(),
+		OnBinaryChunkFooterFromUnreal,
+		jTarget.Get(),
+		jMethod.Get(),
+		jTransferId.Get(),
+		(jint)TotalChunks,
+		(jint)Checksum
+	);
+
+	if (!ClearJavaException(Env, TEXT("onBinaryChunkFooterFromUnreal")))
+	{
+		UE_LOG(LogTemp, Log, TEXT("[FlutterBridge_Android] Chunked binary sent to Flutter: TransferId=%s, Chunks=%d"), *TransferId, TotalChunks);
+	}
+}
+
+/**
+ * Report the progress of an outgoing chunked transfer to Flutter
+ */
+void FlutterBridge_SendBinaryProgress_Android(const FString& TransferId, int32 CurrentChunk, int32 TotalChunks, int64 BytesTransferred, int64 TotalBytes)
+{
+	JNIEnv* Env = FFlutterJNIThread::GetEnv();
+	if (!Env)
+	{
+		return;
+	}
+
+	const FScopedJavaController Controller(Env);
+	const jmethodID OnBinaryProgressFromUnreal = FFlutterJNICache::Get().OnBinaryProgressFromUnreal;
+	if (!Controller.Get() || !OnBinaryProgressFromUnreal)
+	{
+		return;
+	}
+
+	const FScopedJavaString jTransferId(Env, TransferId);
+
+	GJavaUpcallCount.fetch_add(1, std::memory_order_relaxed);
+	Env->CallVoidMethod(
+		Controller.Get(),
+		OnBinaryProgressFromUnreal,
+		jTransferId.Get(),
+		(jint)CurrentChunk,
+		(jint)TotalChunks,
+		(jlong)BytesTransferred,
+		(jlong)TotalBytes
+	);
+
+	ClearJavaException(Env, TEXT("onBinaryProgressFromUnreal"));
+}
+
+/**
+ * Notify Flutter that a level has been loaded
+ */
+void FlutterBridge_NotifyLevelLoaded_Android(const FString& LevelName, int32 BuildIndex)
+{
+	JNIEnv* Env = FFlutterJNIThread::GetEnv();
 	if (!Env)
 	{
 		UE_LOG(LogTemp, Error, TEXT("[FlutterBridge_Android] Failed to get JNI environment"));
 		return;
 	}
 
+	const FScopedJavaController Controller(Env);
+	const jmethodID OnLevelLoaded = FFlutterJNICache::Get().OnLevelLoaded;
+	if (!Controller.Get() || !OnLevelLoaded)
+	{
+		UE_LOG(LogTemp, Warning, TEXT("[FlutterBridge_Android] Cannot notify level loaded: Java instance not initialized"));
+		return;
+	}
+
 	// Convert level name
-	jstring jLevelName = FStringToJString(Env, LevelName);
+	const FScopedJavaString jLevelName(Env, LevelName);
 
 	// Call Java method
+	GJavaUpcallCount.fetch_add(1, std::memory_order_relaxed);
 	Env->CallVoidMethod(
-		GUnrealEngineControllerInstance,
-		GOnLevelLoadedMethodID,
-		jLevelName,
-		BuildIndex
+		Controller.Get(),
+		OnLevelLoaded,
+		jLevelName.Get(),
+		(jint)BuildIndex
 	);
 
-	// Clean up local reference
-	Env->DeleteLocalRef(jLevelName);
-
-	UE_LOG(LogTemp, Log, TEXT("[FlutterBridge_Android] Level loaded notification sent: %s"), *LevelName);
+	if (!ClearJavaException(Env, TEXT("onLevelLoaded")))
+	{
+		UE_LOG(LogTemp, Log, TEXT("[FlutterBridge_Android] Level loaded notification sent: %s"), *LevelName);
+	}
 }
 
 /**
@@ -775,7 +1300,31 @@ void FlutterBridge_NotifyLevelLoaded_Android(const FString& LevelName, int32 Bui
 void FlutterBridge_SetInstance_Android(AFlutterBridge* Instance)
 {
 	GFlutterBridgeInstance = Instance;
+
+	// Look up the Java classes now rather than on the first quality settings call
+	JNIEnv* Env = FAndroidApplication::GetJavaEnv();
+	FFlutterJNIThread::SetJavaVM(Env);
+	FFlutterJNICache::Get().Initialize(Env);
+
 	UE_LOG(LogTemp, Log, TEXT("[FlutterBridge_Android] FlutterBridge instance set"));
 }
 
+/**
+ * Clear the FlutterBridge instance
+ * Called from AFlutterBridge::EndPlay()
+ */
+void FlutterBridge_ClearInstance_Android(AFlutterBridge* Instance)
+{
+	if (GFlutterBridgeInstance != Instance)
+	{
+		return;
+	}
+
+	GFlutterBridgeInstance = nullptr;
+	FFlutterJNICache::Get().ReleaseClasses(FAndroidApplication::GetJavaEnv());
+	GDirectBufferPool.Trim();
+
+	UE_LOG(LogTemp, Log, TEXT("[FlutterBridge_Android] FlutterBridge instance cleared"));
+}
+
 #endif // PLATFORM_ANDROID
@@ -0,0 +1,262 @@
+// Copyright Epic Games, Inc. All Rights Reserved.
+
+#include "FlutterJNICache.h"
+#include "FlutterJNIStrings.h"
+
+#if PLATFORM_ANDROID
+
+#include "Misc/ScopeLock.h"
+
+namespace FlutterJNICache
+{
+	/** Global reference to a class, or null (with the exception cleared) if it cannot be found */
+	static jclass FindClassGlobal(JNIEnv* Env, const char* Name)
+	{
+		jclass LocalClass = Env->FindClass(Name);
+		if (Env->ExceptionCheck() || !LocalClass)
+		{
+			Env->ExceptionClear();
+			UE_LOG(LogTemp, Error, TEXT("[FlutterBridge_Android] Class %s not found"), UTF8_TO_TCHAR(Name));
+			return nullptr;
+		}
+
+		jclass GlobalClass = (jclass)Env->NewGlobalRef(LocalClass);
+		Env->DeleteLocalRef(LocalClass);
+		return GlobalClass;
+	}
+
+	static jmethodID GetMethod(JNIEnv* Env, jclass Class, const char* Name, const char* Signature, bool bStatic = false)
+	{
+		if (!Class)
+		{
+			return nullptr;
+		}
+
+		jmethodID MethodID = bStatic
+			? Env->GetStaticMethodID(Class, Name, Signature)
+			: Env->GetMethodID(Class, Name, Signature);
+		if (Env->ExceptionCheck())
+		{
+			Env->ExceptionClear();
+			UE_LOG(LogTemp, Warning, TEXT("[FlutterBridge_Android] Method %s%s not found"), UTF8_TO_TCHAR(Name), UTF8_TO_TCHAR(Signature));
+			return nullptr;
+		}
+		return MethodID;
+	}
+
+	static void DeleteGlobal(JNIEnv* Env, jclass& Class)
+	{
+		if (Class)
+		{
+			Env->DeleteGlobalRef(Class);
+			Class = nullptr;
+		}
+	}
+}
+
+FFlutterJNICache& FFlutterJNICache::Get()
+{
+	static FFlutterJNICache Cache;
+	return Cache;
+}
+
+bool FFlutterJNICache::Initialize(JNIEnv* Env)
+{
+	using namespace FlutterJNICache;
+
+	if (IsInitialized())
+	{
+		return true;
+	}
+
+	if (!Env)
+	{
+		return false;
+	}
+
+	FScopeLock Lock(&Mutex);
+	if (IsInitialized())
+	{
+		return true;
+	}
+
+	ObjectClass = FindClassGlobal(Env, "java/lang/Object");
+	ObjectToString = GetMethod(Env, ObjectClass, "toString", "()Ljava/lang/String;");
+
+	// valueOf() reuses boxed values for small integers instead of allocating each one
+	IntegerClass = FindClassGlobal(Env, "java/lang/Integer");
+	IntegerValueOf = GetMethod(Env, IntegerClass, "valueOf", "(I)Ljava/lang/Integer;", true);
+
+	MapClass = FindClassGlobal(Env, "java/util/Map");
+	MapEntrySet = GetMethod(Env, MapClass, "entrySet", "()Ljava/util/Set;");
+
+	SetClass = FindClassGlobal(Env, "java/util/Set");
+	SetIterator = GetMethod(Env, SetClass, "iterator", "()Ljava/util/Iterator;");
+
+	IteratorClass = FindClassGlobal(Env, "java/util/Iterator");
+	IteratorHasNext = GetMethod(Env, IteratorClass, "hasNext", "()Z");
+	IteratorNext = GetMethod(Env, IteratorClass, "next", "()Ljava/lang/Object;");
+
+	MapEntryClass = FindClassGlobal(Env, "java/util/Map$Entry");
+	MapEntryGetKey = GetMethod(Env, MapEntryClass, "getKey", "()Ljava/lang/Object;");
+	MapEntryGetValue = GetMethod(Env, MapEntryClass, "getValue", "()Ljava/lang/Object;");
+
+	HashMapClass = FindClassGlobal(Env, "java/util/HashMap");
+	HashMapInit = GetMethod(Env, HashMapClass, "<init>", "(I)V");
+	HashMapPut = GetMethod(Env, HashMapClass, "put", "(Ljava/lang/Object;Ljava/lang/Object;)Ljava/lang/Object;");
+
+	const bool bComplete = ObjectToString && IntegerValueOf && MapEntrySet && SetIterator
+		&& IteratorHasNext && IteratorNext && MapEntryGetKey && MapEntryGetValue
+		&& HashMapInit && HashMapPut;
+
+	if (!bComplete)
+	{
+		ReleaseClassesLocked(Env);
+		return false;
+	}
+
+	bInitialized.store(true, std::memory_order_release);
+	UE_LOG(LogTemp, Log, TEXT("[FlutterBridge_Android] JNI cache initialized"));
+	return true;
+}
+
+void FFlutterJNICache::SetController(JNIEnv* Env, jobject InController)
+{
+	using namespace FlutterJNICache;
+
+	FScopeLock Lock(&Mutex);
+
+	if (Controller)
+	{
+		Env->DeleteGlobalRef(Controller);
+		DeleteGlobal(Env, ControllerClass);
+	}
+
+	Controller = Env->NewGlobalRef(InController);
+	jclass LocalClass = Env->GetObjectClass(InController);
+	ControllerClass = (jclass)Env->NewGlobalRef(LocalClass);
+	Env->DeleteLocalRef(LocalClass);
+
+	OnMessageFromUnreal = GetMethod(Env, ControllerClass,
+		"onMessageFromUnreal",
+		"(Ljava/lang/String;Ljava/lang/String;Ljava/lang/String;)V");
+
+	OnLevelLoaded = GetMethod(Env, ControllerClass,
+		"onLevelLoaded",
+		"(Ljava/lang/String;I)V");
+
+	OnBinaryMessageFromUnreal = GetMethod(Env, ControllerClass,
+		"onBinaryMessageFromUnreal",
+		"(Ljava/lang/String;Ljava/lang/String;[BZI)V");
+
+	// Direct ByteBuffer path; without it binary messages fall back to byte[]
+	OnBinaryBufferFromUnreal = GetMethod(Env, ControllerClass,
+		"onBinaryBufferFromUnreal",
+		"(Ljava/lang/String;Ljava/lang/String;Ljava/nio/ByteBuffer;IZI)V");
+
+	// One call per frame for batched messages; without it batches go out as binary messages
+	OnMessageBatchFromUnreal = GetMethod(Env, ControllerClass,
+		"onMessageBatchFromUnreal",
+		"(Ljava/nio/ByteBuffer;II)V");
+
+	// Chunked sends need a controller that implements these; an older one just cannot receive them
+	OnBinaryChunkHeaderFromUnreal = GetMethod(Env, ControllerClass,
+		"onBinaryChunkHeaderFromUnreal",
+		"(Ljava/lang/String;Ljava/lang/String;Ljava/lang/String;III)V");
+
+	OnBinaryChunkDataFromUnreal = GetMethod(Env, ControllerClass,
+		"onBinaryChunkDataFromUnreal",
+		"(Ljava/lang/String;Ljava/lang/String;Ljava/lang/String;I[B)V");
+
+	OnBinaryChunkFooterFromUnreal = GetMethod(Env, ControllerClass,
+		"onBinaryChunkFooterFromUnreal",
+		"(Ljava/lang/String;Ljava/lang/String;Ljava/lang/String;II)V");
+
+	OnBinaryProgressFromUnreal = GetMethod(Env, ControllerClass,
+		"onBinaryProgressFromUnreal",
+		"(Ljava/lang/String;IIJJ)V");
+}
+
+void FFlutterJNICache::ClearController(JNIEnv* Env)
+{
+	using namespace FlutterJNICache;
+
+	FScopeLock Lock(&Mutex);
+
+	if (Controller)
+	{
+		Env->DeleteGlobalRef(Controller);
+		Controller = nullptr;
+	}
+	DeleteGlobal(Env, ControllerClass);
+
+	OnMessageFromUnreal = nullptr;
+	OnLevelLoaded = nullptr;
+	OnBinaryMessageFromUnreal = nullptr;
+	OnBinaryBufferFromUnreal = nullptr;
+	OnMessageBatchFromUnreal = nullptr;
+	OnBinaryChunkHeaderFromUnreal = nullptr;
+	OnBinaryChunkDataFromUnreal = nullptr;
+	OnBinaryChunkFooterFromUnreal = nullptr;
+	OnBinaryProgressFromUnreal = nullptr;
+}
+
+jobject FFlutterJNICache::NewControllerRef(JNIEnv* Env)
+{
+	FScopeLock Lock(&Mutex);
+	return Controller ? Env->NewLocalRef(Controller) : nullptr;
+}
+
+void FFlutterJNICache::Shutdown(JNIEnv* Env)
+{
+	if (!Env)
+	{
+		return;
+	}
+
+	ClearController(Env);
+	ReleaseClasses(Env);
+
+	UE_LOG(LogTemp, Log, TEXT("[FlutterBridge_Android] JNI cache released"));
+}
+
+void FFlutterJNICache::ReleaseClasses(JNIEnv* Env)
+{
+	if (!Env)
+	{
+		return;
+	}
+
+	FFlutterJStringCache::Get().Clear(Env);
+
+	FScopeLock Lock(&Mutex);
+	ReleaseClassesLocked(Env);
+}
+
+void FFlutterJNICache::ReleaseClassesLocked(JNIEnv* Env)
+{
+	using namespace FlutterJNICache;
+
+	bInitialized.store(false, std::memory_order_release);
+
+	DeleteGlobal(Env, ObjectClass);
+	DeleteGlobal(Env, IntegerClass);
+	DeleteGlobal(Env, MapClass);
+	DeleteGlobal(Env, SetClass);
+	DeleteGlobal(Env, IteratorClass);
+	DeleteGlobal(Env, MapEntryClass);
+	DeleteGlobal(Env, HashMapClass);
+
+	ObjectToString = nullptr;
+	IntegerValueOf = nullptr;
+	MapEntrySet = nullptr;
+	SetIterator = nullptr;
+	IteratorHasNext = nullptr;
+	IteratorNext = nullptr;
+	MapEntryGetKey = nullptr;
+	MapEntryGetValue = nullptr;
+	HashMapInit = nullptr;
+	HashMapPut = nullptr;
+}
+
+#endif // PLATFORM_ANDROID
@@ -0,0 +1,104 @@
+// Copyright Epic Games, Inc. All Rights Reserved.
+
+#pragma once
+
+#include "CoreMinimal.h"
+
+#if PLATFORM_ANDROID
+
+#include "HAL/CriticalSection.h"
+#include <jni.h>
+#include <atomic>
+
+/**
+ * Flutter JNI Cache
+ *
+ * Global class references and method IDs for everything the Android bridge calls into.
+ * FindClass and GetMethodID are among the slowest JNI calls, so they run once instead of
+ * on every conversion or callback.
+ *
+ * - The java.util / java.lang classes are looked up by Initialize(), either from
+ *   FlutterBridge_SetInstance_Android() or lazily by the first helper that needs them.
+ *   Unreal's launcher owns JNI_OnLoad, so the cache cannot hook it.
+ * - The UnrealEngineController instance and its callbacks are set by nativeCreate.
+ * - ReleaseClasses() drops the helper classes when the bridge actor ends play; the
+ *   controller stays, since it belongs to the Java side. Shutdown() from nativeQuit
+ *   releases everything.
+ *
+ * Method IDs stay valid as long as their class is loaded, which the global class
+ * references guarantee.
+ */
+struct FFlutterJNICache
+{
+	static FFlutterJNICache& Get();
+
+	/** Look up the Java classes used by the helpers; only the first successful call does any work */
+	bool Initialize(JNIEnv* Env);
+
+	/** Keep the controller and cache its callback IDs; replaces a previous controller */
+	void SetController(JNIEnv* Env, jobject InController);
+
+	/** Release the controller and its callback IDs */
+	void ClearController(JNIEnv* Env);
+
+	/**
+	 * Local reference to the controller, or null if there is none
+	 * Threads other than the game thread use this so nativeQuit cannot release the
+	 * controller while they call into it.
+	 */
+	jobject NewControllerRef(JNIEnv* Env);
+
+	/** Release the helper classes and cached strings; the next Initialize() looks them up again */
+	void ReleaseClasses(JNIEnv* Env);
+
+	/** Release every global reference, including the controller */
+	void Shutdown(JNIEnv* Env);
+
+	bool IsInitialized() const { return bInitialized.load(std::memory_order_acquire); }
+
+	// java.lang.Object
+	jclass ObjectClass = nullptr;
+	jmethodID ObjectToString = nullptr;
+
+	// java.lang.Integer
+	jclass IntegerClass = nullptr;
+	jmethodID IntegerValueOf = nullptr;
+
+	// java.util.Map, Set, Iterator, Map.Entry
+	jclass MapClass = nullptr;
+	jmethodID MapEntrySet = nullptr;
+	jclass SetClass = nullptr;
+	jmethodID SetIterator = nullptr;
+	jclass IteratorClass = nullptr;
+	jmethodID IteratorHasNext = nullptr;
+	jmethodID IteratorNext = nullptr;
+	jclass MapEntryClass = nullptr;
+	jmethodID MapEntryGetKey = nullptr;
+	jmethodID MapEntryGetValue = nullptr;
+
+	// java.util.HashMap
+	jclass HashMapClass = nullptr;
+	jmethodID HashMapInit = nullptr;
+	jmethodID HashMapPut = nullptr;
+
+	// UnrealEngineController
+	jobject Controller = nullptr;
+	jclass ControllerClass = nullptr;
+	jmethodID OnMessageFromUnreal = nullptr;
+	jmethodID OnLevelLoaded = nullptr;
+	jmethodID OnBinaryMessageFromUnreal = nullptr;
+	jmethodID OnBinaryBufferFromUnreal = nullptr;
+	jmethodID OnMessageBatchFromUnreal = nullptr;
+	jmethodID OnBinaryChunkHeaderFromUnreal = nullptr;
+	jmethodID OnBinaryChunkDataFromUnreal = nullptr;
+	jmethodID OnBinaryChunkFooterFromUnreal = nullptr;
+	jmethodID OnBinaryProgressFromUnreal = nullptr;
+
+private:
+	void ReleaseClassesLocked(JNIEnv* Env);
+
+	FCriticalSection Mutex;
+	std::atomic<bool> bInitialized{ false };
+};
+
+#endif // PLATFORM_ANDROID
@@ -0,0 +1,157 @@
+// Copyright Epic Games, Inc. All Rights Reserved.
+
+#include "FlutterJNIStrings.h"
+
+#if PLATFORM_ANDROID
+
+#include "Misc/ScopeLock.h"
+
+static_assert(sizeof(jchar) == sizeof(UTF16CHAR), "jchar is a UTF-16 code unit");
+
+// ============================================================
+// MARK: - Conversion
+// ============================================================
+
+jstring FStringToJString(JNIEnv* Env, const FString& String)
+{
+	if (!Env)
+	{
+		return nullptr;
+	}
+
+	if constexpr (sizeof(TCHAR) == sizeof(jchar))
+	{
+		return Env->NewString(reinterpret_cast<const jchar*>(*String), String.Len());
+	}
+	else
+	{
+		const auto Converter = StringCast<UTF16CHAR>(*String, String.Len());
+		return Env->NewString(reinterpret_cast<const jchar*>(Converter.Get()), Converter.Length());
+	}
+}
+
+FString JStringToFString(JNIEnv* Env, jstring JavaString)
+{
+	if (!Env || !JavaString)
+	{
+		return FString();
+	}
+
+	const jsize Length = Env->GetStringLength(JavaString);
+	if (Length <= 0)
+	{
+		return FString();
+	}
+
+	if constexpr (sizeof(TCHAR) == sizeof(jchar))
+	{
+		// Copy straight into the FString's storage, terminator included
+		FString Result;
+		TArray<TCHAR>& Chars = Result.GetCharArray();
+		Chars.SetNumUninitialized(Length + 1);
+		Env->GetStringRegion(JavaString, 0, Length, reinterpret_cast<jchar*>(Chars.GetData()));
+		Chars[Length] = TEXT('\0');
+		return Result;
+	}
+	else
+	{
+		TArray<UTF16CHAR> Units;
+		Units.SetNumUninitialized(Length);
+		Env->GetStringRegion(JavaString, 0, Length, reinterpret_cast<jchar*>(Units.GetData()));
+		const auto Converter = StringCast<TCHAR>(Units.GetData(), Length);
+		return FString(Converter.Length(), Converter.Get());
+	}
+}
+
+// ============================================================
+// MARK: - FFlutterJStringCache
+// ============================================================
+
+FFlutterJStringCache& FFlutterJStringCache::Get()
+{
+	static FFlutterJStringCache Cache;
+	return Cache;
+}
+
+jstring FFlutterJStringCache::Find(JNIEnv* Env, const FString& String)
+{
+	if (!Env || String.Len() > MaxLength)
+	{
+		return nullptr;
+	}
+
+	FScopeLock Lock(&Mutex);
+
+	// The global reference may be deleted by Clear() as soon as the lock is released
+	if (const jstring* Existing = Strings.Find(String))
+	{
+		return (jstring)Env->NewLocalRef(*Existing);
+	}
+
+	if (Strings.Num() >= MaxEntries)
+	{
+		return nullptr;
+	}
+
+	jstring Local = FStringToJString(Env, String);
+	if (!Local)
+	{
+		return nullptr;
+	}
+
+	jstring Global = (jstring)Env->NewGlobalRef(Local);
+	if (Global)
+	{
+		Strings.Add(String, Global);
+	}
+	return Local;
+}
+
+void FFlutterJStringCache::Clear(JNIEnv* Env)
+{
+	FScopeLock Lock(&Mutex);
+
+	if (Env)
+	{
+		for (const TPair<FString, jstring>& Entry : Strings)
+		{
+			Env->DeleteGlobalRef(Entry.Value);
+		}
+	}
+	Strings.Empty();
+}
+
+int32 FFlutterJStringCache::Num() const
+{
+	FScopeLock Lock(&Mutex);
+	return Strings.Num();
+}
+
+// ============================================================
+// MARK: - FScopedJavaString
+// ============================================================
+
+FScopedJavaString::FScopedJavaString(JNIEnv* InEnv, const FString& String, bool bCacheable)
+	: Env(InEnv)
+	, Handle(nullptr)
+{
+	if (bCacheable)
+	{
+		Handle = FFlutterJStringCache::Get().Find(Env, String);
+	}
+
+	if (!Handle)
+	{
+		Handle = FStringToJString(Env, String);
+	}
+}
+
+FScopedJavaString::~FScopedJavaString()
+{
+	if (Handle)
+	{
+		Env->DeleteLocalRef(Handle);
+	}
+}
+
+#endif // PLATFORM_ANDROID
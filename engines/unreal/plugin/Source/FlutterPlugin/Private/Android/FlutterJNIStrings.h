@@ -0,0 +1,81 @@
+// Copyright Epic Games, Inc. All Rights Reserved.
+
+#pragma once
+
+#include "CoreMinimal.h"
+
+#if PLATFORM_ANDROID
+
+#include "HAL/CriticalSection.h"
+#include <jni.h>
+
+/**
+ * Flutter JNI Strings
+ *
+ * TCHAR on Android and Java strings are both UTF-16, so strings cross JNI as UTF-16 code
+ * units with NewString / GetStringRegion. Going through UTF-8 would transcode twice per
+ * string (and Java's modified UTF-8 mangles characters outside the BMP).
+ */
+
+/** Create a local jstring from an FString */
+jstring FStringToJString(JNIEnv* Env, const FString& String);
+
+/** Copy a jstring into an FString */
+FString JStringToFString(JNIEnv* Env, jstring JavaString);
+
+/**
+ * Global jstrings for target and method names
+ *
+ * Messages to Flutter repeat a handful of names, so each is created once and reused; the
+ * Java side also receives the same String instance every time. Long strings and names
+ * beyond MaxEntries are not cached.
+ *
+ * Clear() deletes the global references while other threads may still be sending, so
+ * callers only ever get a local reference taken under the lock.
+ */
+class FFlutterJStringCache
+{
+public:
+	static constexpr int32 MaxEntries = 128;
+	static constexpr int32 MaxLength = 64;
+
+	static FFlutterJStringCache& Get();
+
+	/**
+	 * New local reference to the cached jstring, or null if the string is not cacheable or
+	 * the cache is full; the caller deletes it
+	 */
+	jstring Find(JNIEnv* Env, const FString& String);
+
+	/** Release every cached string */
+	void Clear(JNIEnv* Env);
+
+	int32 Num() const;
+
+private:
+	mutable FCriticalSection Mutex;
+	TMap<FString, jstring> Strings;
+};
+
+/**
+ * jstring for the duration of a call
+ * Uses the cache when asked to and falls back to a new string; either way it holds a
+ * local reference, which is deleted on destruction. Pass Get() to variadic JNI calls.
+ */
+class FScopedJavaString
+{
+public:
+	FScopedJavaString(JNIEnv* InEnv, const FString& String, bool bCacheable = false);
+	~FScopedJavaString();
+
+	FScopedJavaString(const FScopedJavaString&) = delete;
+	FScopedJavaString& operator=(const FScopedJavaString&) = delete;
+
+	jstring Get() const { return Handle; }
+
+private:
+	JNIEnv* Env;
+	jstring Handle;
+};
+
+#endif // PLATFORM_ANDROID
@@ -0,0 +1,115 @@
+// Copyright Epic Games, Inc. All Rights Reserved.
+
+#include "FlutterJNIThread.h"
+
+#if PLATFORM_ANDROID
+
+#include "Android/AndroidApplication.h"
+#include "HAL/ThreadManager.h"
+#include <pthread.h>
+#include <atomic>
+
+namespace FlutterJNIThread
+{
+	static std::atomic<JavaVM*> JavaVMInstance(nullptr);
+	static std::atomic<int32> NumAttached(0);
+
+	// Holds the JNIEnv of threads attached here; its destructor detaches them on exit
+	static pthread_key_t DetachKey;
+	static pthread_once_t DetachKeyOnce = PTHREAD_ONCE_INIT;
+
+	// Fast path for every later call on the same thread
+	static thread_local JNIEnv* ThreadEnv = nullptr;
+
+	static void DetachThread(void* Value)
+	{
+		if (JavaVM* VM = JavaVMInstance.load(std::memory_order_acquire))
+		{
+			VM->DetachCurrentThread();
+		}
+		ThreadEnv = nullptr;
+		NumAttached.fetch_sub(1, std::memory_order_relaxed);
+	}
+
+	static void CreateDetachKey()
+	{
+		pthread_key_create(&DetachKey, &DetachThread);
+	}
+}
+
+void FFlutterJNIThread::SetJavaVM(JNIEnv* Env)
+{
+	using namespace FlutterJNIThread;
+
+	JavaVM* VM = nullptr;
+	if (Env && Env->GetJavaVM(&VM) == JNI_OK && VM)
+	{
+		JavaVMInstance.store(VM, std::memory_order_release);
+	}
+}
+
+JNIEnv* FFlutterJNIThread::GetEnv()
+{
+	using namespace FlutterJNIThread;
+
+	if (ThreadEnv)
+	{
+		return ThreadEnv;
+	}
+
+	JavaVM* VM = JavaVMInstance.load(std::memory_order_acquire);
+	if (!VM && IsInGameThread())
+	{
+		// Before nativeCreate the engine's own environment tells us the VM
+		SetJavaVM(FAndroidApplication::GetJavaEnv());
+		VM = JavaVMInstance.load(std::memory_order_acquire);
+	}
+	if (!VM)
+	{
+		return nullptr;
+	}
+
+	JNIEnv* Env = nullptr;
+	const jint Result = VM->GetEnv(reinterpret_cast<void**>(&Env), JNI_VERSION_1_6);
+	if (Result == JNI_OK)
+	{
+		// Attached by Java or the engine, which also own detaching it
+		ThreadEnv = Env;
+		return Env;
+	}
+
+	if (Result != JNI_EDETACHED)
+	{
+		UE_LOG(LogTemp, Error, TEXT("[FlutterBridge_Android] JNI version not supported on this thread (%d)"), Result);
+		return nullptr;
+	}
+
+	pthread_once(&DetachKeyOnce, &CreateDetachKey);
+
+	// Name the Java thread after the engine thread so it is recognisable in traces
+	const FTCHARToUTF8 ThreadName(*FThreadManager::GetThreadName(FPlatformTLS::GetCurrentThreadId()));
+	JavaVMAttachArgs Args;
+	Args.version = JNI_VERSION_1_6;
+	Args.name = ThreadName.Length() > 0 ? ThreadName.Get() : nullptr;
+	Args.group = nullptr;
+
+	if (VM->AttachCurrentThread(&Env, &Args) != JNI_OK || !Env)
+	{
+		UE_LOG(LogTemp, Error, TEXT("[FlutterBridge_Android] Failed to attach thread %u to the Java VM"), FPlatformTLS::GetCurrentThreadId());
+		return nullptr;
+	}
+
+	pthread_setspecific(DetachKey, Env);
+	ThreadEnv = Env;
+	NumAttached.fetch_add(1, std::memory_order_relaxed);
+
+	UE_LOG(LogTemp, Verbose, TEXT("[FlutterBridge_Android] Attached thread %u to the Java VM"), FPlatformTLS::GetCurrentThreadId());
+	return Env;
+}
+
+int32 FFlutterJNIThread::GetNumAttachedThreads()
+{
+	return FlutterJNIThread::NumAttached.load(std::memory_order_relaxed);
+}
+
+#endif // PLATFORM_ANDROID
@@ -0,0 +1,38 @@
+// Copyright Epic Games, Inc. All Rights Reserved.
+
+#pragma once
+
+#include "CoreMinimal.h"
+
+#if PLATFORM_ANDROID
+
+#include <jni.h>
+
+/**
+ * Flutter JNI Thread
+ *
+ * JNIEnv for whichever thread calls into Java. Threads that are not yet attached to the
+ * VM (task graph workers, thread pool threads) are attached on first use and detached
+ * again when the thread exits. The JNIEnv is kept in thread-local storage, so only the
+ * first call on each thread reaches the VM.
+ *
+ * Threads attached by Java or by the engine keep their attachment; only threads attached
+ * here are detached here.
+ *
+ * Natively attached threads have no Java frame, so local references live until the
+ * thread detaches. Callers on worker threads must delete every local reference they
+ * create.
+ */
+struct FFlutterJNIThread
+{
+	/** Remember the VM behind Env; called from nativeCreate and when the bridge starts */
+	static void SetJavaVM(JNIEnv* Env);
+
+	/** JNIEnv for the calling thread, attaching it if needed; null if the VM is not known yet */
+	static JNIEnv* GetEnv();
+
+	/** Number of threads currently attached by GetEnv() */
+	static int32 GetNumAttachedThreads();
+};
+
+#endif // PLATFORM_ANDROID
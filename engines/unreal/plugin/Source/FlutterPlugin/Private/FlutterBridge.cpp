@@ -7,65 +7,57 @@
 #include "Kismet/GameplayStatics.h"
 #include "Scalability.h"
 #include "GameFramework/GameUserSettings.h"
+#include "Containers/Queue.h"
+#include "HAL/PlatformTime.h"
+#include "HAL/IConsoleManager.h"
+#include "Misc/App.h"
+#include "Async/Async.h"
+#include "Misc/CoreDelegates.h"
+#include "Dom/JsonObject.h"
+#include "Serialization/JsonReader.h"
+#include "Serialization/JsonSerializer.h"
+#include <atomic>
 
 // Initialize static instance
 AFlutterBridge* AFlutterBridge::Instance = nullptr;
 
-// CRC32 lookup table
-static const uint32 CRC32Table[256] = {
-	0x00000000, 0x77073096, 0xEE0E612C, 0x990951BA, 0x076DC419, 0x706AF48F,
-	0xE963A535, 0x9E6495A3, 0x0EDB8832, 0x79DCB8A4, 0xE0D5E91E, 0x97D2D988,
-	0x09B64C2B, 0x7EB17CBD, 0xE7B82D07, 0x90BF1D91, 0x1DB71064, 0x6AB020F2,
-	0xF3B97148, 0x84BE41DE, 0x1ADAD47D, 0x6DDDE4EB, 0xF4D4B551, 0x83D385C7,
-	0x136C9856, 0x646BA8C0, 0xFD62F97A, 0x8A65C9EC, 0x14015C4F, 0x63066CD9,
-	0xFA0F3D63, 0x8D080DF5, 0x3B6E20C8, 0x4C69105E, 0xD56041E4, 0xA2677172,
-	0x3C03E4D1, 0x4B04D447, 0xD20D85FD, 0xA50AB56B, 0x35B5A8FA, 0x42B2986C,
-	0xDBBBC9D6, 0xACBCF940, 0x32D86CE3, 0x45DF5C75, 0xDCD60DCF, 0xABD13D59,
-	0x26D930AC, 0x51DE003A, 0xC8D75180, 0xBFD06116, 0x21B4F4B5, 0x56B3C423,
-	0xCFBA9599, 0xB8BDA50F, 0x2802B89E, 0x5F058808, 0xC60CD9B2, 0xB10BE924,
-	0x2F6F7C87, 0x58684C11, 0xC1611DAB, 0xB6662D3D, 0x76DC4190, 0x01DB7106,
-	0x98D220BC, 0xEFD5102A, 0x71B18589, 0x06B6B51F, 0x9FBFE4A5, 0xE8B8D433,
-	0x7807C9A2, 0x0F00F934, 0x9609A88E, 0xE10E9818, 0x7F6A0DBB, 0x086D3D2D,
-	0x91646C97, 0xE6635C01, 0x6B6B51F4, 0x1C6C6162, 0x856530D8, 0xF262004E,
-	0x6C0695ED, 0x1B01A57B, 0x8208F4C1, 0xF50FC457, 0x65B0D9C6, 0x12B7E950,
-	0x8BBEB8EA, 0xFCB9887C, 0x62DD1DDF, 0x15DA2D49, 0x8CD37CF3, 0xFBD44C65,
-	0x4DB26158, 0x3AB551CE, 0xA3BC0074, 0xD4BB30E2, 0x4ADFA541, 0x3DD895D7,
-	0xA4D1C46D, 0xD3D6F4FB, 0x4369E96A, 0x346ED9FC, 0xAD678846, 0xDA60B8D0,
-	0x44042D73, 0x33031DE5, 0xAA0A4C5F, 0xDD0D7CC9, 0x5005713C, 0x270241AA,
-	0xBE0B1010, 0xC90C2086, 0x5768B525, 0x206F85B3, 0xB966D409, 0xCE61E49F,
-	0x5EDEF90E, 0x29D9C998, 0xB0D09822, 0xC7D7A8B4, 0x59B33D17, 0x2EB40D81,
-	0xB7BD5C3B, 0xC0BA6CAD, 0xEDB88320, 0x9ABFB3B6, 0x03B6E20C, 0x74B1D29A,
-	0xEAD54739, 0x9DD277AF, 0x04DB2615, 0x73DC1683, 0xE3630B12, 0x94643B84,
-	0x0D6D6A3E, 0x7A6A5AA8, 0xE40ECF0B, 0x9309FF9D, 0x0A00AE27, 0x7D079EB1,
-	0xF00F9344, 0x8708A3D2, 0x1E01F268, 0x6906C2FE, 0xF762575D, 0x806567CB,
-	0x196C3671, 0x6E6B06E7, 0xFED41B76, 0x89D32BE0, 0x10DA7A5A, 0x67DD4ACC,
-	0xF9B9DF6F, 0x8EBEEFF9, 0x17B7BE43, 0x60B08ED5, 0xD6D6A3E8, 0xA1D1937E,
-	0x38D8C2C4, 0x4FDFF252, 0xD1BB67F1, 0xA6BC5767, 0x3FB506DD, 0x48B2364B,
-	0xD80D2BDA, 0xAF0A1B4C, 0x36034AF6, 0x41047A60, 0xDF60EFC3, 0xA867DF55,
-	0x316E8EEF, 0x4669BE79, 0xCB61B38C, 0xBC66831A, 0x256FD2A0, 0x5268E236,
-	0xCC0C7795, 0xBB0B4703, 0x220216B9, 0x5505262F, 0xC5BA3BBE, 0xB2BD0B28,
-	0x2BB45A92, 0x5CB36A04, 0xC2D7FFA7, 0xB5D0CF31, 0x2CD99E8B, 0x5BDEAE1D,
-	0x9B64C2B0, 0xEC63F226, 0x756AA39C, 0x026D930A, 0x9C0906A9, 0xEB0E363F,
-	0x72076785, 0x05005713, 0x95BF4A82, 0xE2B87A14, 0x7BB12BAE, 0x0CB61B38,
-	0x92D28E9B, 0xE5D5BE0D, 0x7CDCEFB7, 0x0BDBDF21, 0x86D3D2D4, 0xF1D4E242,
-	0x68DDB3F8, 0x1FDA836E, 0x81BE16CD, 0xF6B9265B, 0x6FB077E1, 0x18B74777,
-	0x88085AE6, 0xFF0F6A70, 0x66063BCA, 0x11010B5C, 0x8F659EFF, 0xF862AE69,
-	0x616BFFD3, 0x166CCF45, 0xA00AE278, 0xD70DD2EE, 0x4E048354, 0x3903B3C2,
-	0xA7672661, 0xD06016F7, 0x4969474D, 0x3E6E77DB, 0xAED16A4A, 0xD9D65ADC,
-	0x40DF0B66, 0x37D83BF0, 0xA9BCAE53, 0xDEBB9EC5, 0x47B2CF7F, 0x30B5FFE9,
-	0xBDBDF21C, 0xCABAC28A, 0x53B39330, 0x24B4A3A6, 0xBAD03605, 0xCDD70693,
-	0x54DE5729, 0x23D967BF, 0xB3667A2E, 0xC4614AB8, 0x5D681B02, 0x2A6F2B94,
-	0xB40BBE37, 0xC30C8EA1, 0x5A05DF1B, 0x2D02EF8D
-};
+// Messages from native bridge threads, drained on the game thread.
+// Not owned by the actor so producers never race with its lifetime.
+namespace FlutterIngress
+{
+	static TQueue<FFlutterIngressMessage, EQueueMode::Mpsc> Queue;
+
+	static std::atomic<int32> Depth(0);
+	static std::atomic<int32> PeakDepth(0);
+	static std::atomic<int32> MaxDepth(4096);
+
+	static std::atomic<int64> Enqueued(0);
+	static std::atomic<int64> Delivered(0);
+	static std::atomic<int64> Rejected(0);
+	static std::atomic<int64> DeferredTicks(0);
+}
 
 AFlutterBridge::AFlutterBridge()
 {
 	PrimaryActorTick.bCanEverTick = true;
+	// Keep delivering Flutter messages while the game is paused
+	PrimaryActorTick.bTickEvenWhenPaused = true;
+	IngressTimeBudgetMs = 2.0f;
+	bBatchOutgoingMessages = false;
+	MaxBatchLatencyMs = 0.0f;
+	MaxBatchBytes = 64 * 1024;
+	OutgoingBatchStartTime = 0.0;
 	bIsPaused = false;
 	BinaryChunkSize = 65536; // 64KB default
+	BinaryCompressionCodec = EFlutterCompressionCodec::Gzip;
+	CompressionThreshold = FFlutterCompression::DefaultThreshold;
+	MaxSingleBinaryMessageSize = 256 * 1024; // Matches the Dart chunking threshold
+	MaxDecompressedBinarySize = FFlutterCompression::DefaultMaxDecompressedSize;
+	OutgoingChunkBytesPerFrame = 512 * 1024;
 	bSurfaceReady = false;
 	SurfaceWidth = 0;
 	SurfaceHeight = 0;
+	bRenderScaleApplied = false;
 }
 
 void AFlutterBridge::BeginPlay()
@@ -78,23 +70,62 @@ void AFlutterBridge::BeginPlay()
 	// Initialize platform-specific bridge
 	InitializePlatformBridge();
 
+	// Batched messages go out once all gameplay for the frame has run
+	EndFrameHandle = FCoreDelegates::OnEndFrame.AddUObject(this, &AFlutterBridge::HandleEndFrame);
+
 	UE_LOG(LogTemp, Log, TEXT("[FlutterBridge] Initialized"));
 }
 
 void AFlutterBridge::EndPlay(const EEndPlayReason::Type EndPlayReason)
 {
+	FCoreDelegates::OnEndFrame.Remove(EndFrameHandle);
+
+	// Hand the next level or bridge a full-resolution view
+	if (bRenderScaleApplied)
+	{
+		RenderScale.Configure(FFlutterRenderScaleSettings());
+		ApplyRenderScale();
+	}
+
+	FlushOutgoingBatch();
+
+	if (OutgoingTransfers.Num() > 0)
+	{
+		UE_LOG(LogTemp, Warning, TEXT("[FlutterBridge] Dropping %d unsent chunked transfers"), OutgoingTransfers.Num());
+		OutgoingTransfers.Empty();
+	}
+
 	// Clear singleton
 	if (Instance == this)
 	{
 		Instance = nullptr;
 	}
 
+#if PLATFORM_ANDROID
+	// Release the cached JNI classes; native callbacks stop reaching this actor
+	extern void FlutterBridge_ClearInstance_Android(AFlutterBridge* Instance);
+	FlutterBridge_ClearInstance_Android(this);
+#elif PLATFORM_LINUX
+	// Stop exporting frames before the frame buffer goes away
+	extern void FlutterBridge_ClearInstance_Linux(AFlutterBridge* Instance);
+	FlutterBridge_ClearInstance_Linux(this);
+#endif
+
 	Super::EndPlay(EndPlayReason);
 }
 
 void AFlutterBridge::Tick(float DeltaTime)
 {
 	Super::Tick(DeltaTime);
+
+	DrainIngressQueue();
+	PumpOutgoingTransfers();
+
+	// Undilated frame time, so slow motion does not read as a slow GPU
+	if (RenderScale.Update(FApp::GetDeltaTime()))
+	{
+		ApplyRenderScale();
+	}
 }
 
 // ============================================================
@@ -133,6 +164,30 @@ AFlutterBridge* AFlutterBridge::GetInstance(const UObject* WorldContextObject)
 // ============================================================
 
 void AFlutterBridge::SendToFlutter(const FString& Target, const FString& Method, const FString& Data)
+{
+	if (bBatchOutgoingMessages)
+	{
+		if (OutgoingBatch.IsEmpty())
+		{
+			OutgoingBatchStartTime = FPlatformTime::Seconds();
+		}
+
+		OutgoingBatch.Add(Target, Method, Data);
+		UE_LOG(LogTemp, Verbose, TEXT("[FlutterBridge] Batched message to Flutter: Target=%s, Method=%s"), *Target, *Method);
+
+		if (OutgoingBatch.NumBytes() >= MaxBatchBytes)
+		{
+			FlushOutgoingBatch();
+		}
+		return;
+	}
+
+	// Batching may have just been turned off with messages still held
+	FlushOutgoingBatch();
+	SendToFlutterImmediate(Target, Method, Data);
+}
+
+void AFlutterBridge::SendToFlutterImmediate(const FString& Target, const FString& Method, const FString& Data)
 {
 	UE_LOG(LogTemp, Log, TEXT("[FlutterBridge] Sending to Flutter: Target=%s, Method=%s"), *Target, *Method);
 
@@ -150,57 +205,451 @@ void AFlutterBridge::SendToFlutter(const FString& Target, const FString& Method,
 	// Objective-C++ call to Swift: UnrealBridge.notifyMessage()
 	extern void FlutterBridge_SendToFlutter_Mac(const FString& Target, const FString& Method, const FString& Data);
 	FlutterBridge_SendToFlutter_Mac(Target, Method, Data);
+#elif PLATFORM_LINUX
+	// Unix domain socket to the Flutter Linux plugin
+	extern void FlutterBridge_SendToFlutter_Linux(const FString& Target, const FString& Method, const FString& Data);
+	FlutterBridge_SendToFlutter_Linux(Target, Method, Data);
 #else
 	UE_LOG(LogTemp, Warning, TEXT("[FlutterBridge] SendToFlutter not implemented for this platform"));
 #endif
 }
 
+void AFlutterBridge::SendToFlutterFromAnyThread(const FString& Target, const FString& Method, const FString& Data)
+{
+#if PLATFORM_ANDROID
+	// The Android bridge attaches the calling thread itself
+	SendToFlutterImmediate(Target, Method, Data);
+#else
+	if (IsInGameThread())
+	{
+		SendToFlutterImmediate(Target, Method, Data);
+		return;
+	}
+
+	AsyncTask(ENamedThreads::GameThread, [Target, Method, Data]()
+	{
+		SendToFlutterImmediate(Target, Method, Data);
+	});
+#endif
+}
+
 void AFlutterBridge::ReceiveFromFlutter(const FString& Target, const FString& Method, const FString& Data)
 {
+	if (Target == FFlutterMessageBatch::Target && Method == FFlutterMessageBatch::Method)
+	{
+		ReceiveBatchFromFlutter(Data);
+		return;
+	}
+
 	UE_LOG(LogTemp, Log, TEXT("[FlutterBridge] Received from Flutter: Target=%s, Method=%s"), *Target, *Method);
 
 	// Fire Blueprint event
 	OnMessageFromFlutter(Target, Method, Data);
 }
 
+// ============================================================
+// MARK: - Message Batching
+// ============================================================
+
+void AFlutterBridge::FlushOutgoingBatch()
+{
+	if (OutgoingBatch.IsEmpty())
+	{
+		return;
+	}
+
+	UE_LOG(LogTemp, Verbose, TEXT("[FlutterBridge] Flushing batch: %d messages, %d bytes"), OutgoingBatch.Num(), OutgoingBatch.NumBytes());
+
+#if PLATFORM_ANDROID
+	// A single JNI call with the raw frame; controllers without the batch callback get a binary message
+	extern bool FlutterBridge_SendMessageBatch_Android(const TArray<uint8>& Frame, int32 NumMessages);
+	if (FlutterBridge_SendMessageBatch_Android(OutgoingBatch.GetFrame(), OutgoingBatch.Num()))
+	{
+		OutgoingBatch.Reset();
+		return;
+	}
+#elif PLATFORM_LINUX
+	// The Linux socket carries no binary messages; the batch is unpacked into socket messages
+	extern void FlutterBridge_SendMessageBatch_Linux(const TArray<uint8>& Frame, int32 NumMessages);
+	FlutterBridge_SendMessageBatch_Linux(OutgoingBatch.GetFrame(), OutgoingBatch.Num());
+	OutgoingBatch.Reset();
+	return;
+#endif
+
+	SendBinaryToFlutterImmediate(FFlutterMessageBatch::Target, FFlutterMessageBatch::Method, OutgoingBatch.GetFrame());
+	OutgoingBatch.Reset();
+}
+
+int32 AFlutterBridge::GetPendingBatchedMessages() const
+{
+	return OutgoingBatch.Num();
+}
+
+void AFlutterBridge::HandleEndFrame()
+{
+	FFlutterSurfaceStats::Get().OnFrame(FPlatformTime::Seconds());
+
+	if (OutgoingBatch.IsEmpty())
+	{
+		return;
+	}
+
+	const double HeldMs = (FPlatformTime::Seconds() - OutgoingBatchStartTime) * 1000.0;
+	if (HeldMs >= MaxBatchLatencyMs)
+	{
+		FlushOutgoingBatch();
+	}
+}
+
+void AFlutterBridge::ReceiveBatchFromFlutter(const FString& Data)
+{
+	// JSON batch from the Dart UnrealMessageBatcher: {"count": N, "messages": [{"t", "m", "d"}, ...]}
+	TSharedPtr<FJsonObject> BatchObject;
+	const TSharedRef<TJsonReader<>> Reader = TJsonReaderFactory<>::Create(Data);
+	if (!FJsonSerializer::Deserialize(Reader, BatchObject) || !BatchObject.IsValid())
+	{
+		UE_LOG(LogTemp, Warning, TEXT("[FlutterBridge] Malformed message batch from Flutter"));
+		return;
+	}
+
+	const TArray<TSharedPtr<FJsonValue>>* Messages = nullptr;
+	if (!BatchObject->TryGetArrayField(TEXT("messages"), Messages))
+	{
+		UE_LOG(LogTemp, Warning, TEXT("[FlutterBridge] Message batch from Flutter has no messages"));
+		return;
+	}
+
+	for (const TSharedPtr<FJsonValue>& Value : *Messages)
+	{
+		const TSharedPtr<FJsonObject>* Message = nullptr;
+		if (Value.IsValid() && Value->TryGetObject(Message))
+		{
+			ReceiveFromFlutter(
+				(*Message)->GetStringField(TEXT("t")),
+				(*Message)->GetStringField(TEXT("m")),
+				(*Message)->GetStringField(TEXT("d")));
+		}
+	}
+}
+
+// ============================================================
+// MARK: - Ingress Queue
+// ============================================================
+
+bool AFlutterBridge::EnqueueFromFlutter(FFlutterIngressMessage&& Message)
+{
+	using namespace FlutterIngress;
+
+	// Chunks after the header belong to a transfer that was already admitted;
+	// dropping one would only corrupt it, so the limit applies to new work only
+	const bool bContinuation = Message.Kind == FFlutterIngressMessage::EKind::ChunkData
+		|| Message.Kind == FFlutterIngressMessage::EKind::ChunkFooter;
+
+	// Reserve a slot first so concurrent producers cannot overshoot the limit
+	const int32 Limit = MaxDepth.load(std::memory_order_relaxed);
+	const int32 NewDepth = Depth.fetch_add(1, std::memory_order_relaxed) + 1;
+	if (!bContinuation && Limit > 0 && NewDepth > Limit)
+	{
+		Depth.fetch_sub(1, std::memory_order_relaxed);
+		Rejected.fetch_add(1, std::memory_order_relaxed);
+		UE_LOG(LogTemp, Warning, TEXT("[FlutterBridge] Ingress queue full (%d), rejecting message: Target=%s, Method=%s"),
+			Limit, *Message.Target, *Message.Method);
+		return false;
+	}
+
+	int32 Peak = PeakDepth.load(std::memory_order_relaxed);
+	while (NewDepth > Peak && !PeakDepth.compare_exchange_weak(Peak, NewDepth, std::memory_order_relaxed))
+	{
+	}
+
+	Queue.Enqueue(MoveTemp(Message));
+	Enqueued.fetch_add(1, std::memory_order_relaxed);
+	return true;
+}
+
+bool AFlutterBridge::EnqueueFromFlutter(const FString& Target, const FString& Method, const FString& Data)
+{
+	FFlutterIngressMessage Message;
+	Message.Kind = FFlutterIngressMessage::EKind::Message;
+	Message.Target = Target;
+	Message.Method = Method;
+	Message.Data = Data;
+	return EnqueueFromFlutter(MoveTemp(Message));
+}
+
+FFlutterIngressStatistics AFlutterBridge::GetIngressStatistics()
+{
+	using namespace FlutterIngress;
+
+	FFlutterIngressStatistics Stats;
+	Stats.Enqueued = Enqueued.load(std::memory_order_relaxed);
+	Stats.Delivered = Delivered.load(std::memory_order_relaxed);
+	Stats.Rejected = Rejected.load(std::memory_order_relaxed);
+	Stats.DeferredTicks = DeferredTicks.load(std::memory_order_relaxed);
+	Stats.Depth = Depth.load(std::memory_order_relaxed);
+	Stats.PeakDepth = PeakDepth.load(std::memory_order_relaxed);
+	return Stats;
+}
+
+void AFlutterBridge::SetMaxIngressQueueDepth(int32 MaxDepth)
+{
+	FlutterIngress::MaxDepth.store(FMath::Max(0, MaxDepth), std::memory_order_relaxed);
+}
+
+void AFlutterBridge::DrainIngressQueue()
+{
+	using namespace FlutterIngress;
+
+	if (Queue.IsEmpty())
+	{
+		return;
+	}
+
+	const double Deadline = FPlatformTime::Seconds() + FMath::Max(IngressTimeBudgetMs, 0.1f) / 1000.0;
+
+	FFlutterIngressMessage Message;
+	while (Queue.Dequeue(Message))
+	{
+		Depth.fetch_sub(1, std::memory_order_relaxed);
+
+		DispatchIngressMessage(Message);
+		Delivered.fetch_add(1, std::memory_order_relaxed);
+
+		if (FPlatformTime::Seconds() >= Deadline)
+		{
+			if (!Queue.IsEmpty())
+			{
+				DeferredTicks.fetch_add(1, std::memory_order_relaxed);
+			}
+			break;
+		}
+	}
+}
+
+void AFlutterBridge::DispatchIngressMessage(FFlutterIngressMessage& Message)
+{
+	switch (Message.Kind)
+	{
+	case FFlutterIngressMessage::EKind::Message:
+		ReceiveFromFlutter(Message.Target, Message.Method, Message.Data);
+		break;
+
+	case FFlutterIngressMessage::EKind::Binary:
+		ReceiveBinaryFromFlutter(Message.Target, Message.Method, Message.BinaryData, Message.Checksum);
+		break;
+
+	case FFlutterIngressMessage::EKind::ChunkHeader:
+		ReceiveBinaryChunkHeader(Message.Target, Message.Method, Message.TransferId, Message.TotalSize, Message.TotalChunks, Message.Checksum);
+		break;
+
+	case FFlutterIngressMessage::EKind::ChunkData:
+		ReceiveBinaryChunkData(Message.Target, Message.Method, Message.TransferId, Message.ChunkIndex, Message.BinaryData);
+		break;
+
+	case FFlutterIngressMessage::EKind::ChunkFooter:
+		ReceiveBinaryChunkFooter(Message.Target, Message.Method, Message.TransferId, Message.TotalChunks, Message.Checksum);
+		break;
+	}
+}
+
 // ============================================================
 // MARK: - Binary Message Communication
 // ============================================================
 
 void AFlutterBridge::SendBinaryToFlutter(const FString& Target, const FString& Method, const TArray<uint8>& Data)
+{
+	// Messages batched earlier must reach Flutter first
+	FlushOutgoingBatch();
+	SendBinaryToFlutterImmediate(Target, Method, Data);
+}
+
+void AFlutterBridge::SendBinaryToFlutterImmediate(const FString& Target, const FString& Method, const TArray<uint8>& Data)
 {
 	UE_LOG(LogTemp, Log, TEXT("[FlutterBridge] Sending binary to Flutter: Target=%s, Method=%s, Size=%d"), *Target, *Method, Data.Num());
 
-	int32 Checksum = CalculateCRC32(Data);
+	TArray<uint8> Compressed;
+	const bool bIsCompressed = CompressData(Data, Compressed);
+	const TArray<uint8>& Payload = bIsCompressed ? Compressed : Data;
+
+	if (bIsCompressed)
+	{
+		UE_LOG(LogTemp, Verbose, TEXT("[FlutterBridge] Compressed binary payload: %d -> %d bytes"), Data.Num(), Payload.Num());
+	}
+
+	// One platform call for a large payload would stall the frame, so it goes out in chunks instead
+	if (Payload.Num() > MaxSingleBinaryMessageSize)
+	{
+		QueueOutgoingTransfer(Target, Method, bIsCompressed ? MoveTemp(Compressed) : TArray<uint8>(Data));
+		return;
+	}
+
+	// Flutter verifies the checksum after decompressing, so it covers the original bytes
+	const int32 Checksum = CalculateCRC32(Data);
 
 #if PLATFORM_ANDROID
-	extern void FlutterBridge_SendBinaryToFlutter_Android(const FString& Target, const FString& Method, const TArray<uint8>& Data, int32 Checksum);
-	FlutterBridge_SendBinaryToFlutter_Android(Target, Method, Data, Checksum);
+	extern void FlutterBridge_SendBinaryToFlutter_Android(const FString& Target, const FString& Method, const TArray<uint8>& Data, bool bIsCompressed, int32 Checksum);
+	FlutterBridge_SendBinaryToFlutter_Android(Target, Method, Payload, bIsCompressed, Checksum);
 #elif PLATFORM_IOS
-	extern void FlutterBridge_SendBinaryToFlutter_iOS(const FString& Target, const FString& Method, const TArray<uint8>& Data, int32 Checksum);
-	FlutterBridge_SendBinaryToFlutter_iOS(Target, Method, Data, Checksum);
+	extern void FlutterBridge_SendBinaryToFlutter_iOS(const FString& Target, const FString& Method, const TArray<uint8>& Data, bool bIsCompressed, int32 Checksum);
+	FlutterBridge_SendBinaryToFlutter_iOS(Target, Method, Payload, bIsCompressed, Checksum);
 #elif PLATFORM_MAC
-	extern void FlutterBridge_SendBinaryToFlutter_Mac(const FString& Target, const FString& Method, const TArray<uint8>& Data, int32 Checksum);
-	FlutterBridge_SendBinaryToFlutter_Mac(Target, Method, Data, Checksum);
+	extern void FlutterBridge_SendBinaryToFlutter_Mac(const FString& Target, const FString& Method, const TArray<uint8>& Data, bool bIsCompressed, int32 Checksum);
+	FlutterBridge_SendBinaryToFlutter_Mac(Target, Method, Payload, bIsCompressed, Checksum);
 #else
 	UE_LOG(LogTemp, Warning, TEXT("[FlutterBridge] SendBinaryToFlutter not implemented for this platform"));
 #endif
 }
 
+FString AFlutterBridge::SendChunkedBinaryToFlutter(const FString& Target, const FString& Method, const TArray<uint8>& Data)
+{
+	FlushOutgoingBatch();
+
+	TArray<uint8> Compressed;
+	if (CompressData(Data, Compressed))
+	{
+		return QueueOutgoingTransfer(Target, Method, MoveTemp(Compressed));
+	}
+	return QueueOutgoingTransfer(Target, Method, TArray<uint8>(Data));
+}
+
+int32 AFlutterBridge::GetPendingOutgoingTransfers() const
+{
+	return OutgoingTransfers.Num();
+}
+
+FString AFlutterBridge::QueueOutgoingTransfer(const FString& Target, const FString& Method, TArray<uint8>&& Payload)
+{
+	const FString TransferId = TEXT("ue_") + FGuid::NewGuid().ToString(EGuidFormats::Digits);
+
+	const FFlutterOutgoingTransfer& Transfer = OutgoingTransfers.Emplace_GetRef(TransferId, Target, Method, MoveTemp(Payload), BinaryChunkSize);
+
+	UE_LOG(LogTemp, Log, TEXT("[FlutterBridge] Queued chunked transfer: TransferId=%s, Size=%d, Chunks=%d"), *TransferId, Transfer.GetTotalSize(), Transfer.GetTotalChunks());
+
+	return TransferId;
+}
+
+void AFlutterBridge::SendTypedToFlutter(const FString& Target, const FString& Method, const FFlutterStandardWriter& Payload)
+{
+	SendBinaryToFlutter(Target, Method, Payload.GetBuffer());
+}
+
 void AFlutterBridge::ReceiveBinaryFromFlutter(const FString& Target, const FString& Method, const TArray<uint8>& Data, int32 Checksum)
 {
 	UE_LOG(LogTemp, Log, TEXT("[FlutterBridge] Received binary from Flutter: Target=%s, Method=%s, Size=%d"), *Target, *Method, Data.Num());
 
-	// Verify checksum
+	// Verify checksum; Flutter computes it over the bytes it sent, compressed or not
 	if (!VerifyChecksum(Data, Checksum))
 	{
 		UE_LOG(LogTemp, Warning, TEXT("[FlutterBridge] Binary message checksum mismatch!"));
 	}
 
+	TArray<uint8> Decompressed;
+	if (DecompressData(Data, Decompressed))
+	{
+		ReceiveDecodedBinaryFromFlutter(Target, Method, Decompressed);
+		return;
+	}
+
+	ReceiveDecodedBinaryFromFlutter(Target, Method, Data);
+}
+
+void AFlutterBridge::ReceiveDecodedBinaryFromFlutter(const FString& Target, const FString& Method, const TArray<uint8>& Data)
+{
+	// Length-prefixed batch frame: deliver each message as if it arrived on its own
+	if (Target == FFlutterMessageBatch::Target && FFlutterMessageBatch::IsBatchFrame(Data))
+	{
+		FFlutterMessageBatch::Decode(Data, [this](FString&& MessageTarget, FString&& MessageMethod, FString&& MessageData)
+		{
+			ReceiveFromFlutter(MessageTarget, MessageMethod, MessageData);
+		});
+		return;
+	}
+
 	// Fire Blueprint event
 	OnBinaryMessageFromFlutter(Target, Method, Data);
 }
 
+namespace FlutterOutgoing
+{
+	/** @return False if the transfer cannot be sent; the caller drops it */
+	static bool SendHeader(const FFlutterOutgoingTransfer& Transfer)
+	{
+#if PLATFORM_ANDROID
+		extern bool FlutterBridge_SendBinaryChunkHeader_Android(const FString& Target, const FString& Method, const FString& TransferId, int32 TotalSize, int32 TotalChunks, int32 Checksum);
+		return FlutterBridge_SendBinaryChunkHeader_Android(Transfer.GetTarget(), Transfer.GetMethod(), Transfer.GetTransferId(), Transfer.GetTotalSize(), Transfer.GetTotalChunks(), Transfer.GetChecksum());
+#else
+		UE_LOG(LogTemp, Error, TEXT("[FlutterBridge] Chunked binary transfers not implemented for this platform"));
+		return false;
+#endif
+	}
+
+	static void SendData(const FFlutterOutgoingTransfer& Transfer, int32 ChunkIndex, TConstArrayView<uint8> Data)
+	{
+#if PLATFORM_ANDROID
+		extern void FlutterBridge_SendBinaryChunkData_Android(const FString& Target, const FString& Method, const FString& TransferId, int32 ChunkIndex, TConstArrayView<uint8> Data);
+		FlutterBridge_SendBinaryChunkData_Android(Transfer.GetTarget(), Transfer.GetMethod(), Transfer.GetTransferId(), ChunkIndex, Data);
+#endif
+	}
+
+	static void SendFooter(const FFlutterOutgoingTransfer& Transfer)
+	{
+#if PLATFORM_ANDROID
+		extern void FlutterBridge_SendBinaryChunkFooter_Android(const FString& Target, const FString& Method, const FString& TransferId, int32 TotalChunks, int32 Checksum);
+		FlutterBridge_SendBinaryChunkFooter_Android(Transfer.GetTarget(), Transfer.GetMethod(), Transfer.GetTransferId(), Transfer.GetTotalChunks(), Transfer.GetChecksum());
+#endif
+	}
+
+	static void SendProgress(const FFlutterOutgoingTransfer& Transfer)
+	{
+#if PLATFORM_ANDROID
+		extern void FlutterBridge_SendBinaryProgress_Android(const FString& TransferId, int32 CurrentChunk, int32 TotalChunks, int64 BytesTransferred, int64 TotalBytes);
+		FlutterBridge_SendBinaryProgress_Android(Transfer.GetTransferId(), Transfer.GetSentChunks(), Transfer.GetTotalChunks(), Transfer.GetSentBytes(), Transfer.GetTotalSize());
+#endif
+	}
+}
+
+void AFlutterBridge::PumpOutgoingTransfers()
+{
+	int64 BudgetBytes = OutgoingChunkBytesPerFrame;
+	bool bSentChunk = false;
+
+	// Transfers go out one after another so the first one finishes as early as possible
+	while (OutgoingTransfers.Num() > 0 && (BudgetBytes > 0 || !bSentChunk))
+	{
+		FFlutterOutgoingTransfer& Transfer = OutgoingTransfers[0];
+
+		if (Transfer.GetSentChunks() == 0 && !FlutterOutgoing::SendHeader(Transfer))
+		{
+			UE_LOG(LogTemp, Error, TEXT("[FlutterBridge] Dropping chunked transfer %s (%d bytes): Flutter cannot receive it"), *Transfer.GetTransferId(), Transfer.GetTotalSize());
+			OutgoingTransfers.RemoveAt(0);
+			continue;
+		}
+
+		while (!Transfer.IsComplete() && (BudgetBytes > 0 || !bSentChunk))
+		{
+			int32 ChunkIndex = 0;
+			const TConstArrayView<uint8> Chunk = Transfer.NextChunk(ChunkIndex);
+			FlutterOutgoing::SendData(Transfer, ChunkIndex, Chunk);
+			BudgetBytes -= Chunk.Num();
+			bSentChunk = true;
+		}
+
+		// Progress is reported once per frame rather than per chunk
+		const float Progress = Transfer.GetTotalChunks() > 0 ? (float)Transfer.GetSentChunks() / (float)Transfer.GetTotalChunks() : 1.0f;
+		FlutterOutgoing::SendProgress(Transfer);
+		OnOutgoingTransferProgress(Transfer.GetTransferId(), Transfer.GetSentChunks(), Transfer.GetTotalChunks(), Progress);
+
+		if (!Transfer.IsComplete())
+		{
+			break;
+		}
+
+		FlutterOutgoing::SendFooter(Transfer);
+		UE_LOG(LogTemp, Log, TEXT("[FlutterBridge] Chunked transfer sent: TransferId=%s, Chunks=%d"), *Transfer.GetTransferId(), Transfer.GetTotalChunks());
+		OutgoingTransfers.RemoveAt(0);
+	}
+}
+
 void AFlutterBridge::ReceiveBinaryChunkHeader(
 	const FString& Target,
 	const FString& Method,
@@ -211,15 +660,14 @@ void AFlutterBridge::ReceiveBinaryChunkHeader(
 {
 	UE_LOG(LogTemp, Log, TEXT("[FlutterBridge] Binary chunk header: TransferId=%s, TotalSize=%d, TotalChunks=%d"), *TransferId, TotalSize, TotalChunks);
 
-	FChunkedTransfer Transfer;
-	Transfer.Target = Target;
-	Transfer.Method = Method;
-	Transfer.TotalSize = TotalSize;
-	Transfer.TotalChunks = TotalChunks;
-	Transfer.ExpectedChecksum = Checksum;
-	Transfer.ReceivedChunks = 0;
+	FFlutterChunkedTransfer Transfer(Target, Method, TotalSize, TotalChunks, Checksum, MaxDecompressedBinarySize);
+	if (!Transfer.IsValid())
+	{
+		UE_LOG(LogTemp, Warning, TEXT("[FlutterBridge] Invalid chunked transfer header: TransferId=%s, TotalSize=%d, TotalChunks=%d"), *TransferId, TotalSize, TotalChunks);
+		return;
+	}
 
-	ActiveTransfers.Add(TransferId, Transfer);
+	ActiveTransfers.Add(TransferId, MoveTemp(Transfer));
 }
 
 void AFlutterBridge::ReceiveBinaryChunkData(
@@ -229,19 +677,30 @@ void AFlutterBridge::ReceiveBinaryChunkData(
 	int32 ChunkIndex,
 	const TArray<uint8>& Data)
 {
-	FChunkedTransfer* Transfer = ActiveTransfers.Find(TransferId);
+	FFlutterChunkedTransfer* Transfer = ActiveTransfers.Find(TransferId);
 	if (!Transfer)
 	{
 		UE_LOG(LogTemp, Warning, TEXT("[FlutterBridge] Unknown transfer ID: %s"), *TransferId);
 		return;
 	}
 
-	Transfer->Chunks.Add(ChunkIndex, Data);
-	Transfer->ReceivedChunks++;
+	switch (Transfer->AddChunk(ChunkIndex, Data))
+	{
+	case FFlutterChunkedTransfer::EChunkResult::Duplicate:
+		UE_LOG(LogTemp, Verbose, TEXT("[FlutterBridge] Duplicate chunk %d in transfer %s ignored"), ChunkIndex, *TransferId);
+		return;
+
+	case FFlutterChunkedTransfer::EChunkResult::Rejected:
+		UE_LOG(LogTemp, Warning, TEXT("[FlutterBridge] Rejected chunk %d (%d bytes) in transfer %s"), ChunkIndex, Data.Num(), *TransferId);
+		return;
+
+	case FFlutterChunkedTransfer::EChunkResult::Accepted:
+		break;
+	}
 
 	// Report progress
-	float Progress = (float)Transfer->ReceivedChunks / (float)Transfer->TotalChunks;
-	OnBinaryTransferProgress(TransferId, Transfer->ReceivedChunks, Transfer->TotalChunks, Progress);
+	float Progress = (float)Transfer->GetReceivedChunks() / (float)Transfer->GetTotalChunks();
+	OnBinaryTransferProgress(TransferId, Transfer->GetReceivedChunks(), Transfer->GetTotalChunks(), Progress);
 
 	UE_LOG(LogTemp, Verbose, TEXT("[FlutterBridge] Binary chunk data: TransferId=%s, ChunkIndex=%d, Progress=%.1f%%"), *TransferId, ChunkIndex, Progress * 100.0f);
 }
@@ -255,57 +714,48 @@ void AFlutterBridge::ReceiveBinaryChunkFooter(
 {
 	UE_LOG(LogTemp, Log, TEXT("[FlutterBridge] Binary chunk footer: TransferId=%s"), *TransferId);
 
-	FChunkedTransfer* Transfer = ActiveTransfers.Find(TransferId);
+	FFlutterChunkedTransfer* Transfer = ActiveTransfers.Find(TransferId);
 	if (!Transfer)
 	{
 		UE_LOG(LogTemp, Warning, TEXT("[FlutterBridge] Unknown transfer ID: %s"), *TransferId);
 		return;
 	}
 
-	// Verify all chunks received
-	if (Transfer->ReceivedChunks != Transfer->TotalChunks)
+	// The buffer has holes where chunks are missing, so an incomplete transfer is dropped
+	if (!Transfer->IsComplete())
 	{
-		UE_LOG(LogTemp, Warning, TEXT("[FlutterBridge] Incomplete transfer: received %d/%d chunks"), Transfer->ReceivedChunks, Transfer->TotalChunks);
+		const TArray<int32> Missing = Transfer->GetMissingChunks();
+		UE_LOG(LogTemp, Warning, TEXT("[FlutterBridge] Incomplete transfer %s: received %d/%d chunks, first missing chunk %d"),
+			*TransferId, Transfer->GetReceivedChunks(), Transfer->GetTotalChunks(), Missing.Num() ? Missing[0] : -1);
+		ActiveTransfers.Remove(TransferId);
+		return;
 	}
 
-	// Assemble the complete data
 	AssembleChunkedTransfer(TransferId);
 }
 
 void AFlutterBridge::AssembleChunkedTransfer(const FString& TransferId)
 {
-	FChunkedTransfer* Transfer = ActiveTransfers.Find(TransferId);
+	FFlutterChunkedTransfer* Transfer = ActiveTransfers.Find(TransferId);
 	if (!Transfer)
 	{
 		return;
 	}
 
-	// Assemble chunks in order
-	TArray<uint8> CompleteData;
-	CompleteData.Reserve(Transfer->TotalSize);
-
-	for (int32 i = 0; i < Transfer->TotalChunks; ++i)
+	// Chunks were written in place (and decompressed as they arrived), so the payload is already assembled
+	if (!Transfer->VerifyChecksum())
 	{
-		TArray<uint8>* ChunkData = Transfer->Chunks.Find(i);
-		if (ChunkData)
-		{
-			CompleteData.Append(*ChunkData);
-		}
-		else
-		{
-			UE_LOG(LogTemp, Warning, TEXT("[FlutterBridge] Missing chunk %d in transfer %s"), i, *TransferId);
-		}
+		UE_LOG(LogTemp, Warning, TEXT("[FlutterBridge] Chunked transfer checksum mismatch!"));
 	}
 
-	// Verify checksum
-	if (!VerifyChecksum(CompleteData, Transfer->ExpectedChecksum))
+	if (Transfer->HasDecompressionError())
 	{
-		UE_LOG(LogTemp, Warning, TEXT("[FlutterBridge] Chunked transfer checksum mismatch!"));
+		UE_LOG(LogTemp, Warning, TEXT("[FlutterBridge] Failed to decompress chunked transfer %s; delivering compressed data"), *TransferId);
 	}
 
 	// Fire Blueprint event
-	OnChunkedTransferComplete(TransferId, CompleteData);
-	OnBinaryMessageFromFlutter(Transfer->Target, Transfer->Method, CompleteData);
+	OnChunkedTransferComplete(TransferId, Transfer->GetData());
+	OnBinaryMessageFromFlutter(Transfer->GetTarget(), Transfer->GetMethod(), Transfer->GetData());
 
 	// Cleanup
 	ActiveTransfers.Remove(TransferId);
@@ -324,14 +774,7 @@ int32 AFlutterBridge::GetBinaryChunkSize() const
 
 int32 AFlutterBridge::CalculateCRC32(const TArray<uint8>& Data) const
 {
-	uint32 CRC = 0xFFFFFFFF;
-
-	for (int32 i = 0; i < Data.Num(); ++i)
-	{
-		CRC = CRC32Table[(CRC ^ Data[i]) & 0xFF] ^ (CRC >> 8);
-	}
-
-	return static_cast<int32>(CRC ^ 0xFFFFFFFF);
+	return static_cast<int32>(FFlutterCrc32::Calculate(Data));
 }
 
 bool AFlutterBridge::VerifyChecksum(const TArray<uint8>& Data, int32 ExpectedChecksum) const
@@ -339,24 +782,30 @@ bool AFlutterBridge::VerifyChecksum(const TArray<uint8>& Data, int32 ExpectedChe
 	return CalculateCRC32(Data) == ExpectedChecksum;
 }
 
-TArray<uint8> AFlutterBridge::CompressData(const TArray<uint8>& Data) const
+bool AFlutterBridge::CompressData(const TArray<uint8>& Data, TArray<uint8>& OutCompressed) const
 {
-	// TODO: Implement GZip compression using zlib
-	// For now, return uncompressed data
-	return Data;
+	if (Data.Num() < CompressionThreshold)
+	{
+		return false;
+	}
+
+	return FFlutterCompression::Compress(BinaryCompressionCodec, Data, OutCompressed);
 }
 
-TArray<uint8> AFlutterBridge::DecompressData(const TArray<uint8>& Data) const
+bool AFlutterBridge::DecompressData(const TArray<uint8>& Data, TArray<uint8>& OutDecompressed) const
 {
-	// Check for GZip magic number (0x1F 0x8B)
-	if (Data.Num() >= 2 && Data[0] == 0x1F && Data[1] == 0x8B)
+	// GZip magic or codec envelope; anything else is raw
+	if (FFlutterCompression::Detect(Data) == EFlutterCompressionCodec::None)
 	{
-		// TODO: Implement GZip decompression using zlib
-		UE_LOG(LogTemp, Warning, TEXT("[FlutterBridge] GZip decompression not implemented"));
+		return false;
 	}
 
-	// Return as-is if not compressed
-	return Data;
+	if (!FFlutterCompression::Decompress(Data, OutDecompressed, MaxDecompressedBinarySize))
+	{
+		UE_LOG(LogTemp, Warning, TEXT("[FlutterBridge] Failed to decompress %d byte payload"), Data.Num());
+		return false;
+	}
+	return true;
 }
 
 // ============================================================
@@ -520,7 +969,7 @@ void AFlutterBridge::OnSurfaceReady(int32 Width, int32 Height)
 	// 3. Configure the rendering pipeline
 	
 	// Notify Flutter that surface is ready
-	SendToFlutter(TEXT("FlutterBridge"), TEXT("onSurfaceReady"), FString::Printf(TEXT("{\"width\":%d,\"height\":%d}"), Width, Height));
+	SendToFlutter(TEXT("FlutterBridge"), TEXT("onSurfaceReady"), MakeSurfaceSizeJson(Width, Height));
 }
 
 void AFlutterBridge::OnSurfaceSizeChanged(int32 Width, int32 Height)
@@ -530,10 +979,11 @@ void AFlutterBridge::OnSurfaceSizeChanged(int32 Width, int32 Height)
 	SurfaceWidth = Width;
 	SurfaceHeight = Height;
 	
-	// TODO: Update viewport/render target dimensions
+	// The screen percentage is relative to the viewport, so the render target follows the
+	// new size at the current scale without further work here
 	
 	// Notify Flutter of size change
-	SendToFlutter(TEXT("FlutterBridge"), TEXT("onSurfaceSizeChanged"), FString::Printf(TEXT("{\"width\":%d,\"height\":%d}"), Width, Height));
+	SendToFlutter(TEXT("FlutterBridge"), TEXT("onSurfaceSizeChanged"), MakeSurfaceSizeJson(Width, Height));
 }
 
 void AFlutterBridge::OnSurfaceDestroyed()
@@ -561,6 +1011,133 @@ bool AFlutterBridge::IsSurfaceReady() const
 	return bSurfaceReady;
 }
 
+FFlutterSurfaceStatistics AFlutterBridge::GetSurfaceStatistics()
+{
+	return FFlutterSurfaceStats::Get().GetStatistics();
+}
+
+FString AFlutterBridge::MakeSurfaceSizeJson(int32 Width, int32 Height) const
+{
+	const float Scale = RenderScale.GetScale();
+	int32 RenderWidth = 0;
+	int32 RenderHeight = 0;
+	FFlutterRenderScale::GetRenderSize(Width, Height, Scale, RenderWidth, RenderHeight);
+
+	return FString::Printf(TEXT("{\"width\":%d,\"height\":%d,\"renderScale\":%.3f,\"renderWidth\":%d,\"renderHeight\":%d}"),
+		Width, Height, Scale, RenderWidth, RenderHeight);
+}
+
+// ============================================================
+// MARK: - Render Scale
+// ============================================================
+
+void AFlutterBridge::SetRenderScaleSettings(const FFlutterRenderScaleSettings& Settings)
+{
+	UE_LOG(LogTemp, Log, TEXT("[FlutterBridge] Render scale mode %d, scale %.2f (%.2f-%.2f), target %.0f fps"),
+		(int32)Settings.Mode, Settings.Scale, Settings.MinScale, Settings.MaxScale, Settings.TargetFrameRate);
+
+	// Apply even if the scale is unchanged, the screen percentage may have been changed elsewhere
+	RenderScale.Configure(Settings);
+	ApplyRenderScale();
+}
+
+FFlutterRenderScaleSettings AFlutterBridge::GetRenderScaleSettings() const
+{
+	return RenderScale.GetSettings();
+}
+
+float AFlutterBridge::GetRenderScale() const
+{
+	return RenderScale.GetScale();
+}
+
+void AFlutterBridge::GetRenderSize(int32& OutWidth, int32& OutHeight) const
+{
+	FFlutterRenderScale::GetRenderSize(SurfaceWidth, SurfaceHeight, RenderScale.GetScale(), OutWidth, OutHeight);
+}
+
+void AFlutterBridge::ApplyRenderScale()
+{
+	const float Scale = RenderScale.GetScale();
+
+	static IConsoleVariable* ScreenPercentage = IConsoleManager::Get().FindConsoleVariable(TEXT("r.ScreenPercentage"));
+	if (!ScreenPercentage)
+	{
+		UE_LOG(LogTemp, Warning, TEXT("[FlutterBridge] r.ScreenPercentage not available, render scale ignored"));
+		return;
+	}
+
+	ScreenPercentage->Set(Scale * 100.0f, ECVF_SetByCode);
+	bRenderScaleApplied = RenderScale.GetSettings().Mode != EFlutterRenderScaleMode::Native;
+
+	int32 RenderWidth = 0;
+	int32 RenderHeight = 0;
+	GetRenderSize(RenderWidth, RenderHeight);
+	UE_LOG(LogTemp, Log, TEXT("[FlutterBridge] Render scale %.2f: %dx%d for a %dx%d surface"), Scale, RenderWidth, RenderHeight, SurfaceWidth, SurfaceHeight);
+
+	SendToFlutter(TEXT("FlutterBridge"), TEXT("onRenderScaleChanged"), MakeSurfaceSizeJson(SurfaceWidth, SurfaceHeight));
+}
+
+// ============================================================
+// MARK: - State Mirror
+// ============================================================
+
+bool AFlutterBridge::MirrorStateInt(const FString& Name, int64 Value)
+{
+#if PLATFORM_LINUX
+	extern bool FlutterBridge_MirrorStateInt_Linux(const FString& Name, int64 Value);
+	return FlutterBridge_MirrorStateInt_Linux(Name, Value);
+#else
+	return false;
+#endif
+}
+
+bool AFlutterBridge::MirrorStateFloat(const FString& Name, double Value)
+{
+#if PLATFORM_LINUX
+	extern bool FlutterBridge_MirrorStateDouble_Linux(const FString& Name, double Value);
+	return FlutterBridge_MirrorStateDouble_Linux(Name, Value);
+#else
+	return false;
+#endif
+}
+
+bool AFlutterBridge::MirrorStateBool(const FString& Name, bool Value)
+{
+#if PLATFORM_LINUX
+	extern bool FlutterBridge_MirrorStateBool_Linux(const FString& Name, bool Value);
+	return FlutterBridge_MirrorStateBool_Linux(Name, Value);
+#else
+	return false;
+#endif
+}
+
+void AFlutterBridge::BeginStateMirrorUpdate()
+{
+#if PLATFORM_LINUX
+	extern void FlutterBridge_BeginStateMirrorUpdate_Linux();
+	FlutterBridge_BeginStateMirrorUpdate_Linux();
+#endif
+}
+
+void AFlutterBridge::EndStateMirrorUpdate()
+{
+#if PLATFORM_LINUX
+	extern void FlutterBridge_EndStateMirrorUpdate_Linux();
+	FlutterBridge_EndStateMirrorUpdate_Linux();
+#endif
+}
+
+bool AFlutterBridge::IsStateMirrorAvailable() const
+{
+#if PLATFORM_LINUX
+	extern bool FlutterBridge_IsStateMirrorAvailable_Linux();
+	return FlutterBridge_IsStateMirrorAvailable_Linux();
+#else
+	return false;
+#endif
+}
+
 // ============================================================
 // MARK: - Platform Bridge Initialization
 // ============================================================
@@ -579,6 +1156,10 @@ void AFlutterBridge::InitializePlatformBridge()
 	UE_LOG(LogTemp, Log, TEXT("[FlutterBridge] Initializing macOS bridge"));
 	extern void FlutterBridge_SetInstance_Mac(AFlutterBridge* Instance);
 	FlutterBridge_SetInstance_Mac(this);
+#elif PLATFORM_LINUX
+	UE_LOG(LogTemp, Log, TEXT("[FlutterBridge] Initializing Linux bridge"));
+	extern void FlutterBridge_SetInstance_Linux(AFlutterBridge* Instance);
+	FlutterBridge_SetInstance_Linux(this);
 #else
 	UE_LOG(LogTemp, Log, TEXT("[FlutterBridge] No platform bridge available"));
 #endif
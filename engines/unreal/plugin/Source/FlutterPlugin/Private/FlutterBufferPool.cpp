@@ -0,0 +1,193 @@
+// Copyright Epic Games, Inc. All Rights Reserved.
+
+#include "FlutterBufferPool.h"
+#include "Misc/ScopeLock.h"
+
+namespace FlutterBufferPool
+{
+	/** Buffer IDs are the slot index in the low bits and a generation above it */
+	static constexpr int32 SlotBits = 20;
+	static constexpr int32 SlotMask = (1 << SlotBits) - 1;
+	static constexpr uint32 GenerationMask = (1u << (31 - SlotBits)) - 1;
+
+	/** Cache-line aligned so buffers can be read with vector loads */
+	static constexpr uint32 Alignment = 64;
+}
+
+FFlutterBufferPool::FFlutterBufferPool(int32 InMaxIdlePerClass)
+	: MaxIdlePerClass(FMath::Max(InMaxIdlePerClass, 0))
+{
+}
+
+FFlutterBufferPool::~FFlutterBufferPool()
+{
+	for (FSlot& Slot : Slots)
+	{
+		if (Slot.Data)
+		{
+			FMemory::Free(Slot.Data);
+		}
+	}
+}
+
+int32 FFlutterBufferPool::GetSizeClass(int32 NumBytes)
+{
+	if (NumBytes > MaxSizeClassBytes)
+	{
+		return INDEX_NONE;
+	}
+
+	// 4 KB is class 0, each class doubles
+	const uint32 Rounded = FMath::RoundUpToPowerOfTwo((uint32)FMath::Max(NumBytes, MinSizeClassBytes));
+	return (int32)(FMath::FloorLog2(Rounded) - FMath::FloorLog2((uint32)MinSizeClassBytes));
+}
+
+int32 FFlutterBufferPool::MakeId(int32 SlotIndex) const
+{
+	using namespace FlutterBufferPool;
+	return (int32)((Slots[SlotIndex].Generation & GenerationMask) << SlotBits) | SlotIndex;
+}
+
+int32 FFlutterBufferPool::FindSlot(int32 BufferId) const
+{
+	using namespace FlutterBufferPool;
+
+	if (BufferId < 0)
+	{
+		return INDEX_NONE;
+	}
+
+	const int32 SlotIndex = BufferId & SlotMask;
+	if (!Slots.IsValidIndex(SlotIndex) || !Slots[SlotIndex].bInUse || MakeId(SlotIndex) != BufferId)
+	{
+		return INDEX_NONE;
+	}
+	return SlotIndex;
+}
+
+int32 FFlutterBufferPool::Acquire(int32 NumBytes, uint8*& OutData, int32& OutCapacity)
+{
+	using namespace FlutterBufferPool;
+
+	OutData = nullptr;
+	OutCapacity = 0;
+
+	if (NumBytes < 0)
+	{
+		return INDEX_NONE;
+	}
+
+	const int32 SizeClass = GetSizeClass(NumBytes);
+
+	FScopeLock Lock(&Mutex);
+
+	int32 SlotIndex = INDEX_NONE;
+	if (SizeClass != INDEX_NONE && IdleSlots[SizeClass].Num() > 0)
+	{
+		SlotIndex = IdleSlots[SizeClass].Pop();
+		Statistics.Idle--;
+		Statistics.BytesIdle -= Slots[SlotIndex].Capacity;
+		Statistics.Reused++;
+	}
+	else
+	{
+		if (FreeSlots.Num() > 0)
+		{
+			SlotIndex = FreeSlots.Pop();
+		}
+		else if (Slots.Num() <= SlotMask)
+		{
+			SlotIndex = Slots.AddDefaulted();
+		}
+		else
+		{
+			return INDEX_NONE;
+		}
+
+		const int32 Capacity = SizeClass != INDEX_NONE ? MinSizeClassBytes << SizeClass : NumBytes;
+		FSlot& Slot = Slots[SlotIndex];
+		Slot.Data = (uint8*)FMemory::Malloc(Capacity, Alignment);
+		Slot.Capacity = Capacity;
+		Slot.SizeClass = SizeClass;
+
+		if (!Slot.Data)
+		{
+			Slot.Capacity = 0;
+			FreeSlots.Add(SlotIndex);
+			return INDEX_NONE;
+		}
+	}
+
+	FSlot& Slot = Slots[SlotIndex];
+	Slot.bInUse = true;
+	Slot.Generation++;
+
+	Statistics.Acquired++;
+	Statistics.InUse++;
+	Statistics.BytesInUse += Slot.Capacity;
+
+	OutData = Slot.Data;
+	OutCapacity = Slot.Capacity;
+	return MakeId(SlotIndex);
+}
+
+bool FFlutterBufferPool::Release(int32 BufferId)
+{
+	FScopeLock Lock(&Mutex);
+
+	const int32 SlotIndex = FindSlot(BufferId);
+	if (SlotIndex == INDEX_NONE)
+	{
+		return false;
+	}
+
+	FSlot& Slot = Slots[SlotIndex];
+	Slot.bInUse = false;
+	Statistics.InUse--;
+	Statistics.BytesInUse -= Slot.Capacity;
+
+	if (Slot.SizeClass != INDEX_NONE && IdleSlots[Slot.SizeClass].Num() < MaxIdlePerClass)
+	{
+		IdleSlots[Slot.SizeClass].Add(SlotIndex);
+		Statistics.Idle++;
+		Statistics.BytesIdle += Slot.Capacity;
+	}
+	else
+	{
+		FreeSlot(SlotIndex);
+	}
+	return true;
+}
+
+void FFlutterBufferPool::FreeSlot(int32 SlotIndex)
+{
+	FSlot& Slot = Slots[SlotIndex];
+	FMemory::Free(Slot.Data);
+	Slot.Data = nullptr;
+	Slot.Capacity = 0;
+	Slot.SizeClass = INDEX_NONE;
+	FreeSlots.Add(SlotIndex);
+}
+
+void FFlutterBufferPool::Trim()
+{
+	FScopeLock Lock(&Mutex);
+
+	for (TArray<int32>& Idle : IdleSlots)
+	{
+		for (const int32 SlotIndex : Idle)
+		{
+			FreeSlot(SlotIndex);
+		}
+		Idle.Reset();
+	}
+
+	Statistics.Idle = 0;
+	Statistics.BytesIdle = 0;
+}
+
+FFlutterBufferPoolStatistics FFlutterBufferPool::GetStatistics() const
+{
+	FScopeLock Lock(&Mutex);
+	return Statistics;
+}
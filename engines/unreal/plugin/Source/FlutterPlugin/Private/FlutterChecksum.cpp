@@ -0,0 +1,195 @@
+// Copyright Epic Games, Inc. All Rights Reserved.
+
+#include "FlutterChecksum.h"
+
+// ARMv8 CRC32 instructions compute the same polynomial as the tables below.
+// (SSE4.2's crc32 instruction is CRC-32C, a different polynomial, so x86 stays on slicing-by-8.)
+#if PLATFORM_CPU_ARM_FAMILY && PLATFORM_64BITS && defined(__clang__) && (PLATFORM_ANDROID || PLATFORM_LINUX || PLATFORM_APPLE)
+	#define FLUTTER_CRC32_ARM 1
+#else
+	#define FLUTTER_CRC32_ARM 0
+#endif
+
+#if FLUTTER_CRC32_ARM
+	#if PLATFORM_APPLE
+		#include <sys/sysctl.h>
+	#else
+		#include <sys/auxv.h>
+		#ifndef HWCAP_CRC32
+			#define HWCAP_CRC32 (1 << 7)
+		#endif
+	#endif
+#endif
+
+static_assert(PLATFORM_LITTLE_ENDIAN, "FFlutterCrc32 slicing-by-8 assumes a little-endian host");
+
+namespace FlutterCrc32
+{
+	static constexpr uint32 Polynomial = 0xEDB88320u;
+
+	// Table[0] is the classic byte-at-a-time table; Table[k] advances a byte by k more positions
+	struct FTables
+	{
+		uint32 Table[8][256];
+
+		FTables()
+		{
+			for (uint32 Byte = 0; Byte < 256; ++Byte)
+			{
+				uint32 Crc = Byte;
+				for (int32 Bit = 0; Bit < 8; ++Bit)
+				{
+					Crc = (Crc >> 1) ^ ((Crc & 1) ? Polynomial : 0);
+				}
+				Table[0][Byte] = Crc;
+			}
+
+			for (int32 Slice = 1; Slice < 8; ++Slice)
+			{
+				for (uint32 Byte = 0; Byte < 256; ++Byte)
+				{
+					const uint32 Previous = Table[Slice - 1][Byte];
+					Table[Slice][Byte] = (Previous >> 8) ^ Table[0][Previous & 0xFF];
+				}
+			}
+		}
+	};
+
+	static const FTables& GetTables()
+	{
+		static const FTables Tables;
+		return Tables;
+	}
+
+#if FLUTTER_CRC32_ARM
+	__attribute__((target("crc")))
+	static uint32 UpdateHardware(uint32 State, const uint8* Data, int64 NumBytes)
+	{
+		while (NumBytes > 0 && (reinterpret_cast<UPTRINT>(Data) & 7) != 0)
+		{
+			State = __builtin_arm_crc32b(State, *Data++);
+			NumBytes--;
+		}
+
+		while (NumBytes >= 32)
+		{
+			uint64 Words[4];
+			FMemory::Memcpy(Words, Data, sizeof(Words));
+			State = __builtin_arm_crc32d(State, Words[0]);
+			State = __builtin_arm_crc32d(State, Words[1]);
+			State = __builtin_arm_crc32d(State, Words[2]);
+			State = __builtin_arm_crc32d(State, Words[3]);
+			Data += 32;
+			NumBytes -= 32;
+		}
+
+		while (NumBytes >= 8)
+		{
+			uint64 Word;
+			FMemory::Memcpy(&Word, Data, sizeof(Word));
+			State = __builtin_arm_crc32d(State, Word);
+			Data += 8;
+			NumBytes -= 8;
+		}
+
+		while (NumBytes > 0)
+		{
+			State = __builtin_arm_crc32b(State, *Data++);
+			NumBytes--;
+		}
+
+		return State;
+	}
+
+	static bool DetectHardware()
+	{
+#if PLATFORM_APPLE
+		int32 HasCrc = 0;
+		size_t Size = sizeof(HasCrc);
+		return sysctlbyname("hw.optional.armv8_crc32", &HasCrc, &Size, nullptr, 0) == 0 && HasCrc != 0;
+#else
+		return (getauxval(AT_HWCAP) & HWCAP_CRC32) != 0;
+#endif
+	}
+#endif
+
+	typedef uint32 (*FUpdateFunction)(uint32 State, const uint8* Data, int64 NumBytes);
+
+	static FUpdateFunction SelectUpdateFunction()
+	{
+#if FLUTTER_CRC32_ARM
+		if (DetectHardware())
+		{
+			UE_LOG(LogTemp, Log, TEXT("[FlutterBridge] CRC32 using ARMv8 CRC instructions"));
+			return &UpdateHardware;
+		}
+#endif
+		return &FFlutterCrc32::UpdateSoftware;
+	}
+
+	static FUpdateFunction GetUpdateFunction()
+	{
+		static const FUpdateFunction Function = SelectUpdateFunction();
+		return Function;
+	}
+}
+
+uint32 FFlutterCrc32::UpdateSoftware(uint32 State, const uint8* Data, int64 NumBytes)
+{
+	const FlutterCrc32::FTables& Tables = FlutterCrc32::GetTables();
+	const uint32 (*Table)[256] = Tables.Table;
+
+	while (NumBytes >= 8)
+	{
+		uint32 Low;
+		uint32 High;
+		FMemory::Memcpy(&Low, Data, sizeof(Low));
+		FMemory::Memcpy(&High, Data + 4, sizeof(High));
+		Low ^= State;
+
+		State = Table[7][Low & 0xFF] ^
+			Table[6][(Low >> 8) & 0xFF] ^
+			Table[5][(Low >> 16) & 0xFF] ^
+			Table[4][Low >> 24] ^
+			Table[3][High & 0xFF] ^
+			Table[2][(High >> 8) & 0xFF] ^
+			Table[1][(High >> 16) & 0xFF] ^
+			Table[0][High >> 24];
+
+		Data += 8;
+		NumBytes -= 8;
+	}
+
+	while (NumBytes > 0)
+	{
+		State = Table[0][(State ^ *Data++) & 0xFF] ^ (State >> 8);
+		NumBytes--;
+	}
+
+	return State;
+}
+
+uint32 FFlutterCrc32::Calculate(TConstArrayView<uint8> Data)
+{
+	FFlutterCrc32 Crc;
+	Crc.Update(Data);
+	return Crc.GetValue();
+}
+
+void FFlutterCrc32::Update(TConstArrayView<uint8> Data)
+{
+	Update(Data.GetData(), Data.Num());
+}
+
+void FFlutterCrc32::Update(const uint8* Data, int64 NumBytes)
+{
+	if (NumBytes > 0)
+	{
+		State = FlutterCrc32::GetUpdateFunction()(State, Data, NumBytes);
+	}
+}
+
+bool FFlutterCrc32::IsHardwareAccelerated()
+{
+	return FlutterCrc32::GetUpdateFunction() != &FFlutterCrc32::UpdateSoftware;
+}
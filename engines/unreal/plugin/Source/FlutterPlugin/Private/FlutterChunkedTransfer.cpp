@@ -0,0 +1,180 @@
+// Copyright Epic Games, Inc. All Rights Reserved.
+
+#include "FlutterChunkedTransfer.h"
+
+// ============================================================
+// MARK: - FFlutterChunkedTransfer
+// ============================================================
+
+FFlutterChunkedTransfer::FFlutterChunkedTransfer(const FString& InTarget, const FString& InMethod, int32 InTotalSize, int32 InTotalChunks, int32 InExpectedChecksum,
+	int64 InMaxDecompressedSize)
+	: Target(InTarget)
+	, Method(InMethod)
+	, TotalSize(InTotalSize)
+	, TotalChunks(InTotalChunks)
+	, ExpectedChecksum(InExpectedChecksum)
+	, bIsValid(false)
+	, ChunkSize(0)
+	, ReceivedChunks(0)
+	, NextChecksumChunk(0)
+	, Codec(EFlutterCompressionCodec::None)
+	, MaxDecompressedSize(InMaxDecompressedSize)
+	, bDecompressionError(false)
+{
+	// Every chunk carries at least one byte; an empty payload has no chunks at all. The size
+	// comes from the peer, so it is capped before anything is allocated for it.
+	bIsValid = TotalSize == 0
+		? TotalChunks == 0
+		: TotalSize > 0 && TotalChunks > 0 && TotalChunks <= TotalSize && TotalSize <= MaxDecompressedSize;
+
+	if (bIsValid)
+	{
+		Buffer.SetNumUninitialized(TotalSize);
+		Received.Init(false, TotalChunks);
+	}
+}
+
+int32 FFlutterChunkedTransfer::ExpectedChunkSize(int32 ChunkIndex) const
+{
+	return ChunkIndex == TotalChunks - 1
+		? TotalSize - (TotalChunks - 1) * ChunkSize
+		: ChunkSize;
+}
+
+FFlutterChunkedTransfer::EChunkResult FFlutterChunkedTransfer::AddChunk(int32 ChunkIndex, TConstArrayView<uint8> Data)
+{
+	if (!bIsValid || ChunkIndex < 0 || ChunkIndex >= TotalChunks)
+	{
+		return EChunkResult::Rejected;
+	}
+
+	if (Received[ChunkIndex])
+	{
+		return EChunkResult::Duplicate;
+	}
+
+	// Learn the chunk size; the last chunk alone also determines it through the remainder
+	if (ChunkSize == 0)
+	{
+		int64 Candidate = Data.Num();
+		if (ChunkIndex == TotalChunks - 1 && TotalChunks > 1)
+		{
+			const int64 Remainder = (int64)TotalSize - Data.Num();
+			if (Remainder <= 0 || Remainder % (TotalChunks - 1) != 0)
+			{
+				return EChunkResult::Rejected;
+			}
+			Candidate = Remainder / (TotalChunks - 1);
+		}
+
+		const int64 LastChunkSize = TotalSize - (TotalChunks - 1) * Candidate;
+		if (Candidate <= 0 || LastChunkSize <= 0 || LastChunkSize > Candidate)
+		{
+			return EChunkResult::Rejected;
+		}
+		ChunkSize = (int32)Candidate;
+	}
+
+	if (Data.Num() != ExpectedChunkSize(ChunkIndex))
+	{
+		return EChunkResult::Rejected;
+	}
+
+	FMemory::Memcpy(Buffer.GetData() + (int64)ChunkIndex * ChunkSize, Data.GetData(), Data.Num());
+	Received[ChunkIndex] = true;
+	ReceivedChunks++;
+
+	ConsumeContiguousChunks();
+
+	return EChunkResult::Accepted;
+}
+
+void FFlutterChunkedTransfer::ConsumeContiguousChunks()
+{
+	// Checksum and decompress chunks as soon as they are contiguous so completion does not re-scan the payload
+	while (NextChecksumChunk < TotalChunks && Received[NextChecksumChunk])
+	{
+		const TConstArrayView<uint8> Chunk(Buffer.GetData() + (int64)NextChecksumChunk * ChunkSize, ExpectedChunkSize(NextChecksumChunk));
+		RunningChecksum.Update(Chunk);
+
+		if (NextChecksumChunk == 0)
+		{
+			Codec = FFlutterCompression::Detect(Chunk);
+			if (Codec != EFlutterCompressionCodec::None)
+			{
+				Decompressor = MakeUnique<FFlutterStreamingDecompressor>(Codec, MaxDecompressedSize);
+			}
+		}
+
+		if (Decompressor && !Decompressor->Update(Chunk))
+		{
+			Decompressor.Reset();
+			bDecompressionError = true;
+		}
+
+		NextChecksumChunk++;
+	}
+
+	// Swap in the decompressed payload; the compressed buffer is released here
+	if (NextChecksumChunk == TotalChunks && Decompressor)
+	{
+		if (Decompressor->Finish())
+		{
+			Buffer = Decompressor->TakeOutput();
+		}
+		else
+		{
+			bDecompressionError = true;
+		}
+		Decompressor.Reset();
+	}
+}
+
+TArray<int32> FFlutterChunkedTransfer::GetMissingChunks() const
+{
+	TArray<int32> Missing;
+	Missing.Reserve(TotalChunks - ReceivedChunks);
+	for (int32 Index = 0; Index < Received.Num(); ++Index)
+	{
+		if (!Received[Index])
+		{
+			Missing.Add(Index);
+		}
+	}
+	return Missing;
+}
+
+bool FFlutterChunkedTransfer::VerifyChecksum() const
+{
+	// Once every chunk is contiguous the running value covers the transferred bytes, even after decompression
+	const uint32 Checksum = NextChecksumChunk == TotalChunks
+		? RunningChecksum.GetValue()
+		: FFlutterCrc32::Calculate(Buffer);
+
+	return Checksum == (uint32)ExpectedChecksum;
+}
+
+// ============================================================
+// MARK: - FFlutterOutgoingTransfer
+// ============================================================
+
+FFlutterOutgoingTransfer::FFlutterOutgoingTransfer(const FString& InTransferId, const FString& InTarget, const FString& InMethod, TArray<uint8>&& InData, int32 InChunkSize)
+	: TransferId(InTransferId)
+	, Target(InTarget)
+	, Method(InMethod)
+	, Data(MoveTemp(InData))
+	, ChunkSize(FMath::Max(InChunkSize, 1))
+	, SentChunks(0)
+{
+	TotalChunks = (int32)(((int64)Data.Num() + ChunkSize - 1) / ChunkSize);
+	Checksum = (int32)FFlutterCrc32::Calculate(Data);
+}
+
+TConstArrayView<uint8> FFlutterOutgoingTransfer::NextChunk(int32& OutChunkIndex)
+{
+	check(!IsComplete());
+
+	OutChunkIndex = SentChunks++;
+	const int64 Start = (int64)OutChunkIndex * ChunkSize;
+	return TConstArrayView<uint8>(Data.GetData() + Start, (int32)FMath::Min<int64>(ChunkSize, Data.Num() - Start));
+}
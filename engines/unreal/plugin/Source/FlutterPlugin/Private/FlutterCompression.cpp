@@ -0,0 +1,401 @@
+// Copyright Epic Games, Inc. All Rights Reserved.
+
+#include "FlutterCompression.h"
+#include "Misc/Compression.h"
+
+THIRD_PARTY_INCLUDES_START
+#include "zlib.h"
+THIRD_PARTY_INCLUDES_END
+
+namespace FlutterCompression
+{
+	static constexpr uint8 GzipMagic0 = 0x1F;
+	static constexpr uint8 GzipMagic1 = 0x8B;
+	static constexpr uint8 EnvelopeMagic0 = 'F';
+	static constexpr uint8 EnvelopeMagic1 = 'C';
+
+	/** Minimum growth step for inflate output */
+	static constexpr int32 MinOutputGrowth = 64 * 1024;
+
+	/** Deflate never expands more than this, which bounds sizes claimed by a stream */
+	static constexpr int64 MaxDeflateRatio = 1032;
+
+	static int32 WindowBits(EFlutterCompressionCodec Codec)
+	{
+		// +16 selects the GZip wrapper instead of the zlib one
+		return Codec == EFlutterCompressionCodec::Gzip ? MAX_WBITS + 16 : MAX_WBITS;
+	}
+
+	static void WriteEnvelope(uint8* Header, EFlutterCompressionCodec Codec, uint32 UncompressedSize)
+	{
+		Header[0] = EnvelopeMagic0;
+		Header[1] = EnvelopeMagic1;
+		Header[2] = (uint8)Codec;
+		Header[3] = 0;
+		Header[4] = (uint8)(UncompressedSize);
+		Header[5] = (uint8)(UncompressedSize >> 8);
+		Header[6] = (uint8)(UncompressedSize >> 16);
+		Header[7] = (uint8)(UncompressedSize >> 24);
+	}
+
+	static uint32 ReadUInt32(const uint8* Bytes)
+	{
+		return (uint32)Bytes[0] | ((uint32)Bytes[1] << 8) | ((uint32)Bytes[2] << 16) | ((uint32)Bytes[3] << 24);
+	}
+
+	static bool Deflate(EFlutterCompressionCodec Codec, TConstArrayView<uint8> Data, TArray<uint8>& OutCompressed, int32 Offset)
+	{
+		z_stream Stream;
+		FMemory::Memzero(Stream);
+		if (deflateInit2(&Stream, Z_DEFAULT_COMPRESSION, Z_DEFLATED, WindowBits(Codec), 8, Z_DEFAULT_STRATEGY) != Z_OK)
+		{
+			return false;
+		}
+
+		const uLong Bound = deflateBound(&Stream, (uLong)Data.Num());
+		OutCompressed.SetNumUninitialized(Offset + (int32)Bound);
+
+		Stream.next_in = const_cast<Bytef*>(Data.GetData());
+		Stream.avail_in = (uInt)Data.Num();
+		Stream.next_out = OutCompressed.GetData() + Offset;
+		Stream.avail_out = (uInt)Bound;
+
+		const int Result = deflate(&Stream, Z_FINISH);
+		const int64 Written = (int64)Bound - Stream.avail_out;
+		deflateEnd(&Stream);
+
+		if (Result != Z_STREAM_END)
+		{
+			return false;
+		}
+
+		OutCompressed.SetNum(Offset + (int32)Written);
+		return true;
+	}
+}
+
+// ============================================================
+// MARK: - FFlutterCompression
+// ============================================================
+
+bool FFlutterCompression::Compress(EFlutterCompressionCodec Codec, TConstArrayView<uint8> Data, TArray<uint8>& OutCompressed)
+{
+	using namespace FlutterCompression;
+
+	OutCompressed.Reset();
+
+	bool bCompressed = false;
+	switch (Codec)
+	{
+	case EFlutterCompressionCodec::None:
+		return false;
+
+	case EFlutterCompressionCodec::Gzip:
+		bCompressed = Deflate(Codec, Data, OutCompressed, 0);
+		break;
+
+	case EFlutterCompressionCodec::Zlib:
+		bCompressed = Deflate(Codec, Data, OutCompressed, EnvelopeHeaderSize);
+		break;
+
+	case EFlutterCompressionCodec::LZ4:
+	{
+		int32 CompressedSize = FCompression::CompressMemoryBound(NAME_LZ4, Data.Num());
+		OutCompressed.SetNumUninitialized(EnvelopeHeaderSize + CompressedSize);
+		bCompressed = FCompression::CompressMemory(NAME_LZ4, OutCompressed.GetData() + EnvelopeHeaderSize, CompressedSize, Data.GetData(), Data.Num());
+		if (bCompressed)
+		{
+			OutCompressed.SetNum(EnvelopeHeaderSize + CompressedSize);
+		}
+		break;
+	}
+	}
+
+	if (Codec != EFlutterCompressionCodec::Gzip && bCompressed)
+	{
+		WriteEnvelope(OutCompressed.GetData(), Codec, (uint32)Data.Num());
+	}
+
+	// Incompressible data goes out raw
+	if (!bCompressed || OutCompressed.Num() >= Data.Num())
+	{
+		OutCompressed.Reset();
+		return false;
+	}
+	return true;
+}
+
+EFlutterCompressionCodec FFlutterCompression::Detect(TConstArrayView<uint8> Data)
+{
+	using namespace FlutterCompression;
+
+	if (Data.Num() >= 2 && Data[0] == GzipMagic0 && Data[1] == GzipMagic1)
+	{
+		return EFlutterCompressionCodec::Gzip;
+	}
+
+	if (Data.Num() >= EnvelopeHeaderSize && Data[0] == EnvelopeMagic0 && Data[1] == EnvelopeMagic1 && Data[3] == 0)
+	{
+		const EFlutterCompressionCodec Codec = (EFlutterCompressionCodec)Data[2];
+		if (Codec == EFlutterCompressionCodec::Zlib || Codec == EFlutterCompressionCodec::LZ4)
+		{
+			return Codec;
+		}
+	}
+
+	return EFlutterCompressionCodec::None;
+}
+
+bool FFlutterCompression::Decompress(TConstArrayView<uint8> Data, TArray<uint8>& OutDecompressed, int64 MaxDecompressedSize)
+{
+	using namespace FlutterCompression;
+
+	OutDecompressed.Reset();
+
+	const EFlutterCompressionCodec Codec = Detect(Data);
+	if (Codec == EFlutterCompressionCodec::None)
+	{
+		return false;
+	}
+
+	FFlutterStreamingDecompressor Decompressor(Codec, MaxDecompressedSize);
+
+	// The GZip trailer ends with the uncompressed size modulo 2^32
+	if (Codec == EFlutterCompressionCodec::Gzip && Data.Num() >= 18)
+	{
+		Decompressor.ReserveOutput(FMath::Min3<int64>(ReadUInt32(Data.GetData() + Data.Num() - 4), Data.Num() * MaxDeflateRatio, MaxDecompressedSize));
+	}
+
+	if (!Decompressor.Update(Data) || !Decompressor.Finish())
+	{
+		return false;
+	}
+
+	OutDecompressed = Decompressor.TakeOutput();
+	return true;
+}
+
+// ============================================================
+// MARK: - FFlutterStreamingDecompressor
+// ============================================================
+
+struct FFlutterStreamingDecompressor::FZStream
+{
+	z_stream Stream;
+};
+
+FFlutterStreamingDecompressor::FFlutterStreamingDecompressor(EFlutterCompressionCodec InCodec, int64 InMaxOutputSize)
+	: Codec(InCodec)
+	, MaxOutputSize(FMath::Clamp<int64>(InMaxOutputSize, 0, MAX_int32))
+	, EnvelopeBytes(0)
+	, UncompressedSize(0)
+	, Produced(0)
+	, bFinished(false)
+	, bError(false)
+{
+	using namespace FlutterCompression;
+
+	switch (Codec)
+	{
+	case EFlutterCompressionCodec::Gzip:
+	case EFlutterCompressionCodec::Zlib:
+		Stream = MakeUnique<FZStream>();
+		FMemory::Memzero(Stream->Stream);
+		if (inflateInit2(&Stream->Stream, WindowBits(Codec)) != Z_OK)
+		{
+			Stream.Reset();
+			bError = true;
+		}
+		break;
+
+	case EFlutterCompressionCodec::LZ4:
+		break;
+
+	case EFlutterCompressionCodec::None:
+		bError = true;
+		break;
+	}
+
+	// GZip carries its own header
+	if (Codec == EFlutterCompressionCodec::Gzip)
+	{
+		EnvelopeBytes = FFlutterCompression::EnvelopeHeaderSize;
+	}
+}
+
+FFlutterStreamingDecompressor::~FFlutterStreamingDecompressor()
+{
+	if (Stream)
+	{
+		inflateEnd(&Stream->Stream);
+	}
+}
+
+void FFlutterStreamingDecompressor::ReserveOutput(int64 NumBytes)
+{
+	if (NumBytes > 0 && NumBytes < MAX_int32)
+	{
+		Output.Reserve((int32)NumBytes);
+	}
+}
+
+bool FFlutterStreamingDecompressor::Update(TConstArrayView<uint8> Input)
+{
+	if (bError)
+	{
+		return false;
+	}
+
+	if (!ConsumeEnvelope(Input))
+	{
+		return !bError;
+	}
+
+	if (Input.Num() == 0)
+	{
+		return true;
+	}
+
+	// Trailing data after the end of the stream is malformed
+	if (bFinished)
+	{
+		bError = true;
+		return false;
+	}
+
+	if (Codec == EFlutterCompressionCodec::LZ4)
+	{
+		Pending.Append(Input.GetData(), Input.Num());
+		return true;
+	}
+
+	return Inflate(Input);
+}
+
+bool FFlutterStreamingDecompressor::ConsumeEnvelope(TConstArrayView<uint8>& Input)
+{
+	using namespace FlutterCompression;
+
+	const int32 HeaderSize = FFlutterCompression::EnvelopeHeaderSize;
+	if (EnvelopeBytes == HeaderSize)
+	{
+		return true;
+	}
+
+	const int32 Needed = FMath::Min(HeaderSize - EnvelopeBytes, Input.Num());
+	FMemory::Memcpy(Envelope + EnvelopeBytes, Input.GetData(), Needed);
+	EnvelopeBytes += Needed;
+	Input.RightChopInline(Needed);
+
+	if (EnvelopeBytes < HeaderSize)
+	{
+		return false;
+	}
+
+	if (FFlutterCompression::Detect(TConstArrayView<uint8>(Envelope, HeaderSize)) != Codec)
+	{
+		bError = true;
+		return false;
+	}
+
+	UncompressedSize = ReadUInt32(Envelope + 4);
+	if (UncompressedSize > MaxOutputSize)
+	{
+		bError = true;
+		return false;
+	}
+
+	// The stream may not produce more than the envelope says it holds
+	MaxOutputSize = UncompressedSize;
+	ReserveOutput(UncompressedSize);
+	return true;
+}
+
+bool FFlutterStreamingDecompressor::Inflate(TConstArrayView<uint8> Input)
+{
+	using namespace FlutterCompression;
+
+	z_stream& Z = Stream->Stream;
+	Z.next_in = const_cast<Bytef*>(Input.GetData());
+	Z.avail_in = (uInt)Input.Num();
+
+	for (;;)
+	{
+		// Grow into reserved capacity first, then geometrically, never past the limit
+		if (Produced == Output.Num() && Output.Num() < MaxOutputSize)
+		{
+			const int32 Slack = Output.Max() - Output.Num();
+			const int64 Growth = Slack > 0 ? Slack : FMath::Max(MinOutputGrowth, Output.Num());
+			Output.AddUninitialized((int32)FMath::Min<int64>(Growth, MaxOutputSize - Output.Num()));
+		}
+
+		const uInt Available = (uInt)(Output.Num() - Produced);
+		Z.next_out = Output.GetData() + Produced;
+		Z.avail_out = Available;
+
+		const int Result = inflate(&Z, Z_NO_FLUSH);
+		Produced += Available - Z.avail_out;
+
+		if (Result == Z_STREAM_END)
+		{
+			bFinished = true;
+			bError = Z.avail_in > 0;
+			break;
+		}
+
+		// Out of input: wait for the next piece
+		if (Result == Z_BUF_ERROR && Z.avail_in == 0)
+		{
+			break;
+		}
+
+		// Input left but no room below the limit: the stream is larger than allowed
+		if (Result == Z_BUF_ERROR && Z.avail_out == 0 && Produced >= MaxOutputSize)
+		{
+			bError = true;
+			break;
+		}
+
+		if (Result != Z_OK)
+		{
+			bError = true;
+			break;
+		}
+
+		// A full output buffer may hide pending output, so only stop once there was room to spare
+		if (Z.avail_in == 0 && Z.avail_out > 0)
+		{
+			break;
+		}
+	}
+
+	return !bError;
+}
+
+bool FFlutterStreamingDecompressor::Finish()
+{
+	if (bError || EnvelopeBytes < FFlutterCompression::EnvelopeHeaderSize)
+	{
+		return false;
+	}
+
+	if (Codec == EFlutterCompressionCodec::LZ4)
+	{
+		// LZ4 expands at most ~255:1, which bounds the size an envelope may claim
+		if (UncompressedSize > (uint32)MAX_int32 || UncompressedSize > (uint64)Pending.Num() * 255)
+		{
+			bError = true;
+			return false;
+		}
+
+		Output.SetNumUninitialized((int32)UncompressedSize);
+		bFinished = FCompression::UncompressMemory(NAME_LZ4, Output.GetData(), (int32)UncompressedSize, Pending.GetData(), Pending.Num());
+		Pending.Empty();
+		Produced = bFinished ? UncompressedSize : 0;
+	}
+
+	// A zlib stream that did not reach its end marker is truncated
+	bError = !bFinished || (Codec != EFlutterCompressionCodec::Gzip && Produced != UncompressedSize);
+	Output.SetNum(bError ? 0 : (int32)Produced);
+	return !bError;
+}
@@ -0,0 +1,135 @@
+// Copyright Epic Games, Inc. All Rights Reserved.
+
+#include "FlutterMessageBatch.h"
+
+const TCHAR* FFlutterMessageBatch::Target = TEXT("_batch");
+const TCHAR* FFlutterMessageBatch::Method = TEXT("onBatch");
+
+namespace FlutterMessageBatch
+{
+	static const uint8 Magic0 = 'F';
+	static const uint8 Magic1 = 'B';
+
+	static uint32 ReadUInt32(const uint8* Data)
+	{
+		return (uint32)Data[0] | ((uint32)Data[1] << 8) | ((uint32)Data[2] << 16) | ((uint32)Data[3] << 24);
+	}
+
+	static bool ReadString(const TArray<uint8>& Frame, int32& Offset, FString& OutString)
+	{
+		if (Offset + 4 > Frame.Num())
+		{
+			return false;
+		}
+
+		const uint32 Length = ReadUInt32(Frame.GetData() + Offset);
+		Offset += 4;
+
+		if (Length > (uint32)(Frame.Num() - Offset))
+		{
+			return false;
+		}
+
+		const FUTF8ToTCHAR Converter(reinterpret_cast<const ANSICHAR*>(Frame.GetData() + Offset), Length);
+		OutString = FString(Converter.Length(), Converter.Get());
+		Offset += Length;
+		return true;
+	}
+}
+
+// ============================================================
+// MARK: - Decoding
+// ============================================================
+
+bool FFlutterMessageBatch::IsBatchFrame(const TArray<uint8>& Frame)
+{
+	using namespace FlutterMessageBatch;
+
+	return Frame.Num() >= HeaderSize
+		&& Frame[0] == Magic0
+		&& Frame[1] == Magic1
+		&& Frame[2] == Version;
+}
+
+bool FFlutterMessageBatch::Decode(const TArray<uint8>& Frame, TFunctionRef<void(FString&&, FString&&, FString&&)> Visitor)
+{
+	using namespace FlutterMessageBatch;
+
+	if (!IsBatchFrame(Frame))
+	{
+		return false;
+	}
+
+	const uint32 Count = ReadUInt32(Frame.GetData() + 4);
+	int32 Offset = HeaderSize;
+
+	for (uint32 Index = 0; Index < Count; ++Index)
+	{
+		FString MessageTarget;
+		FString MessageMethod;
+		FString MessageData;
+
+		if (!ReadString(Frame, Offset, MessageTarget)
+			|| !ReadString(Frame, Offset, MessageMethod)
+			|| !ReadString(Frame, Offset, MessageData))
+		{
+			UE_LOG(LogTemp, Warning, TEXT("[FlutterBatch] Truncated batch frame at message %u of %u"), Index, Count);
+			return false;
+		}
+
+		Visitor(MoveTemp(MessageTarget), MoveTemp(MessageMethod), MoveTemp(MessageData));
+	}
+
+	return true;
+}
+
+// ============================================================
+// MARK: - Writer
+// ============================================================
+
+FFlutterMessageBatchWriter::FFlutterMessageBatchWriter()
+	: Count(0)
+{
+	Reset();
+}
+
+void FFlutterMessageBatchWriter::Reset()
+{
+	Buffer.Reset();
+	Buffer.Add(FlutterMessageBatch::Magic0);
+	Buffer.Add(FlutterMessageBatch::Magic1);
+	Buffer.Add(FFlutterMessageBatch::Version);
+	Buffer.Add(0);
+	AppendUInt32(0);
+	Count = 0;
+}
+
+void FFlutterMessageBatchWriter::Add(const FString& Target, const FString& Method, const FString& Data)
+{
+	AppendString(Target);
+	AppendString(Method);
+	AppendString(Data);
+
+	// Keep the header count current so GetFrame() is always sendable
+	Count++;
+	Buffer[4] = (uint8)(Count & 0xFF);
+	Buffer[5] = (uint8)((Count >> 8) & 0xFF);
+	Buffer[6] = (uint8)((Count >> 16) & 0xFF);
+	Buffer[7] = (uint8)((Count >> 24) & 0xFF);
+}
+
+void FFlutterMessageBatchWriter::AppendString(const FString& String)
+{
+	const FTCHARToUTF8 Converter(*String, String.Len());
+	AppendUInt32((uint32)Converter.Length());
+	Buffer.Append(reinterpret_cast<const uint8*>(Converter.Get()), Converter.Length());
+}
+
+void FFlutterMessageBatchWriter::AppendUInt32(uint32 Value)
+{
+	const int32 Offset = Buffer.AddUninitialized(4);
+	Buffer[Offset] = (uint8)(Value & 0xFF);
+	Buffer[Offset + 1] = (uint8)((Value >> 8) & 0xFF);
+	Buffer[Offset + 2] = (uint8)((Value >> 16) & 0xFF);
+	Buffer[Offset + 3] = (uint8)((Value >> 24) & 0xFF);
+}
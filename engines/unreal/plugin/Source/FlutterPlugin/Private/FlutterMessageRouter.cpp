@@ -8,7 +8,11 @@
 UFlutterMessageRouter* UFlutterMessageRouter::Instance = nullptr;
 
 UFlutterMessageRouter::UFlutterMessageRouter()
-	: bQueueUnknownTargets(true)
+	: NumRegisteredTargets(0)
+	, NumCachedDelegates(0)
+	, QueueHead(0)
+	, QueueCount(0)
+	, bQueueUnknownTargets(true)
 	, MaxQueueSize(1000)
 {
 }
@@ -40,97 +44,82 @@ void UFlutterMessageRouter::RegisterTarget(const FString& Name, UObject* Target,
 		return;
 	}
 
+	const FName TargetName(*Name);
+	FFlutterTargetRoutes& Entry = Routes.FindOrAdd(TargetName);
+
 	// Check if singleton already registered
-	if (bIsSingleton && Targets.Contains(Name))
+	if (bIsSingleton && Entry.bIsRegistered)
 	{
 		UE_LOG(LogTemp, Warning, TEXT("[FlutterRouter] Singleton target already registered: %s"), *Name);
 		return;
 	}
 
-	Targets.Add(Name, Target);
-	SingletonFlags.Add(Name, bIsSingleton);
+	if (!Entry.bIsRegistered)
+	{
+		NumRegisteredTargets++;
+	}
+
+	Entry.Object = Target;
+	Entry.bIsRegistered = true;
+	Entry.bIsSingleton = bIsSingleton;
 
 	UE_LOG(LogTemp, Log, TEXT("[FlutterRouter] Registered target: %s (Singleton=%d)"), *Name, bIsSingleton);
 
 	// Update statistics
-	Statistics.RegisteredTargets = Targets.Num();
+	UpdateRegistrationStatistics();
 
-	// Flush any queued messages for this target
-	FlushQueue();
+	// Deliver any messages that arrived before this target
+	FlushQueueForTarget(Name);
 }
 
 void UFlutterMessageRouter::UnregisterTarget(const FString& Name)
 {
-	if (Targets.Remove(Name) > 0)
-	{
-		SingletonFlags.Remove(Name);
-
-		// Remove cached delegates for this target
-		TArray<FString> KeysToRemove;
-		for (const auto& Pair : CachedDelegates)
-		{
-			if (Pair.Key.StartsWith(Name + TEXT(":")))
-			{
-				KeysToRemove.Add(Pair.Key);
-			}
-		}
+	const FName TargetName(*Name, FNAME_Find);
 
-		for (const FString& Key : KeysToRemove)
-		{
-			CachedDelegates.Remove(Key);
-		}
-
-		// Same for binary delegates
-		KeysToRemove.Empty();
-		for (const auto& Pair : CachedBinaryDelegates)
-		{
-			if (Pair.Key.StartsWith(Name + TEXT(":")))
-			{
-				KeysToRemove.Add(Pair.Key);
-			}
-		}
-
-		for (const FString& Key : KeysToRemove)
-		{
-			CachedBinaryDelegates.Remove(Key);
-		}
+	const FFlutterTargetRoutes* Entry = Routes.Find(TargetName);
+	if (Entry && Entry->bIsRegistered)
+	{
+		// Dropping the entry removes every cached delegate of this target with it
+		NumRegisteredTargets--;
+		NumCachedDelegates -= Entry->NumDelegates();
+		Routes.Remove(TargetName);
 
 		UE_LOG(LogTemp, Log, TEXT("[FlutterRouter] Unregistered target: %s"), *Name);
 
 		// Update statistics
-		Statistics.RegisteredTargets = Targets.Num();
-		Statistics.CachedDelegates = CachedDelegates.Num() + CachedBinaryDelegates.Num();
+		UpdateRegistrationStatistics();
 	}
 }
 
 bool UFlutterMessageRouter::IsTargetRegistered(const FString& Name) const
 {
-	return Targets.Contains(Name);
+	return IsTargetRegistered(FName(*Name, FNAME_Find));
+}
+
+bool UFlutterMessageRouter::IsTargetRegistered(FName Target) const
+{
+	const FFlutterTargetRoutes* Entry = Routes.Find(Target);
+	return Entry && Entry->bIsRegistered;
 }
 
 TArray<FFlutterTargetInfo> UFlutterMessageRouter::GetRegisteredTargets() const
 {
 	TArray<FFlutterTargetInfo> Result;
+	Result.Reserve(NumRegisteredTargets);
 
-	for (const auto& Pair : Targets)
+	for (const auto& Pair : Routes)
 	{
-		FFlutterTargetInfo Info;
-		Info.TargetName = Pair.Key;
-		Info.TargetObject = Pair.Value;
-		Info.bIsSingleton = SingletonFlags.Contains(Pair.Key) ? SingletonFlags[Pair.Key] : false;
-
-		// Count registered methods
-		int32 MethodCount = 0;
-		for (const auto& DelegatePair : CachedDelegates)
+		const FFlutterTargetRoutes& Entry = Pair.Value;
+		if (!Entry.bIsRegistered)
 		{
-			if (DelegatePair.Key.StartsWith(Pair.Key + TEXT(":")))
-			{
-				MethodCount++;
-			}
+			continue;
 		}
-		Info.RegisteredMethods = MethodCount;
 
-		Result.Add(Info);
+		FFlutterTargetInfo& Info = Result.AddDefaulted_GetRef();
+		Info.TargetName = Pair.Key.ToString();
+		Info.TargetObject = Entry.Object;
+		Info.bIsSingleton = Entry.bIsSingleton;
+		Info.RegisteredMethods = Entry.Methods.Num();
 	}
 
 	return Result;
@@ -142,31 +131,68 @@ TArray<FFlutterTargetInfo> UFlutterMessageRouter::GetRegisteredTargets() const
 
 void UFlutterMessageRouter::RegisterMethod(const FString& TargetName, const FString& MethodName, FFlutterMethodDelegate Delegate)
 {
-	FString CacheKey = GetCacheKey(TargetName, MethodName);
-	CachedDelegates.Add(CacheKey, Delegate);
+	FFlutterTargetRoutes& Entry = Routes.FindOrAdd(FName(*TargetName));
+	const int32 PreviousCount = Entry.Methods.Num();
+
+	TFlutterMethodRoute<FFlutterMethodDelegate>& Route = Entry.Methods.FindOrAdd(FName(*MethodName));
+	Route.MethodName = MethodName;
+	Route.Delegate = Delegate;
 
-	UE_LOG(LogTemp, Log, TEXT("[FlutterRouter] Registered method: %s"), *CacheKey);
+	NumCachedDelegates += Entry.Methods.Num() - PreviousCount;
 
-	Statistics.CachedDelegates = CachedDelegates.Num() + CachedBinaryDelegates.Num();
+	UE_LOG(LogTemp, Verbose, TEXT("[FlutterRouter] Registered method: %s:%s"), *TargetName, *MethodName);
+
+	UpdateRegistrationStatistics();
 }
 
 void UFlutterMessageRouter::RegisterBinaryMethod(const FString& TargetName, const FString& MethodName, FFlutterBinaryMethodDelegate Delegate)
 {
-	FString CacheKey = GetCacheKey(TargetName, MethodName);
-	CachedBinaryDelegates.Add(CacheKey, Delegate);
+	FFlutterTargetRoutes& Entry = Routes.FindOrAdd(FName(*TargetName));
+	const int32 PreviousCount = Entry.BinaryMethods.Num();
+
+	TFlutterMethodRoute<FFlutterBinaryMethodDelegate>& Route = Entry.BinaryMethods.FindOrAdd(FName(*MethodName));
+	Route.MethodName = MethodName;
+	Route.Delegate = Delegate;
+
+	NumCachedDelegates += Entry.BinaryMethods.Num() - PreviousCount;
+
+	UE_LOG(LogTemp, Verbose, TEXT("[FlutterRouter] Registered binary method: %s:%s"), *TargetName, *MethodName);
+
+	UpdateRegistrationStatistics();
+}
+
+void UFlutterMessageRouter::RegisterTypedMethod(const FString& TargetName, const FString& MethodName, FFlutterTypedMethodDelegate Delegate)
+{
+	FFlutterTargetRoutes& Entry = Routes.FindOrAdd(FName(*TargetName));
+	const int32 PreviousCount = Entry.TypedMethods.Num();
+
+	TFlutterMethodRoute<FFlutterTypedMethodDelegate>& Route = Entry.TypedMethods.FindOrAdd(FName(*MethodName));
+	Route.MethodName = MethodName;
+	Route.Delegate = MoveTemp(Delegate);
 
-	UE_LOG(LogTemp, Log, TEXT("[FlutterRouter] Registered binary method: %s"), *CacheKey);
+	NumCachedDelegates += Entry.TypedMethods.Num() - PreviousCount;
 
-	Statistics.CachedDelegates = CachedDelegates.Num() + CachedBinaryDelegates.Num();
+	UE_LOG(LogTemp, Verbose, TEXT("[FlutterRouter] Registered typed method: %s:%s"), *TargetName, *MethodName);
+
+	UpdateRegistrationStatistics();
 }
 
 void UFlutterMessageRouter::UnregisterMethod(const FString& TargetName, const FString& MethodName)
 {
-	FString CacheKey = GetCacheKey(TargetName, MethodName);
-	CachedDelegates.Remove(CacheKey);
-	CachedBinaryDelegates.Remove(CacheKey);
+	const FFlutterRouteHandle Handle = FindRoute(TargetName, MethodName);
+
+	FFlutterTargetRoutes* Entry = Routes.Find(Handle.Target);
+	if (!Entry)
+	{
+		return;
+	}
 
-	Statistics.CachedDelegates = CachedDelegates.Num() + CachedBinaryDelegates.Num();
+	NumCachedDelegates -= Entry->Methods.Remove(Handle.Method);
+	NumCachedDelegates -= Entry->BinaryMethods.Remove(Handle.Method);
+	NumCachedDelegates -= Entry->TypedMethods.Remove(Handle.Method);
+	RemoveTargetIfEmpty(Handle.Target);
+
+	UpdateRegistrationStatistics();
 }
 
 // ============================================================
@@ -175,17 +201,17 @@ void UFlutterMessageRouter::UnregisterMethod(const FString& TargetName, const FS
 
 bool UFlutterMessageRouter::RouteMessage(const FString& Target, const FString& Method, const FString& Data)
 {
-	FString CacheKey = GetCacheKey(Target, Method);
+	const FFlutterRouteHandle Handle = FindRoute(Target, Method);
 
 	// Try cached delegate first (zero-reflection fast path)
-	if (TryRouteCached(CacheKey, Method, Data))
+	if (TryRouteCached(Handle, Data))
 	{
 		Statistics.MessagesRouted++;
 		return true;
 	}
 
 	// Check if target is registered but method is not
-	if (Targets.Contains(Target))
+	if (IsTargetRegistered(Handle.Target))
 	{
 		UE_LOG(LogTemp, Warning, TEXT("[FlutterRouter] No handler for method: %s on target: %s"), *Method, *Target);
 		Statistics.MessagesDropped++;
@@ -206,17 +232,17 @@ bool UFlutterMessageRouter::RouteMessage(const FString& Target, const FString& M
 
 bool UFlutterMessageRouter::RouteBinaryMessage(const FString& Target, const FString& Method, const TArray<uint8>& Data)
 {
-	FString CacheKey = GetCacheKey(Target, Method);
+	const FFlutterRouteHandle Handle = FindRoute(Target, Method);
 
 	// Try cached delegate first
-	if (TryRouteBinaryCached(CacheKey, Method, Data))
+	if (TryRouteBinaryCached(Handle, Data))
 	{
 		Statistics.MessagesRouted++;
 		return true;
 	}
 
 	// Check if target is registered but method is not
-	if (Targets.Contains(Target))
+	if (IsTargetRegistered(Handle.Target))
 	{
 		UE_LOG(LogTemp, Warning, TEXT("[FlutterRouter] No binary handler for method: %s on target: %s"), *Method, *Target);
 		Statistics.MessagesDropped++;
@@ -232,16 +258,7 @@ bool UFlutterMessageRouter::RouteBinaryMessage(const FString& Target, const FStr
 		QueuedMsg.bIsBinary = true;
 		QueuedMsg.BinaryData = Data;
 
-		if (MessageQueue.Num() < MaxQueueSize)
-		{
-			MessageQueue.Add(QueuedMsg);
-			Statistics.QueuedMessages = MessageQueue.Num();
-		}
-		else
-		{
-			UE_LOG(LogTemp, Warning, TEXT("[FlutterRouter] Message queue full, dropping message"));
-			Statistics.MessagesDropped++;
-		}
+		EnqueueMessage(MoveTemp(QueuedMsg));
 		return true;
 	}
 
@@ -250,23 +267,67 @@ bool UFlutterMessageRouter::RouteBinaryMessage(const FString& Target, const FStr
 	return false;
 }
 
-bool UFlutterMessageRouter::TryRouteCached(const FString& CacheKey, const FString& Method, const FString& Data)
+FFlutterRouteHandle UFlutterMessageRouter::ResolveRoute(const FString& Target, const FString& Method) const
 {
-	FFlutterMethodDelegate* Delegate = CachedDelegates.Find(CacheKey);
-	if (Delegate && Delegate->IsBound())
+	return FFlutterRouteHandle(FName(*Target), FName(*Method));
+}
+
+bool UFlutterMessageRouter::RouteMessageWithHandle(const FFlutterRouteHandle& Handle, const FString& Data)
+{
+	if (TryRouteCached(Handle, Data))
 	{
-		Delegate->Execute(Method, Data);
+		Statistics.MessagesRouted++;
+		return true;
+	}
+
+	// Slow path (missing handler, queuing) needs the names as strings
+	return RouteMessage(Handle.Target.ToString(), Handle.Method.ToString(), Data);
+}
+
+bool UFlutterMessageRouter::RouteBinaryMessageWithHandle(const FFlutterRouteHandle& Handle, const TArray<uint8>& Data)
+{
+	if (TryRouteBinaryCached(Handle, Data))
+	{
+		Statistics.MessagesRouted++;
+		return true;
+	}
+
+	return RouteBinaryMessage(Handle.Target.ToString(), Handle.Method.ToString(), Data);
+}
+
+bool UFlutterMessageRouter::TryRouteCached(const FFlutterRouteHandle& Handle, const FString& Data)
+{
+	FFlutterTargetRoutes* Entry = Routes.Find(Handle.Target);
+	TFlutterMethodRoute<FFlutterMethodDelegate>* Route = Entry ? Entry->Methods.Find(Handle.Method) : nullptr;
+	if (Route && Route->Delegate.IsBound())
+	{
+		Route->Delegate.Execute(Route->MethodName, Data);
 		return true;
 	}
 	return false;
 }
 
-bool UFlutterMessageRouter::TryRouteBinaryCached(const FString& CacheKey, const FString& Method, const TArray<uint8>& Data)
+bool UFlutterMessageRouter::TryRouteBinaryCached(const FFlutterRouteHandle& Handle, const TArray<uint8>& Data)
 {
-	FFlutterBinaryMethodDelegate* Delegate = CachedBinaryDelegates.Find(CacheKey);
-	if (Delegate && Delegate->IsBound())
+	FFlutterTargetRoutes* Entry = Routes.Find(Handle.Target);
+	if (!Entry)
 	{
-		Delegate->Execute(Method, Data);
+		return false;
+	}
+
+	TFlutterMethodRoute<FFlutterBinaryMethodDelegate>* Route = Entry->BinaryMethods.Find(Handle.Method);
+	if (Route && Route->Delegate.IsBound())
+	{
+		Route->Delegate.Execute(Route->MethodName, Data);
+		return true;
+	}
+
+	// Typed handlers decode the payload in place
+	TFlutterMethodRoute<FFlutterTypedMethodDelegate>* TypedRoute = Entry->TypedMethods.Find(Handle.Method);
+	if (TypedRoute && TypedRoute->Delegate.IsBound())
+	{
+		FFlutterStandardReader Reader(Data);
+		TypedRoute->Delegate.Execute(TypedRoute->MethodName, Reader);
 		return true;
 	}
 	return false;
@@ -278,78 +339,148 @@ bool UFlutterMessageRouter::TryRouteBinaryCached(const FString& CacheKey, const
 
 void UFlutterMessageRouter::QueueMessage(const FString& Target, const FString& Method, const FString& Data)
 {
-	if (MessageQueue.Num() >= MaxQueueSize)
-	{
-		UE_LOG(LogTemp, Warning, TEXT("[FlutterRouter] Message queue full, dropping oldest message"));
-		MessageQueue.RemoveAt(0);
-	}
-
 	FQueuedFlutterMessage QueuedMsg;
 	QueuedMsg.Target = Target;
 	QueuedMsg.Method = Method;
 	QueuedMsg.Data = Data;
 	QueuedMsg.bIsBinary = false;
 
-	MessageQueue.Add(QueuedMsg);
-	Statistics.QueuedMessages = MessageQueue.Num();
+	EnqueueMessage(MoveTemp(QueuedMsg));
 
 	UE_LOG(LogTemp, Verbose, TEXT("[FlutterRouter] Queued message for target: %s"), *Target);
 }
 
-void UFlutterMessageRouter::FlushQueue()
+void UFlutterMessageRouter::EnqueueMessage(FQueuedFlutterMessage&& Message)
 {
+	// Slots are allocated once and reused; the ring never shifts entries
 	if (MessageQueue.Num() == 0)
+	{
+		MessageQueue.SetNum(MaxQueueSize);
+	}
+
+	if (QueueCount == MaxQueueSize)
+	{
+		UE_LOG(LogTemp, Warning, TEXT("[FlutterRouter] Message queue full, dropping oldest message"));
+
+		// Overwrite the oldest slot in place
+		ReleaseQueuedSlot(MessageQueue[QueueHead].Target);
+		QueueHead = (QueueHead + 1) % MaxQueueSize;
+		QueueCount--;
+		Statistics.MessagesDropped++;
+	}
+
+	QueuedPerTarget.FindOrAdd(Message.Target)++;
+
+	const int32 Tail = (QueueHead + QueueCount) % MaxQueueSize;
+	MessageQueue[Tail] = MoveTemp(Message);
+	QueueCount++;
+
+	Statistics.QueuedMessages = QueueCount;
+}
+
+void UFlutterMessageRouter::FlushQueue()
+{
+	if (QueueCount == 0)
 	{
 		return;
 	}
 
-	TArray<FQueuedFlutterMessage> MessagesToProcess = MessageQueue;
-	MessageQueue.Empty();
+	TArray<FString> ReadyTargets;
+	for (const auto& Pair : QueuedPerTarget)
+	{
+		if (IsTargetRegistered(Pair.Key))
+		{
+			ReadyTargets.Add(Pair.Key);
+		}
+	}
 
-	for (const FQueuedFlutterMessage& Msg : MessagesToProcess)
+	for (const FString& Target : ReadyTargets)
 	{
-		if (Msg.bIsBinary)
+		FlushQueueForTarget(Target);
+	}
+}
+
+void UFlutterMessageRouter::FlushQueueForTarget(const FString& Target)
+{
+	const int32* Pending = QueuedPerTarget.Find(Target);
+	if (!Pending)
+	{
+		return;
+	}
+
+	// Move this target's messages out and compact the rest in place, keeping arrival order
+	TArray<FQueuedFlutterMessage> Ready;
+	Ready.Reserve(*Pending);
+
+	int32 Kept = 0;
+	for (int32 Offset = 0; Offset < QueueCount; ++Offset)
+	{
+		FQueuedFlutterMessage& Slot = MessageQueue[(QueueHead + Offset) % MaxQueueSize];
+		if (Slot.Target == Target)
 		{
-			if (!RouteBinaryMessage(Msg.Target, Msg.Method, Msg.BinaryData))
-			{
-				// Re-queue if still no handler
-				if (bQueueUnknownTargets && !Targets.Contains(Msg.Target))
-				{
-					MessageQueue.Add(Msg);
-				}
-			}
+			Ready.Add(MoveTemp(Slot));
 		}
 		else
 		{
-			if (!RouteMessage(Msg.Target, Msg.Method, Msg.Data))
+			if (Kept != Offset)
 			{
-				// Re-queue if still no handler
-				if (bQueueUnknownTargets && !Targets.Contains(Msg.Target))
-				{
-					MessageQueue.Add(Msg);
-				}
+				MessageQueue[(QueueHead + Kept) % MaxQueueSize] = MoveTemp(Slot);
 			}
+			Kept++;
 		}
 	}
 
-	Statistics.QueuedMessages = MessageQueue.Num();
+	QueueCount = Kept;
+	QueuedPerTarget.Remove(Target);
+	Statistics.QueuedMessages = QueueCount;
+
+	// Deliver after the queue is consistent, handlers may register or queue more messages
+	for (FQueuedFlutterMessage& Msg : Ready)
+	{
+		if (Msg.bIsBinary)
+		{
+			RouteBinaryMessage(Msg.Target, Msg.Method, Msg.BinaryData);
+		}
+		else
+		{
+			RouteMessage(Msg.Target, Msg.Method, Msg.Data);
+		}
+	}
 }
 
 void UFlutterMessageRouter::ClearQueue()
 {
-	int32 Cleared = MessageQueue.Num();
+	int32 Cleared = QueueCount;
 	MessageQueue.Empty();
+	QueueHead = 0;
+	QueueCount = 0;
+	QueuedPerTarget.Empty();
 	Statistics.QueuedMessages = 0;
 
 	UE_LOG(LogTemp, Log, TEXT("[FlutterRouter] Cleared %d queued messages"), Cleared);
 }
 
+void UFlutterMessageRouter::ReleaseQueuedSlot(const FString& Target)
+{
+	int32* Pending = QueuedPerTarget.Find(Target);
+	if (Pending && --(*Pending) <= 0)
+	{
+		QueuedPerTarget.Remove(Target);
+	}
+}
+
 // ============================================================
 // MARK: - Statistics
 // ============================================================
 
 FFlutterRouterStatistics UFlutterMessageRouter::GetStatistics() const
 {
+	Statistics.QueuedMessagesPerTarget.Reset();
+	for (const auto& Pair : QueuedPerTarget)
+	{
+		Statistics.QueuedMessagesPerTarget.Add(Pair.Key, Pair.Value);
+	}
+
 	return Statistics;
 }
 
@@ -358,9 +489,8 @@ void UFlutterMessageRouter::ResetStatistics()
 	Statistics.MessagesRouted = 0;
 	Statistics.MessagesDropped = 0;
 	// Keep registration counts accurate
-	Statistics.RegisteredTargets = Targets.Num();
-	Statistics.CachedDelegates = CachedDelegates.Num() + CachedBinaryDelegates.Num();
-	Statistics.QueuedMessages = MessageQueue.Num();
+	UpdateRegistrationStatistics();
+	Statistics.QueuedMessages = QueueCount;
 }
 
 // ============================================================
@@ -374,22 +504,60 @@ void UFlutterMessageRouter::SetQueueUnknownTargets(bool bEnable)
 
 void UFlutterMessageRouter::SetMaxQueueSize(int32 Size)
 {
-	MaxQueueSize = FMath::Max(1, Size);
+	const int32 NewSize = FMath::Max(1, Size);
+	if (NewSize == MaxQueueSize)
+	{
+		return;
+	}
 
-	// Trim queue if necessary
-	while (MessageQueue.Num() > MaxQueueSize)
+	// Trim the oldest messages if the queue no longer fits
+	const int32 Trimmed = FMath::Max(0, QueueCount - NewSize);
+	for (int32 Offset = 0; Offset < Trimmed; ++Offset)
 	{
-		MessageQueue.RemoveAt(0);
+		ReleaseQueuedSlot(MessageQueue[(QueueHead + Offset) % MaxQueueSize].Target);
+	}
+	Statistics.MessagesDropped += Trimmed;
+
+	// Rebuild the ring at the new capacity with the surviving messages at the front
+	TArray<FQueuedFlutterMessage> Resized;
+	if (QueueCount > Trimmed)
+	{
+		Resized.SetNum(NewSize);
+		for (int32 Offset = Trimmed; Offset < QueueCount; ++Offset)
+		{
+			Resized[Offset - Trimmed] = MoveTemp(MessageQueue[(QueueHead + Offset) % MaxQueueSize]);
+		}
 	}
 
-	Statistics.QueuedMessages = MessageQueue.Num();
+	MessageQueue = MoveTemp(Resized);
+	QueueHead = 0;
+	QueueCount -= Trimmed;
+	MaxQueueSize = NewSize;
+
+	Statistics.QueuedMessages = QueueCount;
 }
 
 // ============================================================
 // MARK: - Helpers
 // ============================================================
 
-FString UFlutterMessageRouter::GetCacheKey(const FString& Target, const FString& Method) const
+void UFlutterMessageRouter::RemoveTargetIfEmpty(FName Target)
+{
+	const FFlutterTargetRoutes* Entry = Routes.Find(Target);
+	if (Entry && Entry->IsEmpty())
+	{
+		Routes.Remove(Target);
+	}
+}
+
+void UFlutterMessageRouter::UpdateRegistrationStatistics()
+{
+	Statistics.RegisteredTargets = NumRegisteredTargets;
+	Statistics.CachedDelegates = NumCachedDelegates;
+}
+
+FFlutterRouteHandle UFlutterMessageRouter::FindRoute(const FString& Target, const FString& Method) const
 {
-	return FString::Printf(TEXT("%s:%s"), *Target, *Method);
+	// FNAME_Find: names that were never registered resolve to NAME_None and simply miss
+	return FFlutterRouteHandle(FName(*Target, FNAME_Find), FName(*Method, FNAME_Find));
 }
@@ -0,0 +1,104 @@
+// Copyright Epic Games, Inc. All Rights Reserved.
+
+#include "FlutterRenderScale.h"
+
+// ============================================================
+// MARK: - Configuration
+// ============================================================
+
+bool FFlutterRenderScale::Configure(const FFlutterRenderScaleSettings& InSettings)
+{
+	Settings = InSettings;
+	Settings.MinScale = FMath::Clamp(Settings.MinScale, MinAllowedScale, MaxAllowedScale);
+	Settings.MaxScale = FMath::Clamp(Settings.MaxScale, Settings.MinScale, MaxAllowedScale);
+	Settings.Scale = FMath::Clamp(Settings.Scale, MinAllowedScale, MaxAllowedScale);
+	Settings.TargetFrameRate = FMath::Max(Settings.TargetFrameRate, 1.0f);
+
+	ResetWindow();
+	WindowsOnBudget = 0;
+
+	switch (Settings.Mode)
+	{
+	case EFlutterRenderScaleMode::Fixed:
+		return SetScale(Settings.Scale);
+
+	case EFlutterRenderScaleMode::Dynamic:
+		return SetScale(FMath::Clamp(Quantize(Settings.Scale), Settings.MinScale, Settings.MaxScale));
+
+	default:
+		return SetScale(1.0f);
+	}
+}
+
+// ============================================================
+// MARK: - Dynamic Scaling
+// ============================================================
+
+bool FFlutterRenderScale::Update(double FrameSeconds)
+{
+	if (Settings.Mode != EFlutterRenderScaleMode::Dynamic || FrameSeconds <= 0.0 || FrameSeconds > MaxFrameSeconds)
+	{
+		return false;
+	}
+
+	WindowSeconds += FrameSeconds;
+	++WindowFrames;
+	if (WindowSeconds < EvaluationSeconds)
+	{
+		return false;
+	}
+
+	const double Average = WindowSeconds / WindowFrames;
+	const double Target = 1.0 / Settings.TargetFrameRate;
+	const float Current = GetScale();
+	ResetWindow();
+
+	if (Average > Target * OverBudgetFactor)
+	{
+		WindowsOnBudget = 0;
+
+		// Pixel count goes with the square of the scale
+		const float Desired = FMath::Max(Current * (float)FMath::Sqrt(Target / Average), Current - MaxStepDown);
+		const float Stepped = FMath::Min(Quantize(Desired), Current - ScaleStep);
+		return SetScale(FMath::Clamp(Stepped, Settings.MinScale, Settings.MaxScale));
+	}
+
+	if (++WindowsOnBudget >= RaiseAfterWindows)
+	{
+		WindowsOnBudget = 0;
+		return SetScale(FMath::Clamp(Quantize(Current + ScaleStep), Settings.MinScale, Settings.MaxScale));
+	}
+	return false;
+}
+
+bool FFlutterRenderScale::SetScale(float NewScale)
+{
+	if (FMath::IsNearlyEqual(NewScale, GetScale(), 0.001f))
+	{
+		return false;
+	}
+
+	Scale.store(NewScale, std::memory_order_relaxed);
+	return true;
+}
+
+void FFlutterRenderScale::ResetWindow()
+{
+	WindowSeconds = 0.0;
+	WindowFrames = 0;
+}
+
+// ============================================================
+// MARK: - Helpers
+// ============================================================
+
+void FFlutterRenderScale::GetRenderSize(int32 SurfaceWidth, int32 SurfaceHeight, float InScale, int32& OutWidth, int32& OutHeight)
+{
+	OutWidth = SurfaceWidth > 0 ? FMath::Max(1, FMath::RoundToInt(SurfaceWidth * InScale)) : 0;
+	OutHeight = SurfaceHeight > 0 ? FMath::Max(1, FMath::RoundToInt(SurfaceHeight * InScale)) : 0;
+}
+
+float FFlutterRenderScale::Quantize(float Value)
+{
+	return FMath::Clamp(FMath::RoundToFloat(Value / ScaleStep) * ScaleStep, MinAllowedScale, MaxAllowedScale);
+}
@@ -0,0 +1,499 @@
+// Copyright Epic Games, Inc. All Rights Reserved.
+
+#include "FlutterStandardCodec.h"
+
+// The codec is little-endian on the wire; every platform we ship on is too
+static_assert(PLATFORM_LITTLE_ENDIAN, "FlutterStandardCodec assumes a little-endian platform");
+
+// ============================================================
+// MARK: - Writer
+// ============================================================
+
+void FFlutterStandardWriter::WriteNull()
+{
+	WriteType(EFlutterStandardType::Null);
+}
+
+void FFlutterStandardWriter::WriteBool(bool bValue)
+{
+	WriteType(bValue ? EFlutterStandardType::True : EFlutterStandardType::False);
+}
+
+void FFlutterStandardWriter::WriteInt(int64 Value)
+{
+	if (Value >= MIN_int32 && Value <= MAX_int32)
+	{
+		const int32 Value32 = (int32)Value;
+		WriteType(EFlutterStandardType::Int32);
+		WriteRaw(&Value32, sizeof(Value32));
+	}
+	else
+	{
+		WriteType(EFlutterStandardType::Int64);
+		WriteRaw(&Value, sizeof(Value));
+	}
+}
+
+void FFlutterStandardWriter::WriteDouble(double Value)
+{
+	WriteType(EFlutterStandardType::Float64);
+	WriteAlignment(8);
+	WriteRaw(&Value, sizeof(Value));
+}
+
+void FFlutterStandardWriter::WriteString(const FString& Value)
+{
+	WriteType(EFlutterStandardType::String);
+
+	const FTCHARToUTF8 Converter(*Value, Value.Len());
+	WriteSize(Converter.Length());
+	WriteRaw(Converter.Get(), Converter.Length());
+}
+
+void FFlutterStandardWriter::WriteBytes(TConstArrayView<uint8> Values)
+{
+	WriteType(EFlutterStandardType::Uint8List);
+	WriteSize(Values.Num());
+	WriteRaw(Values.GetData(), Values.Num());
+}
+
+void FFlutterStandardWriter::WriteInt32List(TConstArrayView<int32> Values)
+{
+	WriteType(EFlutterStandardType::Int32List);
+	WriteSize(Values.Num());
+	WriteAlignment(4);
+	WriteRaw(Values.GetData(), Values.Num() * sizeof(int32));
+}
+
+void FFlutterStandardWriter::WriteInt64List(TConstArrayView<int64> Values)
+{
+	WriteType(EFlutterStandardType::Int64List);
+	WriteSize(Values.Num());
+	WriteAlignment(8);
+	WriteRaw(Values.GetData(), Values.Num() * sizeof(int64));
+}
+
+void FFlutterStandardWriter::WriteFloat32List(TConstArrayView<float> Values)
+{
+	WriteType(EFlutterStandardType::Float32List);
+	WriteSize(Values.Num());
+	WriteAlignment(4);
+	WriteRaw(Values.GetData(), Values.Num() * sizeof(float));
+}
+
+void FFlutterStandardWriter::WriteFloat64List(TConstArrayView<double> Values)
+{
+	WriteType(EFlutterStandardType::Float64List);
+	WriteSize(Values.Num());
+	WriteAlignment(8);
+	WriteRaw(Values.GetData(), Values.Num() * sizeof(double));
+}
+
+void FFlutterStandardWriter::BeginList(int32 Count)
+{
+	WriteType(EFlutterStandardType::List);
+	WriteSize(Count);
+}
+
+void FFlutterStandardWriter::BeginMap(int32 Count)
+{
+	WriteType(EFlutterStandardType::Map);
+	WriteSize(Count);
+}
+
+void FFlutterStandardWriter::WriteType(EFlutterStandardType Type)
+{
+	Buffer.Add((uint8)Type);
+}
+
+void FFlutterStandardWriter::WriteSize(int32 Size)
+{
+	check(Size >= 0);
+
+	if (Size < 254)
+	{
+		Buffer.Add((uint8)Size);
+	}
+	else if (Size <= 0xFFFF)
+	{
+		const uint16 Size16 = (uint16)Size;
+		Buffer.Add(254);
+		WriteRaw(&Size16, sizeof(Size16));
+	}
+	else
+	{
+		const uint32 Size32 = (uint32)Size;
+		Buffer.Add(255);
+		WriteRaw(&Size32, sizeof(Size32));
+	}
+}
+
+void FFlutterStandardWriter::WriteAlignment(int32 Alignment)
+{
+	const int32 Remainder = Buffer.Num() % Alignment;
+	if (Remainder != 0)
+	{
+		Buffer.AddZeroed(Alignment - Remainder);
+	}
+}
+
+void FFlutterStandardWriter::WriteRaw(const void* Data, int32 NumBytes)
+{
+	if (NumBytes > 0)
+	{
+		const int32 Offset = Buffer.AddUninitialized(NumBytes);
+		FMemory::Memcpy(Buffer.GetData() + Offset, Data, NumBytes);
+	}
+}
+
+// ============================================================
+// MARK: - Reader
+// ============================================================
+
+FFlutterStandardReader::FFlutterStandardReader(TConstArrayView<uint8> InData)
+	: Data(InData)
+	, Position(0)
+	, bError(false)
+{
+}
+
+EFlutterStandardType FFlutterStandardReader::PeekType() const
+{
+	if (bError || IsAtEnd())
+	{
+		return EFlutterStandardType::Invalid;
+	}
+
+	const uint8 Type = Data[Position];
+	return Type <= (uint8)EFlutterStandardType::Float32List ? (EFlutterStandardType)Type : EFlutterStandardType::Invalid;
+}
+
+bool FFlutterStandardReader::ReadNull()
+{
+	return ReadType(EFlutterStandardType::Null);
+}
+
+bool FFlutterStandardReader::ReadBool(bool& bOutValue)
+{
+	switch (PeekType())
+	{
+	case EFlutterStandardType::True:
+		Position++;
+		bOutValue = true;
+		return true;
+
+	case EFlutterStandardType::False:
+		Position++;
+		bOutValue = false;
+		return true;
+
+	default:
+		return Fail();
+	}
+}
+
+bool FFlutterStandardReader::ReadInt(int64& OutValue)
+{
+	switch (PeekType())
+	{
+	case EFlutterStandardType::Int32:
+	{
+		Position++;
+		int32 Value32 = 0;
+		if (!ReadRaw(&Value32, sizeof(Value32)))
+		{
+			return false;
+		}
+		OutValue = Value32;
+		return true;
+	}
+
+	case EFlutterStandardType::Int64:
+		Position++;
+		return ReadRaw(&OutValue, sizeof(OutValue));
+
+	default:
+		return Fail();
+	}
+}
+
+bool FFlutterStandardReader::ReadInt(int32& OutValue)
+{
+	int64 Value = 0;
+	if (!ReadInt(Value))
+	{
+		return false;
+	}
+	if (Value < MIN_int32 || Value > MAX_int32)
+	{
+		return Fail();
+	}
+	OutValue = (int32)Value;
+	return true;
+}
+
+bool FFlutterStandardReader::ReadDouble(double& OutValue)
+{
+	const EFlutterStandardType Type = PeekType();
+	if (Type == EFlutterStandardType::Int32 || Type == EFlutterStandardType::Int64)
+	{
+		int64 Value = 0;
+		if (!ReadInt(Value))
+		{
+			return false;
+		}
+		OutValue = (double)Value;
+		return true;
+	}
+
+	return ReadType(EFlutterStandardType::Float64)
+		&& ReadAlignment(8)
+		&& ReadRaw(&OutValue, sizeof(OutValue));
+}
+
+bool FFlutterStandardReader::ReadString(FString& OutValue)
+{
+	int32 Length = 0;
+	if (!ReadType(EFlutterStandardType::String) || !ReadSize(Length))
+	{
+		return false;
+	}
+	if (Length > Data.Num() - Position)
+	{
+		return Fail();
+	}
+
+	const FUTF8ToTCHAR Converter(reinterpret_cast<const ANSICHAR*>(Data.GetData() + Position), Length);
+	OutValue = FString(Converter.Length(), Converter.Get());
+	Position += Length;
+	return true;
+}
+
+bool FFlutterStandardReader::ReadBytes(TArray<uint8>& OutValues)
+{
+	return ReadTypedList(EFlutterStandardType::Uint8List, 1, OutValues);
+}
+
+bool FFlutterStandardReader::ReadInt32List(TArray<int32>& OutValues)
+{
+	return ReadTypedList(EFlutterStandardType::Int32List, 4, OutValues);
+}
+
+bool FFlutterStandardReader::ReadInt64List(TArray<int64>& OutValues)
+{
+	return ReadTypedList(EFlutterStandardType::Int64List, 8, OutValues);
+}
+
+bool FFlutterStandardReader::ReadFloat32List(TArray<float>& OutValues)
+{
+	return ReadTypedList(EFlutterStandardType::Float32List, 4, OutValues);
+}
+
+bool FFlutterStandardReader::ReadFloat64List(TArray<double>& OutValues)
+{
+	return ReadTypedList(EFlutterStandardType::Float64List, 8, OutValues);
+}
+
+bool FFlutterStandardReader::ReadListHeader(int32& OutCount)
+{
+	return ReadType(EFlutterStandardType::List) && ReadSize(OutCount);
+}
+
+bool FFlutterStandardReader::ReadMapHeader(int32& OutCount)
+{
+	return ReadType(EFlutterStandardType::Map) && ReadSize(OutCount);
+}
+
+bool FFlutterStandardReader::Skip()
+{
+	return SkipValue(0);
+}
+
+bool FFlutterStandardReader::SkipValue(int32 Depth)
+{
+	const EFlutterStandardType Type = PeekType();
+	switch (Type)
+	{
+	case EFlutterStandardType::Null:
+	case EFlutterStandardType::True:
+	case EFlutterStandardType::False:
+		Position++;
+		return true;
+
+	case EFlutterStandardType::Int32:
+	case EFlutterStandardType::Int64:
+	{
+		int64 Ignored = 0;
+		return ReadInt(Ignored);
+	}
+
+	case EFlutterStandardType::Float64:
+	{
+		double Ignored = 0.0;
+		return ReadDouble(Ignored);
+	}
+
+	case EFlutterStandardType::LargeInt:
+	case EFlutterStandardType::String:
+	case EFlutterStandardType::Uint8List:
+	case EFlutterStandardType::Int32List:
+	case EFlutterStandardType::Int64List:
+	case EFlutterStandardType::Float32List:
+	case EFlutterStandardType::Float64List:
+	{
+		static const int32 ElementSizes[] = { 0, 0, 0, 0, 0, 1, 0, 1, 1, 4, 8, 8, 0, 0, 4 };
+		const int32 ElementSize = ElementSizes[(uint8)Type];
+
+		int32 Count = 0;
+		Position++;
+		if (!ReadSize(Count) || (ElementSize > 1 && !ReadAlignment(ElementSize)))
+		{
+			return false;
+		}
+		if ((int64)Count * ElementSize > Data.Num() - Position)
+		{
+			return Fail();
+		}
+		Position += Count * ElementSize;
+		return true;
+	}
+
+	case EFlutterStandardType::List:
+	case EFlutterStandardType::Map:
+	{
+		// Payloads come from Flutter; bound the recursion and the count before walking them
+		if (Depth >= MaxDepth)
+		{
+			return Fail();
+		}
+
+		int32 Count = 0;
+		Position++;
+		if (!ReadSize(Count))
+		{
+			return false;
+		}
+
+		// Every value takes at least one byte
+		const int64 NumValues = Type == EFlutterStandardType::Map ? (int64)Count * 2 : (int64)Count;
+		if (NumValues > Data.Num() - Position)
+		{
+			return Fail();
+		}
+		for (int64 Index = 0; Index < NumValues; ++Index)
+		{
+			if (!SkipValue(Depth + 1))
+			{
+				return false;
+			}
+		}
+		return true;
+	}
+
+	default:
+		return Fail();
+	}
+}
+
+template <typename ElementType>
+bool FFlutterStandardReader::ReadTypedList(EFlutterStandardType Type, int32 Alignment, TArray<ElementType>& OutValues)
+{
+	int32 Count = 0;
+	if (!ReadType(Type) || !ReadSize(Count))
+	{
+		return false;
+	}
+	if (Alignment > 1 && !ReadAlignment(Alignment))
+	{
+		return false;
+	}
+	if ((int64)Count * sizeof(ElementType) > Data.Num() - Position)
+	{
+		return Fail();
+	}
+
+	OutValues.SetNumUninitialized(Count);
+	return ReadRaw(OutValues.GetData(), Count * sizeof(ElementType));
+}
+
+bool FFlutterStandardReader::ReadType(EFlutterStandardType Expected)
+{
+	if (PeekType() != Expected)
+	{
+		return Fail();
+	}
+	Position++;
+	return true;
+}
+
+bool FFlutterStandardReader::ReadSize(int32& OutSize)
+{
+	uint8 First = 0;
+	if (!ReadRaw(&First, 1))
+	{
+		return false;
+	}
+
+	if (First < 254)
+	{
+		OutSize = First;
+		return true;
+	}
+
+	if (First == 254)
+	{
+		uint16 Size16 = 0;
+		if (!ReadRaw(&Size16, sizeof(Size16)))
+		{
+			return false;
+		}
+		OutSize = Size16;
+		return true;
+	}
+
+	uint32 Size32 = 0;
+	if (!ReadRaw(&Size32, sizeof(Size32)))
+	{
+		return false;
+	}
+	if (Size32 > (uint32)MAX_int32)
+	{
+		return Fail();
+	}
+	OutSize = (int32)Size32;
+	return true;
+}
+
+bool FFlutterStandardReader::ReadAlignment(int32 Alignment)
+{
+	const int32 Remainder = Position % Alignment;
+	if (Remainder != 0)
+	{
+		if (Position + (Alignment - Remainder) > Data.Num())
+		{
+			return Fail();
+		}
+		Position += Alignment - Remainder;
+	}
+	return true;
+}
+
+bool FFlutterStandardReader::ReadRaw(void* OutData, int32 NumBytes)
+{
+	if (bError || NumBytes > Data.Num() - Position)
+	{
+		return Fail();
+	}
+	if (NumBytes > 0)
+	{
+		FMemory::Memcpy(OutData, Data.GetData() + Position, NumBytes);
+		Position += NumBytes;
+	}
+	return true;
+}
+
+bool FFlutterStandardReader::Fail()
+{
+	bError = true;
+	return false;
+}
@@ -0,0 +1,251 @@
+// Copyright Epic Games, Inc. All Rights Reserved.
+
+#include "FlutterSurfaceStats.h"
+#include "HAL/PlatformTime.h"
+#include "Misc/ScopeLock.h"
+
+namespace FlutterSurfaceStats
+{
+	/** Weight of a new frame in the baseline average */
+	static constexpr double BaselineWeight = 0.1;
+
+	/** Frames slower than this many baselines outside a transition are hitches, not cadence */
+	static constexpr double BaselineOutlierFactor = 4.0;
+
+	static double ToMs(double Seconds)
+	{
+		return Seconds * 1000.0;
+	}
+}
+
+FFlutterSurfaceStats& FFlutterSurfaceStats::Get()
+{
+	static FFlutterSurfaceStats Stats;
+	return Stats;
+}
+
+// ============================================================
+// MARK: - Transitions
+// ============================================================
+
+void FFlutterSurfaceStats::OnSurfaceReady(double HandoffStartTime, double Now, int32 Width, int32 Height)
+{
+	using namespace FlutterSurfaceStats;
+
+	FScopeLock Lock(&Mutex);
+
+	// A new surface supersedes an open resize of the old one
+	if (Phase == EPhase::Resizing)
+	{
+		FinishResize(LastFrameTime > 0.0 ? LastFrameTime : Now);
+	}
+
+	++Stats.SurfacesCreated;
+	Stats.Width = Width;
+	Stats.Height = Height;
+	Stats.LastCreatedTime = HandoffStartTime;
+	Stats.LastReadyTime = Now;
+	Stats.LastHandoffMs = ToMs(Now - HandoffStartTime);
+
+	Phase = EPhase::AwaitingFirstFrame;
+}
+
+void FFlutterSurfaceStats::OnSurfaceResized(double Now, int32 Width, int32 Height)
+{
+	FScopeLock Lock(&Mutex);
+
+	++Stats.Resizes;
+	Stats.Width = Width;
+	Stats.Height = Height;
+	Stats.LastResizeTime = Now;
+
+	// Before the first frame the resize is part of the time to first frame
+	if (Phase == EPhase::AwaitingFirstFrame)
+	{
+		return;
+	}
+
+	// A resize during a resize (e.g. rotating back) restarts the window but keeps its drops
+	if (Phase != EPhase::Resizing)
+	{
+		ResizeDroppedFrames = 0;
+	}
+	ResizeNormalFrames = 0;
+	ResizeLastSlowFrameTime = 0.0;
+	ResizeFirstFrameTime = 0.0;
+	Phase = EPhase::Resizing;
+}
+
+void FFlutterSurfaceStats::OnSurfaceDestroyed(double StartTime, double Now)
+{
+	using namespace FlutterSurfaceStats;
+
+	FScopeLock Lock(&Mutex);
+
+	if (Phase == EPhase::Resizing)
+	{
+		FinishResize(LastFrameTime > 0.0 ? LastFrameTime : StartTime);
+	}
+
+	++Stats.SurfacesDestroyed;
+	Stats.Width = 0;
+	Stats.Height = 0;
+	Stats.LastDestroyedTime = StartTime;
+	Stats.LastDestroyMs = ToMs(Now - StartTime);
+
+	// Frames without a surface say nothing about the next one
+	Phase = EPhase::Idle;
+	LastFrameTime = 0.0;
+}
+
+// ============================================================
+// MARK: - Frames
+// ============================================================
+
+void FFlutterSurfaceStats::OnFrame(double Now)
+{
+	using namespace FlutterSurfaceStats;
+
+	FScopeLock Lock(&Mutex);
+
+	const double Interval = LastFrameTime > 0.0 ? Now - LastFrameTime : 0.0;
+	LastFrameTime = Now;
+
+	switch (Phase)
+	{
+	case EPhase::AwaitingFirstFrame:
+	{
+		Stats.LastFirstFrameTime = Now;
+		Stats.LastTimeToFirstFrameMs = ToMs(Now - Stats.LastReadyTime);
+		Stats.MaxTimeToFirstFrameMs = FMath::Max(Stats.MaxTimeToFirstFrameMs, Stats.LastTimeToFirstFrameMs);
+		Phase = EPhase::Idle;
+
+		UE_LOG(LogTemp, Log, TEXT("[FlutterBridge] First frame on %dx%d surface after %.1f ms (handoff %.1f ms)"),
+			Stats.Width, Stats.Height, Stats.LastTimeToFirstFrameMs, Stats.LastHandoffMs);
+		break;
+	}
+
+	case EPhase::Resizing:
+	{
+		if (ResizeFirstFrameTime == 0.0)
+		{
+			ResizeFirstFrameTime = Now;
+		}
+
+		// Without a baseline there is nothing to measure drops against
+		if (BaselineFrameSeconds <= 0.0)
+		{
+			FinishResize(Now);
+			break;
+		}
+
+		if (Interval > BaselineFrameSeconds * SlowFrameFactor)
+		{
+			ResizeDroppedFrames += FMath::Max(0, FMath::RoundToInt(Interval / BaselineFrameSeconds) - 1);
+			ResizeLastSlowFrameTime = Now;
+			ResizeNormalFrames = 0;
+		}
+		else if (Interval > 0.0)
+		{
+			++ResizeNormalFrames;
+		}
+
+		if (ResizeNormalFrames >= SettleFrames)
+		{
+			FinishResize(ResizeLastSlowFrameTime > 0.0 ? ResizeLastSlowFrameTime : ResizeFirstFrameTime);
+		}
+		else if (Now - Stats.LastResizeTime >= SettleTimeoutSeconds)
+		{
+			FinishResize(Now);
+		}
+		break;
+	}
+
+	case EPhase::Idle:
+	{
+		if (Interval <= 0.0)
+		{
+			break;
+		}
+
+		if (BaselineFrameSeconds <= 0.0)
+		{
+			BaselineFrameSeconds = Interval;
+		}
+		else if (Interval <= BaselineFrameSeconds * BaselineOutlierFactor)
+		{
+			BaselineFrameSeconds += (Interval - BaselineFrameSeconds) * BaselineWeight;
+		}
+		Stats.BaselineFrameMs = ToMs(BaselineFrameSeconds);
+		break;
+	}
+	}
+}
+
+void FFlutterSurfaceStats::FinishResize(double SettledTime)
+{
+	using namespace FlutterSurfaceStats;
+
+	Stats.LastResizeSettledTime = SettledTime;
+	Stats.LastResizeSettleMs = ToMs(FMath::Max(0.0, SettledTime - Stats.LastResizeTime));
+	Stats.MaxResizeSettleMs = FMath::Max(Stats.MaxResizeSettleMs, Stats.LastResizeSettleMs);
+	Stats.LastResizeDroppedFrames = ResizeDroppedFrames;
+	Stats.TotalResizeDroppedFrames += ResizeDroppedFrames;
+	Phase = EPhase::Idle;
+
+	UE_LOG(LogTemp, Log, TEXT("[FlutterBridge] Resize to %dx%d settled after %.1f ms, %d frames dropped"),
+		Stats.Width, Stats.Height, Stats.LastResizeSettleMs, ResizeDroppedFrames);
+
+	ResizeDroppedFrames = 0;
+	ResizeNormalFrames = 0;
+	ResizeLastSlowFrameTime = 0.0;
+	ResizeFirstFrameTime = 0.0;
+}
+
+// ============================================================
+// MARK: - Queries
+// ============================================================
+
+FFlutterSurfaceStatistics FFlutterSurfaceStats::GetStatistics() const
+{
+	FScopeLock Lock(&Mutex);
+
+	FFlutterSurfaceStatistics Result = Stats;
+	Result.CaptureTime = FPlatformTime::Seconds();
+	return Result;
+}
+
+void FFlutterSurfaceStats::Reset()
+{
+	FScopeLock Lock(&Mutex);
+
+	Stats = FFlutterSurfaceStatistics();
+	Phase = EPhase::Idle;
+	LastFrameTime = 0.0;
+	BaselineFrameSeconds = 0.0;
+	ResizeDroppedFrames = 0;
+	ResizeNormalFrames = 0;
+	ResizeLastSlowFrameTime = 0.0;
+	ResizeFirstFrameTime = 0.0;
+}
+
+FString FFlutterSurfaceStats::ToJson(const FFlutterSurfaceStatistics& Stats)
+{
+	return FString::Printf(
+		TEXT("{\"surfacesCreated\":%d,\"resizes\":%d,\"surfacesDestroyed\":%d,\"width\":%d,\"height\":%d,")
+		TEXT("\"lastHandoffMs\":%.3f,\"lastTimeToFirstFrameMs\":%.3f,\"maxTimeToFirstFrameMs\":%.3f,")
+		TEXT("\"lastResizeSettleMs\":%.3f,\"maxResizeSettleMs\":%.3f,")
+		TEXT("\"lastResizeDroppedFrames\":%d,\"totalResizeDroppedFrames\":%lld,")
+		TEXT("\"lastDestroyMs\":%.3f,\"baselineFrameMs\":%.3f,")
+		TEXT("\"lastCreatedTime\":%.6f,\"lastReadyTime\":%.6f,\"lastFirstFrameTime\":%.6f,")
+		TEXT("\"lastResizeTime\":%.6f,\"lastResizeSettledTime\":%.6f,\"lastDestroyedTime\":%.6f,")
+		TEXT("\"captureTime\":%.6f}"),
+		Stats.SurfacesCreated, Stats.Resizes, Stats.SurfacesDestroyed, Stats.Width, Stats.Height,
+		Stats.LastHandoffMs, Stats.LastTimeToFirstFrameMs, Stats.MaxTimeToFirstFrameMs,
+		Stats.LastResizeSettleMs, Stats.MaxResizeSettleMs,
+		Stats.LastResizeDroppedFrames, (long long)Stats.TotalResizeDroppedFrames,
+		Stats.LastDestroyMs, Stats.BaselineFrameMs,
+		Stats.LastCreatedTime, Stats.LastReadyTime, Stats.LastFirstFrameTime,
+		Stats.LastResizeTime, Stats.LastResizeSettledTime, Stats.LastDestroyedTime,
+		Stats.CaptureTime);
+}
@@ -0,0 +1,489 @@
+// Copyright Epic Games, Inc. All Rights Reserved.
+
+#include "FlutterBridge.h"
+
+#if PLATFORM_LINUX
+
+#include "FlutterMessageBatch.h"
+#include "FlutterSharedFrameBuffer.h"
+#include "FlutterSharedStateMirror.h"
+#include "FlutterSocketConnection.h"
+#include "Async/Async.h"
+#include "Engine/Engine.h"
+#include "Engine/GameViewportClient.h"
+#include "Framework/Application/SlateApplication.h"
+#include "Rendering/SlateRenderer.h"
+#include "Widgets/SWindow.h"
+#include "RenderingThread.h"
+#include "RHICommandList.h"
+#include "HAL/PlatformMisc.h"
+#include "HAL/PlatformTime.h"
+#include "Misc/CommandLine.h"
+#include "Misc/Parse.h"
+#include <atomic>
+
+// Reference to FlutterBridge instance
+static AFlutterBridge* GFlutterBridgeInstance = nullptr;
+
+// ============================================================
+// MARK: - Frame Export
+// ============================================================
+
+/**
+ * Frames go to the Flutter Linux plugin through a shared-memory frame buffer (see
+ * FlutterSharedFrameBuffer.h). Each back buffer Slate is about to present is read back
+ * on the render thread and copied into the buffer; the plugin shows the latest one.
+ *
+ * Reading back works with any RHI, including Vulkan on a software rasterizer such as
+ * lavapipe, which is how headless visual tests run.
+ *
+ * The segment name comes from -FlutterFrameBuffer=<name> or the
+ * GAMEFRAMEWORK_UNREAL_FRAME_BUFFER environment variable; -FlutterFrameBufferFps=<n>
+ * caps the export rate below the engine frame rate.
+ */
+namespace FlutterFrameExport
+{
+	/** Only touched on the render thread while the delegate is bound */
+	static TUniquePtr<FFlutterSharedFrameBuffer> FrameBuffer;
+	static TArray<FColor> Pixels;
+	static double MinFrameInterval = 0.0;
+	static double LastExportTime = 0.0;
+	static bool bWarnedOversized = false;
+
+	/** Window the game viewport draws into; frames from other windows are not exported */
+	static std::atomic<SWindow*> GameWindow(nullptr);
+
+	static FDelegateHandle BackBufferHandle;
+
+	static void OnBackBufferReadyToPresent(SWindow& Window, const FTextureRHIRef& BackBuffer)
+	{
+		check(IsInRenderingThread());
+
+		SWindow* ExportedWindow = GameWindow.load(std::memory_order_relaxed);
+		if (!FrameBuffer.IsValid() || FrameBuffer->IsClosed() || !BackBuffer.IsValid() || (ExportedWindow != nullptr && ExportedWindow != &Window))
+		{
+			return;
+		}
+
+		const double Now = FPlatformTime::Seconds();
+		if (Now - LastExportTime < MinFrameInterval)
+		{
+			return;
+		}
+		LastExportTime = Now;
+
+		const FIntPoint Size = BackBuffer->GetSizeXY();
+		if (static_cast<uint32>(Size.X) > FrameBuffer->GetMaxWidth() || static_cast<uint32>(Size.Y) > FrameBuffer->GetMaxHeight())
+		{
+			if (!bWarnedOversized)
+			{
+				UE_LOG(LogTemp, Warning, TEXT("[FlutterBridge_Linux] %dx%d frames do not fit the %ux%u frame buffer; they are not exported"),
+					Size.X, Size.Y, FrameBuffer->GetMaxWidth(), FrameBuffer->GetMaxHeight());
+				bWarnedOversized = true;
+			}
+			return;
+		}
+
+		// Read back in FColor (BGRA) order; the frame buffer converts while copying
+		const double ReadStart = FPlatformTime::Seconds();
+		FRHICommandListImmediate& RHICmdList = FRHICommandListExecutor::GetImmediateCommandList();
+		RHICmdList.ReadSurfaceData(BackBuffer, FIntRect(0, 0, Size.X, Size.Y), Pixels, FReadSurfaceDataFlags(RCM_UNorm));
+		const double ReadMs = (FPlatformTime::Seconds() - ReadStart) * 1000.0;
+
+		if (Pixels.Num() == Size.X * Size.Y &&
+			FrameBuffer->Publish(Pixels.GetData(), Size.X, Size.Y, Size.X * sizeof(FColor)))
+		{
+			UE_LOG(LogTemp, VeryVerbose, TEXT("[FlutterBridge_Linux] Exported %dx%d frame: readback %.2f ms, copy %.2f ms"),
+				Size.X, Size.Y, ReadMs, FrameBuffer->GetLastCopyMs());
+		}
+	}
+
+	static void Start()
+	{
+		FString Name;
+		if (!FParse::Value(FCommandLine::Get(), TEXT("FlutterFrameBuffer="), Name))
+		{
+			Name = FPlatformMisc::GetEnvironmentVariable(TEXT("GAMEFRAMEWORK_UNREAL_FRAME_BUFFER"));
+		}
+		if (Name.IsEmpty() || !FSlateApplication::IsInitialized() || FSlateApplication::Get().GetRenderer() == nullptr)
+		{
+			UE_LOG(LogTemp, Log, TEXT("[FlutterBridge_Linux] No frame buffer to export to"));
+			return;
+		}
+
+		FString Error;
+		TUniquePtr<FFlutterSharedFrameBuffer> OpenedBuffer = FFlutterSharedFrameBuffer::Open(Name, Error);
+		if (!OpenedBuffer.IsValid())
+		{
+			UE_LOG(LogTemp, Error, TEXT("[FlutterBridge_Linux] Cannot export frames: %s"), *Error);
+			return;
+		}
+
+		float MaxFps = 0.0f;
+		FParse::Value(FCommandLine::Get(), TEXT("FlutterFrameBufferFps="), MaxFps);
+
+		if (GEngine && GEngine->GameViewport)
+		{
+			GameWindow.store(GEngine->GameViewport->GetWindow().Get(), std::memory_order_relaxed);
+		}
+
+		UE_LOG(LogTemp, Log, TEXT("[FlutterBridge_Linux] Exporting frames to %s (up to %ux%u)"),
+			*Name, OpenedBuffer->GetMaxWidth(), OpenedBuffer->GetMaxHeight());
+
+		ENQUEUE_RENDER_COMMAND(FlutterFrameExportStart)(
+			[Buffer = OpenedBuffer.Release(), MaxFps](FRHICommandListImmediate&) mutable
+			{
+				FrameBuffer.Reset(Buffer);
+				MinFrameInterval = MaxFps > 0.0f ? 1.0 / MaxFps : 0.0;
+				LastExportTime = 0.0;
+				bWarnedOversized = false;
+			});
+
+		BackBufferHandle = FSlateApplication::Get().GetRenderer()->OnBackBufferReadyToPresent().AddStatic(&OnBackBufferReadyToPresent);
+	}
+
+	static void Stop()
+	{
+		if (!BackBufferHandle.IsValid())
+		{
+			return;
+		}
+
+		if (FSlateApplication::IsInitialized() && FSlateApplication::Get().GetRenderer() != nullptr)
+		{
+			FSlateApplication::Get().GetRenderer()->OnBackBufferReadyToPresent().Remove(BackBufferHandle);
+		}
+		BackBufferHandle.Reset();
+		GameWindow.store(nullptr, std::memory_order_relaxed);
+
+		ENQUEUE_RENDER_COMMAND(FlutterFrameExportStop)(
+			[](FRHICommandListImmediate&)
+			{
+				FrameBuffer.Reset();
+				Pixels.Empty();
+			});
+		FlushRenderingCommands();
+	}
+}
+
+// ============================================================
+// MARK: - Messaging
+// ============================================================
+
+/**
+ * Messages travel over the Unix domain socket the Flutter Linux plugin listens on (see
+ * FlutterSocketConnection.h). Flutter messages go through the bridge's ingress queue like
+ * on the other platforms; console commands and level loads run on the game thread and are
+ * answered once they have been issued.
+ *
+ * The socket path comes from -FlutterSocket=<path> or the GAMEFRAMEWORK_UNREAL_SOCKET
+ * environment variable.
+ */
+namespace FlutterSocket
+{
+	/** Created and destroyed on the game thread */
+	static TUniquePtr<FFlutterSocketConnection> Connection;
+
+	static bool EnqueueMessage(const TArray<FString>& Strings)
+	{
+		if (Strings.Num() != 3 || GFlutterBridgeInstance == nullptr)
+		{
+			return false;
+		}
+
+		FFlutterIngressMessage Message;
+		Message.Kind = FFlutterIngressMessage::EKind::Message;
+		Message.Target = Strings[0];
+		Message.Method = Strings[1];
+		Message.Data = Strings[2];
+		return GFlutterBridgeInstance->EnqueueFromFlutter(MoveTemp(Message));
+	}
+
+	/** Runs Action on the game thread, then answers Request if the connection is still there */
+	static void RunOnGameThread(const FFlutterSocketConnection::FRequest& Request, TFunction<void()> Action)
+	{
+		FFlutterSocketConnection::FRequest Reply;
+		Reply.RequestId = Request.RequestId;
+		Reply.Op = Request.Op;
+
+		AsyncTask(ENamedThreads::GameThread, [Reply = MoveTemp(Reply), Action = MoveTemp(Action)]()
+		{
+			if (GFlutterBridgeInstance == nullptr)
+			{
+				if (Connection.IsValid())
+				{
+					Connection->RespondError(Reply, TEXT("FlutterBridge instance not set"));
+				}
+				return;
+			}
+
+			Action();
+			if (Connection.IsValid())
+			{
+				Connection->Respond(Reply, {});
+			}
+		});
+	}
+
+	/** Reader thread; the connection outlives every call */
+	static void HandleRequest(FFlutterSocketConnection& Socket, FFlutterSocketConnection::FRequest&& Request)
+	{
+		using FlutterSocketProtocol::EOp;
+
+		if (Request.Op == EOp::Ping)
+		{
+			Socket.Respond(Request, Request.Payload);
+			return;
+		}
+
+		TArray<FString> Strings;
+		if (!FFlutterSocketConnection::DecodeStrings(Request.Payload, Strings))
+		{
+			Socket.RespondError(Request, TEXT("Malformed request payload"));
+			return;
+		}
+
+		switch (Request.Op)
+		{
+		case EOp::SendMessage:
+		case EOp::SendJsonMessage:
+			if (EnqueueMessage(Strings))
+			{
+				Socket.Respond(Request, {});
+			}
+			else
+			{
+				Socket.RespondError(Request, GFlutterBridgeInstance ? TEXT("Ingress queue full") : TEXT("FlutterBridge instance not set"));
+			}
+			break;
+
+		case EOp::ExecuteConsoleCommand:
+			if (Strings.Num() != 1)
+			{
+				Socket.RespondError(Request, TEXT("Expected a command"));
+				break;
+			}
+			UE_LOG(LogTemp, Log, TEXT("[FlutterBridge_Linux] ExecuteConsoleCommand: %s"), *Strings[0]);
+			RunOnGameThread(Request, [Command = Strings[0]]()
+			{
+				GFlutterBridgeInstance->ExecuteConsoleCommand(Command);
+			});
+			break;
+
+		case EOp::LoadLevel:
+			if (Strings.Num() != 1)
+			{
+				Socket.RespondError(Request, TEXT("Expected a level name"));
+				break;
+			}
+			UE_LOG(LogTemp, Log, TEXT("[FlutterBridge_Linux] LoadLevel: %s"), *Strings[0]);
+			RunOnGameThread(Request, [LevelName = Strings[0]]()
+			{
+				GFlutterBridgeInstance->LoadLevel(LevelName);
+			});
+			break;
+
+		default:
+			Socket.RespondError(Request, FString::Printf(TEXT("Unknown operation %d"), static_cast<int32>(Request.Op)));
+			break;
+		}
+	}
+
+	static void Start()
+	{
+		FString Path;
+		if (!FParse::Value(FCommandLine::Get(), TEXT("FlutterSocket="), Path))
+		{
+			Path = FPlatformMisc::GetEnvironmentVariable(TEXT("GAMEFRAMEWORK_UNREAL_SOCKET"));
+		}
+		if (Path.IsEmpty())
+		{
+			UE_LOG(LogTemp, Log, TEXT("[FlutterBridge_Linux] No Flutter socket to connect to"));
+			return;
+		}
+
+		FString Error;
+		Connection = FFlutterSocketConnection::Connect(Path, &HandleRequest, Error);
+		if (!Connection.IsValid())
+		{
+			UE_LOG(LogTemp, Error, TEXT("[FlutterBridge_Linux] Cannot reach Flutter: %s"), *Error);
+			return;
+		}
+
+		UE_LOG(LogTemp, Log, TEXT("[FlutterBridge_Linux] Connected to Flutter at %s"), *Path);
+	}
+
+	static void Stop()
+	{
+		// Joins the reader thread, so no request sees the instance after this
+		Connection.Reset();
+	}
+}
+
+// ============================================================
+// MARK: - State Mirror
+// ============================================================
+
+/**
+ * Game state Flutter shows every frame (score, level, health) goes through a shared-memory
+ * state mirror (see FlutterSharedStateMirror.h) instead of messages; the plugin reads it
+ * when Flutter asks and never waits for the engine.
+ *
+ * The segment name comes from -FlutterStateMirror=<name> or the
+ * GAMEFRAMEWORK_UNREAL_STATE_MIRROR environment variable.
+ */
+namespace FlutterStateMirror
+{
+	/** Created, written and destroyed on the game thread */
+	static TUniquePtr<FFlutterSharedStateMirror> Mirror;
+
+	static bool IsAvailable()
+	{
+		return Mirror.IsValid() && !Mirror->IsClosed();
+	}
+
+	static void Start()
+	{
+		FString Name;
+		if (!FParse::Value(FCommandLine::Get(), TEXT("FlutterStateMirror="), Name))
+		{
+			Name = FPlatformMisc::GetEnvironmentVariable(TEXT("GAMEFRAMEWORK_UNREAL_STATE_MIRROR"));
+		}
+		if (Name.IsEmpty())
+		{
+			UE_LOG(LogTemp, Log, TEXT("[FlutterBridge_Linux] No state mirror to write to"));
+			return;
+		}
+
+		FString Error;
+		Mirror = FFlutterSharedStateMirror::Open(Name, Error);
+		if (!Mirror.IsValid())
+		{
+			UE_LOG(LogTemp, Error, TEXT("[FlutterBridge_Linux] Cannot mirror game state: %s"), *Error);
+			return;
+		}
+
+		UE_LOG(LogTemp, Log, TEXT("[FlutterBridge_Linux] Mirroring game state to %s"), *Name);
+	}
+
+	static void Stop()
+	{
+		Mirror.Reset();
+	}
+}
+
+// ============================================================
+// MARK: - Platform Bridge Functions
+// ============================================================
+
+/**
+ * Set the FlutterBridge instance
+ * Called from AFlutterBridge::BeginPlay()
+ */
+void FlutterBridge_SetInstance_Linux(AFlutterBridge* Instance)
+{
+	GFlutterBridgeInstance = Instance;
+	FlutterFrameExport::Start();
+	FlutterSocket::Start();
+	FlutterStateMirror::Start();
+	UE_LOG(LogTemp, Log, TEXT("[FlutterBridge_Linux] FlutterBridge instance set"));
+}
+
+/**
+ * Clear the FlutterBridge instance
+ * Called from AFlutterBridge::EndPlay()
+ */
+void FlutterBridge_ClearInstance_Linux(AFlutterBridge* Instance)
+{
+	if (GFlutterBridgeInstance != Instance)
+	{
+		return;
+	}
+
+	FlutterStateMirror::Stop();
+	FlutterSocket::Stop();
+	FlutterFrameExport::Stop();
+	GFlutterBridgeInstance = nullptr;
+}
+
+/**
+ * Send message to Flutter
+ * Called from AFlutterBridge::SendToFlutterImmediate()
+ */
+void FlutterBridge_SendToFlutter_Linux(const FString& Target, const FString& Method, const FString& Data)
+{
+	if (!FlutterSocket::Connection.IsValid() || !FlutterSocket::Connection->IsConnected())
+	{
+		UE_LOG(LogTemp, Warning, TEXT("[FlutterBridge_Linux] Not connected to Flutter, dropping message: Target=%s, Method=%s"), *Target, *Method);
+		return;
+	}
+
+	FlutterSocket::Connection->SendMessage(Target, Method, Data);
+}
+
+/**
+ * Send a batch frame (see FFlutterMessageBatch) to Flutter
+ * Called from AFlutterBridge::FlushOutgoingBatch(). The plugin only takes string messages,
+ * so each message in the frame becomes a socket message of its own.
+ */
+void FlutterBridge_SendMessageBatch_Linux(const TArray<uint8>& Frame, int32 NumMessages)
+{
+	if (!FlutterSocket::Connection.IsValid() || !FlutterSocket::Connection->IsConnected())
+	{
+		UE_LOG(LogTemp, Warning, TEXT("[FlutterBridge_Linux] Not connected to Flutter, dropping batch of %d messages"), NumMessages);
+		return;
+	}
+
+	FFlutterSocketConnection& Connection = *FlutterSocket::Connection;
+	const bool bDecoded = FFlutterMessageBatch::Decode(Frame, [&Connection](FString&& Target, FString&& Method, FString&& Data)
+	{
+		Connection.SendMessage(Target, Method, Data);
+	});
+
+	if (!bDecoded)
+	{
+		UE_LOG(LogTemp, Error, TEXT("[FlutterBridge_Linux] Malformed outgoing batch of %d messages"), NumMessages);
+	}
+}
+
+/**
+ * Mirror game state to Flutter
+ * Called from the AFlutterBridge::MirrorState* functions on the game thread
+ */
+bool FlutterBridge_MirrorStateInt_Linux(const FString& Name, int64 Value)
+{
+	return FlutterStateMirror::IsAvailable() && FlutterStateMirror::Mirror->SetInt(Name, Value);
+}
+
+bool FlutterBridge_MirrorStateDouble_Linux(const FString& Name, double Value)
+{
+	return FlutterStateMirror::IsAvailable() && FlutterStateMirror::Mirror->SetDouble(Name, Value);
+}
+
+bool FlutterBridge_MirrorStateBool_Linux(const FString& Name, bool Value)
+{
+	return FlutterStateMirror::IsAvailable() && FlutterStateMirror::Mirror->SetBool(Name, Value);
+}
+
+void FlutterBridge_BeginStateMirrorUpdate_Linux()
+{
+	if (FlutterStateMirror::Mirror.IsValid())
+	{
+		FlutterStateMirror::Mirror->BeginWrite();
+	}
+}
+
+void FlutterBridge_EndStateMirrorUpdate_Linux()
+{
+	if (FlutterStateMirror::Mirror.IsValid())
+	{
+		FlutterStateMirror::Mirror->EndWrite();
+	}
+}
+
+bool FlutterBridge_IsStateMirrorAvailable_Linux()
+{
+	return FlutterStateMirror::IsAvailable();
+}
+
+#endif // PLATFORM_LINUX
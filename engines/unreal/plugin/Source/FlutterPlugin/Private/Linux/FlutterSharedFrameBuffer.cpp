@@ -0,0 +1,177 @@
+// Copyright Epic Games, Inc. All Rights Reserved.
+
+#include "FlutterSharedFrameBuffer.h"
+
+#if PLATFORM_LINUX
+
+#include <errno.h>
+#include <fcntl.h>
+#include <linux/futex.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <sys/syscall.h>
+#include <time.h>
+#include <unistd.h>
+#include <climits>
+
+using namespace FlutterSharedFrameBuffer;
+
+namespace
+{
+	/** CLOCK_MONOTONIC, the clock the plugin measures latency with */
+	uint64 MonotonicNanoseconds()
+	{
+		struct timespec Now;
+		clock_gettime(CLOCK_MONOTONIC, &Now);
+		return static_cast<uint64>(Now.tv_sec) * 1000000000ull + Now.tv_nsec;
+	}
+
+	/** The slots hold RGBA; one pass per row, as the copy is the main per-frame cost */
+	void SwizzleRow(const FColor* Source, uint32* Dest, uint32 Width)
+	{
+		const uint32* In = reinterpret_cast<const uint32*>(Source);
+		for (uint32 X = 0; X < Width; ++X)
+		{
+			const uint32 Pixel = In[X];
+			Dest[X] = (Pixel & 0xFF00FF00u) | ((Pixel & 0x00FF0000u) >> 16) | ((Pixel & 0x000000FFu) << 16);
+		}
+	}
+}
+
+// ============================================================
+// MARK: - Setup
+// ============================================================
+
+TUniquePtr<FFlutterSharedFrameBuffer> FFlutterSharedFrameBuffer::Open(const FString& Name, FString& OutError)
+{
+	const int Fd = shm_open(TCHAR_TO_UTF8(*Name), O_RDWR, 0);
+	if (Fd < 0)
+	{
+		OutError = FString::Printf(TEXT("shm_open(%s) failed: %s"), *Name, UTF8_TO_TCHAR(strerror(errno)));
+		return nullptr;
+	}
+
+	struct stat Info;
+	if (fstat(Fd, &Info) != 0 || static_cast<SIZE_T>(Info.st_size) < sizeof(FHeader))
+	{
+		close(Fd);
+		OutError = FString::Printf(TEXT("%s is too small for a frame buffer"), *Name);
+		return nullptr;
+	}
+
+	const SIZE_T MappedSize = static_cast<SIZE_T>(Info.st_size);
+	void* MappedMemory = mmap(nullptr, MappedSize, PROT_READ | PROT_WRITE, MAP_SHARED, Fd, 0);
+	close(Fd);
+	if (MappedMemory == MAP_FAILED)
+	{
+		OutError = FString::Printf(TEXT("mmap of %s failed: %s"), *Name, UTF8_TO_TCHAR(strerror(errno)));
+		return nullptr;
+	}
+
+	const FHeader* MappedHeader = static_cast<const FHeader*>(MappedMemory);
+	const uint64 SlotsEnd = MappedHeader->SlotsOffset + MappedHeader->SlotCapacity * NumSlots;
+	if (MappedHeader->Magic != Magic || MappedHeader->Version != Version || SlotsEnd > MappedSize ||
+		MappedHeader->SlotCapacity < static_cast<uint64>(MappedHeader->MaxWidth) * MappedHeader->MaxHeight * 4)
+	{
+		munmap(MappedMemory, MappedSize);
+		OutError = FString::Printf(TEXT("%s is not a version %u frame buffer"), *Name, Version);
+		return nullptr;
+	}
+
+	return TUniquePtr<FFlutterSharedFrameBuffer>(new FFlutterSharedFrameBuffer(MappedMemory, MappedSize));
+}
+
+FFlutterSharedFrameBuffer::FFlutterSharedFrameBuffer(void* InMapping, SIZE_T InSize)
+	: Mapping(InMapping)
+	, Size(InSize)
+	, Header(static_cast<FHeader*>(InMapping))
+{
+}
+
+FFlutterSharedFrameBuffer::~FFlutterSharedFrameBuffer()
+{
+	// The plugin owns the segment and unlinks it
+	munmap(Mapping, Size);
+}
+
+bool FFlutterSharedFrameBuffer::IsClosed() const
+{
+	return Header->Closed.load(std::memory_order_acquire) != 0;
+}
+
+uint8* FFlutterSharedFrameBuffer::GetSlotPixels(uint32 Slot) const
+{
+	return static_cast<uint8*>(Mapping) + Header->SlotsOffset + Header->SlotCapacity * Slot;
+}
+
+// ============================================================
+// MARK: - Publishing
+// ============================================================
+
+uint32 FFlutterSharedFrameBuffer::ClaimBackSlot() const
+{
+	// The back slot is whichever is neither middle nor front; read both between plugin swaps
+	for (;;)
+	{
+		const uint32 Middle = Header->Middle.load(std::memory_order_acquire) & SlotMask;
+		const uint32 Front = Header->Front.load(std::memory_order_acquire);
+		const uint32 MiddleAgain = Header->Middle.load(std::memory_order_acquire) & SlotMask;
+		if (Middle == MiddleAgain && Middle != Front && Front < NumSlots)
+		{
+			return 3 - Middle - Front;
+		}
+	}
+}
+
+bool FFlutterSharedFrameBuffer::Publish(const FColor* Pixels, uint32 Width, uint32 Height, uint32 Stride)
+{
+	const uint32 RowBytes = Width * 4;
+	if (Pixels == nullptr || Width == 0 || Height == 0 || Stride < RowBytes ||
+		Width > Header->MaxWidth || Height > Header->MaxHeight)
+	{
+		Header->FramesRejected.fetch_add(1, std::memory_order_relaxed);
+		return false;
+	}
+
+	if (BackSlot >= NumSlots)
+	{
+		// First frame since the engine opened the segment: continue any earlier sequence
+		BackSlot = ClaimBackSlot();
+		for (const FSlotHeader& Slot : Header->Slots)
+		{
+			NextSequence = FMath::Max(NextSequence, Slot.Sequence + 1);
+		}
+	}
+
+	const uint64 Start = MonotonicNanoseconds();
+	uint8* Dest = GetSlotPixels(BackSlot);
+	const uint8* Source = reinterpret_cast<const uint8*>(Pixels);
+	for (uint32 Y = 0; Y < Height; ++Y)
+	{
+		SwizzleRow(reinterpret_cast<const FColor*>(Source + static_cast<SIZE_T>(Stride) * Y),
+			reinterpret_cast<uint32*>(Dest + static_cast<SIZE_T>(RowBytes) * Y), Width);
+	}
+	const uint64 End = MonotonicNanoseconds();
+	LastCopyNs = End - Start;
+
+	FSlotHeader& Slot = Header->Slots[BackSlot];
+	Slot.Sequence = NextSequence++;
+	Slot.Width = Width;
+	Slot.Height = Height;
+	Slot.Stride = RowBytes;
+	Slot.CopyNs = LastCopyNs;
+	Slot.PublishTimeNs = End;
+
+	BackSlot = Header->Middle.exchange(BackSlot | FreshBit, std::memory_order_acq_rel) & SlotMask;
+	Header->FramesPublished.fetch_add(1, std::memory_order_relaxed);
+
+	// Wake the plugin's watcher thread only if it is asleep
+	Header->FrameCounter.fetch_add(1, std::memory_order_release);
+	if (Header->Waiters.load(std::memory_order_acquire) != 0)
+	{
+		syscall(SYS_futex, reinterpret_cast<uint32*>(&Header->FrameCounter), FUTEX_WAKE, INT_MAX, nullptr, nullptr, 0);
+	}
+	return true;
+}
+
+#endif // PLATFORM_LINUX
@@ -0,0 +1,105 @@
+// Copyright Epic Games, Inc. All Rights Reserved.
+
+#pragma once
+
+#include "CoreMinimal.h"
+
+#if PLATFORM_LINUX
+
+#include <atomic>
+
+/**
+ * Flutter Shared Frame Buffer
+ *
+ * Writer side of the shared-memory frame transport to the Flutter Linux plugin. The
+ * plugin creates the segment (frameTexture#create) and passes its name to the engine;
+ * the engine copies each finished frame into it, and the plugin shows the latest one
+ * in a Flutter Texture widget.
+ *
+ * Three slots: the engine fills its back slot and swaps it with the shared middle
+ * slot in one atomic exchange, the plugin swaps its front slot with the middle one.
+ * Neither side ever waits for the other and no slot is written while it is read.
+ *
+ * The layout must match engines/unreal/dart/linux/frame_buffer.h.
+ */
+namespace FlutterSharedFrameBuffer
+{
+	static constexpr uint32 Magic = 0x42464647; // "GFFB"
+	static constexpr uint32 Version = 1;
+	static constexpr uint32 NumSlots = 3;
+	static constexpr uint32 FreshBit = 0x4;
+	static constexpr uint32 SlotMask = 0x3;
+
+	struct FSlotHeader
+	{
+		uint64 Sequence;
+		uint32 Width;
+		uint32 Height;
+		uint32 Stride;
+		uint32 Reserved;
+		uint64 CopyNs;
+		uint64 PublishTimeNs;
+	};
+
+	struct FHeader
+	{
+		uint32 Magic;
+		uint32 Version;
+		uint32 MaxWidth;
+		uint32 MaxHeight;
+		uint64 SlotCapacity;
+		uint64 SlotsOffset;
+		std::atomic<uint32> Middle;
+		std::atomic<uint32> Front;
+		std::atomic<uint32> FrameCounter;
+		std::atomic<uint32> Waiters;
+		std::atomic<uint32> Closed;
+		uint32 Reserved;
+		std::atomic<uint64> FramesPublished;
+		std::atomic<uint64> FramesRejected;
+		FSlotHeader Slots[NumSlots];
+	};
+
+	static_assert(sizeof(FSlotHeader) == 40, "Frame slot header layout changed");
+	static_assert(sizeof(FHeader) == 192, "Frame buffer header layout changed");
+}
+
+class FFlutterSharedFrameBuffer
+{
+public:
+	/** Map the segment the Flutter plugin created; null with OutError set on failure */
+	static TUniquePtr<FFlutterSharedFrameBuffer> Open(const FString& Name, FString& OutError);
+
+	~FFlutterSharedFrameBuffer();
+
+	/**
+	 * Copy a BGRA frame (FColor order) into the back slot and make it the latest.
+	 * Rows are Stride bytes apart. Frames larger than the segment allows are rejected.
+	 */
+	bool Publish(const FColor* Pixels, uint32 Width, uint32 Height, uint32 Stride);
+
+	/** True once the plugin has disposed of the texture */
+	bool IsClosed() const;
+
+	uint32 GetMaxWidth() const { return Header->MaxWidth; }
+	uint32 GetMaxHeight() const { return Header->MaxHeight; }
+
+	/** Conversion and copy time of the last published frame */
+	double GetLastCopyMs() const { return LastCopyNs / 1e6; }
+
+private:
+	FFlutterSharedFrameBuffer(void* InMapping, SIZE_T InSize);
+
+	uint8* GetSlotPixels(uint32 Slot) const;
+	uint32 ClaimBackSlot() const;
+
+	void* Mapping;
+	SIZE_T Size;
+	FlutterSharedFrameBuffer::FHeader* Header;
+
+	uint32 BackSlot = FlutterSharedFrameBuffer::NumSlots;
+	uint64 NextSequence = 1;
+	uint64 LastCopyNs = 0;
+};
+
+#endif // PLATFORM_LINUX
@@ -0,0 +1,186 @@
+// Copyright Epic Games, Inc. All Rights Reserved.
+
+#include "FlutterSharedStateMirror.h"
+
+#if PLATFORM_LINUX
+
+#include <errno.h>
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <time.h>
+#include <unistd.h>
+#include <cstring>
+
+using namespace FlutterSharedStateMirror;
+
+namespace
+{
+	/** CLOCK_MONOTONIC, the clock the plugin measures the state's age with */
+	uint64 MonotonicNanoseconds()
+	{
+		struct timespec Now;
+		clock_gettime(CLOCK_MONOTONIC, &Now);
+		return static_cast<uint64>(Now.tv_sec) * 1000000000ull + Now.tv_nsec;
+	}
+}
+
+// ============================================================
+// MARK: - Setup
+// ============================================================
+
+TUniquePtr<FFlutterSharedStateMirror> FFlutterSharedStateMirror::Open(const FString& Name, FString& OutError)
+{
+	const int Fd = shm_open(TCHAR_TO_UTF8(*Name), O_RDWR, 0);
+	if (Fd < 0)
+	{
+		OutError = FString::Printf(TEXT("shm_open(%s) failed: %s"), *Name, UTF8_TO_TCHAR(strerror(errno)));
+		return nullptr;
+	}
+
+	struct stat Info;
+	if (fstat(Fd, &Info) != 0 || static_cast<SIZE_T>(Info.st_size) < sizeof(FHeader))
+	{
+		close(Fd);
+		OutError = FString::Printf(TEXT("%s is too small for a state mirror"), *Name);
+		return nullptr;
+	}
+
+	void* MappedMemory = mmap(nullptr, sizeof(FHeader), PROT_READ | PROT_WRITE, MAP_SHARED, Fd, 0);
+	close(Fd);
+	if (MappedMemory == MAP_FAILED)
+	{
+		OutError = FString::Printf(TEXT("mmap of %s failed: %s"), *Name, UTF8_TO_TCHAR(strerror(errno)));
+		return nullptr;
+	}
+
+	const FHeader* MappedHeader = static_cast<const FHeader*>(MappedMemory);
+	if (MappedHeader->Magic != Magic || MappedHeader->Version != Version || MappedHeader->Capacity != NumFields)
+	{
+		munmap(MappedMemory, sizeof(FHeader));
+		OutError = FString::Printf(TEXT("%s is not a version %u state mirror"), *Name, Version);
+		return nullptr;
+	}
+
+	return TUniquePtr<FFlutterSharedStateMirror>(new FFlutterSharedStateMirror(MappedMemory));
+}
+
+FFlutterSharedStateMirror::FFlutterSharedStateMirror(void* InMapping)
+	: Mapping(InMapping)
+	, Header(static_cast<FHeader*>(InMapping))
+{
+}
+
+FFlutterSharedStateMirror::~FFlutterSharedStateMirror()
+{
+	// The plugin owns the segment and unlinks it
+	munmap(Mapping, sizeof(FHeader));
+}
+
+bool FFlutterSharedStateMirror::IsClosed() const
+{
+	return Header->Closed.load(std::memory_order_acquire) != 0;
+}
+
+// ============================================================
+// MARK: - Writing
+// ============================================================
+
+void FFlutterSharedStateMirror::BeginWrite()
+{
+	if (WriteDepth++ > 0)
+	{
+		return;
+	}
+
+	// Still odd if an earlier engine process died mid-write
+	const uint64 Sequence = Header->Sequence.load(std::memory_order_relaxed);
+	if ((Sequence & 1) == 0)
+	{
+		Header->Sequence.store(Sequence + 1, std::memory_order_relaxed);
+	}
+	std::atomic_thread_fence(std::memory_order_release);
+}
+
+void FFlutterSharedStateMirror::EndWrite()
+{
+	if (WriteDepth == 0 || --WriteDepth > 0)
+	{
+		return;
+	}
+
+	Header->WriteTimeNs.store(MonotonicNanoseconds(), std::memory_order_relaxed);
+	Header->Writes.fetch_add(1, std::memory_order_relaxed);
+	Header->Sequence.store(Header->Sequence.load(std::memory_order_relaxed) + 1, std::memory_order_release);
+}
+
+int32 FFlutterSharedStateMirror::Declare(const FString& Name, EFieldType Type)
+{
+	if (const int32* Known = FieldIndices.Find(Name))
+	{
+		return Header->Fields[*Known].Type == static_cast<uint32>(Type) ? *Known : INDEX_NONE;
+	}
+
+	FTCHARToUTF8 Utf8Name(*Name);
+	const int32 Length = Utf8Name.Length();
+	if (Length == 0 || Length >= static_cast<int32>(NameSize))
+	{
+		return INDEX_NONE;
+	}
+
+	// Fields an earlier engine process declared keep their place
+	const uint32 Count = Header->FieldCount.load(std::memory_order_acquire);
+	for (uint32 Index = 0; Index < Count; ++Index)
+	{
+		if (strcmp(Header->Fields[Index].Name, Utf8Name.Get()) == 0)
+		{
+			FieldIndices.Add(Name, Index);
+			return Header->Fields[Index].Type == static_cast<uint32>(Type) ? static_cast<int32>(Index) : INDEX_NONE;
+		}
+	}
+	if (Count >= NumFields)
+	{
+		return INDEX_NONE;
+	}
+
+	FField& Field = Header->Fields[Count];
+	FMemory::Memcpy(Field.Name, Utf8Name.Get(), Length);
+	Field.Name[Length] = '\0';
+	Field.Type = static_cast<uint32>(Type);
+	Field.Value.store(0, std::memory_order_relaxed);
+	// The plugin looks at a field's name and type only below FieldCount
+	Header->FieldCount.store(Count + 1, std::memory_order_release);
+	FieldIndices.Add(Name, Count);
+	return static_cast<int32>(Count);
+}
+
+bool FFlutterSharedStateMirror::Set(const FString& Name, EFieldType Type, uint64 Bits)
+{
+	BeginWrite();
+	const int32 Index = Declare(Name, Type);
+	if (Index != INDEX_NONE)
+	{
+		Header->Fields[Index].Value.store(Bits, std::memory_order_relaxed);
+	}
+	EndWrite();
+	return Index != INDEX_NONE;
+}
+
+bool FFlutterSharedStateMirror::SetInt(const FString& Name, int64 Value)
+{
+	return Set(Name, EFieldType::Int, static_cast<uint64>(Value));
+}
+
+bool FFlutterSharedStateMirror::SetDouble(const FString& Name, double Value)
+{
+	uint64 Bits;
+	FMemory::Memcpy(&Bits, &Value, sizeof(Bits));
+	return Set(Name, EFieldType::Double, Bits);
+}
+
+bool FFlutterSharedStateMirror::SetBool(const FString& Name, bool Value)
+{
+	return Set(Name, EFieldType::Bool, Value ? 1 : 0);
+}
+
+#endif // PLATFORM_LINUX
@@ -0,0 +1,104 @@
+// Copyright Epic Games, Inc. All Rights Reserved.
+
+#pragma once
+
+#include "CoreMinimal.h"
+
+#if PLATFORM_LINUX
+
+#include <atomic>
+
+/**
+ * Flutter Shared State Mirror
+ *
+ * Writer side of the shared-memory state mirror read by the Flutter Linux plugin. The
+ * plugin creates the segment and passes its name to the engine; the engine writes named
+ * numeric fields into it and Flutter reads them when it draws, with no message either way.
+ *
+ * A seqlock guards the values: a write makes Sequence odd, stores the values and makes it
+ * even again, and the plugin retries any read that overlapped a write. A field's name and
+ * type are fixed when it is declared and published through FieldCount.
+ *
+ * The layout must match engines/unreal/dart/linux/state_mirror.h.
+ */
+namespace FlutterSharedStateMirror
+{
+	static constexpr uint32 Magic = 0x4D534647; // "GFSM"
+	static constexpr uint32 Version = 1;
+	static constexpr uint32 NumFields = 64;
+	static constexpr uint32 NameSize = 48;
+
+	enum class EFieldType : uint32
+	{
+		None = 0,
+		Int = 1,
+		Double = 2,
+		Bool = 3,
+	};
+
+	struct FField
+	{
+		ANSICHAR Name[NameSize];
+		uint32 Type;
+		uint32 Reserved;
+		std::atomic<uint64> Value;
+	};
+
+	struct FHeader
+	{
+		uint32 Magic;
+		uint32 Version;
+		uint32 Capacity;
+		std::atomic<uint32> FieldCount;
+		std::atomic<uint64> Sequence;
+		std::atomic<uint64> WriteTimeNs;
+		std::atomic<uint64> Writes;
+		std::atomic<uint32> Closed;
+		uint32 Reserved;
+		uint64 Reserved2[2];
+		FField Fields[NumFields];
+	};
+
+	static_assert(sizeof(FField) == 64, "State field layout changed");
+	static_assert(sizeof(FHeader) == 64 + 64 * NumFields, "State mirror header layout changed");
+}
+
+class FFlutterSharedStateMirror
+{
+public:
+	/** Map the segment the Flutter plugin created; null with OutError set on failure */
+	static TUniquePtr<FFlutterSharedStateMirror> Open(const FString& Name, FString& OutError);
+
+	~FFlutterSharedStateMirror();
+
+	/** Fields set between BeginWrite() and EndWrite() reach Flutter together; calls nest */
+	void BeginWrite();
+	void EndWrite();
+
+	/**
+	 * Set a field, declaring it on first use; outside BeginWrite() it is a write of its own.
+	 * False if the name is empty or longer than 47 bytes, the field has another type, or
+	 * all 64 fields are taken.
+	 */
+	bool SetInt(const FString& Name, int64 Value);
+	bool SetDouble(const FString& Name, double Value);
+	bool SetBool(const FString& Name, bool Value);
+
+	/** True once the plugin has gone away */
+	bool IsClosed() const;
+
+private:
+	FFlutterSharedStateMirror(void* InMapping);
+
+	bool Set(const FString& Name, FlutterSharedStateMirror::EFieldType Type, uint64 Bits);
+	int32 Declare(const FString& Name, FlutterSharedStateMirror::EFieldType Type);
+
+	void* Mapping;
+	FlutterSharedStateMirror::FHeader* Header;
+
+	/** Field index by name, so a set does not scan the segment */
+	TMap<FString, int32> FieldIndices;
+	int32 WriteDepth = 0;
+};
+
+#endif // PLATFORM_LINUX
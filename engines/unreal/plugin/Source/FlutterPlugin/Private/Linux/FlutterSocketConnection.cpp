@@ -0,0 +1,283 @@
+// Copyright Epic Games, Inc. All Rights Reserved.
+
+#include "FlutterSocketConnection.h"
+
+#if PLATFORM_LINUX
+
+#include "HAL/RunnableThread.h"
+#include "Misc/ScopeLock.h"
+#include "Containers/StringConv.h"
+#include <errno.h>
+#include <sys/socket.h>
+#include <sys/un.h>
+#include <unistd.h>
+
+using namespace FlutterSocketProtocol;
+
+namespace
+{
+	void AppendUint32(TArray<uint8>& Out, uint32 Value)
+	{
+		Out.Add(Value & 0xFF);
+		Out.Add((Value >> 8) & 0xFF);
+		Out.Add((Value >> 16) & 0xFF);
+		Out.Add((Value >> 24) & 0xFF);
+	}
+
+	uint32 ReadUint32(const uint8* Data)
+	{
+		return static_cast<uint32>(Data[0]) | (static_cast<uint32>(Data[1]) << 8) |
+			(static_cast<uint32>(Data[2]) << 16) | (static_cast<uint32>(Data[3]) << 24);
+	}
+
+	void AppendString(TArray<uint8>& Out, const FString& Value)
+	{
+		FTCHARToUTF8 Utf8(*Value);
+		AppendUint32(Out, Utf8.Length());
+		Out.Append(reinterpret_cast<const uint8*>(Utf8.Get()), Utf8.Length());
+	}
+}
+
+// ============================================================
+// MARK: - Setup
+// ============================================================
+
+TUniquePtr<FFlutterSocketConnection> FFlutterSocketConnection::Connect(const FString& Path, FRequestHandler Handler, FString& OutError)
+{
+	FTCHARToUTF8 PathUtf8(*Path);
+	struct sockaddr_un Address = {};
+	Address.sun_family = AF_UNIX;
+	if (PathUtf8.Length() == 0 || PathUtf8.Length() >= static_cast<int32>(sizeof(Address.sun_path)))
+	{
+		OutError = FString::Printf(TEXT("Invalid socket path %s"), *Path);
+		return nullptr;
+	}
+	FMemory::Memcpy(Address.sun_path, PathUtf8.Get(), PathUtf8.Length());
+
+	const int Socket = socket(AF_UNIX, SOCK_STREAM | SOCK_CLOEXEC, 0);
+	if (Socket < 0 || connect(Socket, reinterpret_cast<struct sockaddr*>(&Address), sizeof(Address)) != 0)
+	{
+		OutError = FString::Printf(TEXT("Connecting to %s failed: %s"), *Path, UTF8_TO_TCHAR(strerror(errno)));
+		if (Socket >= 0)
+		{
+			close(Socket);
+		}
+		return nullptr;
+	}
+
+	const int BufferSize = 1024 * 1024;
+	setsockopt(Socket, SOL_SOCKET, SO_SNDBUF, &BufferSize, sizeof(BufferSize));
+	setsockopt(Socket, SOL_SOCKET, SO_RCVBUF, &BufferSize, sizeof(BufferSize));
+
+	TUniquePtr<FFlutterSocketConnection> Connection(new FFlutterSocketConnection(Socket, MoveTemp(Handler)));
+	Connection->Thread = FRunnableThread::Create(Connection.Get(), TEXT("FlutterSocketConnection"));
+	return Connection;
+}
+
+FFlutterSocketConnection::FFlutterSocketConnection(int InSocket, FRequestHandler InHandler)
+	: Socket(InSocket)
+	, Handler(MoveTemp(InHandler))
+{
+}
+
+FFlutterSocketConnection::~FFlutterSocketConnection()
+{
+	Stop();
+	if (Thread)
+	{
+		Thread->WaitForCompletion();
+		delete Thread;
+		Thread = nullptr;
+	}
+	close(Socket);
+}
+
+void FFlutterSocketConnection::Stop()
+{
+	// Unblocks the reader; the plugin sees the engine disconnect
+	bConnected = false;
+	shutdown(Socket, SHUT_RDWR);
+}
+
+// ============================================================
+// MARK: - Reading
+// ============================================================
+
+uint32 FFlutterSocketConnection::Run()
+{
+	TArray<uint8> Buffer;
+	int32 Consumed = 0;
+	uint8 Chunk[64 * 1024];
+
+	while (bConnected)
+	{
+		const ssize_t Count = recv(Socket, Chunk, sizeof(Chunk), 0);
+		if (Count < 0 && errno == EINTR)
+		{
+			continue;
+		}
+		if (Count <= 0)
+		{
+			break;
+		}
+
+		if (Consumed > 0 && Consumed >= Buffer.Num() / 2)
+		{
+			Buffer.RemoveAt(0, Consumed);
+			Consumed = 0;
+		}
+		Buffer.Append(Chunk, Count);
+
+		while (Buffer.Num() - Consumed >= 4)
+		{
+			const uint32 Length = ReadUint32(Buffer.GetData() + Consumed);
+			if (Length < HeaderSize || Length > MaxFrameSize)
+			{
+				UE_LOG(LogTemp, Error, TEXT("[FlutterSocketConnection] Malformed frame from Flutter; disconnecting"));
+				// Closes the plugin's end too, so it fails its outstanding requests instead of waiting them out
+				shutdown(Socket, SHUT_RDWR);
+				bConnected = false;
+				break;
+			}
+			if (static_cast<uint32>(Buffer.Num() - Consumed - 4) < Length)
+			{
+				break;
+			}
+
+			const uint8* Header = Buffer.GetData() + Consumed + 4;
+			if (static_cast<EFrameType>(Header[0]) == EFrameType::Request)
+			{
+				FRequest Request;
+				Request.Op = static_cast<EOp>(Header[1]);
+				Request.RequestId = ReadUint32(Header + 4);
+				Request.Payload.Append(Header + HeaderSize, Length - HeaderSize);
+				Handler(*this, MoveTemp(Request));
+			}
+			Consumed += 4 + Length;
+		}
+	}
+
+	bConnected = false;
+	UE_LOG(LogTemp, Log, TEXT("[FlutterSocketConnection] Disconnected from Flutter"));
+	return 0;
+}
+
+bool FFlutterSocketConnection::DecodeStrings(TConstArrayView<uint8> Payload, TArray<FString>& OutStrings)
+{
+	OutStrings.Reset();
+	int32 Offset = 0;
+	while (Offset < Payload.Num())
+	{
+		if (Payload.Num() - Offset < 4)
+		{
+			return false;
+		}
+		const uint32 Length = ReadUint32(Payload.GetData() + Offset);
+		Offset += 4;
+		if (static_cast<uint32>(Payload.Num() - Offset) < Length)
+		{
+			return false;
+		}
+		FUTF8ToTCHAR Converted(reinterpret_cast<const ANSICHAR*>(Payload.GetData() + Offset), Length);
+		OutStrings.Emplace(Converted.Length(), Converted.Get());
+		Offset += Length;
+	}
+	return true;
+}
+
+// ============================================================
+// MARK: - Writing
+// ============================================================
+
+bool FFlutterSocketConnection::SendFrame(EFrameType Type, EOp Op, uint32 RequestId, TConstArrayView<uint8> Payload)
+{
+	if (!bConnected || static_cast<uint32>(Payload.Num()) > MaxFrameSize - HeaderSize)
+	{
+		return false;
+	}
+
+	uint8 Header[4 + HeaderSize] = {};
+	const uint32 Length = HeaderSize + Payload.Num();
+	Header[0] = Length & 0xFF;
+	Header[1] = (Length >> 8) & 0xFF;
+	Header[2] = (Length >> 16) & 0xFF;
+	Header[3] = (Length >> 24) & 0xFF;
+	Header[4] = static_cast<uint8>(Type);
+	Header[5] = static_cast<uint8>(Op);
+	Header[8] = RequestId & 0xFF;
+	Header[9] = (RequestId >> 8) & 0xFF;
+	Header[10] = (RequestId >> 16) & 0xFF;
+	Header[11] = (RequestId >> 24) & 0xFF;
+
+	// Header and payload in one sendmsg, without copying the payload
+	struct iovec Parts[2] = {
+		{ Header, sizeof(Header) },
+		{ const_cast<uint8*>(Payload.GetData()), static_cast<size_t>(Payload.Num()) }
+	};
+	struct msghdr Message = {};
+	Message.msg_iov = Parts;
+	Message.msg_iovlen = 2;
+
+	FScopeLock Lock(&WriteLock);
+	while (Message.msg_iovlen > 0)
+	{
+		const ssize_t Sent = sendmsg(Socket, &Message, MSG_NOSIGNAL);
+		if (Sent < 0 && errno == EINTR)
+		{
+			continue;
+		}
+		if (Sent < 0)
+		{
+			bConnected = false;
+			return false;
+		}
+
+		// Skip whatever was written, possibly part of one part
+		size_t Remaining = static_cast<size_t>(Sent);
+		while (Message.msg_iovlen > 0 && Remaining >= Message.msg_iov[0].iov_len)
+		{
+			Remaining -= Message.msg_iov[0].iov_len;
+			++Message.msg_iov;
+			--Message.msg_iovlen;
+		}
+		if (Message.msg_iovlen > 0)
+		{
+			Message.msg_iov[0].iov_base = static_cast<uint8*>(Message.msg_iov[0].iov_base) + Remaining;
+			Message.msg_iov[0].iov_len -= Remaining;
+		}
+	}
+	return true;
+}
+
+void FFlutterSocketConnection::Respond(const FRequest& Request, TConstArrayView<uint8> Payload)
+{
+	if (Request.IsPosted())
+	{
+		return;
+	}
+	SendFrame(EFrameType::Response, Request.Op, Request.RequestId, Payload);
+}
+
+void FFlutterSocketConnection::RespondError(const FRequest& Request, const FString& Message)
+{
+	if (Request.IsPosted())
+	{
+		UE_LOG(LogTemp, Warning, TEXT("[FlutterSocketConnection] Posted message failed: %s"), *Message);
+		return;
+	}
+	FTCHARToUTF8 Utf8(*Message);
+	SendFrame(EFrameType::Error, Request.Op, Request.RequestId,
+		TConstArrayView<uint8>(reinterpret_cast<const uint8*>(Utf8.Get()), Utf8.Length()));
+}
+
+bool FFlutterSocketConnection::SendMessage(const FString& Target, const FString& Method, const FString& Data)
+{
+	TArray<uint8> Payload;
+	Payload.Reserve(12 + Target.Len() + Method.Len() + Data.Len());
+	AppendString(Payload, Target);
+	AppendString(Payload, Method);
+	AppendString(Payload, Data);
+	return SendFrame(EFrameType::Event, EOp::Message, 0, Payload);
+}
+
+#endif // PLATFORM_LINUX
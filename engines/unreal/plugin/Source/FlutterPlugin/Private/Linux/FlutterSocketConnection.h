@@ -0,0 +1,106 @@
+// Copyright Epic Games, Inc. All Rights Reserved.
+
+#pragma once
+
+#include "CoreMinimal.h"
+
+#if PLATFORM_LINUX
+
+#include "HAL/Runnable.h"
+#include "HAL/CriticalSection.h"
+#include <atomic>
+
+class FRunnableThread;
+
+/**
+ * Wire format shared with the Flutter Linux plugin (engines/unreal/dart/linux/engine_transport.h)
+ *
+ * Each frame: uint32 length of the rest (little endian), uint8 type, uint8 op, uint16 reserved,
+ * uint32 request id, payload. String payloads are each a uint32 length and UTF-8 bytes.
+ * Requests with id 0 are posted from Flutter's message lane and get no response.
+ */
+namespace FlutterSocketProtocol
+{
+	enum class EFrameType : uint8
+	{
+		Request = 1,
+		Response = 2,
+		Error = 3,
+		Event = 4
+	};
+
+	enum class EOp : uint8
+	{
+		Ping = 0,
+		SendMessage = 1,
+		SendJsonMessage = 2,
+		ExecuteConsoleCommand = 3,
+		LoadLevel = 4,
+		Message = 5
+	};
+
+	static constexpr uint32 HeaderSize = 8;
+	static constexpr uint32 MaxFrameSize = 64 * 1024 * 1024;
+}
+
+/**
+ * Flutter Socket Connection
+ *
+ * Engine end of the Unix domain socket the Flutter Linux plugin listens on. A reader thread
+ * splits incoming bytes into requests and hands them to the request handler; responses and
+ * messages can be sent from any thread.
+ */
+class FFlutterSocketConnection : public FRunnable
+{
+public:
+	struct FRequest
+	{
+		uint32 RequestId = 0;
+		FlutterSocketProtocol::EOp Op = FlutterSocketProtocol::EOp::Ping;
+		TArray<uint8> Payload;
+
+		/** Posted requests are carried out without an answer */
+		bool IsPosted() const { return RequestId == 0; }
+	};
+
+	/** Called on the reader thread for every request */
+	using FRequestHandler = TFunction<void(FFlutterSocketConnection& Connection, FRequest&& Request)>;
+
+	/** Connect to the plugin's socket; null with OutError set on failure */
+	static TUniquePtr<FFlutterSocketConnection> Connect(const FString& Path, FRequestHandler Handler, FString& OutError);
+
+	virtual ~FFlutterSocketConnection();
+
+	/** Answer a request with a raw payload */
+	void Respond(const FRequest& Request, TConstArrayView<uint8> Payload);
+
+	/** Fail a request; the plugin reports Message to Dart */
+	void RespondError(const FRequest& Request, const FString& Message);
+
+	/** Send an engine message to Flutter (onMessage) */
+	bool SendMessage(const FString& Target, const FString& Method, const FString& Data);
+
+	bool IsConnected() const { return bConnected.load(); }
+
+	/** Split a string payload; false if it is malformed */
+	static bool DecodeStrings(TConstArrayView<uint8> Payload, TArray<FString>& OutStrings);
+
+	// FRunnable
+	virtual uint32 Run() override;
+	virtual void Stop() override;
+
+private:
+	FFlutterSocketConnection(int InSocket, FRequestHandler InHandler);
+
+	bool SendFrame(FlutterSocketProtocol::EFrameType Type, FlutterSocketProtocol::EOp Op, uint32 RequestId, TConstArrayView<uint8> Payload);
+
+	int Socket;
+	FRequestHandler Handler;
+	FRunnableThread* Thread = nullptr;
+	std::atomic<bool> bConnected{ true };
+
+	/** Frames from several threads must not interleave */
+	FCriticalSection WriteLock;
+};
+
+#endif // PLATFORM_LINUX
@@ -31,10 +31,10 @@ void FlutterBridge_SendToFlutter_Mac(const FString& Target, const FString& Metho
  * Send binary data to Flutter via macOS
  * Called from AFlutterBridge::SendBinaryToFlutter()
  */
-void FlutterBridge_SendBinaryToFlutter_Mac(const FString& Target, const FString& Method, const TArray<uint8>& Data, int32 Checksum)
+void FlutterBridge_SendBinaryToFlutter_Mac(const FString& Target, const FString& Method, const TArray<uint8>& Data, bool bIsCompressed, int32 Checksum)
 {
-	UE_LOG(LogTemp, Log, TEXT("[FlutterBridge_Mac] SendBinaryToFlutter: Target=%s, Method=%s, Size=%d, Checksum=%d"), 
-		*Target, *Method, Data.Num(), Checksum);
+	UE_LOG(LogTemp, Log, TEXT("[FlutterBridge_Mac] SendBinaryToFlutter: Target=%s, Method=%s, Size=%d, Compressed=%d, Checksum=%d"), 
+		*Target, *Method, Data.Num(), bIsCompressed ? 1 : 0, Checksum);
 	
 	// TODO: Implement actual binary communication with Flutter
 	// This would typically use method channels via the Flutter engine
@@ -60,18 +60,12 @@ AFlutterBridge* FlutterBridge_GetInstance_Mac()
 
 /**
  * Receive a message from Flutter
- * This should be called from the Flutter side when a message needs to be sent to Unreal
+ * This should be called from the Flutter side when a message needs to be sent to Unreal.
+ * Safe to call from any thread; delivery happens on the game thread.
  */
 void FlutterBridge_ReceiveFromFlutter_Mac(const FString& Target, const FString& Method, const FString& Data)
 {
-	if (GFlutterBridgeInstance)
-	{
-		GFlutterBridgeInstance->ReceiveFromFlutter(Target, Method, Data);
-	}
-	else
-	{
-		UE_LOG(LogTemp, Warning, TEXT("[FlutterBridge_Mac] Cannot receive from Flutter: Bridge instance not set"));
-	}
+	AFlutterBridge::EnqueueFromFlutter(Target, Method, Data);
 }
 
 #endif // PLATFORM_MAC
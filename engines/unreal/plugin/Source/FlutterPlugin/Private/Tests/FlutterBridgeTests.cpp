@@ -0,0 +1,297 @@
+// Copyright Epic Games, Inc. All Rights Reserved.
+
+#include "FlutterBridge.h"
+#include "Misc/AutomationTest.h"
+#include "Async/ParallelFor.h"
+#include "Engine/World.h"
+#include "HAL/PlatformTime.h"
+
+#if WITH_DEV_AUTOMATION_TESTS
+
+namespace FlutterBridgeTests
+{
+	/** Spawns a bridge into a throwaway world and tears both down */
+	struct FScopedTestBridge
+	{
+		UWorld* World;
+		AFlutterBridge* Bridge;
+
+		FScopedTestBridge()
+		{
+			World = UWorld::CreateWorld(EWorldType::Game, false);
+			Bridge = World->SpawnActor<AFlutterBridge>();
+		}
+
+		~FScopedTestBridge()
+		{
+			World->DestroyWorld(false);
+		}
+
+		/** Deliver everything currently queued, ignoring the time budget */
+		void DrainAll()
+		{
+			const float SavedBudget = Bridge->IngressTimeBudgetMs;
+			Bridge->IngressTimeBudgetMs = 60000.0f;
+			Bridge->Tick(0.0f);
+			Bridge->IngressTimeBudgetMs = SavedBudget;
+		}
+	};
+}
+
+// ============================================================
+// MARK: - Ingress Queue
+// ============================================================
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FFlutterBridgeIngressQueueTest, "FlutterPlugin.Bridge.IngressQueue",
+	EAutomationTestFlags::ApplicationContextMask | EAutomationTestFlags::ProductFilter)
+
+bool FFlutterBridgeIngressQueueTest::RunTest(const FString& Parameters)
+{
+	using namespace FlutterBridgeTests;
+
+	FScopedTestBridge Scope;
+	Scope.DrainAll();
+
+	const int32 NumProducers = 4;
+	const int32 MessagesPerProducer = 500;
+	const int32 MaxDepth = 1000;
+
+	const FFlutterIngressStatistics Before = AFlutterBridge::GetIngressStatistics();
+	AFlutterBridge::SetMaxIngressQueueDepth(MaxDepth);
+
+	// Native threads push concurrently without touching the bridge
+	ParallelFor(NumProducers, [](int32 Producer)
+	{
+		for (int32 Index = 0; Index < MessagesPerProducer; ++Index)
+		{
+			AFlutterBridge::EnqueueFromFlutter(TEXT("Bench"), TEXT("onMessage"), FString::Printf(TEXT("%d:%d"), Producer, Index));
+		}
+	});
+
+	FFlutterIngressStatistics After = AFlutterBridge::GetIngressStatistics();
+	TestEqual(TEXT("Accepted up to the depth limit"), After.Enqueued - Before.Enqueued, (int64)MaxDepth);
+	TestEqual(TEXT("Excess rejected"), After.Rejected - Before.Rejected, (int64)(NumProducers * MessagesPerProducer - MaxDepth));
+	TestEqual(TEXT("Depth at limit"), After.Depth, MaxDepth);
+	TestTrue(TEXT("Peak depth tracked"), After.PeakDepth >= MaxDepth);
+
+	// A tiny budget still makes progress and reports the backlog
+	Scope.Bridge->IngressTimeBudgetMs = 0.1f;
+	Scope.Bridge->Tick(0.0f);
+	After = AFlutterBridge::GetIngressStatistics();
+	TestTrue(TEXT("At least one message delivered per tick"), After.Delivered - Before.Delivered >= 1);
+
+	Scope.DrainAll();
+	After = AFlutterBridge::GetIngressStatistics();
+	TestEqual(TEXT("Every accepted message delivered"), After.Delivered - Before.Delivered, (int64)MaxDepth);
+	TestEqual(TEXT("Queue empty"), After.Depth, 0);
+
+	AFlutterBridge::SetMaxIngressQueueDepth(4096);
+
+	return true;
+}
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FFlutterBridgeIngressChunkLimitTest, "FlutterPlugin.Bridge.IngressChunkLimit",
+	EAutomationTestFlags::ApplicationContextMask | EAutomationTestFlags::ProductFilter)
+
+bool FFlutterBridgeIngressChunkLimitTest::RunTest(const FString& Parameters)
+{
+	using namespace FlutterBridgeTests;
+
+	FScopedTestBridge Scope;
+	Scope.DrainAll();
+
+	auto MakeChunk = [](FFlutterIngressMessage::EKind Kind)
+	{
+		FFlutterIngressMessage Message;
+		Message.Kind = Kind;
+		Message.Target = TEXT("Bench");
+		Message.Method = TEXT("onChunk");
+		Message.TransferId = TEXT("limit-test");
+		Message.TotalChunks = 1;
+		return Message;
+	};
+
+	const FFlutterIngressStatistics Before = AFlutterBridge::GetIngressStatistics();
+	AFlutterBridge::SetMaxIngressQueueDepth(1);
+
+	TestTrue(TEXT("Header admitted"), AFlutterBridge::EnqueueFromFlutter(MakeChunk(FFlutterIngressMessage::EKind::ChunkHeader)));
+	TestFalse(TEXT("Message rejected when full"), AFlutterBridge::EnqueueFromFlutter(TEXT("Bench"), TEXT("onMessage"), TEXT("")));
+	TestFalse(TEXT("New transfer rejected when full"), AFlutterBridge::EnqueueFromFlutter(MakeChunk(FFlutterIngressMessage::EKind::ChunkHeader)));
+	TestTrue(TEXT("Chunk data accepted past the limit"), AFlutterBridge::EnqueueFromFlutter(MakeChunk(FFlutterIngressMessage::EKind::ChunkData)));
+	TestTrue(TEXT("Footer accepted past the limit"), AFlutterBridge::EnqueueFromFlutter(MakeChunk(FFlutterIngressMessage::EKind::ChunkFooter)));
+
+	const FFlutterIngressStatistics After = AFlutterBridge::GetIngressStatistics();
+	TestEqual(TEXT("Only new work rejected"), After.Rejected - Before.Rejected, (int64)2);
+	TestEqual(TEXT("Continuations counted in depth"), After.Depth, 3);
+
+	Scope.DrainAll();
+	AFlutterBridge::SetMaxIngressQueueDepth(4096);
+
+	return true;
+}
+
+// ============================================================
+// MARK: - Outgoing Chunked Transfers
+// ============================================================
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FFlutterBridgeOutgoingChunksTest, "FlutterPlugin.Bridge.OutgoingChunks",
+	EAutomationTestFlags::ApplicationContextMask | EAutomationTestFlags::ProductFilter)
+
+bool FFlutterBridgeOutgoingChunksTest::RunTest(const FString& Parameters)
+{
+	using namespace FlutterBridgeTests;
+
+	FScopedTestBridge Scope;
+	AFlutterBridge* Bridge = Scope.Bridge;
+	Bridge->BinaryCompressionCodec = EFlutterCompressionCodec::None;
+	Bridge->SetBinaryChunkSize(64 * 1024);
+	Bridge->OutgoingChunkBytesPerFrame = 256 * 1024;
+
+	TArray<uint8> Data;
+	Data.SetNumZeroed(1024 * 1024);
+
+	// Small payloads still go out as a single message
+	Bridge->SendBinaryToFlutter(TEXT("Level"), TEXT("onState"), TArray<uint8>({ 1, 2, 3 }));
+	TestEqual(TEXT("Small payload not chunked"), Bridge->GetPendingOutgoingTransfers(), 0);
+
+	// 16 chunks at 4 per frame
+	Bridge->SendBinaryToFlutter(TEXT("Level"), TEXT("onLevelData"), Data);
+	TestEqual(TEXT("Large payload queued"), Bridge->GetPendingOutgoingTransfers(), 1);
+
+	for (int32 Frame = 0; Frame < 3; ++Frame)
+	{
+		Bridge->Tick(0.0f);
+	}
+	TestEqual(TEXT("Spread over several frames"), Bridge->GetPendingOutgoingTransfers(), 1);
+
+	Bridge->Tick(0.0f);
+	TestEqual(TEXT("Sent within the budget"), Bridge->GetPendingOutgoingTransfers(), 0);
+
+	// A budget smaller than a chunk still sends one chunk per frame
+	Bridge->OutgoingChunkBytesPerFrame = 1024;
+	Data.SetNum(2 * 64 * 1024);
+	const FString TransferId = Bridge->SendChunkedBinaryToFlutter(TEXT("Level"), TEXT("onLevelData"), Data);
+	TestTrue(TEXT("Transfer id returned"), TransferId.StartsWith(TEXT("ue_")));
+
+	Bridge->Tick(0.0f);
+	TestEqual(TEXT("One chunk per frame"), Bridge->GetPendingOutgoingTransfers(), 1);
+	Bridge->Tick(0.0f);
+	TestEqual(TEXT("Transfer finished"), Bridge->GetPendingOutgoingTransfers(), 0);
+
+	return true;
+}
+
+// ============================================================
+// MARK: - Message Batching
+// ============================================================
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FFlutterBridgeBatchOrderTest, "FlutterPlugin.Bridge.BatchOrder",
+	EAutomationTestFlags::ApplicationContextMask | EAutomationTestFlags::ProductFilter)
+
+bool FFlutterBridgeBatchOrderTest::RunTest(const FString& Parameters)
+{
+	using namespace FlutterBridgeTests;
+
+	FScopedTestBridge Scope;
+	AFlutterBridge* Bridge = Scope.Bridge;
+	Bridge->BinaryCompressionCodec = EFlutterCompressionCodec::None;
+	Bridge->MaxBatchLatencyMs = 60000.0f;
+
+	auto SendBatched = [Bridge](int32 Count)
+	{
+		Bridge->bBatchOutgoingMessages = true;
+		for (int32 Index = 0; Index < Count; ++Index)
+		{
+			Bridge->SendToFlutter(TEXT("Level"), TEXT("onEvent"), FString::Printf(TEXT("%d"), Index));
+		}
+	};
+
+	SendBatched(3);
+	TestEqual(TEXT("Messages held in the batch"), Bridge->GetPendingBatchedMessages(), 3);
+
+	// Each send below must push the held batch out ahead of itself
+	Bridge->SendBinaryToFlutter(TEXT("Level"), TEXT("onState"), TArray<uint8>({ 1, 2, 3 }));
+	TestEqual(TEXT("Binary send flushes the batch first"), Bridge->GetPendingBatchedMessages(), 0);
+
+	SendBatched(3);
+	FFlutterStandardWriter Typed;
+	Typed.WriteInt(7);
+	Bridge->SendTypedToFlutter(TEXT("Level"), TEXT("onTyped"), Typed);
+	TestEqual(TEXT("Typed send flushes the batch first"), Bridge->GetPendingBatchedMessages(), 0);
+
+	SendBatched(3);
+	Bridge->SendChunkedBinaryToFlutter(TEXT("Level"), TEXT("onLevelData"), TArray<uint8>({ 1, 2, 3 }));
+	TestEqual(TEXT("Chunked send flushes the batch first"), Bridge->GetPendingBatchedMessages(), 0);
+
+	SendBatched(3);
+	Bridge->bBatchOutgoingMessages = false;
+	Bridge->SendToFlutter(TEXT("Level"), TEXT("onEvent"), TEXT("unbatched"));
+	TestEqual(TEXT("Unbatched send flushes the batch first"), Bridge->GetPendingBatchedMessages(), 0);
+
+	return true;
+}
+
+// ============================================================
+// MARK: - JNI Crossings
+// ============================================================
+
+#if PLATFORM_ANDROID
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FFlutterBridgeJNICrossingsBenchmark, "FlutterPlugin.Bridge.Benchmark.JNICrossings",
+	EAutomationTestFlags::ApplicationContextMask | EAutomationTestFlags::PerfFilter)
+
+bool FFlutterBridgeJNICrossingsBenchmark::RunTest(const FString& Parameters)
+{
+	using namespace FlutterBridgeTests;
+	extern int64 FlutterBridge_GetJavaUpcallCount_Android();
+
+	const int32 Frames = 60;
+	const int32 MessagesPerFrame = 32;
+	const FString Data = TEXT("{\"rotation\":{\"pitch\":0.0,\"yaw\":123.4,\"roll\":0.0},\"speed\":45.0}");
+
+	FScopedTestBridge Scope;
+	AFlutterBridge* Bridge = Scope.Bridge;
+
+	// Run the same frames once per message and once batched
+	int64 Crossings[2];
+	double Seconds[2];
+	for (int32 Pass = 0; Pass < 2; ++Pass)
+	{
+		Bridge->bBatchOutgoingMessages = Pass == 1;
+
+		const int64 StartCount = FlutterBridge_GetJavaUpcallCount_Android();
+		const double StartTime = FPlatformTime::Seconds();
+		for (int32 Frame = 0; Frame < Frames; ++Frame)
+		{
+			for (int32 Message = 0; Message < MessagesPerFrame; ++Message)
+			{
+				Bridge->SendToFlutter(TEXT("RotatingCube"), TEXT("onStateSync"), Data);
+			}
+			Bridge->FlushOutgoingBatch();
+		}
+		Seconds[Pass] = FPlatformTime::Seconds() - StartTime;
+		Crossings[Pass] = FlutterBridge_GetJavaUpcallCount_Android() - StartCount;
+	}
+
+	if (Crossings[0] == 0)
+	{
+		AddWarning(TEXT("No Java controller attached; nothing crossed JNI"));
+		return true;
+	}
+
+	TestTrue(TEXT("Batching needs at most one crossing per frame"), Crossings[1] <= Frames);
+
+	AddInfo(FString::Printf(TEXT("%d frames x %d messages: per message %lld crossings, %.1f us/frame; batched %lld crossings, %.1f us/frame"),
+		Frames,
+		MessagesPerFrame,
+		Crossings[0],
+		Seconds[0] * 1e6 / Frames,
+		Crossings[1],
+		Seconds[1] * 1e6 / Frames));
+
+	return true;
+}
+
+#endif // PLATFORM_ANDROID
+
+#endif // WITH_DEV_AUTOMATION_TESTS
@@ -0,0 +1,154 @@
+// Copyright Epic Games, Inc. All Rights Reserved.
+
+#include "FlutterBufferPool.h"
+#include "Misc/AutomationTest.h"
+#include "HAL/PlatformTime.h"
+
+#if PLATFORM_ANDROID
+#include "Android/AndroidApplication.h"
+#include <jni.h>
+#endif
+
+#if WITH_DEV_AUTOMATION_TESTS
+
+// ============================================================
+// MARK: - Pool
+// ============================================================
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FFlutterBufferPoolTest, "FlutterPlugin.BufferPool.Reuse",
+	EAutomationTestFlags::ApplicationContextMask | EAutomationTestFlags::ProductFilter)
+
+bool FFlutterBufferPoolTest::RunTest(const FString& Parameters)
+{
+	TestEqual(TEXT("Small requests use the smallest class"), FFlutterBufferPool::GetSizeClass(1), 0);
+	TestEqual(TEXT("Exact class size"), FFlutterBufferPool::GetSizeClass(8 * 1024), 1);
+	TestEqual(TEXT("Rounded up"), FFlutterBufferPool::GetSizeClass(8 * 1024 + 1), 2);
+	TestEqual(TEXT("Largest class"), FFlutterBufferPool::GetSizeClass(FFlutterBufferPool::MaxSizeClassBytes), FFlutterBufferPool::NumSizeClasses - 1);
+	TestEqual(TEXT("Oversize is unpooled"), FFlutterBufferPool::GetSizeClass(FFlutterBufferPool::MaxSizeClassBytes + 1), (int32)INDEX_NONE);
+
+	FFlutterBufferPool Pool(2);
+
+	uint8* Data = nullptr;
+	int32 Capacity = 0;
+	const int32 First = Pool.Acquire(100 * 1024, Data, Capacity);
+	TestTrue(TEXT("Acquired"), First != INDEX_NONE && Data != nullptr);
+	TestEqual(TEXT("Capacity is the class size"), Capacity, 128 * 1024);
+	FMemory::Memset(Data, 0xAB, Capacity);
+
+	// Released buffers come back for the same size class
+	uint8* FirstData = Data;
+	TestTrue(TEXT("Released"), Pool.Release(First));
+	const int32 Second = Pool.Acquire(70 * 1024, Data, Capacity);
+	TestTrue(TEXT("Same memory reused"), Data == FirstData);
+	TestTrue(TEXT("New ID for the reused buffer"), Second != First);
+
+	// A stale ID must not release the buffer that was handed out again
+	TestFalse(TEXT("Stale release ignored"), Pool.Release(First));
+	TestTrue(TEXT("Current release accepted"), Pool.Release(Second));
+	TestFalse(TEXT("Double release ignored"), Pool.Release(Second));
+
+	// Only MaxIdlePerClass buffers are kept per class
+	int32 Ids[3];
+	for (int32& Id : Ids)
+	{
+		Id = Pool.Acquire(4096, Data, Capacity);
+	}
+	for (const int32 Id : Ids)
+	{
+		Pool.Release(Id);
+	}
+
+	FFlutterBufferPoolStatistics Stats = Pool.GetStatistics();
+	TestEqual(TEXT("Nothing in use"), Stats.InUse, 0);
+	TestEqual(TEXT("Idle buffers capped per class"), Stats.Idle, 3); // 2 x 4 KB + 1 x 128 KB
+	TestEqual(TEXT("Reuse counted"), Stats.Reused, (int64)1);
+
+	// Oversize buffers are exact and never kept
+	const int32 Large = Pool.Acquire(FFlutterBufferPool::MaxSizeClassBytes + 1, Data, Capacity);
+	TestEqual(TEXT("Oversize capacity is exact"), Capacity, FFlutterBufferPool::MaxSizeClassBytes + 1);
+	Pool.Release(Large);
+	TestEqual(TEXT("Oversize not kept"), Pool.GetStatistics().Idle, 3);
+
+	Pool.Trim();
+	Stats = Pool.GetStatistics();
+	TestTrue(TEXT("Trim frees idle buffers"), Stats.Idle == 0 && Stats.BytesIdle == 0);
+
+	return true;
+}
+
+// ============================================================
+// MARK: - Benchmark
+// ============================================================
+
+#if PLATFORM_ANDROID
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FFlutterBufferPoolJNIBenchmark, "FlutterPlugin.BufferPool.Benchmark.JNI",
+	EAutomationTestFlags::ApplicationContextMask | EAutomationTestFlags::PerfFilter)
+
+bool FFlutterBufferPoolJNIBenchmark::RunTest(const FString& Parameters)
+{
+	JNIEnv* Env = FAndroidApplication::GetJavaEnv();
+	if (!Env)
+	{
+		AddError(TEXT("No JNI environment"));
+		return false;
+	}
+
+	FFlutterBufferPool Pool;
+	const int32 PayloadSizes[] = { 64 * 1024, 1024 * 1024, 8 * 1024 * 1024 };
+
+	for (const int32 PayloadSize : PayloadSizes)
+	{
+		TArray<uint8> Payload;
+		Payload.SetNumUninitialized(PayloadSize);
+		for (int32 Index = 0; Index < PayloadSize; ++Index)
+		{
+			Payload[Index] = (uint8)Index;
+		}
+
+		const int32 Iterations = FMath::Max(4, (64 * 1024 * 1024) / PayloadSize);
+		TArray<uint8> Received;
+		Received.SetNumUninitialized(PayloadSize);
+
+		// byte[]: a Java heap array per message, copied in and out
+		double StartTime = FPlatformTime::Seconds();
+		for (int32 Iteration = 0; Iteration < Iterations; ++Iteration)
+		{
+			jbyteArray Array = Env->NewByteArray(PayloadSize);
+			Env->SetByteArrayRegion(Array, 0, PayloadSize, reinterpret_cast<const jbyte*>(Payload.GetData()));
+			Env->GetByteArrayRegion(Array, 0, PayloadSize, reinterpret_cast<jbyte*>(Received.GetData()));
+			Env->DeleteLocalRef(Array);
+		}
+		const double ArraySeconds = FPlatformTime::Seconds() - StartTime;
+
+		// Direct buffer: pooled native memory wrapped without allocating on the Java heap
+		StartTime = FPlatformTime::Seconds();
+		for (int32 Iteration = 0; Iteration < Iterations; ++Iteration)
+		{
+			uint8* Data = nullptr;
+			int32 Capacity = 0;
+			const int32 BufferId = Pool.Acquire(PayloadSize, Data, Capacity);
+			FMemory::Memcpy(Data, Payload.GetData(), PayloadSize);
+			jobject Buffer = Env->NewDirectByteBuffer(Data, PayloadSize);
+			FMemory::Memcpy(Received.GetData(), Env->GetDirectBufferAddress(Buffer), PayloadSize);
+			Env->DeleteLocalRef(Buffer);
+			Pool.Release(BufferId);
+		}
+		const double DirectSeconds = FPlatformTime::Seconds() - StartTime;
+
+		TestTrue(TEXT("Payload intact"), Received == Payload);
+
+		const double Megabytes = (double)PayloadSize * Iterations / (1024.0 * 1024.0);
+		AddInfo(FString::Printf(TEXT("%5d KB: byte[] %.0f MB/s, direct buffer %.0f MB/s (%.2fx)"),
+			PayloadSize / 1024,
+			Megabytes / ArraySeconds,
+			Megabytes / DirectSeconds,
+			ArraySeconds / DirectSeconds));
+	}
+
+	return true;
+}
+
+#endif // PLATFORM_ANDROID
+
+#endif // WITH_DEV_AUTOMATION_TESTS
@@ -0,0 +1,136 @@
+// Copyright Epic Games, Inc. All Rights Reserved.
+
+#include "FlutterChecksum.h"
+#include "Misc/AutomationTest.h"
+#include "HAL/PlatformTime.h"
+#include "Math/RandomStream.h"
+
+#if WITH_DEV_AUTOMATION_TESTS
+
+namespace FlutterChecksumTests
+{
+	// The byte-at-a-time loop AFlutterBridge used before FFlutterCrc32
+	struct FLegacyCrc32
+	{
+		uint32 Table[256];
+
+		FLegacyCrc32()
+		{
+			for (uint32 Byte = 0; Byte < 256; ++Byte)
+			{
+				uint32 Crc = Byte;
+				for (int32 Bit = 0; Bit < 8; ++Bit)
+				{
+					Crc = (Crc >> 1) ^ ((Crc & 1) ? 0xEDB88320u : 0);
+				}
+				Table[Byte] = Crc;
+			}
+		}
+
+		uint32 Calculate(const TArray<uint8>& Data) const
+		{
+			uint32 CRC = 0xFFFFFFFF;
+			for (int32 i = 0; i < Data.Num(); ++i)
+			{
+				CRC = Table[(CRC ^ Data[i]) & 0xFF] ^ (CRC >> 8);
+			}
+			return CRC ^ 0xFFFFFFFF;
+		}
+	};
+
+	TArray<uint8> MakeRandomData(int32 NumBytes)
+	{
+		FRandomStream Random(1234);
+		TArray<uint8> Data;
+		Data.SetNumUninitialized(NumBytes);
+		for (uint8& Byte : Data)
+		{
+			Byte = (uint8)Random.RandRange(0, 255);
+		}
+		return Data;
+	}
+}
+
+// ============================================================
+// MARK: - Correctness
+// ============================================================
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FFlutterChecksumTest, "FlutterPlugin.Checksum.Crc32",
+	EAutomationTestFlags::ApplicationContextMask | EAutomationTestFlags::ProductFilter)
+
+bool FFlutterChecksumTest::RunTest(const FString& Parameters)
+{
+	using namespace FlutterChecksumTests;
+
+	// Standard check value for CRC-32/ISO-HDLC, as computed by zlib and the Dart side
+	const uint8 Check[] = { '1', '2', '3', '4', '5', '6', '7', '8', '9' };
+	TestEqual(TEXT("Check value"), FFlutterCrc32::Calculate(Check), 0xCBF43926u);
+	TestEqual(TEXT("Empty input"), FFlutterCrc32::Calculate(TConstArrayView<uint8>()), 0u);
+
+	const FLegacyCrc32 Legacy;
+	const TArray<uint8> Data = MakeRandomData(4099);
+
+	// Odd lengths and offsets exercise the unaligned head and tail of every path
+	for (int32 Offset = 0; Offset < 9; ++Offset)
+	{
+		const TArray<uint8> Slice(Data.GetData() + Offset, Data.Num() - Offset * 37);
+		const uint32 Expected = Legacy.Calculate(Slice);
+
+		TestEqual(*FString::Printf(TEXT("Dispatched path, offset %d"), Offset), FFlutterCrc32::Calculate(Slice), Expected);
+		TestEqual(*FString::Printf(TEXT("Software path, offset %d"), Offset),
+			FFlutterCrc32::UpdateSoftware(0xFFFFFFFFu, Slice.GetData(), Slice.Num()) ^ 0xFFFFFFFFu, Expected);
+	}
+
+	// Feeding chunks in order gives the same result as the whole buffer
+	FFlutterCrc32 Running;
+	for (int32 Start = 0; Start < Data.Num(); Start += 1000)
+	{
+		Running.Update(Data.GetData() + Start, FMath::Min(1000, Data.Num() - Start));
+	}
+	TestEqual(TEXT("Incremental update"), Running.GetValue(), Legacy.Calculate(Data));
+
+	Running.Reset();
+	TestEqual(TEXT("Reset"), Running.GetValue(), 0u);
+
+	return true;
+}
+
+// ============================================================
+// MARK: - Throughput Benchmark
+// ============================================================
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FFlutterChecksumBenchmark, "FlutterPlugin.Checksum.Benchmark.Throughput",
+	EAutomationTestFlags::ApplicationContextMask | EAutomationTestFlags::PerfFilter)
+
+bool FFlutterChecksumBenchmark::RunTest(const FString& Parameters)
+{
+	using namespace FlutterChecksumTests;
+
+	const int32 PayloadSize = 8 * 1024 * 1024;
+	const int32 Iterations = 16;
+	const TArray<uint8> Data = MakeRandomData(PayloadSize);
+	const FLegacyCrc32 Legacy;
+
+	auto Measure = [&](const TCHAR* Name, TFunctionRef<uint32()> Checksum)
+	{
+		uint32 Result = 0;
+		const double StartTime = FPlatformTime::Seconds();
+		for (int32 Iteration = 0; Iteration < Iterations; ++Iteration)
+		{
+			Result ^= Checksum();
+		}
+		const double Seconds = FPlatformTime::Seconds() - StartTime;
+
+		AddInfo(FString::Printf(TEXT("%-14s %.2f GB/s (%08x)"), Name, (double)PayloadSize * Iterations / Seconds / 1.0e9, Result));
+	};
+
+	Measure(TEXT("table loop:"), [&]() { return Legacy.Calculate(Data); });
+	Measure(TEXT("slicing-by-8:"), [&]() { return FFlutterCrc32::UpdateSoftware(0xFFFFFFFFu, Data.GetData(), Data.Num()) ^ 0xFFFFFFFFu; });
+	Measure(TEXT("dispatched:"), [&]() { return FFlutterCrc32::Calculate(Data); });
+
+	AddInfo(FString::Printf(TEXT("Hardware CRC32: %s"), FFlutterCrc32::IsHardwareAccelerated() ? TEXT("yes") : TEXT("no")));
+
+	return true;
+}
+
+#endif // WITH_DEV_AUTOMATION_TESTS
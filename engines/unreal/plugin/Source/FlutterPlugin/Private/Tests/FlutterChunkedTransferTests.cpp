@@ -0,0 +1,205 @@
+// Copyright Epic Games, Inc. All Rights Reserved.
+
+#include "FlutterChunkedTransfer.h"
+#include "Misc/AutomationTest.h"
+
+#if WITH_DEV_AUTOMATION_TESTS
+
+namespace FlutterChunkedTransferTests
+{
+	// 10 chunks of 1000 bytes plus a 234 byte tail, split the way the Dart sender does
+	const int32 ChunkSize = 1000;
+
+	TArray<uint8> MakePayload()
+	{
+		TArray<uint8> Payload;
+		Payload.SetNumUninitialized(10 * ChunkSize + 234);
+		for (int32 Index = 0; Index < Payload.Num(); ++Index)
+		{
+			Payload[Index] = (uint8)(Index * 31 + Index / 256);
+		}
+		return Payload;
+	}
+
+	int32 NumChunks(const TArray<uint8>& Payload)
+	{
+		return (Payload.Num() + ChunkSize - 1) / ChunkSize;
+	}
+
+	TConstArrayView<uint8> GetChunk(const TArray<uint8>& Payload, int32 ChunkIndex)
+	{
+		const int32 Start = ChunkIndex * ChunkSize;
+		return TConstArrayView<uint8>(Payload.GetData() + Start, FMath::Min(ChunkSize, Payload.Num() - Start));
+	}
+
+	FFlutterChunkedTransfer MakeTransfer(const TArray<uint8>& Payload)
+	{
+		return FFlutterChunkedTransfer(TEXT("AssetLoader"), TEXT("onAsset"), Payload.Num(), NumChunks(Payload), (int32)FFlutterCrc32::Calculate(Payload));
+	}
+}
+
+// ============================================================
+// MARK: - Reassembly
+// ============================================================
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FFlutterChunkedTransferOrderTest, "FlutterPlugin.ChunkedTransfer.OutOfOrder",
+	EAutomationTestFlags::ApplicationContextMask | EAutomationTestFlags::ProductFilter)
+
+bool FFlutterChunkedTransferOrderTest::RunTest(const FString& Parameters)
+{
+	using namespace FlutterChunkedTransferTests;
+
+	const TArray<uint8> Payload = MakePayload();
+
+	// Last chunk first: the chunk size has to be derived from the remainder
+	FFlutterChunkedTransfer Transfer = MakeTransfer(Payload);
+	TestTrue(TEXT("Header accepted"), Transfer.IsValid());
+	TestEqual(TEXT("Buffer allocated up front"), Transfer.GetData().Num(), Payload.Num());
+
+	const int32 Order[] = { 10, 3, 0, 7, 1, 9, 2, 8, 4, 6, 5 };
+	for (const int32 ChunkIndex : Order)
+	{
+		TestTrue(*FString::Printf(TEXT("Chunk %d accepted"), ChunkIndex),
+			Transfer.AddChunk(ChunkIndex, GetChunk(Payload, ChunkIndex)) == FFlutterChunkedTransfer::EChunkResult::Accepted);
+	}
+
+	TestTrue(TEXT("Complete"), Transfer.IsComplete());
+	TestTrue(TEXT("Payload reassembled in place"), Transfer.GetData() == Payload);
+	TestTrue(TEXT("Checksum verified"), Transfer.VerifyChecksum());
+
+	// In-order delivery takes the running checksum path
+	FFlutterChunkedTransfer InOrder = MakeTransfer(Payload);
+	for (int32 ChunkIndex = 0; ChunkIndex < NumChunks(Payload); ++ChunkIndex)
+	{
+		InOrder.AddChunk(ChunkIndex, GetChunk(Payload, ChunkIndex));
+	}
+	TestTrue(TEXT("In-order payload"), InOrder.IsComplete() && InOrder.GetData() == Payload && InOrder.VerifyChecksum());
+
+	// A single-chunk transfer
+	const TArray<uint8> Small = { 1, 2, 3 };
+	FFlutterChunkedTransfer Single(TEXT("A"), TEXT("b"), Small.Num(), 1, (int32)FFlutterCrc32::Calculate(Small));
+	Single.AddChunk(0, Small);
+	TestTrue(TEXT("Single chunk"), Single.IsComplete() && Single.VerifyChecksum());
+
+	return true;
+}
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FFlutterChunkedTransferDuplicateTest, "FlutterPlugin.ChunkedTransfer.Duplicates",
+	EAutomationTestFlags::ApplicationContextMask | EAutomationTestFlags::ProductFilter)
+
+bool FFlutterChunkedTransferDuplicateTest::RunTest(const FString& Parameters)
+{
+	using namespace FlutterChunkedTransferTests;
+
+	const TArray<uint8> Payload = MakePayload();
+	FFlutterChunkedTransfer Transfer = MakeTransfer(Payload);
+
+	TestTrue(TEXT("First copy accepted"), Transfer.AddChunk(4, GetChunk(Payload, 4)) == FFlutterChunkedTransfer::EChunkResult::Accepted);
+
+	// A resent chunk with different bytes must not overwrite the first copy
+	TArray<uint8> Corrupt(GetChunk(Payload, 4));
+	Corrupt[0] ^= 0xFF;
+	TestTrue(TEXT("Second copy is a duplicate"), Transfer.AddChunk(4, Corrupt) == FFlutterChunkedTransfer::EChunkResult::Duplicate);
+	TestEqual(TEXT("Duplicate not counted"), Transfer.GetReceivedChunks(), 1);
+
+	for (int32 ChunkIndex = 0; ChunkIndex < NumChunks(Payload); ++ChunkIndex)
+	{
+		Transfer.AddChunk(ChunkIndex, GetChunk(Payload, ChunkIndex));
+	}
+	TestTrue(TEXT("Payload intact"), Transfer.IsComplete() && Transfer.GetData() == Payload && Transfer.VerifyChecksum());
+
+	return true;
+}
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FFlutterChunkedTransferMissingTest, "FlutterPlugin.ChunkedTransfer.Missing",
+	EAutomationTestFlags::ApplicationContextMask | EAutomationTestFlags::ProductFilter)
+
+bool FFlutterChunkedTransferMissingTest::RunTest(const FString& Parameters)
+{
+	using namespace FlutterChunkedTransferTests;
+
+	const TArray<uint8> Payload = MakePayload();
+	FFlutterChunkedTransfer Transfer = MakeTransfer(Payload);
+
+	for (int32 ChunkIndex = 0; ChunkIndex < NumChunks(Payload); ++ChunkIndex)
+	{
+		if (ChunkIndex != 2 && ChunkIndex != 9)
+		{
+			Transfer.AddChunk(ChunkIndex, GetChunk(Payload, ChunkIndex));
+		}
+	}
+
+	TestFalse(TEXT("Not complete"), Transfer.IsComplete());
+	TestTrue(TEXT("Missing chunks reported"), Transfer.GetMissingChunks() == TArray<int32>({ 2, 9 }));
+
+	// Malformed chunks are rejected without touching the buffer
+	TestTrue(TEXT("Index past the end"), Transfer.AddChunk(11, GetChunk(Payload, 0)) == FFlutterChunkedTransfer::EChunkResult::Rejected);
+	TestTrue(TEXT("Negative index"), Transfer.AddChunk(-1, GetChunk(Payload, 0)) == FFlutterChunkedTransfer::EChunkResult::Rejected);
+	TestTrue(TEXT("Wrong chunk size"), Transfer.AddChunk(2, GetChunk(Payload, 10)) == FFlutterChunkedTransfer::EChunkResult::Rejected);
+
+	Transfer.AddChunk(9, GetChunk(Payload, 9));
+	Transfer.AddChunk(2, GetChunk(Payload, 2));
+	TestTrue(TEXT("Late chunks complete the transfer"), Transfer.IsComplete() && Transfer.VerifyChecksum());
+
+	// Headers that cannot describe a transfer allocate nothing
+	TestFalse(TEXT("More chunks than bytes"), FFlutterChunkedTransfer(TEXT("A"), TEXT("b"), 4, 5, 0).IsValid());
+	TestFalse(TEXT("Negative size"), FFlutterChunkedTransfer(TEXT("A"), TEXT("b"), -1, 1, 0).IsValid());
+	TestTrue(TEXT("Empty payload"), FFlutterChunkedTransfer(TEXT("A"), TEXT("b"), 0, 0, 0).IsComplete());
+
+	return true;
+}
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FFlutterChunkedTransferSizeLimitTest, "FlutterPlugin.ChunkedTransfer.SizeLimit",
+	EAutomationTestFlags::ApplicationContextMask | EAutomationTestFlags::ProductFilter)
+
+bool FFlutterChunkedTransferSizeLimitTest::RunTest(const FString& Parameters)
+{
+	// The announced size comes from the peer; a header above the cap allocates nothing
+	const FFlutterChunkedTransfer Oversized(TEXT("A"), TEXT("b"), 4096, 4, 0, 1024);
+	TestFalse(TEXT("Size above the cap rejected"), Oversized.IsValid());
+	TestEqual(TEXT("Nothing allocated"), (int64)Oversized.GetData().GetAllocatedSize(), (int64)0);
+
+	TestTrue(TEXT("Size at the cap accepted"), FFlutterChunkedTransfer(TEXT("A"), TEXT("b"), 1024, 4, 0, 1024).IsValid());
+	TestFalse(TEXT("Default cap applies"), FFlutterChunkedTransfer(TEXT("A"), TEXT("b"), MAX_int32, 1, 0).IsValid());
+
+	return true;
+}
+
+// ============================================================
+// MARK: - Outgoing
+// ============================================================
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FFlutterChunkedTransferOutgoingTest, "FlutterPlugin.ChunkedTransfer.Outgoing",
+	EAutomationTestFlags::ApplicationContextMask | EAutomationTestFlags::ProductFilter)
+
+bool FFlutterChunkedTransferOutgoingTest::RunTest(const FString& Parameters)
+{
+	using namespace FlutterChunkedTransferTests;
+
+	const TArray<uint8> Payload = MakePayload();
+	FFlutterOutgoingTransfer Outgoing(TEXT("ue_1"), TEXT("AssetLoader"), TEXT("onAsset"), TArray<uint8>(Payload), ChunkSize);
+
+	TestEqual(TEXT("Chunk count"), Outgoing.GetTotalChunks(), NumChunks(Payload));
+	TestEqual(TEXT("Checksum over the payload"), Outgoing.GetChecksum(), (int32)FFlutterCrc32::Calculate(Payload));
+
+	// Whatever the sender splits, the receiver reassembles
+	FFlutterChunkedTransfer Incoming(Outgoing.GetTarget(), Outgoing.GetMethod(), Outgoing.GetTotalSize(), Outgoing.GetTotalChunks(), Outgoing.GetChecksum());
+	while (!Outgoing.IsComplete())
+	{
+		int32 ChunkIndex = 0;
+		const TConstArrayView<uint8> Chunk = Outgoing.NextChunk(ChunkIndex);
+		TestTrue(*FString::Printf(TEXT("Chunk %d accepted"), ChunkIndex),
+			Incoming.AddChunk(ChunkIndex, Chunk) == FFlutterChunkedTransfer::EChunkResult::Accepted);
+	}
+
+	TestEqual(TEXT("Every byte counted as sent"), Outgoing.GetSentBytes(), Payload.Num());
+	TestTrue(TEXT("Round trip"), Incoming.IsComplete() && Incoming.GetData() == Payload && Incoming.VerifyChecksum());
+
+	// An empty payload has no chunks and is complete immediately
+	FFlutterOutgoingTransfer Empty(TEXT("ue_2"), TEXT("A"), TEXT("b"), TArray<uint8>(), ChunkSize);
+	TestTrue(TEXT("Empty payload"), Empty.IsComplete() && Empty.GetTotalChunks() == 0);
+
+	return true;
+}
+
+#endif // WITH_DEV_AUTOMATION_TESTS
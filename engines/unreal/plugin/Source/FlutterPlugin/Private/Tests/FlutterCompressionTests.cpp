@@ -0,0 +1,214 @@
+// Copyright Epic Games, Inc. All Rights Reserved.
+
+#include "FlutterCompression.h"
+#include "FlutterChunkedTransfer.h"
+#include "Misc/AutomationTest.h"
+#include "HAL/PlatformTime.h"
+#include "Math/RandomStream.h"
+
+#if WITH_DEV_AUTOMATION_TESTS
+
+namespace FlutterCompressionTests
+{
+	const EFlutterCompressionCodec Codecs[] = { EFlutterCompressionCodec::Gzip, EFlutterCompressionCodec::Zlib, EFlutterCompressionCodec::LZ4 };
+
+	/** Tile-map-like level data: runs of a few tile ids with occasional noise */
+	TArray<uint8> MakeLevelData(int32 NumBytes)
+	{
+		FRandomStream Random(42);
+		TArray<uint8> Data;
+		Data.Reserve(NumBytes);
+		while (Data.Num() < NumBytes)
+		{
+			const uint8 Tile = (uint8)Random.RandRange(0, 15);
+			const int32 Run = FMath::Min(Random.RandRange(1, 24), NumBytes - Data.Num());
+			for (int32 Index = 0; Index < Run; ++Index)
+			{
+				Data.Add(Random.FRand() < 0.05f ? (uint8)Random.RandRange(0, 255) : Tile);
+			}
+		}
+		return Data;
+	}
+
+	TArray<uint8> MakeNoise(int32 NumBytes)
+	{
+		FRandomStream Random(7);
+		TArray<uint8> Data;
+		Data.SetNumUninitialized(NumBytes);
+		for (uint8& Byte : Data)
+		{
+			Byte = (uint8)Random.RandRange(0, 255);
+		}
+		return Data;
+	}
+}
+
+// ============================================================
+// MARK: - Round Trip
+// ============================================================
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FFlutterCompressionRoundTripTest, "FlutterPlugin.Compression.RoundTrip",
+	EAutomationTestFlags::ApplicationContextMask | EAutomationTestFlags::ProductFilter)
+
+bool FFlutterCompressionRoundTripTest::RunTest(const FString& Parameters)
+{
+	using namespace FlutterCompressionTests;
+
+	const TArray<uint8> Data = MakeLevelData(200 * 1024);
+
+	for (const EFlutterCompressionCodec Codec : Codecs)
+	{
+		const FString Name = UEnum::GetValueAsString(Codec);
+
+		TArray<uint8> Compressed;
+		TestTrue(*(Name + TEXT(" compresses")), FFlutterCompression::Compress(Codec, Data, Compressed));
+		TestTrue(*(Name + TEXT(" is smaller")), Compressed.Num() < Data.Num());
+		TestTrue(*(Name + TEXT(" is detected")), FFlutterCompression::Detect(Compressed) == Codec);
+
+		TArray<uint8> Decompressed;
+		TestTrue(*(Name + TEXT(" round trips")), FFlutterCompression::Decompress(Compressed, Decompressed) && Decompressed == Data);
+
+		// Streaming in uneven pieces, including a split inside the envelope header
+		const int32 PieceSizes[] = { 3, 1000, 65536 };
+		for (const int32 PieceSize : PieceSizes)
+		{
+			FFlutterStreamingDecompressor Decompressor(Codec);
+			bool bOk = true;
+			for (int32 Offset = 0; Offset < Compressed.Num(); Offset += PieceSize)
+			{
+				bOk &= Decompressor.Update(TConstArrayView<uint8>(Compressed.GetData() + Offset, FMath::Min(PieceSize, Compressed.Num() - Offset)));
+			}
+			bOk &= Decompressor.Finish();
+			TestTrue(*FString::Printf(TEXT("%s streams in %d byte pieces"), *Name, PieceSize), bOk && Decompressor.GetOutput() == Data);
+		}
+
+		// Truncated streams fail instead of returning partial data
+		TArray<uint8> Truncated = Compressed;
+		Truncated.SetNum(Truncated.Num() - 16);
+		TestFalse(*(Name + TEXT(" rejects truncated data")), FFlutterCompression::Decompress(Truncated, Decompressed));
+	}
+
+	// Incompressible data and raw payloads are left alone
+	TArray<uint8> Compressed;
+	TestFalse(TEXT("Noise is sent raw"), FFlutterCompression::Compress(EFlutterCompressionCodec::Gzip, MakeNoise(4096), Compressed));
+	TestFalse(TEXT("None never compresses"), FFlutterCompression::Compress(EFlutterCompressionCodec::None, Data, Compressed));
+	TestTrue(TEXT("Raw data is not detected as compressed"), FFlutterCompression::Detect(Data) == EFlutterCompressionCodec::None);
+
+	return true;
+}
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FFlutterCompressionLimitTest, "FlutterPlugin.Compression.OutputLimit",
+	EAutomationTestFlags::ApplicationContextMask | EAutomationTestFlags::ProductFilter)
+
+bool FFlutterCompressionLimitTest::RunTest(const FString& Parameters)
+{
+	using namespace FlutterCompressionTests;
+
+	// Highly compressible, like a payload built to exhaust memory
+	TArray<uint8> Data;
+	Data.SetNumZeroed(1024 * 1024);
+
+	for (const EFlutterCompressionCodec Codec : Codecs)
+	{
+		const FString Name = UEnum::GetValueAsString(Codec);
+
+		TArray<uint8> Compressed;
+		FFlutterCompression::Compress(Codec, Data, Compressed);
+
+		TArray<uint8> Decompressed;
+		TestTrue(*(Name + TEXT(" fits an exact limit")), FFlutterCompression::Decompress(Compressed, Decompressed, Data.Num()) && Decompressed == Data);
+		TestFalse(*(Name + TEXT(" fails past the limit")), FFlutterCompression::Decompress(Compressed, Decompressed, Data.Num() - 1));
+		TestEqual(*(Name + TEXT(" leaves no output")), Decompressed.Num(), 0);
+	}
+
+	// An envelope that understates the size may not produce more than it claims
+	TArray<uint8> Compressed;
+	FFlutterCompression::Compress(EFlutterCompressionCodec::Zlib, Data, Compressed);
+	Compressed[4] = 16;
+	Compressed[5] = Compressed[6] = Compressed[7] = 0;
+	TArray<uint8> Decompressed;
+	TestFalse(TEXT("zlib stream larger than its envelope fails"), FFlutterCompression::Decompress(Compressed, Decompressed));
+
+	return true;
+}
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FFlutterCompressionChunkedTest, "FlutterPlugin.Compression.ChunkedTransfer",
+	EAutomationTestFlags::ApplicationContextMask | EAutomationTestFlags::ProductFilter)
+
+bool FFlutterCompressionChunkedTest::RunTest(const FString& Parameters)
+{
+	using namespace FlutterCompressionTests;
+
+	const TArray<uint8> Data = MakeLevelData(512 * 1024);
+	TArray<uint8> Compressed;
+	FFlutterCompression::Compress(EFlutterCompressionCodec::Gzip, Data, Compressed);
+
+	// The checksum covers the transferred (compressed) bytes, as the Dart sender computes it
+	const int32 ChunkSize = 4096;
+	const int32 NumChunks = (Compressed.Num() + ChunkSize - 1) / ChunkSize;
+	FFlutterChunkedTransfer Transfer(TEXT("Level"), TEXT("onLevelData"), Compressed.Num(), NumChunks, (int32)FFlutterCrc32::Calculate(Compressed));
+
+	// Deliver back to front so decompression only starts once chunk 0 arrives
+	for (int32 ChunkIndex = NumChunks - 1; ChunkIndex >= 0; --ChunkIndex)
+	{
+		const int32 Start = ChunkIndex * ChunkSize;
+		Transfer.AddChunk(ChunkIndex, TConstArrayView<uint8>(Compressed.GetData() + Start, FMath::Min(ChunkSize, Compressed.Num() - Start)));
+	}
+
+	TestTrue(TEXT("Complete"), Transfer.IsComplete());
+	TestTrue(TEXT("Codec detected"), Transfer.GetCodec() == EFlutterCompressionCodec::Gzip);
+	TestFalse(TEXT("No decompression error"), Transfer.HasDecompressionError());
+	TestTrue(TEXT("Payload decompressed"), Transfer.GetData() == Data);
+	TestTrue(TEXT("Checksum verified"), Transfer.VerifyChecksum());
+
+	return true;
+}
+
+// ============================================================
+// MARK: - Benchmark
+// ============================================================
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FFlutterCompressionBenchmark, "FlutterPlugin.Compression.Benchmark.Codecs",
+	EAutomationTestFlags::ApplicationContextMask | EAutomationTestFlags::PerfFilter)
+
+bool FFlutterCompressionBenchmark::RunTest(const FString& Parameters)
+{
+	using namespace FlutterCompressionTests;
+
+	const int32 PayloadSize = 4 * 1024 * 1024;
+	const int32 Iterations = 8;
+	const TArray<uint8> Data = MakeLevelData(PayloadSize);
+
+	for (const EFlutterCompressionCodec Codec : Codecs)
+	{
+		TArray<uint8> Compressed;
+		TArray<uint8> Decompressed;
+
+		double StartTime = FPlatformTime::Seconds();
+		for (int32 Iteration = 0; Iteration < Iterations; ++Iteration)
+		{
+			FFlutterCompression::Compress(Codec, Data, Compressed);
+		}
+		const double CompressSeconds = FPlatformTime::Seconds() - StartTime;
+
+		StartTime = FPlatformTime::Seconds();
+		for (int32 Iteration = 0; Iteration < Iterations; ++Iteration)
+		{
+			FFlutterCompression::Decompress(Compressed, Decompressed);
+		}
+		const double DecompressSeconds = FPlatformTime::Seconds() - StartTime;
+
+		TestTrue(TEXT("Round trip"), Decompressed == Data);
+
+		const double Megabytes = (double)PayloadSize * Iterations / (1024.0 * 1024.0);
+		AddInfo(FString::Printf(TEXT("%-6s ratio %.3f, compress %.0f MB/s, decompress %.0f MB/s"),
+			*UEnum::GetValueAsString(Codec).RightChop(26),
+			(double)Compressed.Num() / PayloadSize,
+			Megabytes / CompressSeconds,
+			Megabytes / DecompressSeconds));
+	}
+
+	return true;
+}
+
+#endif // WITH_DEV_AUTOMATION_TESTS
@@ -0,0 +1,142 @@
+// Copyright Epic Games, Inc. All Rights Reserved.
+
+#include "CoreMinimal.h"
+#include "Misc/AutomationTest.h"
+
+#if WITH_DEV_AUTOMATION_TESTS && PLATFORM_ANDROID
+
+#include "Android/FlutterJNIStrings.h"
+#include "Android/AndroidApplication.h"
+#include "HAL/PlatformTime.h"
+
+namespace FlutterJNIStringsTests
+{
+	FString MakeJson(const TCHAR* Name)
+	{
+		return FString::Printf(TEXT("{\"player\":\"%s\",\"position\":{\"x\":12.5,\"y\":-3.25,\"z\":100.0},\"health\":87,\"inventory\":[\"sword\",\"shield\",\"potion\"]}"), Name);
+	}
+
+	/** The previous marshalling: UTF-8 on the native side, modified UTF-8 decoded by Java */
+	jstring LegacyToJString(JNIEnv* Env, const FString& String)
+	{
+		FTCHARToUTF8 Converter(*String);
+		return Env->NewStringUTF(Converter.Get());
+	}
+
+	FString LegacyToFString(JNIEnv* Env, jstring JavaString)
+	{
+		const char* UTFString = Env->GetStringUTFChars(JavaString, nullptr);
+		FString Result(UTF8_TO_TCHAR(UTFString));
+		Env->ReleaseStringUTFChars(JavaString, UTFString);
+		return Result;
+	}
+}
+
+// ============================================================
+// MARK: - Round Trip
+// ============================================================
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FFlutterJNIStringsRoundTripTest, "FlutterPlugin.JNIStrings.RoundTrip",
+	EAutomationTestFlags::ApplicationContextMask | EAutomationTestFlags::ProductFilter)
+
+bool FFlutterJNIStringsRoundTripTest::RunTest(const FString& Parameters)
+{
+	using namespace FlutterJNIStringsTests;
+
+	JNIEnv* Env = FAndroidApplication::GetJavaEnv();
+	if (!Env)
+	{
+		AddError(TEXT("No JNI environment"));
+		return false;
+	}
+
+	// Includes a surrogate pair (U+1F3AE), which modified UTF-8 cannot carry as-is
+	const FString Samples[] = {
+		FString(),
+		TEXT("onMessage"),
+		MakeJson(TEXT("Ren\u00e9e \u4e2d\u6587")),
+		FString(TEXT("controller \U0001F3AE")),
+	};
+
+	for (const FString& Sample : Samples)
+	{
+		jstring JavaString = FStringToJString(Env, Sample);
+		TestEqual(TEXT("Length in UTF-16 units"), (int32)Env->GetStringLength(JavaString), Sample.Len());
+		TestEqual(*FString::Printf(TEXT("Round trip '%s'"), *Sample), JStringToFString(Env, JavaString), Sample);
+		Env->DeleteLocalRef(JavaString);
+	}
+
+	// Cached names are the same Java object every time
+	FFlutterJStringCache& Cache = FFlutterJStringCache::Get();
+	jstring First = Cache.Find(Env, TEXT("GameManager"));
+	jstring Second = Cache.Find(Env, TEXT("GameManager"));
+	TestTrue(TEXT("Cached string reused"), First != nullptr && Env->IsSameObject(First, Second));
+	Env->DeleteLocalRef(First);
+	Env->DeleteLocalRef(Second);
+	TestNull(TEXT("Long strings not cached"), Cache.Find(Env, MakeJson(TEXT("x"))));
+
+	return true;
+}
+
+// ============================================================
+// MARK: - Benchmark
+// ============================================================
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FFlutterJNIStringsBenchmark, "FlutterPlugin.JNIStrings.Benchmark.Marshalling",
+	EAutomationTestFlags::ApplicationContextMask | EAutomationTestFlags::PerfFilter)
+
+bool FFlutterJNIStringsBenchmark::RunTest(const FString& Parameters)
+{
+	using namespace FlutterJNIStringsTests;
+
+	JNIEnv* Env = FAndroidApplication::GetJavaEnv();
+	if (!Env)
+	{
+		AddError(TEXT("No JNI environment"));
+		return false;
+	}
+
+	const int32 Iterations = 20000;
+	const FString Payloads[] = { MakeJson(TEXT("Renee")), MakeJson(TEXT("Ren\u00e9e \u4e2d\u6587 \u0645\u0631\u062d\u0628\u0627")) };
+	const TCHAR* Names[] = { TEXT("ASCII"), TEXT("non-ASCII") };
+
+	for (int32 PayloadIndex = 0; PayloadIndex < UE_ARRAY_COUNT(Payloads); ++PayloadIndex)
+	{
+		const FString& Payload = Payloads[PayloadIndex];
+
+		// One message: target, method and data to Java and back
+		double StartTime = FPlatformTime::Seconds();
+		for (int32 Iteration = 0; Iteration < Iterations; ++Iteration)
+		{
+			jstring Target = LegacyToJString(Env, TEXT("GameManager"));
+			jstring Method = LegacyToJString(Env, TEXT("onPlayerState"));
+			jstring Data = LegacyToJString(Env, Payload);
+			LegacyToFString(Env, Data);
+			Env->DeleteLocalRef(Target);
+			Env->DeleteLocalRef(Method);
+			Env->DeleteLocalRef(Data);
+		}
+		const double LegacySeconds = FPlatformTime::Seconds() - StartTime;
+
+		StartTime = FPlatformTime::Seconds();
+		for (int32 Iteration = 0; Iteration < Iterations; ++Iteration)
+		{
+			const FScopedJavaString Target(Env, TEXT("GameManager"), true);
+			const FScopedJavaString Method(Env, TEXT("onPlayerState"), true);
+			const FScopedJavaString Data(Env, Payload);
+			JStringToFString(Env, Data.Get());
+		}
+		const double Utf16Seconds = FPlatformTime::Seconds() - StartTime;
+
+		AddInfo(FString::Printf(TEXT("%-9s %d chars: UTF-8 %.2f us/msg, UTF-16 + cache %.2f us/msg (%.2fx)"),
+			Names[PayloadIndex],
+			Payload.Len(),
+			LegacySeconds * 1e6 / Iterations,
+			Utf16Seconds * 1e6 / Iterations,
+			LegacySeconds / Utf16Seconds));
+	}
+
+	return true;
+}
+
+#endif // WITH_DEV_AUTOMATION_TESTS && PLATFORM_ANDROID
@@ -0,0 +1,59 @@
+// Copyright Epic Games, Inc. All Rights Reserved.
+
+#include "CoreMinimal.h"
+#include "Misc/AutomationTest.h"
+
+#if WITH_DEV_AUTOMATION_TESTS && PLATFORM_ANDROID
+
+#include "Android/FlutterJNIThread.h"
+#include "Android/AndroidApplication.h"
+#include "Async/Async.h"
+#include "HAL/PlatformProcess.h"
+#include "HAL/PlatformTime.h"
+
+// ============================================================
+// MARK: - Attach
+// ============================================================
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FFlutterJNIThreadAttachTest, "FlutterPlugin.JNIThread.Attach",
+	EAutomationTestFlags::ApplicationContextMask | EAutomationTestFlags::ProductFilter)
+
+bool FFlutterJNIThreadAttachTest::RunTest(const FString& Parameters)
+{
+	FFlutterJNIThread::SetJavaVM(FAndroidApplication::GetJavaEnv());
+
+	// The game thread is attached by the engine and keeps that attachment
+	const int32 AttachedBefore = FFlutterJNIThread::GetNumAttachedThreads();
+	TestNotNull(TEXT("Game thread environment"), FFlutterJNIThread::GetEnv());
+	TestEqual(TEXT("Game thread not attached again"), FFlutterJNIThread::GetNumAttachedThreads(), AttachedBefore);
+
+	// A fresh native thread is attached on first use and gets the same JNIEnv after that
+	TFuture<bool> Worker = Async(EAsyncExecution::Thread, [AttachedBefore]()
+	{
+		JNIEnv* First = FFlutterJNIThread::GetEnv();
+		JNIEnv* Second = FFlutterJNIThread::GetEnv();
+		if (!First || First != Second || FFlutterJNIThread::GetNumAttachedThreads() != AttachedBefore + 1)
+		{
+			return false;
+		}
+
+		// The environment is usable from this thread
+		jstring String = First->NewStringUTF("worker");
+		const bool bUsable = String != nullptr && First->GetStringLength(String) == 6;
+		First->DeleteLocalRef(String);
+		return bUsable;
+	});
+	TestTrue(TEXT("Worker thread attached and usable"), Worker.Get());
+
+	// The thread detaches as it exits
+	const double Deadline = FPlatformTime::Seconds() + 2.0;
+	while (FFlutterJNIThread::GetNumAttachedThreads() != AttachedBefore && FPlatformTime::Seconds() < Deadline)
+	{
+		FPlatformProcess::Sleep(0.01f);
+	}
+	TestEqual(TEXT("Worker thread detached on exit"), FFlutterJNIThread::GetNumAttachedThreads(), AttachedBefore);
+
+	return true;
+}
+
+#endif // WITH_DEV_AUTOMATION_TESTS && PLATFORM_ANDROID
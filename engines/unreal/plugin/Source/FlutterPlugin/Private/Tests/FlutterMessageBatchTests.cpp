@@ -0,0 +1,104 @@
+// Copyright Epic Games, Inc. All Rights Reserved.
+
+#include "FlutterMessageBatch.h"
+#include "Misc/AutomationTest.h"
+#include "HAL/PlatformTime.h"
+
+#if WITH_DEV_AUTOMATION_TESTS
+
+// ============================================================
+// MARK: - Round Trip
+// ============================================================
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FFlutterMessageBatchRoundTripTest, "FlutterPlugin.Batch.RoundTrip",
+	EAutomationTestFlags::ApplicationContextMask | EAutomationTestFlags::ProductFilter)
+
+bool FFlutterMessageBatchRoundTripTest::RunTest(const FString& Parameters)
+{
+	FFlutterMessageBatchWriter Writer;
+	TestTrue(TEXT("Empty writer still produces a valid frame"), FFlutterMessageBatch::IsBatchFrame(Writer.GetFrame()));
+
+	Writer.Add(TEXT("GameManager"), TEXT("onScore"), TEXT("{\"score\":10}"));
+	Writer.Add(TEXT("Player"), TEXT("onMove"), FString());
+	Writer.Add(TEXT("Chat"), TEXT("onText"), TEXT("h\u00e9llo \u2713"));
+	TestEqual(TEXT("Message count"), Writer.Num(), 3);
+
+	TArray<FString> Decoded;
+	const bool bDecoded = FFlutterMessageBatch::Decode(Writer.GetFrame(), [&Decoded](FString&& Target, FString&& Method, FString&& Data)
+	{
+		Decoded.Add(Target + TEXT("|") + Method + TEXT("|") + Data);
+	});
+
+	TestTrue(TEXT("Frame decodes"), bDecoded);
+	TestEqual(TEXT("All messages decoded"), Decoded.Num(), 3);
+	if (Decoded.Num() == 3)
+	{
+		TestEqual(TEXT("First message"), Decoded[0], FString(TEXT("GameManager|onScore|{\"score\":10}")));
+		TestEqual(TEXT("Empty data survives"), Decoded[1], FString(TEXT("Player|onMove|")));
+		TestEqual(TEXT("Non-ASCII data survives"), Decoded[2], FString(TEXT("Chat|onText|h\u00e9llo \u2713")));
+	}
+
+	// A truncated frame is rejected rather than read past the end
+	TArray<uint8> Truncated = Writer.GetFrame();
+	Truncated.SetNum(Truncated.Num() - 3);
+	int32 Visited = 0;
+	TestFalse(TEXT("Truncated frame rejected"), FFlutterMessageBatch::Decode(Truncated, [&Visited](FString&&, FString&&, FString&&) { Visited++; }));
+	TestEqual(TEXT("Complete messages before the cut are delivered"), Visited, 2);
+
+	Writer.Reset();
+	TestEqual(TEXT("Reset clears messages"), Writer.Num(), 0);
+	TestEqual(TEXT("Reset leaves only the header"), Writer.NumBytes(), FFlutterMessageBatch::HeaderSize);
+
+	return true;
+}
+
+// ============================================================
+// MARK: - Throughput Benchmark
+// ============================================================
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FFlutterMessageBatchBenchmark, "FlutterPlugin.Batch.Benchmark.Throughput",
+	EAutomationTestFlags::ApplicationContextMask | EAutomationTestFlags::PerfFilter)
+
+bool FFlutterMessageBatchBenchmark::RunTest(const FString& Parameters)
+{
+	const int32 BatchSizes[] = { 1, 16, 256 };
+	const int32 TotalMessages = 256 * 1024;
+	const FString Target = TEXT("RotatingCube");
+	const FString Method = TEXT("onStateSync");
+	const FString Data = TEXT("{\"rotation\":{\"pitch\":0.0,\"yaw\":123.4,\"roll\":0.0},\"speed\":45.0}");
+
+	for (const int32 BatchSize : BatchSizes)
+	{
+		FFlutterMessageBatchWriter Writer;
+		int32 Frames = 0;
+		int32 Delivered = 0;
+		int64 Bytes = 0;
+
+		// Encode on the sending side, decode on the receiving side; one frame per platform crossing
+		const double StartTime = FPlatformTime::Seconds();
+		for (int32 Message = 0; Message < TotalMessages; ++Message)
+		{
+			Writer.Add(Target, Method, Data);
+			if (Writer.Num() == BatchSize)
+			{
+				Bytes += Writer.NumBytes();
+				FFlutterMessageBatch::Decode(Writer.GetFrame(), [&Delivered](FString&&, FString&&, FString&&) { Delivered++; });
+				Writer.Reset();
+				Frames++;
+			}
+		}
+		const double Seconds = FPlatformTime::Seconds() - StartTime;
+
+		TestEqual(TEXT("Every message delivered"), Delivered, TotalMessages);
+
+		AddInfo(FString::Printf(TEXT("batch %3d: %.2f M msgs/s, %d crossings, %.1f bytes/msg"),
+			BatchSize,
+			TotalMessages / Seconds / 1.0e6,
+			Frames,
+			(double)Bytes / TotalMessages));
+	}
+
+	return true;
+}
+
+#endif // WITH_DEV_AUTOMATION_TESTS
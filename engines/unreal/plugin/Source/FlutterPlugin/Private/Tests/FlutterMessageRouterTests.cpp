@@ -0,0 +1,489 @@
+// Copyright Epic Games, Inc. All Rights Reserved.
+
+#include "FlutterMessageRouter.h"
+#include "FlutterTestReceiver.h"
+#include "Misc/AutomationTest.h"
+#include "HAL/PlatformTime.h"
+
+#if WITH_DEV_AUTOMATION_TESTS
+
+namespace FlutterMessageRouterTests
+{
+	FFlutterMethodDelegate MakeDelegate(UFlutterTestReceiver* Receiver)
+	{
+		FFlutterMethodDelegate Delegate;
+		Delegate.BindUFunction(Receiver, GET_FUNCTION_NAME_CHECKED(UFlutterTestReceiver, OnMessage));
+		return Delegate;
+	}
+
+	FFlutterBinaryMethodDelegate MakeBinaryDelegate(UFlutterTestReceiver* Receiver)
+	{
+		FFlutterBinaryMethodDelegate Delegate;
+		Delegate.BindUFunction(Receiver, GET_FUNCTION_NAME_CHECKED(UFlutterTestReceiver, OnBinaryMessage));
+		return Delegate;
+	}
+
+	FString TargetName(int32 Index)
+	{
+		return FString::Printf(TEXT("BenchTarget%d"), Index / 20);
+	}
+
+	FString MethodName(int32 Index)
+	{
+		return FString::Printf(TEXT("benchMethod%d"), Index);
+	}
+}
+
+// ============================================================
+// MARK: - Route Handles
+// ============================================================
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FFlutterRouterRouteHandleTest, "FlutterPlugin.Router.RouteHandle",
+	EAutomationTestFlags::ApplicationContextMask | EAutomationTestFlags::ProductFilter)
+
+bool FFlutterRouterRouteHandleTest::RunTest(const FString& Parameters)
+{
+	using namespace FlutterMessageRouterTests;
+
+	UFlutterMessageRouter* Router = NewObject<UFlutterMessageRouter>();
+	UFlutterTestReceiver* Receiver = NewObject<UFlutterTestReceiver>();
+
+	Router->RegisterTarget(TEXT("GameManager"), Receiver, true);
+	Router->RegisterMethod(TEXT("GameManager"), TEXT("onPlayerAction"), MakeDelegate(Receiver));
+	Router->RegisterBinaryMethod(TEXT("GameManager"), TEXT("onPlayerAction"), MakeBinaryDelegate(Receiver));
+
+	const FFlutterRouteHandle Handle = Router->ResolveRoute(TEXT("GameManager"), TEXT("onPlayerAction"));
+	TestTrue(TEXT("Resolved handle is valid"), Handle.IsValid());
+	TestTrue(TEXT("Resolving twice yields the same handle"), Handle == Router->ResolveRoute(TEXT("GameManager"), TEXT("onPlayerAction")));
+
+	TestTrue(TEXT("Route by handle"), Router->RouteMessageWithHandle(Handle, TEXT("{\"jump\":true}")));
+	TestEqual(TEXT("Handler received method name"), Receiver->LastMethod, FString(TEXT("onPlayerAction")));
+	TestEqual(TEXT("Handler received data"), Receiver->LastData, FString(TEXT("{\"jump\":true}")));
+
+	TestTrue(TEXT("Route by strings"), Router->RouteMessage(TEXT("GameManager"), TEXT("onPlayerAction"), TEXT("{}")));
+	TestEqual(TEXT("String and handle paths reach the same handler"), Receiver->MessagesReceived, 2);
+
+	TestTrue(TEXT("Route binary by handle"), Router->RouteBinaryMessageWithHandle(Handle, TArray<uint8>{ 1, 2, 3 }));
+	TestEqual(TEXT("Binary handler received data"), Receiver->LastBinaryData.Num(), 3);
+
+	// A handle outlives its handler and simply misses once the method is gone
+	Router->UnregisterMethod(TEXT("GameManager"), TEXT("onPlayerAction"));
+	TestFalse(TEXT("Stale handle is not routed"), Router->RouteMessageWithHandle(Handle, TEXT("{}")));
+	TestEqual(TEXT("Stale handle counted as dropped"), Router->GetStatistics().MessagesDropped, 1);
+
+	// Re-registering makes the same handle live again
+	Router->RegisterMethod(TEXT("GameManager"), TEXT("onPlayerAction"), MakeDelegate(Receiver));
+	TestTrue(TEXT("Handle routes after re-registration"), Router->RouteMessageWithHandle(Handle, TEXT("{}")));
+
+	// Names that were never registered must not resolve to a live route
+	TestFalse(TEXT("Unknown method on known target"), Router->RouteMessage(TEXT("GameManager"), TEXT("neverRegistered"), TEXT("{}")));
+
+	return true;
+}
+
+// ============================================================
+// MARK: - Typed Methods
+// ============================================================
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FFlutterRouterTypedMethodTest, "FlutterPlugin.Router.TypedMethod",
+	EAutomationTestFlags::ApplicationContextMask | EAutomationTestFlags::ProductFilter)
+
+bool FFlutterRouterTypedMethodTest::RunTest(const FString& Parameters)
+{
+	using namespace FlutterMessageRouterTests;
+
+	UFlutterMessageRouter* Router = NewObject<UFlutterMessageRouter>();
+	UFlutterTestReceiver* Receiver = NewObject<UFlutterTestReceiver>();
+
+	FString ReceivedMethod;
+	double ReceivedSpeed = 0.0;
+	bool bReceivedRotating = false;
+
+	FFlutterTypedMethodDelegate Delegate;
+	Delegate.BindLambda([&](const FString& Method, FFlutterStandardReader& Payload)
+	{
+		int32 Count = 0;
+		ReceivedMethod = Method;
+		Payload.ReadListHeader(Count);
+		Payload.ReadDouble(ReceivedSpeed);
+		Payload.ReadBool(bReceivedRotating);
+	});
+
+	Router->RegisterTarget(TEXT("Cube"), Receiver);
+	Router->RegisterTypedMethod(TEXT("Cube"), TEXT("setState"), Delegate);
+	TestEqual(TEXT("Typed method counted"), Router->GetStatistics().CachedDelegates, 1);
+
+	FFlutterStandardWriter Writer;
+	Writer.BeginList(2);
+	Writer.WriteDouble(90.0);
+	Writer.WriteBool(true);
+
+	TestTrue(TEXT("Typed message routed"), Router->RouteBinaryMessage(TEXT("Cube"), TEXT("setState"), Writer.GetBuffer()));
+	TestEqual(TEXT("Method name passed through"), ReceivedMethod, FString(TEXT("setState")));
+	TestEqual(TEXT("Speed decoded"), ReceivedSpeed, 90.0);
+	TestTrue(TEXT("Flag decoded"), bReceivedRotating);
+
+	// A raw binary handler on the same method takes precedence over the typed one
+	Router->RegisterBinaryMethod(TEXT("Cube"), TEXT("setState"), MakeBinaryDelegate(Receiver));
+	ReceivedMethod.Reset();
+	Router->RouteBinaryMessage(TEXT("Cube"), TEXT("setState"), Writer.GetBuffer());
+	TestTrue(TEXT("Raw handler preferred"), ReceivedMethod.IsEmpty() && Receiver->LastBinaryData == Writer.GetBuffer());
+
+	Router->UnregisterMethod(TEXT("Cube"), TEXT("setState"));
+	TestEqual(TEXT("Typed method released"), Router->GetStatistics().CachedDelegates, 0);
+
+	return true;
+}
+
+// ============================================================
+// MARK: - Registration Index
+// ============================================================
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FFlutterRouterRegistrationIndexTest, "FlutterPlugin.Router.RegistrationIndex",
+	EAutomationTestFlags::ApplicationContextMask | EAutomationTestFlags::ProductFilter)
+
+bool FFlutterRouterRegistrationIndexTest::RunTest(const FString& Parameters)
+{
+	using namespace FlutterMessageRouterTests;
+
+	UFlutterMessageRouter* Router = NewObject<UFlutterMessageRouter>();
+	UFlutterTestReceiver* Receiver = NewObject<UFlutterTestReceiver>();
+
+	// Methods registered ahead of their target are kept and picked up on registration
+	Router->RegisterMethod(TEXT("Player"), TEXT("onMove"), MakeDelegate(Receiver));
+	TestFalse(TEXT("Method alone does not register the target"), Router->IsTargetRegistered(TEXT("Player")));
+	TestEqual(TEXT("Early method is counted"), Router->GetStatistics().CachedDelegates, 1);
+
+	Router->RegisterTarget(TEXT("Player"), Receiver);
+	Router->RegisterBinaryMethod(TEXT("Player"), TEXT("onSnapshot"), MakeBinaryDelegate(Receiver));
+	Router->RegisterTarget(TEXT("Camera"), Receiver);
+	Router->RegisterMethod(TEXT("Camera"), TEXT("onZoom"), MakeDelegate(Receiver));
+
+	const TArray<FFlutterTargetInfo> Targets = Router->GetRegisteredTargets();
+	TestEqual(TEXT("Both targets listed"), Targets.Num(), 2);
+	for (const FFlutterTargetInfo& Info : Targets)
+	{
+		TestEqual(*FString::Printf(TEXT("%s has one string method"), *Info.TargetName), Info.RegisteredMethods, 1);
+	}
+
+	// Unregistering one target leaves the other untouched
+	Router->UnregisterTarget(TEXT("Player"));
+	TestFalse(TEXT("Player gone"), Router->RouteMessage(TEXT("Player"), TEXT("onMove"), TEXT("{}")));
+	TestTrue(TEXT("Camera still routed"), Router->RouteMessage(TEXT("Camera"), TEXT("onZoom"), TEXT("{}")));
+	TestEqual(TEXT("Player delegates released"), Router->GetStatistics().CachedDelegates, 1);
+	TestEqual(TEXT("One target left"), Router->GetStatistics().RegisteredTargets, 1);
+
+	// Re-registering a method must not inflate the count
+	Router->RegisterMethod(TEXT("Camera"), TEXT("onZoom"), MakeDelegate(Receiver));
+	TestEqual(TEXT("Replaced method counted once"), Router->GetStatistics().CachedDelegates, 1);
+
+	Router->UnregisterMethod(TEXT("Camera"), TEXT("onZoom"));
+	TestEqual(TEXT("No delegates left"), Router->GetStatistics().CachedDelegates, 0);
+	TestTrue(TEXT("Target outlives its last method"), Router->IsTargetRegistered(TEXT("Camera")));
+
+	return true;
+}
+
+// ============================================================
+// MARK: - Registration Stress
+// ============================================================
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FFlutterRouterRegistrationStressTest, "FlutterPlugin.Router.Benchmark.Registration",
+	EAutomationTestFlags::ApplicationContextMask | EAutomationTestFlags::PerfFilter)
+
+bool FFlutterRouterRegistrationStressTest::RunTest(const FString& Parameters)
+{
+	using namespace FlutterMessageRouterTests;
+
+	const int32 NumTargets = 10000;
+	const int32 MethodsPerTarget = 20;
+
+	UFlutterMessageRouter* Router = NewObject<UFlutterMessageRouter>();
+	UFlutterTestReceiver* Receiver = NewObject<UFlutterTestReceiver>();
+	const FFlutterMethodDelegate Delegate = MakeDelegate(Receiver);
+
+	TArray<FString> Targets;
+	Targets.Reserve(NumTargets);
+	for (int32 Index = 0; Index < NumTargets * MethodsPerTarget; Index += MethodsPerTarget)
+	{
+		Targets.Add(TargetName(Index));
+	}
+
+	// Actors spawning: target plus its methods
+	double StartTime = FPlatformTime::Seconds();
+	for (int32 TargetIndex = 0; TargetIndex < NumTargets; ++TargetIndex)
+	{
+		Router->RegisterTarget(Targets[TargetIndex], Receiver);
+		for (int32 Method = 0; Method < MethodsPerTarget; ++Method)
+		{
+			Router->RegisterMethod(Targets[TargetIndex], MethodName(Method), Delegate);
+		}
+	}
+	const double RegisterSeconds = FPlatformTime::Seconds() - StartTime;
+
+	TestEqual(TEXT("All targets registered"), Router->GetStatistics().RegisteredTargets, NumTargets);
+	TestEqual(TEXT("All delegates registered"), Router->GetStatistics().CachedDelegates, NumTargets * MethodsPerTarget);
+
+	// Debug UI polling the target list
+	StartTime = FPlatformTime::Seconds();
+	const TArray<FFlutterTargetInfo> Infos = Router->GetRegisteredTargets();
+	const double IntrospectSeconds = FPlatformTime::Seconds() - StartTime;
+
+	TestEqual(TEXT("Introspection lists every target"), Infos.Num(), NumTargets);
+	TestEqual(TEXT("Introspection counts methods per target"), Infos.Num() > 0 ? Infos[0].RegisteredMethods : 0, MethodsPerTarget);
+
+	// Actors despawning; each unregister should only touch its own methods
+	StartTime = FPlatformTime::Seconds();
+	for (int32 TargetIndex = 0; TargetIndex < NumTargets; ++TargetIndex)
+	{
+		Router->UnregisterTarget(Targets[TargetIndex]);
+	}
+	const double UnregisterSeconds = FPlatformTime::Seconds() - StartTime;
+
+	TestEqual(TEXT("No targets left"), Router->GetStatistics().RegisteredTargets, 0);
+	TestEqual(TEXT("No delegates left"), Router->GetStatistics().CachedDelegates, 0);
+
+	AddInfo(FString::Printf(TEXT("%d targets x %d methods: register %.2f ms, introspect %.2f ms, unregister %.2f ms (%.2f us/target)"),
+		NumTargets,
+		MethodsPerTarget,
+		RegisterSeconds * 1000.0,
+		IntrospectSeconds * 1000.0,
+		UnregisterSeconds * 1000.0,
+		UnregisterSeconds * 1.0e6 / NumTargets));
+
+	return true;
+}
+
+// ============================================================
+// MARK: - Pre-Ready Queue
+// ============================================================
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FFlutterRouterPreReadyQueueTest, "FlutterPlugin.Router.PreReadyQueue",
+	EAutomationTestFlags::ApplicationContextMask | EAutomationTestFlags::ProductFilter)
+
+bool FFlutterRouterPreReadyQueueTest::RunTest(const FString& Parameters)
+{
+	using namespace FlutterMessageRouterTests;
+
+	UFlutterMessageRouter* Router = NewObject<UFlutterMessageRouter>();
+	UFlutterTestReceiver* Player = NewObject<UFlutterTestReceiver>();
+	UFlutterTestReceiver* Camera = NewObject<UFlutterTestReceiver>();
+	Router->SetMaxQueueSize(4);
+
+	Router->RouteMessage(TEXT("Player"), TEXT("onMove"), TEXT("1"));
+	Router->RouteMessage(TEXT("Camera"), TEXT("onZoom"), TEXT("2"));
+	Router->RouteMessage(TEXT("Player"), TEXT("onMove"), TEXT("3"));
+	Router->RouteMessage(TEXT("Camera"), TEXT("onZoom"), TEXT("4"));
+
+	FFlutterRouterStatistics Stats = Router->GetStatistics();
+	TestEqual(TEXT("Queue is full"), Stats.QueuedMessages, 4);
+	TestEqual(TEXT("Player depth"), Stats.QueuedMessagesPerTarget.FindRef(TEXT("Player")), 2);
+	TestEqual(TEXT("Camera depth"), Stats.QueuedMessagesPerTarget.FindRef(TEXT("Camera")), 2);
+
+	// Overflow drops the oldest message ("1")
+	Router->RouteMessage(TEXT("Player"), TEXT("onMove"), TEXT("5"));
+	Stats = Router->GetStatistics();
+	TestEqual(TEXT("Queue stays at capacity"), Stats.QueuedMessages, 4);
+	TestEqual(TEXT("Overflow counted as dropped"), Stats.MessagesDropped, 1);
+
+	// Handlers bound ahead of registration pick up the queued messages
+	Router->RegisterMethod(TEXT("Player"), TEXT("onMove"), MakeDelegate(Player));
+	Router->RegisterMethod(TEXT("Camera"), TEXT("onZoom"), MakeDelegate(Camera));
+
+	// Registering one target delivers only its messages, oldest first
+	Router->RegisterTarget(TEXT("Player"), Player);
+	TestEqual(TEXT("Player received surviving messages"), Player->MessagesReceived, 2);
+	TestEqual(TEXT("Player received newest last"), Player->LastData, FString(TEXT("5")));
+	TestEqual(TEXT("Camera untouched"), Camera->MessagesReceived, 0);
+
+	Stats = Router->GetStatistics();
+	TestEqual(TEXT("Camera messages still queued"), Stats.QueuedMessages, 2);
+	TestFalse(TEXT("Player no longer listed"), Stats.QueuedMessagesPerTarget.Contains(TEXT("Player")));
+
+	// Shrinking the queue trims the oldest remaining message ("2")
+	Router->SetMaxQueueSize(1);
+	TestEqual(TEXT("Queue trimmed"), Router->GetStatistics().QueuedMessages, 1);
+
+	Router->RegisterTarget(TEXT("Camera"), Camera);
+	TestEqual(TEXT("Camera received the newest message"), Camera->MessagesReceived, 1);
+	TestEqual(TEXT("Camera data"), Camera->LastData, FString(TEXT("4")));
+	TestEqual(TEXT("Queue drained"), Router->GetStatistics().QueuedMessages, 0);
+
+	return true;
+}
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FFlutterRouterPreReadyNewNameTest, "FlutterPlugin.Router.PreReadyNewName",
+	EAutomationTestFlags::ApplicationContextMask | EAutomationTestFlags::ProductFilter)
+
+bool FFlutterRouterPreReadyNewNameTest::RunTest(const FString& Parameters)
+{
+	using namespace FlutterMessageRouterTests;
+
+	// A name nothing has created yet, whatever ran before this test
+	const FString Target = TEXT("LateTarget") + FGuid::NewGuid().ToString(EGuidFormats::Digits);
+	TestTrue(TEXT("Target name does not exist yet"), FName(*Target, FNAME_Find).IsNone());
+
+	UFlutterMessageRouter* Router = NewObject<UFlutterMessageRouter>();
+	UFlutterTestReceiver* Receiver = NewObject<UFlutterTestReceiver>();
+
+	TestTrue(TEXT("Message queued"), Router->RouteMessage(Target, TEXT("onReady"), TEXT("1")));
+	TestTrue(TEXT("Binary message queued"), Router->RouteBinaryMessage(Target, TEXT("onBlob"), TArray<uint8>({ 1, 2 })));
+	TestEqual(TEXT("Both messages queued"), Router->GetStatistics().QueuedMessagesPerTarget.FindRef(Target), 2);
+	TestTrue(TEXT("Queueing does not create the name"), FName(*Target, FNAME_Find).IsNone());
+
+	Router->RegisterMethod(Target, TEXT("onReady"), MakeDelegate(Receiver));
+	Router->RegisterBinaryMethod(Target, TEXT("onBlob"), MakeBinaryDelegate(Receiver));
+	Router->RegisterTarget(Target, Receiver);
+
+	TestEqual(TEXT("Message delivered on registration"), Receiver->MessagesReceived, 1);
+	TestEqual(TEXT("Binary message delivered on registration"), Receiver->BinaryMessagesReceived, 1);
+	TestEqual(TEXT("Nothing dropped"), Router->GetStatistics().MessagesDropped, 0);
+	TestEqual(TEXT("Queue drained"), Router->GetStatistics().QueuedMessages, 0);
+
+	return true;
+}
+
+// ============================================================
+// MARK: - Startup Burst Benchmark
+// ============================================================
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FFlutterRouterStartupBurstBenchmark, "FlutterPlugin.Router.Benchmark.StartupBurst",
+	EAutomationTestFlags::ApplicationContextMask | EAutomationTestFlags::PerfFilter)
+
+bool FFlutterRouterStartupBurstBenchmark::RunTest(const FString& Parameters)
+{
+	using namespace FlutterMessageRouterTests;
+
+	const int32 NumTargets = 100;
+	const int32 MessagesPerTarget = 10;
+	const int32 Overflow = 500;
+
+	UFlutterMessageRouter* Router = NewObject<UFlutterMessageRouter>();
+	UFlutterTestReceiver* Receiver = NewObject<UFlutterTestReceiver>();
+	Router->SetMaxQueueSize(NumTargets * MessagesPerTarget);
+
+	TArray<FString> Targets;
+	for (int32 TargetIndex = 0; TargetIndex < NumTargets; ++TargetIndex)
+	{
+		Targets.Add(TargetName(TargetIndex * 20));
+	}
+
+	// Flutter bursts messages before any target exists; the extra ones overflow the queue
+	double StartTime = FPlatformTime::Seconds();
+	for (int32 Message = 0; Message < NumTargets * MessagesPerTarget + Overflow; ++Message)
+	{
+		Router->RouteMessage(Targets[Message % NumTargets], TEXT("onReady"), TEXT("{\"ready\":true}"));
+	}
+	const double QueueSeconds = FPlatformTime::Seconds() - StartTime;
+
+	TestEqual(TEXT("Overflow dropped oldest"), Router->GetStatistics().MessagesDropped, Overflow);
+
+	for (const FString& Target : Targets)
+	{
+		Router->RegisterMethod(Target, TEXT("onReady"), MakeDelegate(Receiver));
+	}
+
+	// Targets register one by one, each flush touches the queue once
+	StartTime = FPlatformTime::Seconds();
+	for (const FString& Target : Targets)
+	{
+		UFlutterTestReceiver* Actor = NewObject<UFlutterTestReceiver>();
+		Router->RegisterTarget(Target, Actor);
+	}
+	const double FlushSeconds = FPlatformTime::Seconds() - StartTime;
+
+	TestEqual(TEXT("Every queued message delivered"), Receiver->MessagesReceived, NumTargets * MessagesPerTarget);
+	TestEqual(TEXT("Queue drained"), Router->GetStatistics().QueuedMessages, 0);
+
+	AddInfo(FString::Printf(TEXT("%d queued messages (%d overflow): queue %.2f ms, register+flush %d targets %.2f ms"),
+		NumTargets * MessagesPerTarget,
+		Overflow,
+		QueueSeconds * 1000.0,
+		NumTargets,
+		FlushSeconds * 1000.0));
+
+	return true;
+}
+
+// ============================================================
+// MARK: - Dispatch Benchmark
+// ============================================================
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FFlutterRouterDispatchBenchmark, "FlutterPlugin.Router.Benchmark.Dispatch",
+	EAutomationTestFlags::ApplicationContextMask | EAutomationTestFlags::PerfFilter)
+
+bool FFlutterRouterDispatchBenchmark::RunTest(const FString& Parameters)
+{
+	using namespace FlutterMessageRouterTests;
+
+	const int32 MethodCounts[] = { 1, 100, 10000 };
+	const int32 MessagesPerRun = 200000;
+	const FString Payload = TEXT("{\"x\":1.0,\"y\":2.0}");
+
+	for (const int32 NumMethods : MethodCounts)
+	{
+		UFlutterMessageRouter* Router = NewObject<UFlutterMessageRouter>();
+		UFlutterTestReceiver* Receiver = NewObject<UFlutterTestReceiver>();
+		const FFlutterMethodDelegate Delegate = MakeDelegate(Receiver);
+
+		// Legacy layout: "Target:Method" string keys built per message
+		TMap<FString, FFlutterMethodDelegate> LegacyDelegates;
+
+		TArray<FString> Targets;
+		TArray<FString> Methods;
+		TArray<FFlutterRouteHandle> Handles;
+
+		for (int32 Index = 0; Index < NumMethods; ++Index)
+		{
+			Targets.Add(TargetName(Index));
+			Methods.Add(MethodName(Index));
+			Router->RegisterMethod(Targets.Last(), Methods.Last(), Delegate);
+			LegacyDelegates.Add(FString::Printf(TEXT("%s:%s"), *Targets.Last(), *Methods.Last()), Delegate);
+			Handles.Add(Router->ResolveRoute(Targets.Last(), Methods.Last()));
+		}
+
+		// Old path: format key, hash string, dispatch
+		double StartTime = FPlatformTime::Seconds();
+		for (int32 Message = 0; Message < MessagesPerRun; ++Message)
+		{
+			const int32 Index = Message % NumMethods;
+			const FString CacheKey = FString::Printf(TEXT("%s:%s"), *Targets[Index], *Methods[Index]);
+			if (const FFlutterMethodDelegate* Found = LegacyDelegates.Find(CacheKey))
+			{
+				Found->Execute(Methods[Index], Payload);
+			}
+		}
+		const double LegacySeconds = FPlatformTime::Seconds() - StartTime;
+
+		// New string path: interned name lookup, no formatting
+		StartTime = FPlatformTime::Seconds();
+		for (int32 Message = 0; Message < MessagesPerRun; ++Message)
+		{
+			const int32 Index = Message % NumMethods;
+			Router->RouteMessage(Targets[Index], Methods[Index], Payload);
+		}
+		const double StringSeconds = FPlatformTime::Seconds() - StartTime;
+
+		// Handle path: integer hash lookup only
+		StartTime = FPlatformTime::Seconds();
+		for (int32 Message = 0; Message < MessagesPerRun; ++Message)
+		{
+			Router->RouteMessageWithHandle(Handles[Message % NumMethods], Payload);
+		}
+		const double HandleSeconds = FPlatformTime::Seconds() - StartTime;
+
+		TestEqual(TEXT("Every message was delivered"), Receiver->MessagesReceived, MessagesPerRun * 3);
+		TestEqual(TEXT("Router counted every routed message"), Router->GetStatistics().MessagesRouted, MessagesPerRun * 2);
+
+		const double ToNanosPerMessage = 1.0e9 / MessagesPerRun;
+		AddInfo(FString::Printf(TEXT("%5d methods: legacy %.1f ns/msg, string %.1f ns/msg, handle %.1f ns/msg"),
+			NumMethods,
+			LegacySeconds * ToNanosPerMessage,
+			StringSeconds * ToNanosPerMessage,
+			HandleSeconds * ToNanosPerMessage));
+	}
+
+	return true;
+}
+
+#endif // WITH_DEV_AUTOMATION_TESTS
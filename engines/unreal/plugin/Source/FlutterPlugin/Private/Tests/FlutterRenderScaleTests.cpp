@@ -0,0 +1,121 @@
+// Copyright Epic Games, Inc. All Rights Reserved.
+
+#include "FlutterRenderScale.h"
+#include "Misc/AutomationTest.h"
+
+#if WITH_DEV_AUTOMATION_TESTS
+
+namespace FlutterRenderScaleTests
+{
+	static FFlutterRenderScaleSettings MakeSettings(EFlutterRenderScaleMode Mode, float Scale, float MinScale = 0.5f, float MaxScale = 1.0f)
+	{
+		FFlutterRenderScaleSettings Settings;
+		Settings.Mode = Mode;
+		Settings.Scale = Scale;
+		Settings.MinScale = MinScale;
+		Settings.MaxScale = MaxScale;
+		Settings.TargetFrameRate = 60.0f;
+		return Settings;
+	}
+
+	/** Feed one evaluation window of identical frames; true if the scale changed */
+	static bool RunWindow(FFlutterRenderScale& RenderScale, double FrameSeconds)
+	{
+		bool bChanged = false;
+		for (double Elapsed = 0.0; Elapsed < FFlutterRenderScale::EvaluationSeconds; Elapsed += FrameSeconds)
+		{
+			bChanged |= RenderScale.Update(FrameSeconds);
+		}
+		return bChanged;
+	}
+}
+
+// ============================================================
+// MARK: - Fixed
+// ============================================================
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FFlutterRenderScaleFixedTest, "FlutterPlugin.RenderScale.Fixed",
+	EAutomationTestFlags::ApplicationContextMask | EAutomationTestFlags::ProductFilter)
+
+bool FFlutterRenderScaleFixedTest::RunTest(const FString& Parameters)
+{
+	using namespace FlutterRenderScaleTests;
+
+	FFlutterRenderScale RenderScale;
+	TestEqual(TEXT("Native by default"), RenderScale.GetScale(), 1.0f);
+
+	TestTrue(TEXT("Fixed scale changes it"), RenderScale.Configure(MakeSettings(EFlutterRenderScaleMode::Fixed, 0.7f)));
+	TestEqual(TEXT("Fixed scale"), RenderScale.GetScale(), 0.7f);
+	TestFalse(TEXT("Fixed ignores frame times"), RunWindow(RenderScale, 0.1));
+
+	int32 Width = 0;
+	int32 Height = 0;
+	FFlutterRenderScale::GetRenderSize(1080, 2340, RenderScale.GetScale(), Width, Height);
+	TestEqual(TEXT("Render width"), Width, 756);
+	TestEqual(TEXT("Render height"), Height, 1638);
+
+	FFlutterRenderScale::GetRenderSize(0, 0, 0.5f, Width, Height);
+	TestEqual(TEXT("No surface, no render target"), Width, 0);
+
+	RenderScale.Configure(MakeSettings(EFlutterRenderScaleMode::Fixed, 0.01f));
+	TestEqual(TEXT("Clamped to the allowed range"), RenderScale.GetScale(), FFlutterRenderScale::MinAllowedScale);
+
+	TestTrue(TEXT("Back to native"), RenderScale.Configure(MakeSettings(EFlutterRenderScaleMode::Native, 0.5f)));
+	TestEqual(TEXT("Native scale"), RenderScale.GetScale(), 1.0f);
+
+	return true;
+}
+
+// ============================================================
+// MARK: - Dynamic
+// ============================================================
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FFlutterRenderScaleDynamicTest, "FlutterPlugin.RenderScale.Dynamic",
+	EAutomationTestFlags::ApplicationContextMask | EAutomationTestFlags::ProductFilter)
+
+bool FFlutterRenderScaleDynamicTest::RunTest(const FString& Parameters)
+{
+	using namespace FlutterRenderScaleTests;
+
+	const double Target = 1.0 / 60.0;
+
+	FFlutterRenderScale RenderScale;
+	RenderScale.Configure(MakeSettings(EFlutterRenderScaleMode::Dynamic, 1.0f));
+
+	// 30 fps at full resolution: the pixel count needs to halve, capped by the largest step
+	TestTrue(TEXT("Scales down when over budget"), RunWindow(RenderScale, 2.0 * Target));
+	TestEqual(TEXT("Limited to one large step"), RenderScale.GetScale(), 1.0f - FFlutterRenderScale::MaxStepDown, 0.001f);
+
+	// Slightly over budget still moves by at least one step
+	TestTrue(TEXT("Small overshoot"), RunWindow(RenderScale, 1.15 * Target));
+	TestEqual(TEXT("One step down"), RenderScale.GetScale(), 0.75f, 0.001f);
+
+	// Far over budget stops at the minimum
+	for (int32 Window = 0; Window < 10; ++Window)
+	{
+		RunWindow(RenderScale, 4.0 * Target);
+	}
+	TestEqual(TEXT("Held at the minimum"), RenderScale.GetScale(), 0.5f, 0.001f);
+
+	// On budget, it probes upwards one step every few windows
+	for (int32 Window = 1; Window < FFlutterRenderScale::RaiseAfterWindows; ++Window)
+	{
+		TestFalse(TEXT("Waits before raising"), RunWindow(RenderScale, Target));
+	}
+	TestTrue(TEXT("Raises after enough windows"), RunWindow(RenderScale, Target));
+	TestEqual(TEXT("One step up"), RenderScale.GetScale(), 0.55f, 0.001f);
+
+	for (int32 Window = 0; Window < 100; ++Window)
+	{
+		RunWindow(RenderScale, Target);
+	}
+	TestEqual(TEXT("Held at the maximum"), RenderScale.GetScale(), 1.0f, 0.001f);
+
+	// Hitches such as level loads are not rendering cost
+	TestFalse(TEXT("Long frames ignored"), RunWindow(RenderScale, 1.0));
+	TestEqual(TEXT("Unchanged by hitches"), RenderScale.GetScale(), 1.0f, 0.001f);
+
+	return true;
+}
+
+#endif // WITH_DEV_AUTOMATION_TESTS
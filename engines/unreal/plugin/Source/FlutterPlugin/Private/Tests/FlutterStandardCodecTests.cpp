@@ -0,0 +1,336 @@
+// Copyright Epic Games, Inc. All Rights Reserved.
+
+#include "FlutterStandardCodec.h"
+#include "Misc/AutomationTest.h"
+#include "HAL/PlatformTime.h"
+#include "Dom/JsonObject.h"
+#include "Serialization/JsonReader.h"
+#include "Serialization/JsonWriter.h"
+#include "Serialization/JsonSerializer.h"
+
+#if WITH_DEV_AUTOMATION_TESTS
+
+namespace FlutterStandardCodecTests
+{
+	/** Cube state in the shape ARotatingCube::GetStateJson() sends */
+	struct FCubeState
+	{
+		double Speed = 45.0;
+		double Rpm = 7.5;
+		FVector Axis = FVector(0.0, 0.0, 1.0);
+		FLinearColor Color = FLinearColor(0.2f, 0.4f, 0.8f, 1.0f);
+		double Rotation = 123.4;
+		bool bIsRotating = true;
+	};
+
+	void WriteVector(FFlutterStandardWriter& Writer, const FVector& Vector)
+	{
+		Writer.BeginMap(3);
+		Writer.WriteString(TEXT("x")); Writer.WriteDouble(Vector.X);
+		Writer.WriteString(TEXT("y")); Writer.WriteDouble(Vector.Y);
+		Writer.WriteString(TEXT("z")); Writer.WriteDouble(Vector.Z);
+	}
+
+	void WriteCubeState(FFlutterStandardWriter& Writer, const FCubeState& State)
+	{
+		Writer.BeginMap(6);
+		Writer.WriteString(TEXT("speed")); Writer.WriteDouble(State.Speed);
+		Writer.WriteString(TEXT("rpm")); Writer.WriteDouble(State.Rpm);
+		Writer.WriteString(TEXT("axis")); WriteVector(Writer, State.Axis);
+		const float Color[] = { State.Color.R, State.Color.G, State.Color.B, State.Color.A };
+		Writer.WriteString(TEXT("color")); Writer.WriteFloat32List(Color);
+		Writer.WriteString(TEXT("rotation")); Writer.WriteDouble(State.Rotation);
+		Writer.WriteString(TEXT("isRotating")); Writer.WriteBool(State.bIsRotating);
+	}
+
+	bool ReadCubeState(FFlutterStandardReader& Reader, FCubeState& OutState)
+	{
+		int32 Count = 0;
+		if (!Reader.ReadMapHeader(Count))
+		{
+			return false;
+		}
+
+		FString Key;
+		for (int32 Index = 0; Index < Count && Reader.ReadString(Key); ++Index)
+		{
+			if (Key == TEXT("speed")) { Reader.ReadDouble(OutState.Speed); }
+			else if (Key == TEXT("rpm")) { Reader.ReadDouble(OutState.Rpm); }
+			else if (Key == TEXT("rotation")) { Reader.ReadDouble(OutState.Rotation); }
+			else if (Key == TEXT("isRotating")) { Reader.ReadBool(OutState.bIsRotating); }
+			else if (Key == TEXT("axis"))
+			{
+				int32 AxisCount = 0;
+				FString AxisKey;
+				Reader.ReadMapHeader(AxisCount);
+				for (int32 Axis = 0; Axis < AxisCount && Reader.ReadString(AxisKey); ++Axis)
+				{
+					Reader.ReadDouble(AxisKey == TEXT("x") ? OutState.Axis.X : AxisKey == TEXT("y") ? OutState.Axis.Y : OutState.Axis.Z);
+				}
+			}
+			else if (Key == TEXT("color"))
+			{
+				TArray<float> Color;
+				if (Reader.ReadFloat32List(Color) && Color.Num() == 4)
+				{
+					OutState.Color = FLinearColor(Color[0], Color[1], Color[2], Color[3]);
+				}
+			}
+			else
+			{
+				Reader.Skip();
+			}
+		}
+
+		return !Reader.HasError();
+	}
+
+	FString CubeStateToPrintfJson(const FCubeState& State)
+	{
+		return FString::Printf(
+			TEXT("{\"speed\":%.1f,\"rpm\":%.2f,\"axis\":{\"x\":%.2f,\"y\":%.2f,\"z\":%.2f},")
+			TEXT("\"color\":{\"r\":%.2f,\"g\":%.2f,\"b\":%.2f,\"a\":%.2f},")
+			TEXT("\"rotation\":%.1f,\"isRotating\":%s}"),
+			State.Speed, State.Rpm,
+			State.Axis.X, State.Axis.Y, State.Axis.Z,
+			State.Color.R, State.Color.G, State.Color.B, State.Color.A,
+			State.Rotation, State.bIsRotating ? TEXT("true") : TEXT("false"));
+	}
+
+	FString CubeStateToJsonObject(const FCubeState& State)
+	{
+		TSharedRef<FJsonObject> Axis = MakeShared<FJsonObject>();
+		Axis->SetNumberField(TEXT("x"), State.Axis.X);
+		Axis->SetNumberField(TEXT("y"), State.Axis.Y);
+		Axis->SetNumberField(TEXT("z"), State.Axis.Z);
+
+		TSharedRef<FJsonObject> Color = MakeShared<FJsonObject>();
+		Color->SetNumberField(TEXT("r"), State.Color.R);
+		Color->SetNumberField(TEXT("g"), State.Color.G);
+		Color->SetNumberField(TEXT("b"), State.Color.B);
+		Color->SetNumberField(TEXT("a"), State.Color.A);
+
+		TSharedRef<FJsonObject> Root = MakeShared<FJsonObject>();
+		Root->SetNumberField(TEXT("speed"), State.Speed);
+		Root->SetNumberField(TEXT("rpm"), State.Rpm);
+		Root->SetObjectField(TEXT("axis"), Axis);
+		Root->SetObjectField(TEXT("color"), Color);
+		Root->SetNumberField(TEXT("rotation"), State.Rotation);
+		Root->SetBoolField(TEXT("isRotating"), State.bIsRotating);
+
+		FString Output;
+		TSharedRef<TJsonWriter<>> JsonWriter = TJsonWriterFactory<>::Create(&Output);
+		FJsonSerializer::Serialize(Root, JsonWriter);
+		return Output;
+	}
+
+	bool CubeStateFromJson(const FString& Json, FCubeState& OutState)
+	{
+		TSharedPtr<FJsonObject> Root;
+		TSharedRef<TJsonReader<>> JsonReader = TJsonReaderFactory<>::Create(Json);
+		if (!FJsonSerializer::Deserialize(JsonReader, Root) || !Root.IsValid())
+		{
+			return false;
+		}
+
+		OutState.Speed = Root->GetNumberField(TEXT("speed"));
+		OutState.Rpm = Root->GetNumberField(TEXT("rpm"));
+		OutState.Rotation = Root->GetNumberField(TEXT("rotation"));
+		OutState.bIsRotating = Root->GetBoolField(TEXT("isRotating"));
+
+		const TSharedPtr<FJsonObject> Axis = Root->GetObjectField(TEXT("axis"));
+		OutState.Axis = FVector(Axis->GetNumberField(TEXT("x")), Axis->GetNumberField(TEXT("y")), Axis->GetNumberField(TEXT("z")));
+
+		const TSharedPtr<FJsonObject> Color = Root->GetObjectField(TEXT("color"));
+		OutState.Color = FLinearColor(
+			(float)Color->GetNumberField(TEXT("r")),
+			(float)Color->GetNumberField(TEXT("g")),
+			(float)Color->GetNumberField(TEXT("b")),
+			(float)Color->GetNumberField(TEXT("a")));
+		return true;
+	}
+}
+
+// ============================================================
+// MARK: - Wire Compatibility
+// ============================================================
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FFlutterStandardCodecWireTest, "FlutterPlugin.StandardCodec.Wire",
+	EAutomationTestFlags::ApplicationContextMask | EAutomationTestFlags::ProductFilter)
+
+bool FFlutterStandardCodecWireTest::RunTest(const FString& Parameters)
+{
+	// Byte sequences produced by Dart's StandardMessageCodec for the same values
+	FFlutterStandardWriter Writer;
+
+	Writer.BeginMap(1);
+	Writer.WriteString(TEXT("a"));
+	Writer.WriteInt(1);
+	TestTrue(TEXT("{'a': 1}"), Writer.GetBuffer() == TArray<uint8>({ 13, 1, 7, 1, 'a', 3, 1, 0, 0, 0 }));
+
+	Writer.Reset();
+	Writer.WriteDouble(1.5);
+	TestTrue(TEXT("1.5 is aligned to 8 bytes"), Writer.GetBuffer() == TArray<uint8>({ 6, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0xF8, 0x3F }));
+
+	Writer.Reset();
+	Writer.WriteInt(1LL << 40);
+	TestEqual(TEXT("Large ints use Int64"), Writer.GetBuffer()[0], (uint8)EFlutterStandardType::Int64);
+
+	Writer.Reset();
+	TArray<uint8> Bytes;
+	Bytes.SetNumZeroed(300);
+	Writer.WriteBytes(Bytes);
+	TestTrue(TEXT("Sizes from 254 use a 16-bit length"), Writer.NumBytes() == 4 + 300 && Writer.GetBuffer()[1] == 254 && Writer.GetBuffer()[2] == 0x2C && Writer.GetBuffer()[3] == 0x01);
+
+	return true;
+}
+
+// ============================================================
+// MARK: - Round Trip
+// ============================================================
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FFlutterStandardCodecRoundTripTest, "FlutterPlugin.StandardCodec.RoundTrip",
+	EAutomationTestFlags::ApplicationContextMask | EAutomationTestFlags::ProductFilter)
+
+bool FFlutterStandardCodecRoundTripTest::RunTest(const FString& Parameters)
+{
+	using namespace FlutterStandardCodecTests;
+
+	FFlutterStandardWriter Writer;
+	Writer.BeginList(8);
+	Writer.WriteNull();
+	Writer.WriteBool(false);
+	Writer.WriteInt(-42);
+	Writer.WriteInt(1LL << 40);
+	Writer.WriteString(TEXT("h\u00e9llo"));
+	const int32 IntValues[] = { 1, 2, 3 };
+	const double DoubleValues[] = { 0.5, -2.25 };
+	Writer.WriteInt32List(IntValues);
+	Writer.WriteFloat64List(DoubleValues);
+	WriteCubeState(Writer, FCubeState());
+
+	FFlutterStandardReader Reader(Writer.GetBuffer());
+	int32 Count = 0;
+	bool bValue = true;
+	int32 SmallInt = 0;
+	int64 LargeInt = 0;
+	FString String;
+	TArray<int32> Ints;
+	TArray<double> Doubles;
+	FCubeState State;
+	State.Speed = 0.0;
+
+	TestTrue(TEXT("List header"), Reader.ReadListHeader(Count) && Count == 8);
+	TestTrue(TEXT("Null"), Reader.ReadNull());
+	TestTrue(TEXT("Bool"), Reader.ReadBool(bValue) && !bValue);
+	TestTrue(TEXT("Int32"), Reader.ReadInt(SmallInt) && SmallInt == -42);
+	TestTrue(TEXT("Int64"), Reader.ReadInt(LargeInt) && LargeInt == (1LL << 40));
+	TestTrue(TEXT("String"), Reader.ReadString(String) && String == TEXT("h\u00e9llo"));
+	TestTrue(TEXT("Int32List"), Reader.ReadInt32List(Ints) && Ints == TArray<int32>({ 1, 2, 3 }));
+	TestTrue(TEXT("Float64List"), Reader.ReadFloat64List(Doubles) && Doubles == TArray<double>({ 0.5, -2.25 }));
+	TestTrue(TEXT("Nested map"), ReadCubeState(Reader, State) && State.Speed == 45.0 && State.bIsRotating);
+	TestTrue(TEXT("Everything consumed"), Reader.IsAtEnd());
+
+	// Skip walks nested values without decoding them
+	FFlutterStandardReader Skipper(Writer.GetBuffer());
+	TestTrue(TEXT("Skip the whole list"), Skipper.Skip() && Skipper.IsAtEnd());
+
+	// Type mismatches and truncation fail instead of reading garbage
+	FFlutterStandardReader Mismatch(Writer.GetBuffer());
+	TestFalse(TEXT("Map header on a list"), Mismatch.ReadMapHeader(Count));
+	TestTrue(TEXT("Error is sticky"), Mismatch.HasError() && !Mismatch.ReadListHeader(Count));
+
+	TArray<uint8> Truncated = Writer.GetBuffer();
+	Truncated.SetNum(Truncated.Num() - 5);
+	FFlutterStandardReader TruncatedReader(Truncated);
+	TestFalse(TEXT("Truncated data"), TruncatedReader.Skip());
+
+	// Nesting is bounded: one list per level, innermost holding a null
+	auto MakeNested = [](int32 Depth)
+	{
+		TArray<uint8> Nested;
+		for (int32 Level = 0; Level < Depth; ++Level)
+		{
+			Nested.Append({ (uint8)EFlutterStandardType::List, 1 });
+		}
+		Nested.Add((uint8)EFlutterStandardType::Null);
+		return Nested;
+	};
+	const TArray<uint8> AtLimit = MakeNested(FFlutterStandardReader::MaxDepth);
+	FFlutterStandardReader Deepest(AtLimit);
+	TestTrue(TEXT("Nesting at the limit"), Deepest.Skip() && Deepest.IsAtEnd());
+	const TArray<uint8> PastLimit = MakeNested(100000);
+	FFlutterStandardReader TooDeep(PastLimit);
+	TestTrue(TEXT("Nesting past the limit"), !TooDeep.Skip() && TooDeep.HasError());
+
+	// A map claiming MAX_int32 entries fails before walking anything
+	const TArray<uint8> HugeMap = { (uint8)EFlutterStandardType::Map, 255, 0xFF, 0xFF, 0xFF, 0x7F, (uint8)EFlutterStandardType::Null };
+	FFlutterStandardReader HugeMapReader(HugeMap);
+	TestFalse(TEXT("Map count beyond the data"), HugeMapReader.Skip());
+
+	return true;
+}
+
+// ============================================================
+// MARK: - Benchmark
+// ============================================================
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FFlutterStandardCodecBenchmark, "FlutterPlugin.StandardCodec.Benchmark.StateSync",
+	EAutomationTestFlags::ApplicationContextMask | EAutomationTestFlags::PerfFilter)
+
+bool FFlutterStandardCodecBenchmark::RunTest(const FString& Parameters)
+{
+	using namespace FlutterStandardCodecTests;
+
+	const int32 Iterations = 100000;
+	const FCubeState Source;
+	FCubeState Decoded;
+
+	// Printf JSON encode (ARotatingCube, AFlutterGameMode) + FJsonSerializer decode
+	int64 PrintfBytes = 0;
+	double StartTime = FPlatformTime::Seconds();
+	for (int32 Iteration = 0; Iteration < Iterations; ++Iteration)
+	{
+		const FString Json = CubeStateToPrintfJson(Source);
+		PrintfBytes = FTCHARToUTF8(*Json).Length();
+		CubeStateFromJson(Json, Decoded);
+	}
+	const double PrintfSeconds = FPlatformTime::Seconds() - StartTime;
+
+	// FJsonObject + TJsonWriter encode (UFlutterBlueprintLibrary::MapToJsonString) + decode
+	int64 JsonObjectBytes = 0;
+	StartTime = FPlatformTime::Seconds();
+	for (int32 Iteration = 0; Iteration < Iterations; ++Iteration)
+	{
+		const FString Json = CubeStateToJsonObject(Source);
+		JsonObjectBytes = FTCHARToUTF8(*Json).Length();
+		CubeStateFromJson(Json, Decoded);
+	}
+	const double JsonObjectSeconds = FPlatformTime::Seconds() - StartTime;
+
+	// Standard codec into a reused buffer + in-place decode
+	FFlutterStandardWriter Writer;
+	int64 StandardBytes = 0;
+	StartTime = FPlatformTime::Seconds();
+	for (int32 Iteration = 0; Iteration < Iterations; ++Iteration)
+	{
+		Writer.Reset();
+		WriteCubeState(Writer, Source);
+		StandardBytes = Writer.NumBytes();
+
+		FFlutterStandardReader Reader(Writer.GetBuffer());
+		ReadCubeState(Reader, Decoded);
+	}
+	const double StandardSeconds = FPlatformTime::Seconds() - StartTime;
+
+	TestEqual(TEXT("Decoded state matches"), Decoded.Rotation, Source.Rotation);
+
+	const double ToNanos = 1.0e9 / Iterations;
+	AddInfo(FString::Printf(TEXT("printf JSON:   %.0f ns/msg, %lld bytes"), PrintfSeconds * ToNanos, PrintfBytes));
+	AddInfo(FString::Printf(TEXT("FJsonObject:   %.0f ns/msg, %lld bytes"), JsonObjectSeconds * ToNanos, JsonObjectBytes));
+	AddInfo(FString::Printf(TEXT("standard codec: %.0f ns/msg, %lld bytes"), StandardSeconds * ToNanos, StandardBytes));
+
+	return true;
+}
+
+#endif // WITH_DEV_AUTOMATION_TESTS
@@ -0,0 +1,173 @@
+// Copyright Epic Games, Inc. All Rights Reserved.
+
+#include "FlutterSurfaceStats.h"
+#include "Misc/AutomationTest.h"
+
+#if WITH_DEV_AUTOMATION_TESTS
+
+namespace FlutterSurfaceStatsTests
+{
+	static constexpr double FrameTime = 1.0 / 60.0;
+
+	/** Feeds frames at a steady rate and keeps the clock */
+	struct FFrameClock
+	{
+		FFlutterSurfaceStats& Stats;
+		double Now;
+
+		FFrameClock(FFlutterSurfaceStats& InStats, double Start)
+			: Stats(InStats)
+			, Now(Start)
+		{
+		}
+
+		void Frame(double Interval = FrameTime)
+		{
+			Now += Interval;
+			Stats.OnFrame(Now);
+		}
+
+		void Frames(int32 Count)
+		{
+			for (int32 Index = 0; Index < Count; ++Index)
+			{
+				Frame();
+			}
+		}
+	};
+}
+
+// ============================================================
+// MARK: - Handoff
+// ============================================================
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FFlutterSurfaceStatsHandoffTest, "FlutterPlugin.SurfaceStats.Handoff",
+	EAutomationTestFlags::ApplicationContextMask | EAutomationTestFlags::ProductFilter)
+
+bool FFlutterSurfaceStatsHandoffTest::RunTest(const FString& Parameters)
+{
+	using namespace FlutterSurfaceStatsTests;
+
+	// A private recorder, the shared one is fed by real frames
+	FFlutterSurfaceStats Recorder;
+	FFrameClock Clock(Recorder, 100.0);
+
+	Recorder.OnSurfaceReady(100.0, 100.004, 1080, 2340);
+	Clock.Now = 100.004;
+	Clock.Frame(0.030);
+
+	FFlutterSurfaceStatistics Stats = Recorder.GetStatistics();
+	TestEqual(TEXT("Surface counted"), Stats.SurfacesCreated, 1);
+	TestEqual(TEXT("Width"), Stats.Width, 1080);
+	TestEqual(TEXT("Height"), Stats.Height, 2340);
+	TestEqual(TEXT("Handoff"), Stats.LastHandoffMs, 4.0, 0.001);
+	TestEqual(TEXT("Time to first frame"), Stats.LastTimeToFirstFrameMs, 30.0, 0.001);
+	TestEqual(TEXT("First frame time"), Stats.LastFirstFrameTime, 100.034, 1e-9);
+
+	Clock.Frames(30);
+	Stats = Recorder.GetStatistics();
+	TestEqual(TEXT("Baseline follows the frame rate"), Stats.BaselineFrameMs, FrameTime * 1000.0, 0.01);
+
+	// Destroyed and recreated: the time to first frame is measured again, the max kept
+	Recorder.OnSurfaceDestroyed(Clock.Now, Clock.Now + 0.002);
+	Stats = Recorder.GetStatistics();
+	TestEqual(TEXT("Destroy counted"), Stats.SurfacesDestroyed, 1);
+	TestEqual(TEXT("Destroy time"), Stats.LastDestroyMs, 2.0, 0.001);
+	TestEqual(TEXT("No size without a surface"), Stats.Width, 0);
+
+	Recorder.OnSurfaceReady(Clock.Now + 1.0, Clock.Now + 1.001, 720, 1280);
+	Clock.Now += 1.001;
+	Clock.Frame(0.010);
+	Stats = Recorder.GetStatistics();
+	TestEqual(TEXT("Second surface counted"), Stats.SurfacesCreated, 2);
+	TestEqual(TEXT("Latest time to first frame"), Stats.LastTimeToFirstFrameMs, 10.0, 0.001);
+	TestEqual(TEXT("Max time to first frame"), Stats.MaxTimeToFirstFrameMs, 30.0, 0.001);
+
+	return true;
+}
+
+// ============================================================
+// MARK: - Resize
+// ============================================================
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FFlutterSurfaceStatsResizeTest, "FlutterPlugin.SurfaceStats.Resize",
+	EAutomationTestFlags::ApplicationContextMask | EAutomationTestFlags::ProductFilter)
+
+bool FFlutterSurfaceStatsResizeTest::RunTest(const FString& Parameters)
+{
+	using namespace FlutterSurfaceStatsTests;
+
+	FFlutterSurfaceStats Recorder;
+	FFrameClock Clock(Recorder, 100.0);
+
+	Recorder.OnSurfaceReady(100.0, 100.0, 1080, 2340);
+	Clock.Frames(60);
+
+	// Rotation: one frame takes six frame times, the next three, then the rate recovers
+	const double ResizeTime = Clock.Now + 0.001;
+	Recorder.OnSurfaceResized(ResizeTime, 2340, 1080);
+	Clock.Frame(6.0 * FrameTime);
+	Clock.Frame(3.0 * FrameTime);
+	const double LastSlowFrame = Clock.Now;
+
+	Clock.Frames(FFlutterSurfaceStats::SettleFrames - 1);
+	TestEqual(TEXT("Still settling"), Recorder.GetStatistics().LastResizeSettledTime, 0.0);
+
+	Clock.Frame();
+	FFlutterSurfaceStatistics Stats = Recorder.GetStatistics();
+	TestEqual(TEXT("Resize counted"), Stats.Resizes, 1);
+	TestEqual(TEXT("New size"), Stats.Width, 2340);
+	TestEqual(TEXT("Dropped frames"), Stats.LastResizeDroppedFrames, 5 + 2);
+	TestEqual(TEXT("Settled at the last slow frame"), Stats.LastResizeSettledTime, LastSlowFrame, 1e-9);
+	TestEqual(TEXT("Settle time"), Stats.LastResizeSettleMs, (LastSlowFrame - ResizeTime) * 1000.0, 0.001);
+	TestEqual(TEXT("Baseline unaffected"), Stats.BaselineFrameMs, FrameTime * 1000.0, 0.01);
+
+	// A resize that rendering absorbs costs nothing
+	Recorder.OnSurfaceResized(Clock.Now, 1080, 2340);
+	Clock.Frames(FFlutterSurfaceStats::SettleFrames);
+	Stats = Recorder.GetStatistics();
+	TestEqual(TEXT("Second resize counted"), Stats.Resizes, 2);
+	TestEqual(TEXT("Nothing dropped"), Stats.LastResizeDroppedFrames, 0);
+	TestEqual(TEXT("Drops accumulate"), Stats.TotalResizeDroppedFrames, (int64)7);
+
+	// Rendering that never recovers is closed by the timeout
+	const double StuckTime = Clock.Now;
+	Recorder.OnSurfaceResized(StuckTime, 2340, 1080);
+	while (Clock.Now - StuckTime < FFlutterSurfaceStats::SettleTimeoutSeconds)
+	{
+		Clock.Frame(2.0 * FrameTime);
+	}
+	Stats = Recorder.GetStatistics();
+	TestTrue(TEXT("Closed by the timeout"), Stats.LastResizeSettledTime >= StuckTime + FFlutterSurfaceStats::SettleTimeoutSeconds);
+	TestTrue(TEXT("Every slow frame dropped one"), Stats.LastResizeDroppedFrames >= 59);
+	TestEqual(TEXT("Max settle time"), Stats.MaxResizeSettleMs, Stats.LastResizeSettleMs);
+
+	return true;
+}
+
+// ============================================================
+// MARK: - JSON
+// ============================================================
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FFlutterSurfaceStatsJsonTest, "FlutterPlugin.SurfaceStats.Json",
+	EAutomationTestFlags::ApplicationContextMask | EAutomationTestFlags::ProductFilter)
+
+bool FFlutterSurfaceStatsJsonTest::RunTest(const FString& Parameters)
+{
+	FFlutterSurfaceStatistics Stats;
+	Stats.SurfacesCreated = 2;
+	Stats.Resizes = 3;
+	Stats.LastResizeDroppedFrames = 7;
+	Stats.TotalResizeDroppedFrames = 9;
+	Stats.LastTimeToFirstFrameMs = 12.5;
+
+	const FString Json = FFlutterSurfaceStats::ToJson(Stats);
+	TestTrue(TEXT("Object"), Json.StartsWith(TEXT("{")) && Json.EndsWith(TEXT("}")));
+	TestTrue(TEXT("Counts"), Json.Contains(TEXT("\"surfacesCreated\":2,\"resizes\":3,")));
+	TestTrue(TEXT("Dropped frames"), Json.Contains(TEXT("\"lastResizeDroppedFrames\":7,\"totalResizeDroppedFrames\":9,")));
+	TestTrue(TEXT("Durations"), Json.Contains(TEXT("\"lastTimeToFirstFrameMs\":12.500,")));
+
+	return true;
+}
+
+#endif // WITH_DEV_AUTOMATION_TESTS
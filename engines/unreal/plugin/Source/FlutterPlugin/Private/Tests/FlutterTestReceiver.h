@@ -0,0 +1,42 @@
+// Copyright Epic Games, Inc. All Rights Reserved.
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "UObject/Object.h"
+#include "FlutterTestReceiver.generated.h"
+
+/**
+ * Message sink used by the FlutterPlugin automation tests
+ *
+ * Dynamic delegates can only bind to UFUNCTIONs, so the tests bind router
+ * handlers to an instance of this class and inspect the counters afterwards.
+ */
+UCLASS(Transient)
+class UFlutterTestReceiver : public UObject
+{
+	GENERATED_BODY()
+
+public:
+	UFUNCTION()
+	void OnMessage(const FString& Method, const FString& Data)
+	{
+		MessagesReceived++;
+		LastMethod = Method;
+		LastData = Data;
+	}
+
+	UFUNCTION()
+	void OnBinaryMessage(const FString& Method, const TArray<uint8>& Data)
+	{
+		BinaryMessagesReceived++;
+		LastMethod = Method;
+		LastBinaryData = Data;
+	}
+
+	int32 MessagesReceived = 0;
+	int32 BinaryMessagesReceived = 0;
+	FString LastMethod;
+	FString LastData;
+	TArray<uint8> LastBinaryData;
+};
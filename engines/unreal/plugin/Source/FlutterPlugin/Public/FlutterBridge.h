@@ -4,8 +4,48 @@
 
 #include "CoreMinimal.h"
 #include "GameFramework/Actor.h"
+#include "FlutterIngressMessage.h"
+#include "FlutterMessageBatch.h"
+#include "FlutterStandardCodec.h"
+#include "FlutterChunkedTransfer.h"
+#include "FlutterCompression.h"
+#include "FlutterSurfaceStats.h"
+#include "FlutterRenderScale.h"
 #include "FlutterBridge.generated.h"
 
+/**
+ * Back-pressure counters for the native -> game thread ingress queue
+ */
+USTRUCT(BlueprintType)
+struct FFlutterIngressStatistics
+{
+	GENERATED_BODY()
+
+	/** Messages accepted from native threads */
+	UPROPERTY(BlueprintReadOnly, Category = "Flutter")
+	int64 Enqueued = 0;
+
+	/** Messages delivered on the game thread */
+	UPROPERTY(BlueprintReadOnly, Category = "Flutter")
+	int64 Delivered = 0;
+
+	/** Messages rejected because the queue was at MaxIngressQueueDepth */
+	UPROPERTY(BlueprintReadOnly, Category = "Flutter")
+	int64 Rejected = 0;
+
+	/** Ticks that ran out of time budget with messages still waiting */
+	UPROPERTY(BlueprintReadOnly, Category = "Flutter")
+	int64 DeferredTicks = 0;
+
+	/** Messages currently waiting */
+	UPROPERTY(BlueprintReadOnly, Category = "Flutter")
+	int32 Depth = 0;
+
+	/** Highest depth observed */
+	UPROPERTY(BlueprintReadOnly, Category = "Flutter")
+	int32 PeakDepth = 0;
+};
+
 /**
  * Flutter Bridge Actor
  *
@@ -41,9 +81,20 @@ public:
 	UFUNCTION(BlueprintCallable, Category = "Flutter")
 	void SendToFlutter(const FString& Target, const FString& Method, const FString& Data);
 
+	/**
+	 * Send a message to Flutter from any thread
+	 * Safe to call from task graph workers and other native threads, e.g. to deliver the
+	 * result of an async save or analytics serializer without going through the game thread.
+	 * On Android the calling thread is attached to the Java VM on first use and detached when
+	 * it exits; other platforms hand the message to the game thread.
+	 * The message is never batched, so messages from different threads may arrive in any order.
+	 */
+	static void SendToFlutterFromAnyThread(const FString& Target, const FString& Method, const FString& Data);
+
 	/**
 	 * Called when a message is received from Flutter
-	 * This is called from native code (JNI/Objective-C++)
+	 * Batches sent by Flutter to "_batch"/"onBatch" are unpacked and delivered one by one.
+	 * Must run on the game thread; native threads use EnqueueFromFlutter() instead.
 	 * @param Target - The target object in Unreal (e.g., "PlayerController")
 	 * @param Method - The method name to call
 	 * @param Data - The data received (JSON string)
@@ -56,12 +107,117 @@ public:
 	UFUNCTION(BlueprintImplementableEvent, Category = "Flutter")
 	void OnMessageFromFlutter(const FString& Target, const FString& Method, const FString& Data);
 
+	// ============================================================
+	// MARK: - Message Batching
+	// ============================================================
+
+	/**
+	 * Collect outgoing messages and send them as one batch frame at the end of the frame
+	 * Cuts per-message platform crossings when gameplay emits many small events.
+	 */
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Flutter|Batching")
+	bool bBatchOutgoingMessages;
+
+	/**
+	 * How long a batch may be held across frames, in milliseconds (0 = send every frame)
+	 */
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Flutter|Batching", meta = (ClampMin = "0.0"))
+	float MaxBatchLatencyMs;
+
+	/**
+	 * Send the batch immediately once it grows past this many bytes
+	 */
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Flutter|Batching", meta = (ClampMin = "256"))
+	int32 MaxBatchBytes;
+
+	/**
+	 * Send any batched messages now
+	 * Unbatched and binary sends call this first, so Flutter sees messages in the order they were sent.
+	 */
+	UFUNCTION(BlueprintCallable, Category = "Flutter|Batching")
+	void FlushOutgoingBatch();
+
+	/**
+	 * Number of messages waiting in the outgoing batch
+	 */
+	UFUNCTION(BlueprintCallable, Category = "Flutter|Batching")
+	int32 GetPendingBatchedMessages() const;
+
+	// ============================================================
+	// MARK: - Ingress Queue
+	// ============================================================
+
+	/**
+	 * Hand a message from any thread to the game thread
+	 * Lock-free and never blocks the caller. Queued messages are delivered from Tick(),
+	 * and are kept across bridge instances so nothing is lost before BeginPlay().
+	 * Chunk data and footers are always accepted so an admitted transfer is never cut short.
+	 * @return False if the queue is full and the message was rejected
+	 */
+	static bool EnqueueFromFlutter(FFlutterIngressMessage&& Message);
+	static bool EnqueueFromFlutter(const FString& Target, const FString& Method, const FString& Data);
+
+	/**
+	 * Get ingress queue back-pressure counters
+	 */
+	UFUNCTION(BlueprintCallable, Category = "Flutter|Ingress")
+	static FFlutterIngressStatistics GetIngressStatistics();
+
+	/**
+	 * Limit the number of waiting messages (0 = unlimited)
+	 * Applies to messages, binary messages and chunk headers.
+	 */
+	UFUNCTION(BlueprintCallable, Category = "Flutter|Ingress")
+	static void SetMaxIngressQueueDepth(int32 MaxDepth);
+
+	/**
+	 * Game thread time spent delivering queued messages per tick, in milliseconds
+	 * At least one message is delivered per tick regardless of the budget.
+	 */
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Flutter|Ingress", meta = (ClampMin = "0.1"))
+	float IngressTimeBudgetMs;
+
 	// ============================================================
 	// MARK: - Binary Message Communication
 	// ============================================================
 
+	/**
+	 * Codec for outgoing binary messages
+	 * GZip is understood by every Flutter client; Zlib and LZ4 need a client with codec envelope support.
+	 */
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Flutter|Binary")
+	EFlutterCompressionCodec BinaryCompressionCodec;
+
+	/**
+	 * Binary messages smaller than this many bytes are sent uncompressed
+	 */
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Flutter|Binary", meta = (ClampMin = "0"))
+	int32 CompressionThreshold;
+
+	/**
+	 * Binary payloads larger than this many bytes (after compression) are sent as a chunked transfer
+	 */
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Flutter|Binary", meta = (ClampMin = "1024"))
+	int32 MaxSingleBinaryMessageSize;
+
+	/**
+	 * Compressed binary messages from Flutter may not decompress to more than this many bytes
+	 * Larger payloads are rejected instead of being inflated on the game thread. Chunked transfers
+	 * announcing a larger size are rejected before their buffer is allocated.
+	 */
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Flutter|Binary", meta = (ClampMin = "1024"))
+	int32 MaxDecompressedBinarySize;
+
+	/**
+	 * Chunk bytes handed to the platform per frame across all outgoing chunked transfers
+	 * At least one chunk is sent per frame regardless of the budget.
+	 */
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Flutter|Binary", meta = (ClampMin = "1024"))
+	int32 OutgoingChunkBytesPerFrame;
+
 	/**
 	 * Send binary data to Flutter
+	 * Payloads above MaxSingleBinaryMessageSize are split into chunks and sent over several frames.
 	 * @param Target - The target object in Flutter
 	 * @param Method - The method name to call
 	 * @param Data - The binary data to send
@@ -69,6 +225,25 @@ public:
 	UFUNCTION(BlueprintCallable, Category = "Flutter|Binary")
 	void SendBinaryToFlutter(const FString& Target, const FString& Method, const TArray<uint8>& Data);
 
+	/**
+	 * Send binary data to Flutter as a chunked transfer, regardless of its size
+	 * @return The transfer ID reported by OnOutgoingTransferProgress
+	 */
+	UFUNCTION(BlueprintCallable, Category = "Flutter|Binary")
+	FString SendChunkedBinaryToFlutter(const FString& Target, const FString& Method, const TArray<uint8>& Data);
+
+	/**
+	 * Get the number of outgoing chunked transfers not fully sent yet
+	 */
+	UFUNCTION(BlueprintCallable, Category = "Flutter|Binary")
+	int32 GetPendingOutgoingTransfers() const;
+
+	/**
+	 * Send a typed payload encoded with FFlutterStandardWriter
+	 * Decode on the Dart side with StandardMessageCodec instead of parsing JSON.
+	 */
+	void SendTypedToFlutter(const FString& Target, const FString& Method, const FFlutterStandardWriter& Payload);
+
 	/**
 	 * Called when binary data is received from Flutter
 	 * @param Target - The target object in Unreal
@@ -141,6 +316,12 @@ public:
 	UFUNCTION(BlueprintImplementableEvent, Category = "Flutter|Binary")
 	void OnBinaryTransferProgress(const FString& TransferId, int32 CurrentChunk, int32 TotalChunks, float Progress);
 
+	/**
+	 * Blueprint event fired once per frame while an outgoing chunked transfer is being sent
+	 */
+	UFUNCTION(BlueprintImplementableEvent, Category = "Flutter|Binary")
+	void OnOutgoingTransferProgress(const FString& TransferId, int32 SentChunks, int32 TotalChunks, float Progress);
+
 	// ============================================================
 	// MARK: - Console Commands
 	// ============================================================
@@ -286,6 +467,40 @@ public:
 	UFUNCTION(BlueprintCallable, Category = "Flutter|Surface")
 	bool IsSurfaceReady() const;
 
+	/**
+	 * Get surface handoff, first frame and resize timings
+	 * Flutter reads the same numbers with engine#getSurfaceStatistics.
+	 */
+	UFUNCTION(BlueprintCallable, Category = "Flutter|Surface")
+	static FFlutterSurfaceStatistics GetSurfaceStatistics();
+
+	// ============================================================
+	// MARK: - Render Scale
+	// ============================================================
+
+	/**
+	 * Render the game view below (or above) the surface resolution and upscale it
+	 * Flutter sets this with engine#setRenderScale. Changes are reported to Flutter as
+	 * FlutterBridge.onRenderScaleChanged.
+	 */
+	UFUNCTION(BlueprintCallable, Category = "Flutter|Surface")
+	void SetRenderScaleSettings(const FFlutterRenderScaleSettings& Settings);
+
+	UFUNCTION(BlueprintCallable, Category = "Flutter|Surface")
+	FFlutterRenderScaleSettings GetRenderScaleSettings() const;
+
+	/**
+	 * Current scale per axis of the rendered view (1 = surface resolution)
+	 */
+	UFUNCTION(BlueprintCallable, Category = "Flutter|Surface")
+	float GetRenderScale() const;
+
+	/**
+	 * Size the scene is rendered at before it is upscaled to the surface
+	 */
+	UFUNCTION(BlueprintCallable, Category = "Flutter|Surface")
+	void GetRenderSize(int32& OutWidth, int32& OutHeight) const;
+
 	/**
 	 * Blueprint events for lifecycle
 	 */
@@ -298,6 +513,41 @@ public:
 	UFUNCTION(BlueprintImplementableEvent, Category = "Flutter|Lifecycle")
 	void OnEngineQuitBP();
 
+	// ============================================================
+	// MARK: - State Mirror
+	// ============================================================
+
+	/**
+	 * Mirror a game state field Flutter reads every frame (score, health, ...)
+	 * On Linux the field goes to shared memory that Flutter reads with
+	 * stateMirror#read, without a message; elsewhere this returns false and the state
+	 * should be sent as a message. Names are at most 47 bytes, a field keeps the type it
+	 * was first set with, and up to 64 fields can be mirrored.
+	 */
+	UFUNCTION(BlueprintCallable, Category = "Flutter|State")
+	bool MirrorStateInt(const FString& Name, int64 Value);
+
+	UFUNCTION(BlueprintCallable, Category = "Flutter|State")
+	bool MirrorStateFloat(const FString& Name, double Value);
+
+	UFUNCTION(BlueprintCallable, Category = "Flutter|State")
+	bool MirrorStateBool(const FString& Name, bool Value);
+
+	/**
+	 * Fields mirrored between Begin and End reach Flutter together; calls nest
+	 */
+	UFUNCTION(BlueprintCallable, Category = "Flutter|State")
+	void BeginStateMirrorUpdate();
+
+	UFUNCTION(BlueprintCallable, Category = "Flutter|State")
+	void EndStateMirrorUpdate();
+
+	/**
+	 * True if mirrored state reaches Flutter
+	 */
+	UFUNCTION(BlueprintCallable, Category = "Flutter|State")
+	bool IsStateMirrorAvailable() const;
+
 	// ============================================================
 	// MARK: - Singleton Access
 	// ============================================================
@@ -327,33 +577,41 @@ private:
 	int32 SurfaceWidth;
 	int32 SurfaceHeight;
 
+	// Render scale, applied as the screen percentage
+	FFlutterRenderScale RenderScale;
+	bool bRenderScaleApplied;
+
 	// Active chunked transfers
-	struct FChunkedTransfer
-	{
-		FString Target;
-		FString Method;
-		int32 TotalSize;
-		int32 TotalChunks;
-		int32 ExpectedChecksum;
-		TMap<int32, TArray<uint8>> Chunks;
-		int32 ReceivedChunks;
-
-		FChunkedTransfer()
-			: TotalSize(0)
-			, TotalChunks(0)
-			, ExpectedChecksum(0)
-			, ReceivedChunks(0)
-		{}
-	};
-
-	TMap<FString, FChunkedTransfer> ActiveTransfers;
+	TMap<FString, FFlutterChunkedTransfer> ActiveTransfers;
+
+	// Outgoing chunked transfers, sent one after another
+	TArray<FFlutterOutgoingTransfer> OutgoingTransfers;
+
+	// Outgoing batch state
+	FFlutterMessageBatchWriter OutgoingBatch;
+	double OutgoingBatchStartTime;
+	FDelegateHandle EndFrameHandle;
+
+	static void SendToFlutterImmediate(const FString& Target, const FString& Method, const FString& Data);
+	void SendBinaryToFlutterImmediate(const FString& Target, const FString& Method, const TArray<uint8>& Data);
+	void HandleEndFrame();
+	void ApplyRenderScale();
+	FString MakeSurfaceSizeJson(int32 Width, int32 Height) const;
+	void ReceiveBatchFromFlutter(const FString& Data);
+	void ReceiveDecodedBinaryFromFlutter(const FString& Target, const FString& Method, const TArray<uint8>& Data);
+
+	// Deliver queued native messages within IngressTimeBudgetMs
+	void DrainIngressQueue();
+	void DispatchIngressMessage(FFlutterIngressMessage& Message);
 
 	// Binary helpers
 	int32 CalculateCRC32(const TArray<uint8>& Data) const;
 	bool VerifyChecksum(const TArray<uint8>& Data, int32 ExpectedChecksum) const;
-	TArray<uint8> CompressData(const TArray<uint8>& Data) const;
-	TArray<uint8> DecompressData(const TArray<uint8>& Data) const;
+	bool CompressData(const TArray<uint8>& Data, TArray<uint8>& OutCompressed) const;
+	bool DecompressData(const TArray<uint8>& Data, TArray<uint8>& OutDecompressed) const;
 	void AssembleChunkedTransfer(const FString& TransferId);
+	FString QueueOutgoingTransfer(const FString& Target, const FString& Method, TArray<uint8>&& Payload);
+	void PumpOutgoingTransfers();
 
 	// Platform-specific bridge initialization
 	void InitializePlatformBridge();
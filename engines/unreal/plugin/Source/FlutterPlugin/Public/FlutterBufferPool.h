@@ -0,0 +1,93 @@
+// Copyright Epic Games, Inc. All Rights Reserved.
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "HAL/CriticalSection.h"
+
+/**
+ * Buffer pool counters
+ */
+struct FFlutterBufferPoolStatistics
+{
+	/** Buffers handed out */
+	int64 Acquired = 0;
+	/** Acquisitions served from an idle buffer instead of a new allocation */
+	int64 Reused = 0;
+	/** Buffers currently handed out, and their capacity */
+	int32 InUse = 0;
+	int64 BytesInUse = 0;
+	/** Buffers kept for reuse, and their capacity */
+	int32 Idle = 0;
+	int64 BytesIdle = 0;
+};
+
+/**
+ * Flutter Buffer Pool
+ *
+ * Reusable native buffers in power-of-two size classes from 4 KB to 16 MB. The Android
+ * bridge wraps them in direct ByteBuffers, so binary payloads cross JNI without landing on
+ * the Java heap; Java hands the buffer back by ID once Flutter has consumed it.
+ *
+ * Buffers are identified by an ID that includes a generation, so a stale or repeated
+ * release is ignored instead of freeing a buffer that was handed out again. Requests
+ * above the largest size class are allocated exactly and freed on release.
+ *
+ * Thread-safe.
+ */
+class FLUTTERPLUGIN_API FFlutterBufferPool
+{
+public:
+	static constexpr int32 MinSizeClassBytes = 4 * 1024;
+	static constexpr int32 MaxSizeClassBytes = 16 * 1024 * 1024;
+	static constexpr int32 NumSizeClasses = 13;
+
+	/** @param InMaxIdlePerClass - Idle buffers kept per size class; the rest are freed on release */
+	explicit FFlutterBufferPool(int32 InMaxIdlePerClass = 4);
+	~FFlutterBufferPool();
+
+	FFlutterBufferPool(const FFlutterBufferPool&) = delete;
+	FFlutterBufferPool& operator=(const FFlutterBufferPool&) = delete;
+
+	/**
+	 * Get a buffer of at least NumBytes
+	 * @return Buffer ID, or INDEX_NONE if NumBytes is negative or the allocation failed
+	 */
+	int32 Acquire(int32 NumBytes, uint8*& OutData, int32& OutCapacity);
+
+	/** Return a buffer; false if the ID is not currently handed out */
+	bool Release(int32 BufferId);
+
+	/** Free every idle buffer */
+	void Trim();
+
+	FFlutterBufferPoolStatistics GetStatistics() const;
+
+	/** Size class serving NumBytes, or INDEX_NONE if it is larger than MaxSizeClassBytes */
+	static int32 GetSizeClass(int32 NumBytes);
+
+private:
+	struct FSlot
+	{
+		uint8* Data = nullptr;
+		int32 Capacity = 0;
+		int32 SizeClass = INDEX_NONE;
+		uint32 Generation = 0;
+		bool bInUse = false;
+	};
+
+	int32 MakeId(int32 SlotIndex) const;
+	int32 FindSlot(int32 BufferId) const;
+	void FreeSlot(int32 SlotIndex);
+
+	mutable FCriticalSection Mutex;
+	int32 MaxIdlePerClass;
+
+	TArray<FSlot> Slots;
+	/** Slot indices without memory */
+	TArray<int32> FreeSlots;
+	/** Slot indices with memory that are not handed out, per size class */
+	TArray<int32> IdleSlots[NumSizeClasses];
+
+	FFlutterBufferPoolStatistics Statistics;
+};
@@ -0,0 +1,51 @@
+// Copyright Epic Games, Inc. All Rights Reserved.
+
+#pragma once
+
+#include "CoreMinimal.h"
+
+/**
+ * Flutter CRC32
+ *
+ * CRC-32 (IEEE 802.3, the zlib/Dart polynomial) used to verify binary transfers.
+ * Uses the ARMv8 CRC32 instructions when the CPU has them and slicing-by-8 tables
+ * otherwise; the implementation is picked once at first use.
+ *
+ * Usage:
+ * ```cpp
+ * const uint32 Checksum = FFlutterCrc32::Calculate(Data);
+ *
+ * FFlutterCrc32 Running;
+ * Running.Update(Chunk0);
+ * Running.Update(Chunk1);
+ * const uint32 Checksum = Running.GetValue();
+ * ```
+ */
+class FLUTTERPLUGIN_API FFlutterCrc32
+{
+public:
+	FFlutterCrc32()
+		: State(0xFFFFFFFFu)
+	{}
+
+	/** Checksum of a whole buffer */
+	static uint32 Calculate(TConstArrayView<uint8> Data);
+
+	/** Feed the next bytes of the stream */
+	void Update(TConstArrayView<uint8> Data);
+	void Update(const uint8* Data, int64 NumBytes);
+
+	/** Checksum of everything fed so far; Update() may still be called afterwards */
+	uint32 GetValue() const { return State ^ 0xFFFFFFFFu; }
+
+	void Reset() { State = 0xFFFFFFFFu; }
+
+	/** True when the hardware CRC32 instructions are in use */
+	static bool IsHardwareAccelerated();
+
+	/** Portable slicing-by-8 path, exposed for tests and benchmarks */
+	static uint32 UpdateSoftware(uint32 State, const uint8* Data, int64 NumBytes);
+
+private:
+	uint32 State;
+};
@@ -0,0 +1,132 @@
+// Copyright Epic Games, Inc. All Rights Reserved.
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Containers/BitArray.h"
+#include "FlutterChecksum.h"
+#include "FlutterCompression.h"
+
+/**
+ * Flutter Chunked Transfer
+ *
+ * Reassembles a chunked binary transfer in place. The destination buffer is allocated
+ * once from the TotalSize announced in the header and every chunk is copied straight to
+ * ChunkIndex * ChunkSize, so the completed payload needs no extra assembly pass.
+ *
+ * The sender uses a fixed chunk size with a shorter last chunk; the size is learned from
+ * the first chunk that arrives and every later chunk is checked against it.
+ *
+ * A compressed payload (GZip or codec envelope) is decompressed chunk by chunk as soon as
+ * chunks are contiguous, and replaces the compressed buffer once the transfer completes.
+ * Decompression fails if the payload would grow beyond MaxDecompressedSize, and a header
+ * announcing more than MaxDecompressedSize bytes is rejected before the buffer is allocated.
+ *
+ * FFlutterOutgoingTransfer is the sending side: it owns the payload and hands out views of
+ * consecutive chunks, so a large send can be spread over several frames without copies.
+ */
+class FLUTTERPLUGIN_API FFlutterChunkedTransfer
+{
+public:
+	enum class EChunkResult : uint8
+	{
+		Accepted,
+		/** Chunk was already received; the data is ignored */
+		Duplicate,
+		/** Index out of range or size inconsistent with the transfer */
+		Rejected
+	};
+
+	FFlutterChunkedTransfer(const FString& InTarget, const FString& InMethod, int32 InTotalSize, int32 InTotalChunks, int32 InExpectedChecksum,
+		int64 InMaxDecompressedSize = FFlutterCompression::DefaultMaxDecompressedSize);
+
+	/** False if the header values cannot describe a transfer; nothing is allocated then */
+	bool IsValid() const { return bIsValid; }
+
+	/** Copy a chunk into place */
+	EChunkResult AddChunk(int32 ChunkIndex, TConstArrayView<uint8> Data);
+
+	bool IsComplete() const { return bIsValid && ReceivedChunks == TotalChunks; }
+
+	/** Indices of chunks not received yet */
+	TArray<int32> GetMissingChunks() const;
+
+	/** Compare the transferred bytes against the header checksum; only meaningful once complete */
+	bool VerifyChecksum() const;
+
+	/** Reassembled payload, decompressed if it was sent compressed; only fully written once IsComplete() */
+	const TArray<uint8>& GetData() const { return Buffer; }
+
+	/** Codec the payload was sent with, None if raw */
+	EFlutterCompressionCodec GetCodec() const { return Codec; }
+
+	/** True if the payload was compressed but could not be decompressed; GetData() then holds the compressed bytes */
+	bool HasDecompressionError() const { return bDecompressionError; }
+
+	const FString& GetTarget() const { return Target; }
+	const FString& GetMethod() const { return Method; }
+	int32 GetTotalSize() const { return TotalSize; }
+	int32 GetTotalChunks() const { return TotalChunks; }
+	int32 GetReceivedChunks() const { return ReceivedChunks; }
+
+private:
+	int32 ExpectedChunkSize(int32 ChunkIndex) const;
+	void ConsumeContiguousChunks();
+
+	FString Target;
+	FString Method;
+	int32 TotalSize;
+	int32 TotalChunks;
+	int32 ExpectedChecksum;
+	bool bIsValid;
+
+	/** Size of every chunk but the last; 0 until the first chunk arrives */
+	int32 ChunkSize;
+	int32 ReceivedChunks;
+
+	TArray<uint8> Buffer;
+	TBitArray<> Received;
+
+	/** CRC of chunks [0, NextChecksumChunk), advanced as contiguous chunks arrive */
+	FFlutterCrc32 RunningChecksum;
+	int32 NextChecksumChunk;
+
+	EFlutterCompressionCodec Codec;
+	int64 MaxDecompressedSize;
+	TUniquePtr<FFlutterStreamingDecompressor> Decompressor;
+	bool bDecompressionError;
+};
+
+/**
+ * Splits an outgoing payload into fixed-size chunks, with a shorter last chunk
+ * The checksum covers the bytes as sent, which is what the receiver verifies after reassembly.
+ */
+class FLUTTERPLUGIN_API FFlutterOutgoingTransfer
+{
+public:
+	FFlutterOutgoingTransfer(const FString& InTransferId, const FString& InTarget, const FString& InMethod, TArray<uint8>&& InData, int32 InChunkSize);
+
+	/** View of the next chunk to send; advances the transfer. Only valid while !IsComplete() */
+	TConstArrayView<uint8> NextChunk(int32& OutChunkIndex);
+
+	bool IsComplete() const { return SentChunks == TotalChunks; }
+
+	const FString& GetTransferId() const { return TransferId; }
+	const FString& GetTarget() const { return Target; }
+	const FString& GetMethod() const { return Method; }
+	int32 GetTotalSize() const { return Data.Num(); }
+	int32 GetTotalChunks() const { return TotalChunks; }
+	int32 GetSentChunks() const { return SentChunks; }
+	int32 GetSentBytes() const { return (int32)FMath::Min<int64>((int64)SentChunks * ChunkSize, Data.Num()); }
+	int32 GetChecksum() const { return Checksum; }
+
+private:
+	FString TransferId;
+	FString Target;
+	FString Method;
+	TArray<uint8> Data;
+	int32 ChunkSize;
+	int32 TotalChunks;
+	int32 SentChunks;
+	int32 Checksum;
+};
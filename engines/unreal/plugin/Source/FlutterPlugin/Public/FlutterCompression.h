@@ -0,0 +1,128 @@
+// Copyright Epic Games, Inc. All Rights Reserved.
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Templates/UniquePtr.h"
+#include "FlutterCompression.generated.h"
+
+/**
+ * Compression codecs for binary messages
+ */
+UENUM(BlueprintType)
+enum class EFlutterCompressionCodec : uint8
+{
+	/** Send payloads raw */
+	None,
+	/** GZip stream; self-identifying and decoded by every Flutter client */
+	Gzip,
+	/** zlib stream inside a codec envelope */
+	Zlib,
+	/** LZ4 block inside a codec envelope; fastest, lower ratio */
+	LZ4
+};
+
+/**
+ * Flutter Compression
+ *
+ * Compresses binary message payloads. GZip payloads are sent as a plain GZip stream so
+ * existing clients keep working; the other codecs are wrapped in an 8-byte envelope:
+ *
+ *   "FC" magic, uint8 codec, uint8 reserved, uint32 uncompressed size (little-endian)
+ *
+ * Usage:
+ * ```cpp
+ * TArray<uint8> Compressed;
+ * if (FFlutterCompression::Compress(EFlutterCompressionCodec::LZ4, Data, Compressed)) { ... }
+ *
+ * TArray<uint8> Decompressed;
+ * if (FFlutterCompression::Detect(Payload) != EFlutterCompressionCodec::None)
+ * {
+ *     FFlutterCompression::Decompress(Payload, Decompressed);
+ * }
+ * ```
+ */
+struct FLUTTERPLUGIN_API FFlutterCompression
+{
+	/** Payloads smaller than this are sent raw; matches the Dart and Unity protocols */
+	static constexpr int32 DefaultThreshold = 1024;
+
+	static constexpr int32 EnvelopeHeaderSize = 8;
+
+	/** Decompressed payloads may not grow beyond this unless the caller sets its own limit */
+	static constexpr int64 DefaultMaxDecompressedSize = 256 * 1024 * 1024;
+
+	/**
+	 * Compress a payload with the given codec
+	 * @return False if the codec is None, compression failed, or the result is not smaller than the input
+	 */
+	static bool Compress(EFlutterCompressionCodec Codec, TConstArrayView<uint8> Data, TArray<uint8>& OutCompressed);
+
+	/** Codec of a payload from its leading bytes; None for raw data */
+	static EFlutterCompressionCodec Detect(TConstArrayView<uint8> Data);
+
+	/**
+	 * Decompress a payload produced by Compress()
+	 * @return False if it is raw, malformed, or would decompress to more than MaxDecompressedSize bytes
+	 */
+	static bool Decompress(TConstArrayView<uint8> Data, TArray<uint8>& OutDecompressed, int64 MaxDecompressedSize = DefaultMaxDecompressedSize);
+};
+
+/**
+ * Decompresses a payload that arrives in pieces, e.g. the chunks of a chunked transfer,
+ * so the compressed data never has to be reassembled first.
+ *
+ * GZip and zlib are inflated as each piece arrives. LZ4 blocks cannot be decoded before
+ * the block is complete, so LZ4 input is collected and decoded in Finish().
+ *
+ * The payload comes from Flutter and is not trusted: output never grows beyond the size
+ * recorded in the codec envelope or MaxOutputSize, and a stream that needs more fails.
+ */
+class FLUTTERPLUGIN_API FFlutterStreamingDecompressor
+{
+public:
+	/** Codec must be the result of FFlutterCompression::Detect() on the first piece */
+	explicit FFlutterStreamingDecompressor(EFlutterCompressionCodec InCodec, int64 InMaxOutputSize = FFlutterCompression::DefaultMaxDecompressedSize);
+	~FFlutterStreamingDecompressor();
+
+	/** Feed the next piece, in order; returns false once the stream is malformed */
+	bool Update(TConstArrayView<uint8> Input);
+
+	/** Finish the stream; returns true if it ended cleanly with everything decoded */
+	bool Finish();
+
+	/** Decompressed payload; complete once Finish() returned true */
+	const TArray<uint8>& GetOutput() const { return Output; }
+	TArray<uint8> TakeOutput() { return MoveTemp(Output); }
+
+	/** Preallocate the output when the decompressed size is known up front */
+	void ReserveOutput(int64 NumBytes);
+
+	bool HasError() const { return bError; }
+
+private:
+	bool ConsumeEnvelope(TConstArrayView<uint8>& Input);
+	bool Inflate(TConstArrayView<uint8> Input);
+
+	struct FZStream;
+
+	EFlutterCompressionCodec Codec;
+	TUniquePtr<FZStream> Stream;
+
+	/** Output limit; lowered to the envelope's uncompressed size once that is known */
+	int64 MaxOutputSize;
+
+	/** Envelope bytes seen so far; the header may straddle pieces */
+	uint8 Envelope[FFlutterCompression::EnvelopeHeaderSize];
+	int32 EnvelopeBytes;
+	uint32 UncompressedSize;
+
+	/** LZ4 input collected until Finish() */
+	TArray<uint8> Pending;
+
+	/** Output is grown ahead of inflate; only the first Produced bytes are valid until Finish() */
+	TArray<uint8> Output;
+	int64 Produced;
+	bool bFinished;
+	bool bError;
+};
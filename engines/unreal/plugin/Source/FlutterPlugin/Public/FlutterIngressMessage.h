@@ -0,0 +1,32 @@
+// Copyright Epic Games, Inc. All Rights Reserved.
+
+#pragma once
+
+#include "CoreMinimal.h"
+
+/**
+ * Message handed from a native bridge thread to the game thread
+ * See AFlutterBridge::EnqueueFromFlutter().
+ */
+struct FFlutterIngressMessage
+{
+	enum class EKind : uint8
+	{
+		Message,
+		Binary,
+		ChunkHeader,
+		ChunkData,
+		ChunkFooter
+	};
+
+	EKind Kind = EKind::Message;
+	FString Target;
+	FString Method;
+	FString Data;
+	FString TransferId;
+	TArray<uint8> BinaryData;
+	int32 ChunkIndex = 0;
+	int32 TotalChunks = 0;
+	int32 TotalSize = 0;
+	int32 Checksum = 0;
+};
@@ -0,0 +1,77 @@
+// Copyright Epic Games, Inc. All Rights Reserved.
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Templates/Function.h"
+
+/**
+ * Flutter Message Batch
+ *
+ * Length-prefixed frame carrying many Target/Method/Data messages in one platform
+ * crossing. Sent as a binary message to Target "_batch", Method "onBatch".
+ *
+ * Layout (little-endian):
+ *   "FB" magic, uint8 version, uint8 reserved, uint32 message count
+ *   per message: uint32 length + UTF-8 bytes, for Target, Method and Data in turn
+ *
+ * Usage:
+ * ```cpp
+ * FFlutterMessageBatchWriter Writer;
+ * Writer.Add("GameManager", "onScore", "{\"score\":10}");
+ * SendBinaryToFlutter(FFlutterMessageBatch::Target, FFlutterMessageBatch::Method, Writer.GetFrame());
+ *
+ * FFlutterMessageBatch::Decode(Frame, [](FString&& Target, FString&& Method, FString&& Data) { ... });
+ * ```
+ */
+struct FLUTTERPLUGIN_API FFlutterMessageBatch
+{
+	static const TCHAR* Target;
+	static const TCHAR* Method;
+
+	static constexpr uint8 Version = 1;
+	static constexpr int32 HeaderSize = 8;
+
+	/** Check the frame header without decoding the messages */
+	static bool IsBatchFrame(const TArray<uint8>& Frame);
+
+	/**
+	 * Decode every message in a frame, in order
+	 * The visitor receives Target, Method and Data and may move from them.
+	 * @return False if the frame is malformed; messages before the error have already been visited
+	 */
+	static bool Decode(const TArray<uint8>& Frame, TFunctionRef<void(FString&&, FString&&, FString&&)> Visitor);
+};
+
+/**
+ * Accumulates messages into a batch frame without intermediate allocations
+ */
+class FLUTTERPLUGIN_API FFlutterMessageBatchWriter
+{
+public:
+	FFlutterMessageBatchWriter();
+
+	/** Append one message to the frame */
+	void Add(const FString& Target, const FString& Method, const FString& Data);
+
+	/** Drop all messages, keeping the buffer capacity */
+	void Reset();
+
+	/** Number of messages in the frame */
+	int32 Num() const { return Count; }
+
+	/** Size of the frame in bytes, header included */
+	int32 NumBytes() const { return Buffer.Num(); }
+
+	bool IsEmpty() const { return Count == 0; }
+
+	/** Frame ready to send; valid until the next Add() or Reset() */
+	const TArray<uint8>& GetFrame() const { return Buffer; }
+
+private:
+	void AppendString(const FString& String);
+	void AppendUInt32(uint32 Value);
+
+	TArray<uint8> Buffer;
+	int32 Count;
+};
@@ -4,6 +4,7 @@
 
 #include "CoreMinimal.h"
 #include "UObject/NoExportTypes.h"
+#include "FlutterStandardCodec.h"
 #include "FlutterMessageRouter.generated.h"
 
 // Forward declarations
@@ -19,6 +20,12 @@ DECLARE_DYNAMIC_DELEGATE_TwoParams(FFlutterMethodDelegate, const FString&, Metho
  */
 DECLARE_DYNAMIC_DELEGATE_TwoParams(FFlutterBinaryMethodDelegate, const FString&, Method, const TArray<uint8>&, Data);
 
+/**
+ * Native delegate for typed payloads in StandardMessageCodec format
+ * The reader is positioned at the start of the payload and is only valid during the call.
+ */
+DECLARE_DELEGATE_TwoParams(FFlutterTypedMethodDelegate, const FString& /* Method */, FFlutterStandardReader& /* Payload */);
+
 /**
  * Registration info for a Flutter target
  */
@@ -69,6 +76,10 @@ struct FFlutterRouterStatistics
 	UPROPERTY(BlueprintReadOnly, Category = "Flutter")
 	int32 QueuedMessages;
 
+	/** Queued message count per target that has not registered yet */
+	UPROPERTY(BlueprintReadOnly, Category = "Flutter")
+	TMap<FString, int32> QueuedMessagesPerTarget;
+
 	FFlutterRouterStatistics()
 		: MessagesRouted(0)
 		, MessagesDropped(0)
@@ -78,8 +89,90 @@ struct FFlutterRouterStatistics
 	{}
 };
 
+/**
+ * Pre-resolved route to a Target:Method handler
+ *
+ * Resolve once with UFlutterMessageRouter::ResolveRoute() and reuse the handle for
+ * every message sent to the same handler. Both names are interned, so routing a
+ * message through a handle is an integer hash lookup with no string formatting.
+ */
+USTRUCT(BlueprintType)
+struct FLUTTERPLUGIN_API FFlutterRouteHandle
+{
+	GENERATED_BODY()
+
+	UPROPERTY(BlueprintReadOnly, Category = "Flutter")
+	FName Target;
+
+	UPROPERTY(BlueprintReadOnly, Category = "Flutter")
+	FName Method;
+
+	FFlutterRouteHandle()
+		: Target(NAME_None)
+		, Method(NAME_None)
+	{}
+
+	FFlutterRouteHandle(FName InTarget, FName InMethod)
+		: Target(InTarget)
+		, Method(InMethod)
+	{}
+
+	bool IsValid() const
+	{
+		return !Target.IsNone() && !Method.IsNone();
+	}
+
+	bool operator==(const FFlutterRouteHandle& Other) const
+	{
+		return Target == Other.Target && Method == Other.Method;
+	}
+
+	friend uint32 GetTypeHash(const FFlutterRouteHandle& Handle)
+	{
+		return HashCombine(GetTypeHash(Handle.Target), GetTypeHash(Handle.Method));
+	}
+};
+
+/**
+ * Cached handler for a single route.
+ * The method name is kept as a string so dispatch can hand it to the delegate as-is.
+ */
+template <typename DelegateType>
+struct TFlutterMethodRoute
+{
+	FString MethodName;
+	DelegateType Delegate;
+};
+
+/**
+ * Registration state and method handlers of a single target
+ * Methods may be registered before the target itself, so an entry can exist
+ * with bIsRegistered still false.
+ */
+struct FFlutterTargetRoutes
+{
+	UObject* Object = nullptr;
+	bool bIsRegistered = false;
+	bool bIsSingleton = false;
+
+	TMap<FName, TFlutterMethodRoute<FFlutterMethodDelegate>> Methods;
+	TMap<FName, TFlutterMethodRoute<FFlutterBinaryMethodDelegate>> BinaryMethods;
+	TMap<FName, TFlutterMethodRoute<FFlutterTypedMethodDelegate>> TypedMethods;
+
+	int32 NumDelegates() const
+	{
+		return Methods.Num() + BinaryMethods.Num() + TypedMethods.Num();
+	}
+
+	bool IsEmpty() const
+	{
+		return !bIsRegistered && NumDelegates() == 0;
+	}
+};
+
 /**
  * Queued message for pre-ready delivery
+ * Move-only: payloads are moved into the queue and out again on delivery.
  */
 struct FQueuedFlutterMessage
 {
@@ -92,6 +185,11 @@ struct FQueuedFlutterMessage
 	FQueuedFlutterMessage()
 		: bIsBinary(false)
 	{}
+
+	FQueuedFlutterMessage(FQueuedFlutterMessage&&) = default;
+	FQueuedFlutterMessage& operator=(FQueuedFlutterMessage&&) = default;
+	FQueuedFlutterMessage(const FQueuedFlutterMessage&) = delete;
+	FQueuedFlutterMessage& operator=(const FQueuedFlutterMessage&) = delete;
 };
 
 /**
@@ -111,6 +209,10 @@ struct FQueuedFlutterMessage
  * FFlutterMethodDelegate Delegate;
  * Delegate.BindDynamic(this, &AMyActor::OnPlayerAction);
  * Router->RegisterMethod("GameManager", "onPlayerAction", Delegate);
+ *
+ * // Hot paths: resolve the route once, then route by handle
+ * FFlutterRouteHandle Route = Router->ResolveRoute("GameManager", "onPlayerAction");
+ * Router->RouteMessageWithHandle(Route, Data);
  * ```
  */
 UCLASS(BlueprintType)
@@ -182,6 +284,13 @@ public:
 	UFUNCTION(BlueprintCallable, Category = "Flutter|Router")
 	void RegisterBinaryMethod(const FString& TargetName, const FString& MethodName, FFlutterBinaryMethodDelegate Delegate);
 
+	/**
+	 * Register a native handler for typed binary payloads
+	 * Used for binary messages to this method when no RegisterBinaryMethod() handler is bound;
+	 * the payload is decoded in place with FFlutterStandardReader instead of going through JSON.
+	 */
+	void RegisterTypedMethod(const FString& TargetName, const FString& MethodName, FFlutterTypedMethodDelegate Delegate);
+
 	/**
 	 * Unregister a method handler
 	 */
@@ -208,22 +317,53 @@ public:
 	UFUNCTION(BlueprintCallable, Category = "Flutter|Router")
 	bool RouteBinaryMessage(const FString& Target, const FString& Method, const TArray<uint8>& Data);
 
+	/**
+	 * Resolve a Target:Method pair into a reusable route handle
+	 * The handle stays valid across handler re-registration; it does not keep the handler alive.
+	 */
+	UFUNCTION(BlueprintCallable, Category = "Flutter|Router")
+	FFlutterRouteHandle ResolveRoute(const FString& Target, const FString& Method) const;
+
+	/**
+	 * Route a message through a pre-resolved handle
+	 * @param Handle - Handle returned by ResolveRoute()
+	 * @param Data - The message data (JSON string)
+	 * @return True if the message was routed successfully
+	 */
+	UFUNCTION(BlueprintCallable, Category = "Flutter|Router")
+	bool RouteMessageWithHandle(const FFlutterRouteHandle& Handle, const FString& Data);
+
+	/**
+	 * Route a binary message through a pre-resolved handle
+	 */
+	UFUNCTION(BlueprintCallable, Category = "Flutter|Router")
+	bool RouteBinaryMessageWithHandle(const FFlutterRouteHandle& Handle, const TArray<uint8>& Data);
+
 	// ============================================================
 	// MARK: - Message Queuing
 	// ============================================================
 
 	/**
 	 * Queue a message for later delivery (e.g., before targets are registered)
+	 * The queue holds at most MaxQueueSize messages; when full the oldest is dropped.
 	 */
 	UFUNCTION(BlueprintCallable, Category = "Flutter|Router")
 	void QueueMessage(const FString& Target, const FString& Method, const FString& Data);
 
 	/**
-	 * Flush all queued messages to their targets
+	 * Flush queued messages to every target that is registered now
+	 * Messages for targets that are still unknown stay queued.
 	 */
 	UFUNCTION(BlueprintCallable, Category = "Flutter|Router")
 	void FlushQueue();
 
+	/**
+	 * Deliver the queued messages of one target, in arrival order
+	 * Called automatically by RegisterTarget().
+	 */
+	UFUNCTION(BlueprintCallable, Category = "Flutter|Router")
+	void FlushQueueForTarget(const FString& Target);
+
 	/**
 	 * Clear all queued messages without delivering them
 	 */
@@ -266,16 +406,21 @@ private:
 	// Singleton instance
 	static UFlutterMessageRouter* Instance;
 
-	// Registered targets
-	TMap<FString, UObject*> Targets;
-	TMap<FString, bool> SingletonFlags;
+	// Target -> method index; every operation touches only the methods of one target
+	TMap<FName, FFlutterTargetRoutes> Routes;
 
-	// Cached delegates for fast lookup
-	TMap<FString, FFlutterMethodDelegate> CachedDelegates;
-	TMap<FString, FFlutterBinaryMethodDelegate> CachedBinaryDelegates;
+	// Running totals so statistics never have to walk the index
+	int32 NumRegisteredTargets;
+	int32 NumCachedDelegates;
 
-	// Message queue for pre-ready messages
+	// Ring buffer of pre-ready messages; slots are allocated once at MaxQueueSize
 	TArray<FQueuedFlutterMessage> MessageQueue;
+	int32 QueueHead;
+	int32 QueueCount;
+
+	// Number of queued messages per target, so a flush can skip targets with nothing pending.
+	// Keyed by string: queued targets are not registered yet and need not exist as names.
+	TMap<FString, int32> QueuedPerTarget;
 
 	// Configuration
 	bool bQueueUnknownTargets;
@@ -284,12 +429,21 @@ private:
 	// Statistics
 	mutable FFlutterRouterStatistics Statistics;
 
-	// Helper to generate cache key
-	FString GetCacheKey(const FString& Target, const FString& Method) const;
+	// Look up a route without adding unknown names to the name table
+	FFlutterRouteHandle FindRoute(const FString& Target, const FString& Method) const;
+
+	// Queue helpers
+	void EnqueueMessage(FQueuedFlutterMessage&& Message);
+	void ReleaseQueuedSlot(const FString& Target);
+
+	// Registration helpers
+	bool IsTargetRegistered(FName Target) const;
+	void RemoveTargetIfEmpty(FName Target);
+	void UpdateRegistrationStatistics();
 
 	// Try to route via cached delegate
-	bool TryRouteCached(const FString& CacheKey, const FString& Method, const FString& Data);
-	bool TryRouteBinaryCached(const FString& CacheKey, const FString& Method, const TArray<uint8>& Data);
+	bool TryRouteCached(const FFlutterRouteHandle& Handle, const FString& Data);
+	bool TryRouteBinaryCached(const FFlutterRouteHandle& Handle, const TArray<uint8>& Data);
 };
 
 /**
@@ -0,0 +1,115 @@
+// Copyright Epic Games, Inc. All Rights Reserved.
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include <atomic>
+#include "FlutterRenderScale.generated.h"
+
+/**
+ * How the game view resolution relates to the surface
+ */
+UENUM(BlueprintType)
+enum class EFlutterRenderScaleMode : uint8
+{
+	/** Render at the surface resolution */
+	Native,
+	/** Render at a fixed fraction of the surface resolution */
+	Fixed,
+	/** Adjust the fraction between MinScale and MaxScale to hold the target frame rate */
+	Dynamic
+};
+
+/**
+ * Render scale configuration, as sent by Flutter
+ */
+USTRUCT(BlueprintType)
+struct FFlutterRenderScaleSettings
+{
+	GENERATED_BODY()
+
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Flutter")
+	EFlutterRenderScaleMode Mode = EFlutterRenderScaleMode::Native;
+
+	/** Scale per axis in Fixed mode, and the starting scale in Dynamic mode */
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Flutter", meta = (ClampMin = "0.25", ClampMax = "2.0"))
+	float Scale = 1.0f;
+
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Flutter", meta = (ClampMin = "0.25", ClampMax = "2.0"))
+	float MinScale = 0.5f;
+
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Flutter", meta = (ClampMin = "0.25", ClampMax = "2.0"))
+	float MaxScale = 1.0f;
+
+	/** Frame rate Dynamic mode tries to hold */
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Flutter", meta = (ClampMin = "1.0"))
+	float TargetFrameRate = 60.0f;
+};
+
+/**
+ * Flutter Render Scale
+ *
+ * Decides the resolution the game view renders at relative to the platform surface. The
+ * bridge applies the scale as the engine's screen percentage, so the scene renders into
+ * a smaller target and is upscaled to the surface, which keeps its full size.
+ *
+ * Dynamic mode averages frame times over EvaluationSeconds:
+ * - Over budget, the scale drops in proportion to the square root of the overshoot
+ *   (render cost follows pixel count), by at most MaxStepDown.
+ * - At or under budget for RaiseAfterWindows windows in a row, it rises by one step.
+ *   With vsync the frame time cannot show headroom, so raising is a probe that the
+ *   next window undoes if it was too far.
+ * Scales are multiples of ScaleStep so small frame time changes do not reallocate render
+ * targets.
+ *
+ * Update() runs on the game thread; GetScale() may be read from any thread.
+ */
+class FLUTTERPLUGIN_API FFlutterRenderScale
+{
+public:
+	static constexpr float ScaleStep = 0.05f;
+	static constexpr float MinAllowedScale = 0.25f;
+	static constexpr float MaxAllowedScale = 2.0f;
+	static constexpr float MaxStepDown = 0.2f;
+	static constexpr double EvaluationSeconds = 0.5;
+	static constexpr int32 RaiseAfterWindows = 4;
+
+	/** Frames slower than this over the target are over budget */
+	static constexpr double OverBudgetFactor = 1.1;
+
+	/** Frames longer than this (loading, backgrounding) are not rendering cost */
+	static constexpr double MaxFrameSeconds = 0.25;
+
+	/**
+	 * Replace the configuration; out of range values are clamped
+	 * @return True if the scale changed
+	 */
+	bool Configure(const FFlutterRenderScaleSettings& InSettings);
+
+	/**
+	 * Account for a frame; only Dynamic mode reacts
+	 * @return True if the scale changed
+	 */
+	bool Update(double FrameSeconds);
+
+	float GetScale() const { return Scale.load(std::memory_order_relaxed); }
+
+	const FFlutterRenderScaleSettings& GetSettings() const { return Settings; }
+
+	/** Render target size for a surface at a scale; at least 1x1 for a non-empty surface */
+	static void GetRenderSize(int32 SurfaceWidth, int32 SurfaceHeight, float Scale, int32& OutWidth, int32& OutHeight);
+
+	/** Round to a multiple of ScaleStep within the allowed range */
+	static float Quantize(float Value);
+
+private:
+	bool SetScale(float NewScale);
+	void ResetWindow();
+
+	FFlutterRenderScaleSettings Settings;
+	std::atomic<float> Scale{ 1.0f };
+
+	double WindowSeconds = 0.0;
+	int32 WindowFrames = 0;
+	int32 WindowsOnBudget = 0;
+};
@@ -0,0 +1,152 @@
+// Copyright Epic Games, Inc. All Rights Reserved.
+
+#pragma once
+
+#include "CoreMinimal.h"
+
+/**
+ * Value type tags of Flutter's StandardMessageCodec
+ */
+enum class EFlutterStandardType : uint8
+{
+	Null = 0,
+	True = 1,
+	False = 2,
+	Int32 = 3,
+	Int64 = 4,
+	LargeInt = 5,
+	Float64 = 6,
+	String = 7,
+	Uint8List = 8,
+	Int32List = 9,
+	Int64List = 10,
+	Float64List = 11,
+	List = 12,
+	Map = 13,
+	Float32List = 14,
+
+	/** Not a codec type: returned by PeekType() at the end of the data or after an error */
+	Invalid = 0xFF
+};
+
+/**
+ * Flutter Standard Writer
+ *
+ * Encodes values in the StandardMessageCodec wire format, so payloads can be decoded
+ * on the Dart side with `const StandardMessageCodec().decodeMessage(bytes)`.
+ * Values are written straight into an owned buffer that is reused across messages.
+ *
+ * Usage:
+ * ```cpp
+ * FFlutterStandardWriter Writer;
+ * Writer.BeginMap(2);
+ * Writer.WriteString(TEXT("yaw"));   Writer.WriteDouble(Rotation.Yaw);
+ * Writer.WriteString(TEXT("speed")); Writer.WriteDouble(Speed);
+ * Bridge->SendTypedToFlutter(TEXT("Cube"), TEXT("onState"), Writer);
+ * Writer.Reset();
+ * ```
+ */
+class FLUTTERPLUGIN_API FFlutterStandardWriter
+{
+public:
+	FFlutterStandardWriter() = default;
+
+	void WriteNull();
+	void WriteBool(bool bValue);
+
+	/** Writes an Int32 when the value fits, Int64 otherwise */
+	void WriteInt(int64 Value);
+	void WriteDouble(double Value);
+	void WriteString(const FString& Value);
+
+	void WriteBytes(TConstArrayView<uint8> Values);
+	void WriteInt32List(TConstArrayView<int32> Values);
+	void WriteInt64List(TConstArrayView<int64> Values);
+	void WriteFloat32List(TConstArrayView<float> Values);
+	void WriteFloat64List(TConstArrayView<double> Values);
+
+	/** Start a list; follow with exactly Count values */
+	void BeginList(int32 Count);
+
+	/** Start a map; follow with exactly Count key/value pairs */
+	void BeginMap(int32 Count);
+
+	/** Drop the encoded data, keeping the buffer capacity */
+	void Reset() { Buffer.Reset(); }
+
+	/** Encoded bytes; valid until the next write or Reset() */
+	const TArray<uint8>& GetBuffer() const { return Buffer; }
+
+	int32 NumBytes() const { return Buffer.Num(); }
+
+private:
+	void WriteType(EFlutterStandardType Type);
+	void WriteSize(int32 Size);
+	void WriteAlignment(int32 Alignment);
+	void WriteRaw(const void* Data, int32 NumBytes);
+
+	TArray<uint8> Buffer;
+};
+
+/**
+ * Flutter Standard Reader
+ *
+ * Decodes StandardMessageCodec data in place without building an intermediate tree.
+ * Every Read function returns false on a type mismatch or truncated data; after the
+ * first failure the reader stays in an error state.
+ */
+class FLUTTERPLUGIN_API FFlutterStandardReader
+{
+public:
+	/** Deepest nesting of lists and maps Skip() walks before failing */
+	static constexpr int32 MaxDepth = 64;
+
+	explicit FFlutterStandardReader(TConstArrayView<uint8> InData);
+
+	/** Type of the next value without consuming it */
+	EFlutterStandardType PeekType() const;
+
+	bool ReadNull();
+	bool ReadBool(bool& bOutValue);
+
+	/** Accepts Int32 and Int64 values */
+	bool ReadInt(int64& OutValue);
+	bool ReadInt(int32& OutValue);
+
+	/** Accepts Float64 values, and integers for convenience */
+	bool ReadDouble(double& OutValue);
+	bool ReadString(FString& OutValue);
+
+	bool ReadBytes(TArray<uint8>& OutValues);
+	bool ReadInt32List(TArray<int32>& OutValues);
+	bool ReadInt64List(TArray<int64>& OutValues);
+	bool ReadFloat32List(TArray<float>& OutValues);
+	bool ReadFloat64List(TArray<double>& OutValues);
+
+	/** Read a list header; the next OutCount values are its elements */
+	bool ReadListHeader(int32& OutCount);
+
+	/** Read a map header; the next OutCount key/value pairs are its entries */
+	bool ReadMapHeader(int32& OutCount);
+
+	/** Skip the next value, including nested lists and maps up to MaxDepth levels */
+	bool Skip();
+
+	bool IsAtEnd() const { return Position >= Data.Num(); }
+	bool HasError() const { return bError; }
+
+private:
+	bool SkipValue(int32 Depth);
+	bool ReadType(EFlutterStandardType Expected);
+	bool ReadSize(int32& OutSize);
+	bool ReadAlignment(int32 Alignment);
+	bool ReadRaw(void* OutData, int32 NumBytes);
+	bool Fail();
+
+	template <typename ElementType>
+	bool ReadTypedList(EFlutterStandardType Type, int32 Alignment, TArray<ElementType>& OutValues);
+
+	TConstArrayView<uint8> Data;
+	int32 Position;
+	bool bError;
+};
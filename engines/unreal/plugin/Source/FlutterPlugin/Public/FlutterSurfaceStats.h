@@ -0,0 +1,174 @@
+// Copyright Epic Games, Inc. All Rights Reserved.
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "HAL/CriticalSection.h"
+#include "FlutterSurfaceStats.generated.h"
+
+/**
+ * Timings of the platform surface lifecycle
+ * Times are FPlatformTime::Seconds(); compare them with CaptureTime. Zero means the
+ * transition has not happened yet.
+ */
+USTRUCT(BlueprintType)
+struct FFlutterSurfaceStatistics
+{
+	GENERATED_BODY()
+
+	/** Surfaces handed to the engine */
+	UPROPERTY(BlueprintReadOnly, Category = "Flutter")
+	int32 SurfacesCreated = 0;
+
+	/** Size changes of the current or earlier surfaces */
+	UPROPERTY(BlueprintReadOnly, Category = "Flutter")
+	int32 Resizes = 0;
+
+	UPROPERTY(BlueprintReadOnly, Category = "Flutter")
+	int32 SurfacesDestroyed = 0;
+
+	/** Current surface size, zero without a surface */
+	UPROPERTY(BlueprintReadOnly, Category = "Flutter")
+	int32 Width = 0;
+
+	UPROPERTY(BlueprintReadOnly, Category = "Flutter")
+	int32 Height = 0;
+
+	/** Surface received from the platform to hardware window set */
+	UPROPERTY(BlueprintReadOnly, Category = "Flutter")
+	double LastHandoffMs = 0.0;
+
+	/** Surface ready to the end of the first frame after it */
+	UPROPERTY(BlueprintReadOnly, Category = "Flutter")
+	double LastTimeToFirstFrameMs = 0.0;
+
+	UPROPERTY(BlueprintReadOnly, Category = "Flutter")
+	double MaxTimeToFirstFrameMs = 0.0;
+
+	/** Size change to the last slow frame before the frame rate recovered */
+	UPROPERTY(BlueprintReadOnly, Category = "Flutter")
+	double LastResizeSettleMs = 0.0;
+
+	UPROPERTY(BlueprintReadOnly, Category = "Flutter")
+	double MaxResizeSettleMs = 0.0;
+
+	/** Frames missed while the last resize settled, measured against BaselineFrameMs */
+	UPROPERTY(BlueprintReadOnly, Category = "Flutter")
+	int32 LastResizeDroppedFrames = 0;
+
+	UPROPERTY(BlueprintReadOnly, Category = "Flutter")
+	int64 TotalResizeDroppedFrames = 0;
+
+	/** Time taken to release the hardware window when the surface went away */
+	UPROPERTY(BlueprintReadOnly, Category = "Flutter")
+	double LastDestroyMs = 0.0;
+
+	/** Typical frame time outside surface transitions */
+	UPROPERTY(BlueprintReadOnly, Category = "Flutter")
+	double BaselineFrameMs = 0.0;
+
+	UPROPERTY(BlueprintReadOnly, Category = "Flutter")
+	double LastCreatedTime = 0.0;
+
+	UPROPERTY(BlueprintReadOnly, Category = "Flutter")
+	double LastReadyTime = 0.0;
+
+	UPROPERTY(BlueprintReadOnly, Category = "Flutter")
+	double LastFirstFrameTime = 0.0;
+
+	UPROPERTY(BlueprintReadOnly, Category = "Flutter")
+	double LastResizeTime = 0.0;
+
+	UPROPERTY(BlueprintReadOnly, Category = "Flutter")
+	double LastResizeSettledTime = 0.0;
+
+	UPROPERTY(BlueprintReadOnly, Category = "Flutter")
+	double LastDestroyedTime = 0.0;
+
+	/** When these statistics were read */
+	UPROPERTY(BlueprintReadOnly, Category = "Flutter")
+	double CaptureTime = 0.0;
+};
+
+/**
+ * Flutter Surface Stats
+ *
+ * Records the surface handoff from the platform view and how rendering recovers from it.
+ * The platform bridge reports transitions as they happen on its thread; the bridge actor
+ * reports the end of every frame from the game thread.
+ *
+ * - Time to first frame runs from the hardware window being set to the end of the next
+ *   frame.
+ * - A resize stays open until SettleFrames frames in a row run at the baseline frame
+ *   time, or SettleTimeoutSeconds pass. Every frame in between that took N baseline
+ *   frames counts N - 1 dropped frames.
+ * - The baseline is a moving average of frame times outside transitions.
+ *
+ * Usage:
+ * ```cpp
+ * const FFlutterSurfaceStatistics Stats = FFlutterSurfaceStats::Get().GetStatistics();
+ * UE_LOG(LogTemp, Log, TEXT("Resize dropped %d frames"), Stats.LastResizeDroppedFrames);
+ * ```
+ */
+class FLUTTERPLUGIN_API FFlutterSurfaceStats
+{
+public:
+	/** Consecutive frames at the baseline frame time that end a resize */
+	static constexpr int32 SettleFrames = 3;
+
+	/** A frame is at the baseline if it takes at most this multiple of it */
+	static constexpr double SlowFrameFactor = 1.5;
+
+	/** A resize that has not settled by then is closed anyway */
+	static constexpr double SettleTimeoutSeconds = 2.0;
+
+	static FFlutterSurfaceStats& Get();
+
+	/**
+	 * Hardware window set for a new surface
+	 * @param HandoffStartTime - When the platform delivered the surface
+	 */
+	void OnSurfaceReady(double HandoffStartTime, double Now, int32 Width, int32 Height);
+
+	void OnSurfaceResized(double Now, int32 Width, int32 Height);
+
+	/**
+	 * Hardware window released
+	 * @param StartTime - When the platform took the surface away
+	 */
+	void OnSurfaceDestroyed(double StartTime, double Now);
+
+	/** End of a game frame */
+	void OnFrame(double Now);
+
+	FFlutterSurfaceStatistics GetStatistics() const;
+
+	/** Forget everything, e.g. between tests */
+	void Reset();
+
+	/** JSON object with camelCase keys, as returned to Flutter by engine#getSurfaceStatistics */
+	static FString ToJson(const FFlutterSurfaceStatistics& Stats);
+
+private:
+	enum class EPhase : uint8
+	{
+		Idle,
+		AwaitingFirstFrame,
+		Resizing
+	};
+
+	void FinishResize(double SettledTime);
+
+	mutable FCriticalSection Mutex;
+	FFlutterSurfaceStatistics Stats;
+	EPhase Phase = EPhase::Idle;
+
+	double LastFrameTime = 0.0;
+	double BaselineFrameSeconds = 0.0;
+
+	// Open resize
+	int32 ResizeDroppedFrames = 0;
+	int32 ResizeNormalFrames = 0;
+	double ResizeLastSlowFrameTime = 0.0;
+	double ResizeFirstFrameTime = 0.0;
+};
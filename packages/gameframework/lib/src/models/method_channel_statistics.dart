@@ -0,0 +1,80 @@
+/// Call statistics for a plugin's method channel (Linux)
+///
+/// Durations are how long each call kept the platform thread busy; calls the
+/// plugin answers later, such as engine round trips, count only until they
+/// are handed off.
+class MethodChannelStatistics {
+  const MethodChannelStatistics({
+    this.unknownCalls = 0,
+    this.methods = const {},
+  });
+
+  /// Calls to methods the plugin does not implement
+  final int unknownCalls;
+
+  /// Statistics by method name, for methods called at least once
+  final Map<String, MethodCallStatistics> methods;
+
+  /// Create from platform map
+  factory MethodChannelStatistics.fromMap(Map<String, dynamic> map) {
+    final methods = (map['methods'] as Map?) ?? const {};
+    return MethodChannelStatistics(
+      unknownCalls: (map['unknownCalls'] as num?)?.toInt() ?? 0,
+      methods: {
+        for (final entry in methods.entries)
+          entry.key as String: MethodCallStatistics.fromMap(
+            Map<String, dynamic>.from(entry.value as Map),
+          ),
+      },
+    );
+  }
+
+  @override
+  String toString() {
+    return 'MethodChannelStatistics('
+        'unknownCalls: $unknownCalls, '
+        'methods: $methods'
+        ')';
+  }
+}
+
+/// Call statistics for one method
+class MethodCallStatistics {
+  const MethodCallStatistics({
+    this.calls = 0,
+    this.totalMicroseconds = 0,
+    this.maxMicroseconds = 0,
+    this.latencyBuckets = const [],
+  });
+
+  final int calls;
+  final double totalMicroseconds;
+  final double maxMicroseconds;
+
+  /// Call counts by duration: bucket 0 counts calls under 1 us, bucket i calls
+  /// from 2^(i-1) up to 2^i us, and the last bucket everything slower
+  final List<int> latencyBuckets;
+
+  double get averageMicroseconds => calls == 0 ? 0 : totalMicroseconds / calls;
+
+  /// Create from platform map
+  factory MethodCallStatistics.fromMap(Map<String, dynamic> map) {
+    return MethodCallStatistics(
+      calls: (map['calls'] as num?)?.toInt() ?? 0,
+      totalMicroseconds: (map['totalUs'] as num?)?.toDouble() ?? 0,
+      maxMicroseconds: (map['maxUs'] as num?)?.toDouble() ?? 0,
+      latencyBuckets: ((map['latencyBuckets'] as List?) ?? const [])
+          .map((count) => (count as num).toInt())
+          .toList(),
+    );
+  }
+
+  @override
+  String toString() {
+    return 'MethodCallStatistics('
+        'calls: $calls, '
+        'average: ${averageMicroseconds.toStringAsFixed(1)}us, '
+        'max: ${maxMicroseconds.toStringAsFixed(1)}us'
+        ')';
+  }
+}
@@ -1,6 +1,8 @@
 import 'package:flutter/foundation.dart';
 import 'package:flutter/services.dart';
 
+import '../models/method_channel_statistics.dart';
+
 /// Platform information utility for the game framework
 ///
 /// Provides information about the current platform and environment.
@@ -49,6 +51,23 @@ class PlatformInfo {
     }
   }
 
+  /// Get call statistics for a plugin's method channel (Linux)
+  ///
+  /// [channel] is the plugin's channel name, e.g. 'gameframework_unreal'.
+  /// Returns null where the plugin does not collect statistics.
+  static Future<MethodChannelStatistics?> getMethodStatistics({
+    String channel = 'gameframework',
+  }) async {
+    try {
+      final result = await MethodChannel(channel)
+          .invokeMapMethod<String, dynamic>('diagnostics#getMethodStatistics');
+      return result == null ? null : MethodChannelStatistics.fromMap(result);
+    } catch (e) {
+      debugPrint('Failed to get method statistics: $e');
+      return null;
+    }
+  }
+
   /// Get platform-specific information
   static PlatformDetails get platform => PlatformDetails._();
 }
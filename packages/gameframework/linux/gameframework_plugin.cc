@@ -4,9 +4,8 @@
 #include <gtk/gtk.h>
 #include <sys/utsname.h>
 
-#include <cstring>
-
 #include "gameframework_plugin_private.h"
+#include "include/gameframework/method_dispatcher.h"
 
 #define GAMEFRAMEWORK_PLUGIN(obj) \
   (G_TYPE_CHECK_INSTANCE_CAST((obj), gameframework_plugin_get_type(), \
@@ -22,17 +21,14 @@ G_DEFINE_TYPE(GameframeworkPlugin, gameframework_plugin, g_object_get_type())
 static void gameframework_plugin_handle_method_call(
     GameframeworkPlugin* self,
     FlMethodCall* method_call) {
-  g_autoptr(FlMethodResponse) response = nullptr;
-
-  const gchar* method = fl_method_call_get_name(method_call);
-
-  if (strcmp(method, "getPlatformVersion") == 0) {
-    response = get_platform_version();
-  } else {
-    response = FL_METHOD_RESPONSE(fl_method_not_implemented_response_new());
-  }
-
-  fl_method_call_respond(method_call, response, nullptr);
+  static gameframework::MethodDispatcher<GameframeworkPlugin> dispatcher({
+      {"getPlatformVersion",
+       [](GameframeworkPlugin*, FlMethodCall*) {
+         return get_platform_version();
+       }},
+  });
+
+  dispatcher.Dispatch(self, method_call);
 }
 
 FlMethodResponse* get_platform_version() {
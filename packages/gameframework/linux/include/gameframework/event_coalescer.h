@@ -0,0 +1,85 @@
+#ifndef FLUTTER_PLUGIN_GAMEFRAMEWORK_EVENT_COALESCER_H_
+#define FLUTTER_PLUGIN_GAMEFRAMEWORK_EVENT_COALESCER_H_
+
+#include <cstddef>
+#include <cstdint>
+#include <string>
+#include <unordered_map>
+#include <utility>
+#include <vector>
+
+namespace gameframework {
+
+// Events waiting for the next flush to Flutter, shared by the Linux plugins;
+// see event_stream.h for the FlEventChannel side.
+//
+// An event added with a key replaces the pending event with the same key, so
+// a kind of event the engine sends every tick (progress, state sync) reaches
+// Flutter at most once per flush, with its latest value. The replacement
+// keeps the first event's place in the order. Events without a key are all
+// kept. Not thread safe; the plugins use it on the main loop.
+template <typename Value>
+class EventCoalescer {
+ public:
+  struct Statistics {
+    uint64_t added = 0;
+    uint64_t coalesced = 0;  // replaced by a later event with the same key
+    uint64_t dropped = 0;    // over the pending limit
+    uint64_t flushes = 0;
+    uint64_t delivered = 0;
+  };
+
+  // |max_pending| bounds the events kept while nothing flushes, e.g. before
+  // Flutter listens; later events without a pending key are dropped.
+  explicit EventCoalescer(size_t max_pending) : max_pending_(max_pending) {}
+
+  // Returns true if the event is the first one pending, so the caller knows
+  // to schedule a flush. An empty |key| never coalesces.
+  bool Add(const std::string& key, Value value) {
+    statistics_.added++;
+    if (!key.empty()) {
+      auto it = keyed_.find(key);
+      if (it != keyed_.end()) {
+        pending_[it->second] = std::move(value);
+        statistics_.coalesced++;
+        return false;
+      }
+    }
+    if (pending_.size() >= max_pending_) {
+      statistics_.dropped++;
+      return false;
+    }
+
+    if (!key.empty()) {
+      keyed_.emplace(key, pending_.size());
+    }
+    pending_.push_back(std::move(value));
+    return pending_.size() == 1;
+  }
+
+  // The pending events in order, leaving none pending.
+  std::vector<Value> Take() {
+    std::vector<Value> events;
+    events.swap(pending_);
+    keyed_.clear();
+    if (!events.empty()) {
+      statistics_.flushes++;
+      statistics_.delivered += events.size();
+    }
+    return events;
+  }
+
+  bool empty() const { return pending_.empty(); }
+  size_t size() const { return pending_.size(); }
+  const Statistics& statistics() const { return statistics_; }
+
+ private:
+  const size_t max_pending_;
+  std::vector<Value> pending_;
+  std::unordered_map<std::string, size_t> keyed_;  // key to index in pending_
+  Statistics statistics_;
+};
+
+}  // namespace gameframework
+
+#endif  // FLUTTER_PLUGIN_GAMEFRAMEWORK_EVENT_COALESCER_H_
@@ -0,0 +1,176 @@
+#ifndef FLUTTER_PLUGIN_GAMEFRAMEWORK_EVENT_STREAM_H_
+#define FLUTTER_PLUGIN_GAMEFRAMEWORK_EVENT_STREAM_H_
+
+#include <flutter_linux/flutter_linux.h>
+
+#include <memory>
+#include <string>
+#include <unordered_set>
+#include <vector>
+
+#include "event_coalescer.h"
+
+namespace gameframework {
+
+// Engine to Flutter events on an FlEventChannel.
+//
+// Each event is a map {"event": name, "data": value}, the format the engine
+// controllers' event streams already use on the other platforms. Events are
+// flushed at most once per frame: a flush with one event sends its map, one
+// with more sends them all as a single list. An event after a quiet frame
+// goes out on the next main loop iteration; the rest wait for the frame.
+//
+// Flutter picks the events to coalesce when it listens, with arguments
+// {"coalesce": [key, ...]}; the plugin gives each event its key (see Send).
+// Events sent before Flutter listens are kept, up to kMaxPendingEvents, and
+// flushed once it does.
+class EventStream {
+ public:
+  static constexpr guint kFlushIntervalMs = 16;
+  static constexpr size_t kMaxPendingEvents = 1024;
+
+  EventStream(FlBinaryMessenger* messenger, const char* name)
+      : coalescer_(kMaxPendingEvents) {
+    g_autoptr(FlStandardMethodCodec) codec = fl_standard_method_codec_new();
+    channel_ = fl_event_channel_new(messenger, name, FL_METHOD_CODEC(codec));
+    fl_event_channel_set_stream_handlers(channel_, ListenCb, CancelCb, this,
+                                         nullptr);
+  }
+
+  ~EventStream() {
+    if (flush_source_ != 0) {
+      g_source_remove(flush_source_);
+    }
+    fl_event_channel_set_stream_handlers(channel_, nullptr, nullptr, nullptr,
+                                         nullptr);
+    g_object_unref(channel_);
+  }
+
+  EventStream(const EventStream&) = delete;
+  EventStream& operator=(const EventStream&) = delete;
+
+  // Queues |event| with |data|, taking ownership of |data| (may be nullptr).
+  // If Flutter asked to coalesce |key|, it replaces a pending event with the
+  // same key.
+  void Send(const char* event, FlValue* data, const std::string& key) {
+    FlValue* value = fl_value_new_map();
+    fl_value_set_string_take(value, "event", fl_value_new_string(event));
+    fl_value_set_string_take(value, "data",
+                             data != nullptr ? data : fl_value_new_null());
+
+    const bool coalesce =
+        !key.empty() && coalesced_keys_.find(key) != coalesced_keys_.end();
+    if (coalescer_.Add(coalesce ? key : std::string(),
+                       Event(value, fl_value_unref))) {
+      ScheduleFlush();
+    }
+  }
+
+  // {"listening", "eventsAdded", "eventsCoalesced", "eventsDropped",
+  // "eventBatches", "eventsDelivered"}
+  FlValue* GetStatistics() const {
+    const EventCoalescer<Event>::Statistics& statistics =
+        coalescer_.statistics();
+    FlValue* result = fl_value_new_map();
+    fl_value_set_string_take(result, "listening",
+                             fl_value_new_bool(listening_));
+    fl_value_set_string_take(result, "eventsAdded",
+                             fl_value_new_int(statistics.added));
+    fl_value_set_string_take(result, "eventsCoalesced",
+                             fl_value_new_int(statistics.coalesced));
+    fl_value_set_string_take(result, "eventsDropped",
+                             fl_value_new_int(statistics.dropped));
+    fl_value_set_string_take(result, "eventBatches",
+                             fl_value_new_int(statistics.flushes));
+    fl_value_set_string_take(result, "eventsDelivered",
+                             fl_value_new_int(statistics.delivered));
+    return result;
+  }
+
+ private:
+  using Event = std::shared_ptr<FlValue>;
+
+  static FlMethodErrorResponse* ListenCb(FlEventChannel* channel,
+                                         FlValue* args, gpointer user_data) {
+    EventStream* self = static_cast<EventStream*>(user_data);
+    self->coalesced_keys_.clear();
+    FlValue* keys = nullptr;
+    if (args != nullptr && fl_value_get_type(args) == FL_VALUE_TYPE_MAP) {
+      keys = fl_value_lookup_string(args, "coalesce");
+    }
+    if (keys != nullptr && fl_value_get_type(keys) == FL_VALUE_TYPE_LIST) {
+      for (size_t i = 0; i < fl_value_get_length(keys); ++i) {
+        FlValue* key = fl_value_get_list_value(keys, i);
+        if (fl_value_get_type(key) == FL_VALUE_TYPE_STRING) {
+          self->coalesced_keys_.insert(fl_value_get_string(key));
+        }
+      }
+    }
+
+    self->listening_ = true;
+    self->ScheduleFlush();
+    return nullptr;
+  }
+
+  static FlMethodErrorResponse* CancelCb(FlEventChannel* channel,
+                                         FlValue* args, gpointer user_data) {
+    static_cast<EventStream*>(user_data)->listening_ = false;
+    return nullptr;
+  }
+
+  static gboolean FlushCb(gpointer user_data) {
+    EventStream* self = static_cast<EventStream*>(user_data);
+    self->flush_source_ = 0;
+    self->Flush();
+    return G_SOURCE_REMOVE;
+  }
+
+  void ScheduleFlush() {
+    if (!listening_ || flush_source_ != 0 || coalescer_.empty()) {
+      return;
+    }
+    const gint64 elapsed_ms =
+        (g_get_monotonic_time() - last_flush_us_) / 1000;
+    const guint delay_ms =
+        elapsed_ms >= static_cast<gint64>(kFlushIntervalMs)
+            ? 0
+            : kFlushIntervalMs - static_cast<guint>(elapsed_ms);
+    flush_source_ = g_timeout_add(delay_ms, FlushCb, this);
+  }
+
+  void Flush() {
+    if (!listening_) {
+      return;
+    }
+    std::vector<Event> events = coalescer_.Take();
+    if (events.empty()) {
+      return;
+    }
+    last_flush_us_ = g_get_monotonic_time();
+
+    g_autoptr(FlValue) value = nullptr;
+    if (events.size() == 1) {
+      value = fl_value_ref(events[0].get());
+    } else {
+      value = fl_value_new_list();
+      for (const Event& event : events) {
+        fl_value_append(value, event.get());
+      }
+    }
+    g_autoptr(GError) error = nullptr;
+    if (!fl_event_channel_send(channel_, value, nullptr, &error)) {
+      g_warning("Failed to send events: %s", error->message);
+    }
+  }
+
+  FlEventChannel* channel_ = nullptr;
+  EventCoalescer<Event> coalescer_;
+  std::unordered_set<std::string> coalesced_keys_;
+  bool listening_ = false;
+  guint flush_source_ = 0;
+  gint64 last_flush_us_ = 0;
+};
+
+}  // namespace gameframework
+
+#endif  // FLUTTER_PLUGIN_GAMEFRAMEWORK_EVENT_STREAM_H_
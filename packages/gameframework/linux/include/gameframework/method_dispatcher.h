@@ -0,0 +1,124 @@
+#ifndef FLUTTER_PLUGIN_GAMEFRAMEWORK_METHOD_DISPATCHER_H_
+#define FLUTTER_PLUGIN_GAMEFRAMEWORK_METHOD_DISPATCHER_H_
+
+#include <flutter_linux/flutter_linux.h>
+
+#include <chrono>
+#include <cstdint>
+#include <initializer_list>
+#include <vector>
+
+#include "method_table.h"
+
+namespace gameframework {
+
+// Method name for the dispatcher's own statistics, answered on every channel
+// that uses a MethodDispatcher.
+constexpr char kMethodStatisticsMethod[] = "diagnostics#getMethodStatistics";
+
+// Routes FlMethodCalls to handlers through a MethodTable and records how long
+// each call keeps the main loop busy.
+//
+// A handler returns the response, or nullptr if it responds to the call
+// itself later (e.g. once the engine answers). For those, the recorded time
+// covers only the handler, not the wait.
+template <typename Plugin>
+class MethodDispatcher {
+ public:
+  using Handler = FlMethodResponse* (*)(Plugin* plugin,
+                                        FlMethodCall* method_call);
+
+  struct Method {
+    const char* name;
+    Handler handler;
+  };
+
+  explicit MethodDispatcher(std::initializer_list<Method> methods)
+      : table_(Names(methods)), statistics_(table_.size()) {
+    for (const Method& method : methods) {
+      handlers_.push_back(method.handler);
+    }
+  }
+
+  void Dispatch(Plugin* plugin, FlMethodCall* method_call) {
+    const auto start = std::chrono::steady_clock::now();
+    const int index = table_.Find(fl_method_call_get_name(method_call));
+
+    g_autoptr(FlMethodResponse) response = nullptr;
+    if (index == MethodTable::kNotFound) {
+      statistics_.RecordUnknown();
+      response = FL_METHOD_RESPONSE(fl_method_not_implemented_response_new());
+    } else if (index == statistics_index()) {
+      g_autoptr(FlValue) result = GetStatistics();
+      response = FL_METHOD_RESPONSE(fl_method_success_response_new(result));
+    } else {
+      response = handlers_[index](plugin, method_call);
+    }
+
+    if (response != nullptr) {
+      fl_method_call_respond(method_call, response, nullptr);
+    }
+
+    if (index != MethodTable::kNotFound) {
+      statistics_.Record(
+          index, std::chrono::duration_cast<std::chrono::nanoseconds>(
+                     std::chrono::steady_clock::now() - start)
+                     .count());
+    }
+  }
+
+  // {"unknownCalls": n, "methods": {name: {"calls", "totalUs", "maxUs",
+  // "latencyBuckets"}}} for the methods called so far
+  FlValue* GetStatistics() const {
+    FlValue* methods = fl_value_new_map();
+    for (size_t i = 0; i < table_.size(); ++i) {
+      const MethodStatistics::Counters& counters =
+          statistics_.counters(static_cast<int>(i));
+      if (counters.calls == 0) {
+        continue;
+      }
+
+      FlValue* buckets = fl_value_new_list();
+      for (uint64_t count : counters.latency_buckets) {
+        fl_value_append_take(buckets, fl_value_new_int(count));
+      }
+
+      FlValue* method = fl_value_new_map();
+      fl_value_set_string_take(method, "calls",
+                               fl_value_new_int(counters.calls));
+      fl_value_set_string_take(method, "totalUs",
+                               fl_value_new_float(counters.total_ns / 1e3));
+      fl_value_set_string_take(method, "maxUs",
+                               fl_value_new_float(counters.max_ns / 1e3));
+      fl_value_set_string_take(method, "latencyBuckets", buckets);
+      fl_value_set_string_take(methods, table_.name(static_cast<int>(i)),
+                               method);
+    }
+
+    FlValue* result = fl_value_new_map();
+    fl_value_set_string_take(result, "unknownCalls",
+                             fl_value_new_int(statistics_.unknown_calls()));
+    fl_value_set_string_take(result, "methods", methods);
+    return result;
+  }
+
+ private:
+  static std::vector<const char*> Names(std::initializer_list<Method> methods) {
+    std::vector<const char*> names;
+    for (const Method& method : methods) {
+      names.push_back(method.name);
+    }
+    names.push_back(kMethodStatisticsMethod);
+    return names;
+  }
+
+  int statistics_index() const { return static_cast<int>(handlers_.size()); }
+
+  MethodTable table_;
+  MethodStatistics statistics_;
+  std::vector<Handler> handlers_;
+};
+
+}  // namespace gameframework
+
+#endif  // FLUTTER_PLUGIN_GAMEFRAMEWORK_METHOD_DISPATCHER_H_
@@ -0,0 +1,160 @@
+#ifndef FLUTTER_PLUGIN_GAMEFRAMEWORK_METHOD_TABLE_H_
+#define FLUTTER_PLUGIN_GAMEFRAMEWORK_METHOD_TABLE_H_
+
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <utility>
+#include <vector>
+
+namespace gameframework {
+
+// Method name lookup shared by the Linux plugins.
+//
+// The names are fixed when the table is built, so the table looks for a hash
+// seed under which no two names share a slot. A lookup is then one hash of
+// the name, one slot and one comparison, however many methods there are and
+// wherever a method sits in the list.
+//
+// Header only, so the engine plugins can use it without linking against this
+// plugin; see method_dispatcher.h for the FlMethodChannel side.
+class MethodTable {
+ public:
+  static constexpr int kNotFound = -1;
+
+  // Indices follow |names|, which must outlive the table (string literals in
+  // practice). A repeated name keeps its first index.
+  explicit MethodTable(const std::vector<const char*>& names) : names_(names) {
+    std::vector<int> unique;
+    for (size_t i = 0; i < names_.size(); ++i) {
+      bool repeated = false;
+      for (int earlier : unique) {
+        repeated = repeated || strcmp(names_[earlier], names_[i]) == 0;
+      }
+      if (!repeated) {
+        unique.push_back(static_cast<int>(i));
+      }
+    }
+
+    size_t size = 4;
+    while (size < unique.size() * 2) {
+      size *= 2;
+    }
+    // Load stays at or under a half, so a seed turns up within a few tries;
+    // growing the table is only a fallback
+    for (;; size *= 2) {
+      for (uint32_t seed = 1; seed <= 1024; ++seed) {
+        if (Build(unique, size, seed)) {
+          return;
+        }
+      }
+    }
+  }
+
+  // Index of |name| in the names the table was built from, or kNotFound.
+  int Find(const char* name) const {
+    size_t length = 0;
+    const uint32_t hash = Hash(name, seed_, &length);
+    const Slot& slot = slots_[hash & mask_];
+    if (slot.index == kNotFound || slot.hash != hash ||
+        slot.length != length || memcmp(names_[slot.index], name, length) != 0) {
+      return kNotFound;
+    }
+    return slot.index;
+  }
+
+  size_t size() const { return names_.size(); }
+  const char* name(int index) const { return names_[index]; }
+
+ private:
+  struct Slot {
+    int index = kNotFound;
+    uint32_t hash = 0;
+    size_t length = 0;
+  };
+
+  // FNV-1a, seeded
+  static uint32_t Hash(const char* name, uint32_t seed, size_t* length) {
+    uint32_t hash = 2166136261u ^ (seed * 16777619u);
+    const char* p = name;
+    for (; *p != '\0'; ++p) {
+      hash = (hash ^ static_cast<uint8_t>(*p)) * 16777619u;
+    }
+    *length = static_cast<size_t>(p - name);
+    return hash ^ (hash >> 15);
+  }
+
+  bool Build(const std::vector<int>& unique, size_t size, uint32_t seed) {
+    std::vector<Slot> slots(size);
+    for (int index : unique) {
+      Slot slot;
+      slot.index = index;
+      slot.hash = Hash(names_[index], seed, &slot.length);
+      Slot& target = slots[slot.hash & (size - 1)];
+      if (target.index != kNotFound) {
+        return false;
+      }
+      target = slot;
+    }
+    slots_ = std::move(slots);
+    mask_ = size - 1;
+    seed_ = seed;
+    return true;
+  }
+
+  std::vector<const char*> names_;
+  std::vector<Slot> slots_;
+  size_t mask_ = 0;
+  uint32_t seed_ = 0;
+};
+
+// Call counts and latencies per method.
+//
+// Latencies go into power-of-two buckets: bucket 0 counts calls under 1 us,
+// bucket i calls from 2^(i-1) up to 2^i us, and the last bucket everything
+// slower. Not thread safe; the plugins record on the main loop.
+class MethodStatistics {
+ public:
+  static constexpr int kLatencyBuckets = 16;
+
+  struct Counters {
+    uint64_t calls = 0;
+    uint64_t total_ns = 0;
+    uint64_t max_ns = 0;
+    uint64_t latency_buckets[kLatencyBuckets] = {};
+  };
+
+  explicit MethodStatistics(size_t methods) : counters_(methods) {}
+
+  void Record(int index, uint64_t elapsed_ns) {
+    Counters& counters = counters_[index];
+    counters.calls++;
+    counters.total_ns += elapsed_ns;
+    if (elapsed_ns > counters.max_ns) {
+      counters.max_ns = elapsed_ns;
+    }
+    counters.latency_buckets[LatencyBucket(elapsed_ns)]++;
+  }
+
+  void RecordUnknown() { unknown_calls_++; }
+
+  static int LatencyBucket(uint64_t elapsed_ns) {
+    const uint64_t micros = elapsed_ns / 1000;
+    if (micros == 0) {
+      return 0;
+    }
+    const int bucket = 64 - __builtin_clzll(micros);
+    return bucket < kLatencyBuckets ? bucket : kLatencyBuckets - 1;
+  }
+
+  const Counters& counters(int index) const { return counters_[index]; }
+  uint64_t unknown_calls() const { return unknown_calls_; }
+
+ private:
+  std::vector<Counters> counters_;
+  uint64_t unknown_calls_ = 0;
+};
+
+}  // namespace gameframework
+
+#endif  // FLUTTER_PLUGIN_GAMEFRAMEWORK_METHOD_TABLE_H_
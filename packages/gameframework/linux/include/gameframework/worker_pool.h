@@ -0,0 +1,167 @@
+#ifndef FLUTTER_PLUGIN_GAMEFRAMEWORK_WORKER_POOL_H_
+#define FLUTTER_PLUGIN_GAMEFRAMEWORK_WORKER_POOL_H_
+
+#include <atomic>
+#include <condition_variable>
+#include <cstddef>
+#include <cstdint>
+#include <deque>
+#include <functional>
+#include <memory>
+#include <mutex>
+#include <thread>
+#include <utility>
+#include <vector>
+
+namespace gameframework {
+
+// Threads for method calls too slow for the main loop, shared by the Linux
+// plugins.
+//
+// Work runs on a worker and returns a task, which the dispatcher runs back
+// on the main loop to answer the call; the plugins dispatch with
+// g_main_context_invoke. Each job ends in exactly one of its result task or
+// its cancel task, both on the main loop.
+//
+// Shutdown, from the plugin's dispose, cancels: queued jobs are cancelled at
+// once, running work sees |cancelled| turn true and should return early, and
+// results still on their way to the main loop are cancelled when they get
+// there. After Shutdown no result task runs, so result tasks may use the
+// plugin; cancel tasks must not.
+//
+// Header only, like method_dispatcher.h.
+class WorkerPool {
+ public:
+  using Task = std::function<void()>;
+  using Dispatcher = std::function<void(Task task)>;
+  using Work = std::function<Task(const std::atomic<bool>& cancelled)>;
+
+  struct Statistics {
+    uint64_t completed = 0;
+    uint64_t cancelled = 0;
+    uint64_t queued = 0;
+    uint64_t running = 0;
+  };
+
+  WorkerPool(size_t threads, Dispatcher dispatcher)
+      : state_(std::make_shared<State>()), dispatcher_(std::move(dispatcher)) {
+    for (size_t i = 0; i < threads; ++i) {
+      threads_.emplace_back(&WorkerPool::Run, this);
+    }
+  }
+
+  ~WorkerPool() { Shutdown(); }
+
+  WorkerPool(const WorkerPool&) = delete;
+  WorkerPool& operator=(const WorkerPool&) = delete;
+
+  // Queues |work|; |on_cancel| answers the call instead if the pool shuts
+  // down first. After Shutdown, cancels at once.
+  void Post(Work work, Task on_cancel) {
+    {
+      std::lock_guard<std::mutex> lock(mutex_);
+      if (!state_->cancelled) {
+        queue_.push_back(Job{std::move(work), std::move(on_cancel)});
+        ready_.notify_one();
+        return;
+      }
+      cancelled_count_++;
+    }
+    on_cancel();
+  }
+
+  // Call on the main loop, which runs the dispatched tasks. Waits for
+  // running work to return.
+  void Shutdown() {
+    std::deque<Job> dropped;
+    {
+      std::lock_guard<std::mutex> lock(mutex_);
+      if (state_->cancelled) {
+        return;
+      }
+      state_->cancelled = true;
+      dropped.swap(queue_);
+      cancelled_count_ += dropped.size();
+      ready_.notify_all();
+    }
+    for (Job& job : dropped) {
+      job.on_cancel();
+    }
+    for (std::thread& thread : threads_) {
+      thread.join();
+    }
+  }
+
+  Statistics GetStatistics() const {
+    std::lock_guard<std::mutex> lock(mutex_);
+    Statistics statistics;
+    statistics.completed = state_->completed;
+    statistics.cancelled = cancelled_count_ + state_->cancelled_results;
+    statistics.queued = queue_.size();
+    statistics.running = running_;
+    return statistics;
+  }
+
+ private:
+  struct Job {
+    Work work;
+    Task on_cancel;
+  };
+
+  // Outlives the pool for results still in the dispatcher. |cancelled| is
+  // written under the pool's mutex; the counters only on the main loop.
+  struct State {
+    std::atomic<bool> cancelled{false};
+    uint64_t completed = 0;
+    uint64_t cancelled_results = 0;
+  };
+
+  void Run() {
+    for (;;) {
+      Job job;
+      {
+        std::unique_lock<std::mutex> lock(mutex_);
+        ready_.wait(lock, [this] {
+          return state_->cancelled || !queue_.empty();
+        });
+        if (queue_.empty()) {
+          return;
+        }
+        job = std::move(queue_.front());
+        queue_.pop_front();
+        running_++;
+      }
+
+      Task result = job.work(state_->cancelled);
+
+      {
+        std::lock_guard<std::mutex> lock(mutex_);
+        running_--;
+      }
+      dispatcher_([state = state_, result = std::move(result),
+                   on_cancel = std::move(job.on_cancel)]() {
+        if (state->cancelled || !result) {
+          state->cancelled_results++;
+          on_cancel();
+        } else {
+          state->completed++;
+          result();
+        }
+      });
+    }
+  }
+
+  const std::shared_ptr<State> state_;
+  const Dispatcher dispatcher_;
+  std::vector<std::thread> threads_;
+
+  mutable std::mutex mutex_;  // guards everything below
+  std::condition_variable ready_;
+  std::deque<Job> queue_;
+  uint64_t running_ = 0;
+  uint64_t cancelled_count_ = 0;
+};
+
+}  // namespace gameframework
+
+#endif  // FLUTTER_PLUGIN_GAMEFRAMEWORK_WORKER_POOL_H_
@@ -0,0 +1,92 @@
+#include <gtest/gtest.h>
+
+#include <cstdio>
+#include <string>
+#include <vector>
+
+#include "include/gameframework/event_coalescer.h"
+
+namespace gameframework {
+namespace test {
+
+TEST(EventCoalescer, KeepsEventsWithoutKeys) {
+  EventCoalescer<int> coalescer(16);
+  EXPECT_TRUE(coalescer.Add("", 1));
+  EXPECT_FALSE(coalescer.Add("", 2));
+  EXPECT_FALSE(coalescer.Add("", 3));
+
+  EXPECT_EQ(coalescer.Take(), std::vector<int>({1, 2, 3}));
+  EXPECT_TRUE(coalescer.empty());
+  EXPECT_TRUE(coalescer.Take().empty());
+}
+
+TEST(EventCoalescer, KeepsTheLatestEventPerKey) {
+  EventCoalescer<std::string> coalescer(16);
+  coalescer.Add("progress", "progress 10");
+  coalescer.Add("", "loaded Intro");
+  coalescer.Add("progress", "progress 50");
+  coalescer.Add("state", "state 1");
+  coalescer.Add("progress", "progress 90");
+  coalescer.Add("state", "state 2");
+
+  EXPECT_EQ(coalescer.Take(),
+            std::vector<std::string>(
+                {"progress 90", "loaded Intro", "state 2"}));
+
+  // A new flush starts over
+  EXPECT_TRUE(coalescer.Add("progress", "progress 100"));
+  EXPECT_EQ(coalescer.Take(), std::vector<std::string>({"progress 100"}));
+
+  const EventCoalescer<std::string>::Statistics& statistics =
+      coalescer.statistics();
+  EXPECT_EQ(statistics.added, 7u);
+  EXPECT_EQ(statistics.coalesced, 3u);
+  EXPECT_EQ(statistics.flushes, 2u);
+  EXPECT_EQ(statistics.delivered, 4u);
+}
+
+TEST(EventCoalescer, DropsEventsOverTheLimit) {
+  EventCoalescer<int> coalescer(2);
+  coalescer.Add("progress", 1);
+  coalescer.Add("", 2);
+  coalescer.Add("", 3);          // dropped
+  coalescer.Add("state", 4);     // dropped
+  coalescer.Add("progress", 5);  // still replaces
+
+  EXPECT_EQ(coalescer.Take(), std::vector<int>({5, 2}));
+  EXPECT_EQ(coalescer.statistics().dropped, 2u);
+}
+
+// An engine ticking at 240 Hz sends progress and state sync every tick and a
+// discrete message every tenth; Flutter flushes at 60 Hz.
+TEST(EventCoalescer, ReportsFloodReduction) {
+  EventCoalescer<int> coalescer(1024);
+  constexpr int kTicks = 240;  // one second
+  uint64_t sends = 0;
+  for (int tick = 0; tick < kTicks; ++tick) {
+    coalescer.Add("progress", tick);
+    coalescer.Add("state", tick);
+    if (tick % 10 == 0) {
+      coalescer.Add("", tick);
+    }
+    if (tick % 4 == 3) {
+      const std::vector<int> events = coalescer.Take();
+      EXPECT_LE(events.size(), 3u);
+      EXPECT_EQ(events[0], tick);  // latest progress
+      sends++;
+    }
+  }
+
+  const EventCoalescer<int>::Statistics& statistics = coalescer.statistics();
+  EXPECT_EQ(sends, 60u);
+  EXPECT_EQ(statistics.flushes, 60u);
+  EXPECT_EQ(statistics.added, 504u);
+  EXPECT_EQ(statistics.delivered, 144u);
+  printf("  %llu engine events, %llu delivered in %llu channel sends\n",
+         static_cast<unsigned long long>(statistics.added),
+         static_cast<unsigned long long>(statistics.delivered),
+         static_cast<unsigned long long>(statistics.flushes));
+}
+
+}  // namespace test
+}  // namespace gameframework
@@ -0,0 +1,148 @@
+#include <gtest/gtest.h>
+
+#include <chrono>
+#include <cstdio>
+#include <cstring>
+#include <string>
+#include <vector>
+
+#include "include/gameframework/method_table.h"
+
+namespace gameframework {
+namespace test {
+
+namespace {
+
+// The Unreal plugin's channel, the largest of the three
+const std::vector<const char*> kMethods = {
+    "getPlatformVersion",       "getEngineType",
+    "getEngineVersion",         "isEngineSupported",
+    "engine#create",            "engine#pause",
+    "engine#resume",            "engine#unload",
+    "engine#quit",              "engine#sendMessage",
+    "engine#sendJsonMessage",   "engine#executeConsoleCommand",
+    "engine#loadLevel",         "engine#applyQualitySettings",
+    "engine#getQualitySettings", "engine#isInBackground",
+    "engine#getConnectionInfo", "frameTexture#create",
+    "frameTexture#getStatistics", "frameTexture#dispose",
+    "diagnostics#getMethodStatistics",
+};
+
+}  // namespace
+
+TEST(MethodTable, FindsEveryMethod) {
+  MethodTable table(kMethods);
+  ASSERT_EQ(table.size(), kMethods.size());
+  for (size_t i = 0; i < kMethods.size(); ++i) {
+    // A copy, so the lookup cannot match on the pointer
+    const std::string name = kMethods[i];
+    EXPECT_EQ(table.Find(name.c_str()), static_cast<int>(i)) << name;
+    EXPECT_STREQ(table.name(static_cast<int>(i)), kMethods[i]);
+  }
+}
+
+TEST(MethodTable, RejectsOtherNames) {
+  MethodTable table(kMethods);
+  for (const char* name :
+       {"", "engine#", "engine#sendMessag", "engine#sendMessages",
+        "Engine#sendMessage", "engine#sendmessage", "getPlatformVersion\n",
+        "unknown"}) {
+    EXPECT_EQ(table.Find(name), MethodTable::kNotFound) << name;
+  }
+}
+
+TEST(MethodTable, HandlesSmallAndRepeatedTables) {
+  MethodTable empty({});
+  EXPECT_EQ(empty.Find("getPlatformVersion"), MethodTable::kNotFound);
+
+  MethodTable single({"getPlatformVersion"});
+  EXPECT_EQ(single.Find("getPlatformVersion"), 0);
+  EXPECT_EQ(single.Find("getEngineType"), MethodTable::kNotFound);
+
+  MethodTable repeated({"a", "b", "a"});
+  EXPECT_EQ(repeated.Find("a"), 0);
+  EXPECT_EQ(repeated.Find("b"), 1);
+}
+
+TEST(MethodTable, BuildsForManyNames) {
+  std::vector<std::string> storage;
+  for (int i = 0; i < 100; ++i) {
+    storage.push_back("method#" + std::to_string(i));
+  }
+  std::vector<const char*> names;
+  for (const std::string& name : storage) {
+    names.push_back(name.c_str());
+  }
+
+  MethodTable table(names);
+  for (size_t i = 0; i < names.size(); ++i) {
+    EXPECT_EQ(table.Find(names[i]), static_cast<int>(i));
+  }
+  EXPECT_EQ(table.Find("method#100"), MethodTable::kNotFound);
+}
+
+TEST(MethodStatistics, BucketsLatencies) {
+  EXPECT_EQ(MethodStatistics::LatencyBucket(0), 0);
+  EXPECT_EQ(MethodStatistics::LatencyBucket(999), 0);
+  EXPECT_EQ(MethodStatistics::LatencyBucket(1000), 1);
+  EXPECT_EQ(MethodStatistics::LatencyBucket(1999), 1);
+  EXPECT_EQ(MethodStatistics::LatencyBucket(2000), 2);
+  EXPECT_EQ(MethodStatistics::LatencyBucket(1000000), 10);  // 1 ms
+  EXPECT_EQ(MethodStatistics::LatencyBucket(10000000000ull),
+            MethodStatistics::kLatencyBuckets - 1);
+
+  MethodStatistics statistics(2);
+  statistics.Record(1, 500);
+  statistics.Record(1, 3000);
+  statistics.RecordUnknown();
+
+  EXPECT_EQ(statistics.counters(0).calls, 0u);
+  const MethodStatistics::Counters& counters = statistics.counters(1);
+  EXPECT_EQ(counters.calls, 2u);
+  EXPECT_EQ(counters.total_ns, 3500u);
+  EXPECT_EQ(counters.max_ns, 3000u);
+  EXPECT_EQ(counters.latency_buckets[0], 1u);
+  EXPECT_EQ(counters.latency_buckets[2], 1u);
+  EXPECT_EQ(statistics.unknown_calls(), 1u);
+}
+
+// Compares a lookup of the method at the end of the list with the strcmp
+// chain the plugins used before.
+TEST(MethodTable, ReportsLookupCost) {
+  MethodTable table(kMethods);
+  const std::string last = kMethods[kMethods.size() - 2];
+  const std::string first = kMethods[0];
+  constexpr int kIterations = 1000000;
+
+  auto measure = [&](auto&& lookup) {
+    volatile int sink = 0;
+    const auto start = std::chrono::steady_clock::now();
+    for (int i = 0; i < kIterations; ++i) {
+      sink = sink + lookup();
+    }
+    return std::chrono::duration<double, std::nano>(
+               std::chrono::steady_clock::now() - start)
+               .count() /
+           kIterations;
+  };
+  auto chain = [&](const std::string& name) {
+    for (size_t i = 0; i < kMethods.size(); ++i) {
+      if (strcmp(name.c_str(), kMethods[i]) == 0) {
+        return static_cast<int>(i);
+      }
+    }
+    return -1;
+  };
+
+  const double table_first = measure([&] { return table.Find(first.c_str()); });
+  const double table_last = measure([&] { return table.Find(last.c_str()); });
+  const double chain_first = measure([&] { return chain(first); });
+  const double chain_last = measure([&] { return chain(last); });
+
+  printf("  table: first %.1f ns, last %.1f ns\n", table_first, table_last);
+  printf("  chain: first %.1f ns, last %.1f ns\n", chain_first, chain_last);
+  EXPECT_EQ(table.Find(last.c_str()), chain(last));
+}
+
+}  // namespace test
+}  // namespace gameframework
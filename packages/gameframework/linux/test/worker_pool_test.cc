@@ -0,0 +1,176 @@
+#include <gtest/gtest.h>
+
+#include <chrono>
+#include <condition_variable>
+#include <cstdio>
+#include <deque>
+#include <mutex>
+#include <thread>
+
+#include "include/gameframework/worker_pool.h"
+
+namespace gameframework {
+namespace test {
+
+namespace {
+
+using Clock = std::chrono::steady_clock;
+
+// Stands in for the GTK main loop: the test thread runs what is dispatched.
+class MainLoop {
+ public:
+  WorkerPool::Dispatcher dispatcher() {
+    return [this](WorkerPool::Task task) {
+      std::lock_guard<std::mutex> lock(mutex_);
+      tasks_.push_back(std::move(task));
+      ready_.notify_one();
+    };
+  }
+
+  // Runs tasks, and |tick| every millisecond, until |done| holds or five
+  // seconds pass. Returns the longest the loop went without ticking.
+  template <typename Predicate, typename Tick>
+  double RunUntil(Predicate done, Tick tick) {
+    const auto deadline = Clock::now() + std::chrono::seconds(5);
+    auto last_tick = Clock::now();
+    double longest_gap_ms = 0;
+    while (!done() && Clock::now() < deadline) {
+      std::unique_lock<std::mutex> lock(mutex_);
+      ready_.wait_for(lock, std::chrono::milliseconds(1),
+                      [this] { return !tasks_.empty(); });
+      std::deque<WorkerPool::Task> tasks;
+      tasks.swap(tasks_);
+      lock.unlock();
+      for (WorkerPool::Task& task : tasks) {
+        task();
+      }
+
+      const auto now = Clock::now();
+      longest_gap_ms = std::max(
+          longest_gap_ms,
+          std::chrono::duration<double, std::milli>(now - last_tick).count());
+      last_tick = now;
+      tick();
+    }
+    return longest_gap_ms;
+  }
+
+  template <typename Predicate>
+  void RunUntil(Predicate done) {
+    RunUntil(done, [] {});
+  }
+
+ private:
+  std::mutex mutex_;
+  std::condition_variable ready_;
+  std::deque<WorkerPool::Task> tasks_;
+};
+
+}  // namespace
+
+// A 200 ms job, like a level load, runs while the main loop keeps ticking.
+TEST(WorkerPool, KeepsTheMainLoopResponsive) {
+  MainLoop loop;
+  WorkerPool pool(2, loop.dispatcher());
+  const std::thread::id main_thread = std::this_thread::get_id();
+
+  bool answered = false;
+  std::thread::id worked_on;
+  std::thread::id answered_on;
+  pool.Post(
+      [&](const std::atomic<bool>& cancelled) -> WorkerPool::Task {
+        worked_on = std::this_thread::get_id();
+        std::this_thread::sleep_for(std::chrono::milliseconds(200));
+        return [&] {
+          answered_on = std::this_thread::get_id();
+          answered = true;
+        };
+      },
+      [] { FAIL() << "cancelled"; });
+
+  int ticks = 0;
+  const double longest_gap_ms =
+      loop.RunUntil([&] { return answered; }, [&] { ticks++; });
+
+  EXPECT_TRUE(answered);
+  EXPECT_NE(worked_on, main_thread);
+  EXPECT_EQ(answered_on, main_thread);
+  EXPECT_GT(ticks, 50);
+  EXPECT_LT(longest_gap_ms, 16.0);
+  printf("  longest main loop stall during a 200 ms job: %.2f ms\n",
+         longest_gap_ms);
+
+  const WorkerPool::Statistics statistics = pool.GetStatistics();
+  EXPECT_EQ(statistics.completed, 1u);
+  EXPECT_EQ(statistics.cancelled, 0u);
+}
+
+TEST(WorkerPool, RunsJobsConcurrently) {
+  MainLoop loop;
+  WorkerPool pool(4, loop.dispatcher());
+
+  int answered = 0;
+  const auto start = Clock::now();
+  for (int i = 0; i < 4; ++i) {
+    pool.Post(
+        [&](const std::atomic<bool>&) -> WorkerPool::Task {
+          std::this_thread::sleep_for(std::chrono::milliseconds(100));
+          return [&] { answered++; };
+        },
+        [] {});
+  }
+  loop.RunUntil([&] { return answered == 4; });
+
+  EXPECT_EQ(answered, 4);
+  EXPECT_LT(Clock::now() - start, std::chrono::milliseconds(300));
+}
+
+TEST(WorkerPool, ShutdownCancelsEveryJobOnce) {
+  MainLoop loop;
+  WorkerPool pool(1, loop.dispatcher());
+
+  std::atomic<bool> started{false};
+  int results = 0;
+  int cancels = 0;
+  // Runs until cancelled
+  pool.Post(
+      [&](const std::atomic<bool>& cancelled) -> WorkerPool::Task {
+        started = true;
+        while (!cancelled) {
+          std::this_thread::sleep_for(std::chrono::milliseconds(1));
+        }
+        return [&] { results++; };
+      },
+      [&] { cancels++; });
+  // Queued behind it
+  for (int i = 0; i < 3; ++i) {
+    pool.Post(
+        [&](const std::atomic<bool>&) -> WorkerPool::Task {
+          return [&] { results++; };
+        },
+        [&] { cancels++; });
+  }
+  while (!started) {
+    std::this_thread::yield();
+  }
+
+  pool.Shutdown();
+  EXPECT_EQ(cancels, 3);
+
+  // The running job's result reaches the main loop after shutdown
+  loop.RunUntil([&] { return cancels == 4; });
+  EXPECT_EQ(cancels, 4);
+  EXPECT_EQ(results, 0);
+
+  // Too late for new work
+  pool.Post(
+      [&](const std::atomic<bool>&) -> WorkerPool::Task {
+        return [&] { results++; };
+      },
+      [&] { cancels++; });
+  EXPECT_EQ(cancels, 5);
+  EXPECT_EQ(pool.GetStatistics().cancelled, 5u);
+}
+
+}  // namespace test
+}  // namespace gameframework
@@ -71,7 +71,7 @@ void AFlutterGameMode::InitializeFlutter()
 		GetWorld()->GetTimerManager().SetTimer(
 			StateSyncTimerHandle,
 			this,
-			&AFlutterGameMode::SyncGameState,
+			&AFlutterGameMode::AutoSyncGameState,
 			StateSyncInterval,
 			true
 		);
@@ -89,6 +89,7 @@ void AFlutterGameMode::StartGame()
 		bIsGameRunning = true;
 		bIsGamePaused = false;
 
+		MirrorGameState();
 		NotifyFlutter(TEXT("gameStarted"), TEXT("{}"));
 		OnGameStarted();
 
@@ -102,6 +103,7 @@ void AFlutterGameMode::PauseGame()
 	{
 		bIsGamePaused = true;
 
+		MirrorGameState();
 		NotifyFlutter(TEXT("gamePaused"), TEXT("{}"));
 		OnGamePaused();
 
@@ -115,6 +117,7 @@ void AFlutterGameMode::ResumeGame()
 	{
 		bIsGamePaused = false;
 
+		MirrorGameState();
 		NotifyFlutter(TEXT("gameResumed"), TEXT("{}"));
 		OnGameResumed();
 
@@ -129,6 +132,7 @@ void AFlutterGameMode::StopGame()
 		bIsGameRunning = false;
 		bIsGamePaused = false;
 
+		MirrorGameState();
 		NotifyFlutter(TEXT("gameStopped"), TEXT("{}"));
 		OnGameStopped();
 
@@ -151,6 +155,7 @@ void AFlutterGameMode::GameOver(const FString& Reason)
 	TSharedRef<TJsonWriter<>> Writer = TJsonWriterFactory<>::Create(&JsonString);
 	FJsonSerializer::Serialize(JsonObject.ToSharedRef(), Writer);
 
+	MirrorGameState();
 	NotifyFlutter(TEXT("gameOver"), JsonString);
 	OnGameOver(Reason);
 
@@ -183,6 +188,7 @@ void AFlutterGameMode::SetScore(int32 NewScore)
 	TSharedRef<TJsonWriter<>> Writer = TJsonWriterFactory<>::Create(&JsonString);
 	FJsonSerializer::Serialize(JsonObject.ToSharedRef(), Writer);
 
+	MirrorGameState();
 	NotifyFlutter(TEXT("scoreChanged"), JsonString);
 	OnScoreChanged(CurrentScore, Delta);
 }
@@ -212,6 +218,7 @@ void AFlutterGameMode::SetLevel(int32 NewLevel)
 	TSharedRef<TJsonWriter<>> Writer = TJsonWriterFactory<>::Create(&JsonString);
 	FJsonSerializer::Serialize(JsonObject.ToSharedRef(), Writer);
 
+	MirrorGameState();
 	NotifyFlutter(TEXT("levelChanged"), JsonString);
 	OnLevelChanged(CurrentLevel);
 }
@@ -253,6 +260,31 @@ void AFlutterGameMode::SyncGameState()
 	NotifyFlutter(TEXT("stateSync"), JsonString);
 }
 
+bool AFlutterGameMode::MirrorGameState()
+{
+	if (!FlutterBridge || !FlutterBridge->IsStateMirrorAvailable())
+	{
+		return false;
+	}
+
+	FlutterBridge->BeginStateMirrorUpdate();
+	FlutterBridge->MirrorStateBool(TEXT("isRunning"), bIsGameRunning);
+	FlutterBridge->MirrorStateBool(TEXT("isPaused"), bIsGamePaused);
+	FlutterBridge->MirrorStateInt(TEXT("score"), CurrentScore);
+	FlutterBridge->MirrorStateInt(TEXT("level"), CurrentLevel);
+	FlutterBridge->EndStateMirrorUpdate();
+	return true;
+}
+
+void AFlutterGameMode::AutoSyncGameState()
+{
+	// Every change is already mirrored; this only covers a mirror that came up late
+	if (!MirrorGameState())
+	{
+		SyncGameState();
+	}
+}
+
 void AFlutterGameMode::NotifyFlutter(const FString& Event, const FString& Data)
 {
 	if (FlutterBridge)
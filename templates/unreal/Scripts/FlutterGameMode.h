@@ -19,6 +19,7 @@ class UFlutterMessageRouter;
  * Features:
  * - Automatic Flutter bridge setup
  * - Game state synchronization (start, pause, resume, stop)
+ * - Shared-memory state mirror for per-frame HUD reads on Linux
  * - Score tracking and updates
  * - Level management
  * - Player action handling
@@ -159,6 +160,14 @@ public:
 	UFUNCTION(BlueprintCallable, Category = "Flutter")
 	void SyncGameState();
 
+	/**
+	 * Write the current game state to the shared-memory state mirror
+	 * Flutter reads it every frame without a message (Linux only). Called on every state
+	 * change; returns false if the mirror is not available.
+	 */
+	UFUNCTION(BlueprintCallable, Category = "Flutter")
+	bool MirrorGameState();
+
 	// ============================================================
 	// MARK: - Blueprint Events
 	// ============================================================
@@ -259,6 +268,9 @@ private:
 	// Initialization
 	void InitializeFlutter();
 
+	// Timer callback; messages are only sent when there is no state mirror
+	void AutoSyncGameState();
+
 	// Send state to Flutter
 	void NotifyFlutter(const FString& Event, const FString& Data);
 };